@@ -109,6 +109,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/api/child_supervision_api.cpp                  \
     src/core/api/coap_api.cpp                               \
     src/core/api/commissioner_api.cpp                       \
+    src/core/api/counters_api.cpp                           \
     src/core/api/crypto_api.cpp                             \
     src/core/api/dataset_api.cpp                            \
     src/core/api/dataset_ftd_api.cpp                        \
@@ -134,6 +135,8 @@ LOCAL_SRC_FILES                                          := \
     src/core/coap/coap.cpp                                  \
     src/core/coap/coap_message.cpp                          \
     src/core/coap/coap_secure.cpp                           \
+    src/core/common/binary_log.cpp                          \
+    src/core/common/counters.cpp                            \
     src/core/common/crc16.cpp                               \
     src/core/common/instance.cpp                            \
     src/core/common/logging.cpp                             \
@@ -172,6 +175,7 @@ LOCAL_SRC_FILES                                          := \
     src/core/meshcop/energy_scan_client.cpp                 \
     src/core/meshcop/joiner.cpp                             \
     src/core/meshcop/joiner_router.cpp                      \
+    src/core/meshcop/joiner_table.cpp                       \
     src/core/meshcop/leader.cpp                             \
     src/core/meshcop/meshcop.cpp                            \
     src/core/meshcop/meshcop_tlvs.cpp                       \
@@ -215,11 +219,13 @@ LOCAL_SRC_FILES                                          := \
     src/core/thread/src_match_controller.cpp                \
     src/core/thread/thread_netif.cpp                        \
     src/core/thread/topology.cpp                            \
+    src/core/thread/virtual_reassembler.cpp                 \
     src/core/utils/channel_manager.cpp                      \
     src/core/utils/channel_monitor.cpp                      \
     src/core/utils/child_supervision.cpp                    \
     src/core/utils/heap.cpp                                 \
     src/core/utils/jam_detector.cpp                         \
+    src/core/utils/latency_tracer.cpp                       \
     src/core/utils/missing_strlcpy.c                        \
     src/core/utils/missing_strlcat.c                        \
     src/core/utils/missing_strnlen.c                        \
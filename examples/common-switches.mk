@@ -33,6 +33,9 @@ BORDER_AGENT        ?= 0
 BORDER_ROUTER       ?= 0
 COAP                ?= 0
 COAPS               ?= 0
+COAP_BLOCK          ?= 0
+COAP_CC             ?= 0
+COAP_OBSERVE        ?= 0
 COMMISSIONER        ?= 0
 COVERAGE            ?= 0
 CHANNEL_MANAGER     ?= 0
@@ -60,6 +63,7 @@ PLATFORM_UDP        ?= 0
 REFERENCE_DEVICE    ?= 0
 SERVICE             ?= 0
 SETTINGS_RAM        ?= 0
+SETTINGS_WEAR_LEVELING ?= 0
 # SLAAC is enabled by default
 SLAAC               ?= 1
 SNTP_CLIENT         ?= 0
@@ -87,6 +91,18 @@ ifeq ($(COAPS),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE=1
 endif
 
+ifeq ($(COAP_BLOCK),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE=1
+endif
+
+ifeq ($(COAP_CC),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE=1
+endif
+
+ifeq ($(COAP_OBSERVE),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE=1
+endif
+
 ifeq ($(COMMISSIONER),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_COMMISSIONER_ENABLE=1
 endif
@@ -222,6 +238,10 @@ ifeq ($(SETTINGS_RAM),1)
 COMMONCFLAGS += -DOPENTHREAD_SETTINGS_RAM=1
 endif
 
+ifeq ($(SETTINGS_WEAR_LEVELING),1)
+COMMONCFLAGS += -DOPENTHREAD_SETTINGS_WEAR_LEVELING=1
+endif
+
 ifeq ($(FULL_LOGS),1)
 # HINT: Add more here, or comment out ones you do not need/want
 LOG_FLAGS += -DOPENTHREAD_CONFIG_LOG_LEVEL=OT_LOG_LEVEL_DEBG
@@ -33,11 +33,13 @@
 #include <ctype.h>
 #include <inttypes.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <syslog.h>
 
+#include <openthread/logging.h>
 #include <openthread/platform/logging.h>
 #include <openthread/platform/toolchain.h>
 
@@ -78,3 +80,71 @@ exit:
 }
 
 #endif // #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED)
+
+#if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY)
+
+static bool sBinaryLogPending = false;
+
+static void handleBinaryLog(void *aContext)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    sBinaryLogPending = true;
+}
+
+void platformLoggingInit(void)
+{
+    otLoggingBinarySetHandler(&handleBinaryLog, NULL);
+}
+
+void platformLoggingProcess(void)
+{
+    uint8_t  records[OT_LOGGING_BINARY_MAX_RECORD_LENGTH * 4];
+    uint16_t length;
+
+    otEXPECT(sBinaryLogPending);
+    sBinaryLogPending = false;
+
+    while ((length = otLoggingBinaryRead(records, sizeof(records))) > 0)
+    {
+        for (uint16_t offset = 0; offset < length; offset += records[offset])
+        {
+            otLogBinaryRecordInfo info;
+            char                  logString[2048];
+            char *                line;
+            char *                next;
+
+            if (otLoggingBinaryDecode(&records[offset], records[offset], &info, logString, sizeof(logString)) !=
+                OT_ERROR_NONE)
+            {
+                syslog(LOG_CRIT, "[%d] Malformed binary log record", gNodeId);
+                continue;
+            }
+
+            for (line = logString; line != NULL; line = next)
+            {
+                if ((next = strchr(line, '\n')) != NULL)
+                {
+                    *next++ = '\0';
+                }
+
+                syslog(LOG_CRIT, "[%d] %s", gNodeId, line);
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+#else // (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY)
+
+void platformLoggingInit(void)
+{
+}
+
+void platformLoggingProcess(void)
+{
+}
+
+#endif // (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY)
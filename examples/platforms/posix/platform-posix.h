@@ -183,6 +183,18 @@ void platformRadioProcess(otInstance *aInstance, const fd_set *aReadFdSet, const
  */
 void platformRandomInit(void);
 
+/**
+ * This function initializes the logging service used by OpenThread.
+ *
+ */
+void platformLoggingInit(void);
+
+/**
+ * This function outputs the log records written since the last call (for binary log output).
+ *
+ */
+void platformLoggingProcess(void);
+
 /**
  * This function updates the file descriptor sets with file descriptors used by the UART driver.
  *
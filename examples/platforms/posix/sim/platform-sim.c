@@ -248,6 +248,7 @@ void otSysInit(int argc, char *argv[])
     platformAlarmInit(1);
     platformRadioInit();
     platformRandomInit();
+    platformLoggingInit();
 
     signal(SIGTERM, &handleSignal);
     signal(SIGHUP, &handleSignal);
@@ -310,6 +311,7 @@ void otSysProcessDrivers(otInstance *aInstance)
 #if OPENTHREAD_POSIX_VIRTUAL_TIME_UART == 0
     platformUartProcess();
 #endif
+    platformLoggingProcess();
 }
 
 #endif // OPENTHREAD_POSIX_VIRTUAL_TIME
@@ -106,6 +106,7 @@ void otSysInit(int aArgCount, char *aArgVector[])
     platformAlarmInit(speedUpFactor);
     platformRadioInit();
     platformRandomInit();
+    platformLoggingInit();
 }
 
 bool otSysPseudoResetWasRequested(void)
@@ -155,6 +156,7 @@ void otSysProcessDrivers(otInstance *aInstance)
     }
 
     platformAlarmProcess(aInstance);
+    platformLoggingProcess();
 
     if (gTerminate)
     {
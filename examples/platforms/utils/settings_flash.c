@@ -101,7 +101,7 @@ struct settingsBlock
 #error "Invalid value for `SETTINGS_CONFIG_PAGE_NUM` (should be >= 2)"
 #endif
 
-#if !OPENTHREAD_SETTINGS_RAM
+#if !OPENTHREAD_SETTINGS_RAM && !OPENTHREAD_SETTINGS_WEAR_LEVELING
 
 static uint32_t sSettingsBaseAddress;
 static uint32_t sSettingsUsedSize;
@@ -218,6 +218,8 @@ static otError addSetting(otInstance *   aInstance,
     } OT_TOOL_PACKED_END addBlock;
     uint32_t             settingsSize = SETTINGS_CONFIG_PAGE_SIZE * SETTINGS_CONFIG_PAGE_NUM / 2;
 
+    otEXPECT_ACTION(aValueLength <= OT_SETTINGS_BLOCK_DATA_SIZE, error = OT_ERROR_NO_BUFS);
+
     addBlock.block.flag = 0xff;
     addBlock.block.key  = aKey;
 
@@ -433,4 +435,4 @@ void otPlatSettingsWipe(otInstance *aInstance)
     otPlatSettingsInit(aInstance);
 }
 
-#endif /* OPENTHREAD_SETTINGS_RAM */
+#endif /* !OPENTHREAD_SETTINGS_RAM && !OPENTHREAD_SETTINGS_WEAR_LEVELING */
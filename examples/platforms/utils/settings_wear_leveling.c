@@ -0,0 +1,651 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform abstraction for non-volatile storage of settings, as a
+ *   log of records over a ring of flash pages.
+ *
+ *   - Records are appended to the newest page. A page is only erased when the log wraps around to it, so all pages
+ *     are erased equally often.
+ *   - A RAM index of the location of each value is built at init, so that reading a value does not search flash.
+ *   - When the log is full, the oldest page is reclaimed by moving its values to the newest page, one page at a
+ *     time. One erased page is always kept so that a page can be reclaimed.
+ *
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <openthread-core-config.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/settings.h>
+
+#include "utils/code_utils.h"
+#include "utils/wrap_string.h"
+
+#include "flash.h"
+
+#define OT_SETTINGS_RECORD_ADD_BEGIN_FLAG (1 << 0)
+#define OT_SETTINGS_RECORD_ADD_COMPLETE_FLAG (1 << 1)
+#define OT_SETTINGS_RECORD_DELETE_FLAG (1 << 2)
+#define OT_SETTINGS_RECORD_FIRST_FLAG (1 << 3) ///< The record starts a new list of values of its key.
+
+#define OT_SETTINGS_RECORD_DATA_SIZE 255
+
+#define OT_SETTINGS_PAGE_IN_USE 0xbe5cc5e1
+#define OT_SETTINGS_PAGE_ERASED 0xffffffff
+
+/**
+ * @def SETTINGS_CONFIG_BASE_ADDRESS
+ *
+ * The base address of settings.
+ *
+ */
+#ifndef SETTINGS_CONFIG_BASE_ADDRESS
+#define SETTINGS_CONFIG_BASE_ADDRESS 0x39000
+#endif // SETTINGS_CONFIG_BASE_ADDRESS
+
+/**
+ * @def SETTINGS_CONFIG_PAGE_SIZE
+ *
+ * The page size of settings.
+ *
+ */
+#ifndef SETTINGS_CONFIG_PAGE_SIZE
+#define SETTINGS_CONFIG_PAGE_SIZE 0x800
+#endif // SETTINGS_CONFIG_PAGE_SIZE
+
+/**
+ * @def SETTINGS_CONFIG_PAGE_NUM
+ *
+ * The page number of settings.
+ *
+ */
+#ifndef SETTINGS_CONFIG_PAGE_NUM
+#define SETTINGS_CONFIG_PAGE_NUM 4
+#endif // SETTINGS_CONFIG_PAGE_NUM
+
+/**
+ * @def SETTINGS_CONFIG_INDEX_SIZE
+ *
+ * The maximum number of values (of all keys) in settings.
+ *
+ */
+#ifndef SETTINGS_CONFIG_INDEX_SIZE
+#define SETTINGS_CONFIG_INDEX_SIZE 64
+#endif // SETTINGS_CONFIG_INDEX_SIZE
+
+#if OPENTHREAD_SETTINGS_WEAR_LEVELING && !OPENTHREAD_SETTINGS_RAM
+
+#if (SETTINGS_CONFIG_PAGE_NUM <= 2)
+#error "Invalid value for `SETTINGS_CONFIG_PAGE_NUM` (should be >= 3)"
+#endif
+
+OT_TOOL_PACKED_BEGIN
+struct settingsPageHeader
+{
+    uint32_t magic;
+    uint32_t sequence;
+} OT_TOOL_PACKED_END;
+
+OT_TOOL_PACKED_BEGIN
+struct settingsRecord
+{
+    uint16_t key;
+    uint16_t flag;
+    uint16_t length;
+    uint16_t reserved;
+} OT_TOOL_PACKED_END;
+
+OT_TOOL_PACKED_BEGIN
+struct settingsRecordBlock
+{
+    struct settingsRecord record;
+    uint8_t               data[OT_SETTINGS_RECORD_DATA_SIZE + 1];
+} OT_TOOL_PACKED_END;
+
+struct settingsIndexEntry
+{
+    uint16_t key;
+    uint16_t length;
+    uint32_t address; ///< The flash address of the record.
+};
+
+// Sorted by key, the values of a key are in the order they were added.
+static struct settingsIndexEntry sIndex[SETTINGS_CONFIG_INDEX_SIZE];
+static uint16_t                  sIndexLength;
+
+static uint32_t sSequence;       // The sequence number of the newest page.
+static uint16_t sWritePage;      // The newest page.
+static uint32_t sWriteOffset;    // The offset of the next record in the newest page.
+static uint16_t sNumErasedPages; // The number of erased pages, they follow the newest page in the ring.
+
+static uint16_t getAlignLength(uint16_t aLength)
+{
+    return (aLength + 3) & 0xfffc;
+}
+
+static uint16_t getRecordSize(uint16_t aLength)
+{
+    return sizeof(struct settingsRecord) + getAlignLength(aLength);
+}
+
+static uint32_t getPageAddress(uint16_t aPage)
+{
+    return SETTINGS_CONFIG_BASE_ADDRESS + (uint32_t)aPage * SETTINGS_CONFIG_PAGE_SIZE;
+}
+
+static uint16_t getPage(uint32_t aAddress)
+{
+    return (uint16_t)((aAddress - SETTINGS_CONFIG_BASE_ADDRESS) / SETTINGS_CONFIG_PAGE_SIZE);
+}
+
+static uint16_t getOldestPage(void)
+{
+    return (sWritePage + sNumErasedPages + 1) % SETTINGS_CONFIG_PAGE_NUM;
+}
+
+// Returns the position of the first value of `aKey` in the index, or the position to insert it.
+static uint16_t findKey(uint16_t aKey)
+{
+    uint16_t low  = 0;
+    uint16_t high = sIndexLength;
+
+    while (low < high)
+    {
+        uint16_t mid = (low + high) / 2;
+
+        if (sIndex[mid].key < aKey)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static uint16_t getValueCount(uint16_t aPosition, uint16_t aKey)
+{
+    uint16_t count = 0;
+
+    while ((aPosition + count < sIndexLength) && (sIndex[aPosition + count].key == aKey))
+    {
+        count++;
+    }
+
+    return count;
+}
+
+static otError insertEntry(uint16_t aPosition, uint16_t aKey, uint16_t aLength, uint32_t aAddress)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(sIndexLength < SETTINGS_CONFIG_INDEX_SIZE, error = OT_ERROR_NO_BUFS);
+
+    memmove(&sIndex[aPosition + 1], &sIndex[aPosition], (sIndexLength - aPosition) * sizeof(sIndex[0]));
+    sIndex[aPosition].key     = aKey;
+    sIndex[aPosition].length  = aLength;
+    sIndex[aPosition].address = aAddress;
+    sIndexLength++;
+
+exit:
+    return error;
+}
+
+static void removeEntries(uint16_t aPosition, uint16_t aCount)
+{
+    memmove(&sIndex[aPosition], &sIndex[aPosition + aCount],
+            (sIndexLength - aPosition - aCount) * sizeof(sIndex[0]));
+    sIndexLength -= aCount;
+}
+
+static void clearRecordFlag(uint32_t aAddress, uint16_t aFlag)
+{
+    struct settingsRecord record;
+
+    utilsFlashRead(aAddress, (uint8_t *)(&record), sizeof(record));
+    record.flag &= (uint16_t)(~aFlag);
+    utilsFlashWrite(aAddress, (uint8_t *)(&record), sizeof(record));
+}
+
+static void erasePage(uint16_t aPage)
+{
+    utilsFlashErasePage(getPageAddress(aPage));
+    utilsFlashStatusWait(1000);
+}
+
+static void openPage(uint16_t aPage)
+{
+    struct settingsPageHeader header;
+
+    // Pages are erased when reclaimed, a page is erased again only if this was interrupted.
+    utilsFlashRead(getPageAddress(aPage), (uint8_t *)(&header), sizeof(header));
+
+    if ((header.magic != OT_SETTINGS_PAGE_ERASED) || (header.sequence != OT_SETTINGS_PAGE_ERASED))
+    {
+        erasePage(aPage);
+    }
+
+    header.magic    = OT_SETTINGS_PAGE_IN_USE;
+    header.sequence = ++sSequence;
+    utilsFlashWrite(getPageAddress(aPage), (uint8_t *)(&header), sizeof(header));
+
+    sWritePage   = aPage;
+    sWriteOffset = sizeof(header);
+    sNumErasedPages--;
+}
+
+static void resetSettings(void)
+{
+    for (uint16_t page = 0; page < SETTINGS_CONFIG_PAGE_NUM; page++)
+    {
+        erasePage(page);
+    }
+
+    sIndexLength    = 0;
+    sSequence       = 0;
+    sNumErasedPages = SETTINGS_CONFIG_PAGE_NUM;
+    openPage(0);
+}
+
+static otError appendRecord(uint16_t       aKey,
+                            bool           aFirst,
+                            const uint8_t *aValue,
+                            uint16_t       aValueLength,
+                            uint32_t *     aAddress)
+{
+    otError                    error = OT_ERROR_NONE;
+    struct settingsRecordBlock block;
+    uint32_t                   address;
+
+    otEXPECT_ACTION(aValueLength <= OT_SETTINGS_RECORD_DATA_SIZE, error = OT_ERROR_NO_BUFS);
+
+    if (sWriteOffset + getRecordSize(aValueLength) > SETTINGS_CONFIG_PAGE_SIZE)
+    {
+        otEXPECT_ACTION(sNumErasedPages > 0, error = OT_ERROR_NO_BUFS);
+        openPage((sWritePage + 1) % SETTINGS_CONFIG_PAGE_NUM);
+    }
+
+    address = getPageAddress(sWritePage) + sWriteOffset;
+
+    block.record.key      = aKey;
+    block.record.flag     = 0xffff & (uint16_t)(~OT_SETTINGS_RECORD_ADD_BEGIN_FLAG);
+    block.record.length   = aValueLength;
+    block.record.reserved = 0xffff;
+
+    if (aFirst)
+    {
+        block.record.flag &= (uint16_t)(~OT_SETTINGS_RECORD_FIRST_FLAG);
+    }
+
+    utilsFlashWrite(address, (uint8_t *)(&block.record), sizeof(block.record));
+
+    memset(block.data, 0xff, sizeof(block.data));
+    memcpy(block.data, aValue, aValueLength);
+    utilsFlashWrite(address + sizeof(block.record), block.data, getAlignLength(aValueLength));
+
+    block.record.flag &= (uint16_t)(~OT_SETTINGS_RECORD_ADD_COMPLETE_FLAG);
+    utilsFlashWrite(address, (uint8_t *)(&block.record), sizeof(block.record));
+
+    sWriteOffset += getRecordSize(aValueLength);
+    *aAddress = address;
+
+exit:
+    return error;
+}
+
+// Returns whether all values of a key fit in the newest page and the erased pages.
+static bool canMoveValues(uint16_t aPosition, uint16_t aCount)
+{
+    uint32_t offset   = sWriteOffset;
+    uint16_t numPages = 0;
+
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        uint16_t size = getRecordSize(sIndex[aPosition + i].length);
+
+        if (offset + size > SETTINGS_CONFIG_PAGE_SIZE)
+        {
+            numPages++;
+            offset = sizeof(struct settingsPageHeader);
+        }
+
+        offset += size;
+    }
+
+    return numPages <= sNumErasedPages;
+}
+
+// Moves all values of a key to the newest page, in order, so that the key no longer uses older pages.
+//
+// The first copy supersedes the originals, so if this is interrupted only the values of a key that has several
+// values may be lost.
+static void moveValues(uint16_t aPosition, uint16_t aCount)
+{
+    uint8_t data[OT_SETTINGS_RECORD_DATA_SIZE];
+
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        struct settingsIndexEntry *entry = &sIndex[aPosition + i];
+        uint32_t                   address;
+
+        utilsFlashRead(entry->address + sizeof(struct settingsRecord), data, entry->length);
+        appendRecord(entry->key, (i == 0), data, entry->length, &address);
+        clearRecordFlag(entry->address, OT_SETTINGS_RECORD_DELETE_FLAG);
+        entry->address = address;
+    }
+}
+
+static otError reclaimPage(uint16_t aPage)
+{
+    otError  error    = OT_ERROR_NONE;
+    uint16_t position = 0;
+
+    otEXPECT_ACTION(aPage != sWritePage, error = OT_ERROR_NO_BUFS);
+
+    while (position < sIndexLength)
+    {
+        uint16_t first;
+        uint16_t count;
+
+        if (getPage(sIndex[position].address) != aPage)
+        {
+            position++;
+            continue;
+        }
+
+        first = findKey(sIndex[position].key);
+        count = getValueCount(first, sIndex[position].key);
+        otEXPECT_ACTION(canMoveValues(first, count), error = OT_ERROR_NO_BUFS);
+        moveValues(first, count);
+        position = first + count;
+    }
+
+    erasePage(aPage);
+    sNumErasedPages++;
+
+exit:
+    return error;
+}
+
+// Reclaims the oldest pages, if needed, so that a record fits while keeping one page erased.
+static otError reserveSpace(uint16_t aValueLength)
+{
+    otError  error    = OT_ERROR_NONE;
+    uint16_t attempts = 0;
+
+    while ((sWriteOffset + getRecordSize(aValueLength) > SETTINGS_CONFIG_PAGE_SIZE) && (sNumErasedPages < 2))
+    {
+        otEXPECT_ACTION(attempts++ < SETTINGS_CONFIG_PAGE_NUM, error = OT_ERROR_NO_BUFS);
+        otEXPECT((error = reclaimPage(getOldestPage())) == OT_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+
+static void loadRecord(const struct settingsRecord *aRecord, uint32_t aAddress)
+{
+    uint16_t position = findKey(aRecord->key);
+    uint16_t count    = getValueCount(position, aRecord->key);
+
+    if (!(aRecord->flag & OT_SETTINGS_RECORD_FIRST_FLAG))
+    {
+        removeEntries(position, count);
+        count = 0;
+    }
+
+    insertEntry(position + count, aRecord->key, aRecord->length, aAddress);
+}
+
+static void loadPage(uint16_t aPage)
+{
+    uint32_t offset = sizeof(struct settingsPageHeader);
+
+    while (offset + sizeof(struct settingsRecord) <= SETTINGS_CONFIG_PAGE_SIZE)
+    {
+        uint32_t              address = getPageAddress(aPage) + offset;
+        struct settingsRecord record;
+
+        utilsFlashRead(address, (uint8_t *)(&record), sizeof(record));
+
+        if ((record.flag & OT_SETTINGS_RECORD_ADD_BEGIN_FLAG) ||
+            (offset + getRecordSize(record.length) > SETTINGS_CONFIG_PAGE_SIZE))
+        {
+            break;
+        }
+
+        if (!(record.flag & OT_SETTINGS_RECORD_ADD_COMPLETE_FLAG) && (record.flag & OT_SETTINGS_RECORD_DELETE_FLAG))
+        {
+            loadRecord(&record, address);
+        }
+
+        offset += getRecordSize(record.length);
+    }
+
+    if (aPage == sWritePage)
+    {
+        sWriteOffset = offset;
+    }
+}
+
+// settings API
+void otPlatSettingsInit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    struct settingsPageHeader header;
+    bool                      found = false;
+    uint16_t                  numPages;
+    uint16_t                  page;
+
+    utilsFlashInit();
+
+    // The newest page has the highest sequence number, the other pages in use precede it in the ring.
+    for (page = 0; page < SETTINGS_CONFIG_PAGE_NUM; page++)
+    {
+        utilsFlashRead(getPageAddress(page), (uint8_t *)(&header), sizeof(header));
+
+        if ((header.magic == OT_SETTINGS_PAGE_IN_USE) && (!found || (int32_t)(header.sequence - sSequence) > 0))
+        {
+            found      = true;
+            sSequence  = header.sequence;
+            sWritePage = page;
+        }
+    }
+
+    otEXPECT_ACTION(found, resetSettings());
+
+    page     = sWritePage;
+    numPages = 1;
+
+    while (numPages < SETTINGS_CONFIG_PAGE_NUM)
+    {
+        uint16_t prev = (page + SETTINGS_CONFIG_PAGE_NUM - 1) % SETTINGS_CONFIG_PAGE_NUM;
+
+        utilsFlashRead(getPageAddress(prev), (uint8_t *)(&header), sizeof(header));
+
+        if ((header.magic != OT_SETTINGS_PAGE_IN_USE) || (header.sequence != sSequence - numPages))
+        {
+            break;
+        }
+
+        page = prev;
+        numPages++;
+    }
+
+    sIndexLength    = 0;
+    sNumErasedPages = SETTINGS_CONFIG_PAGE_NUM - numPages;
+
+    // Records are replayed from the oldest page, so that newer records supersede older ones.
+    for (uint16_t i = 0; i < numPages; i++)
+    {
+        loadPage((page + i) % SETTINGS_CONFIG_PAGE_NUM);
+    }
+
+exit:
+    return;
+}
+
+void otPlatSettingsDeinit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError                          error       = OT_ERROR_NONE;
+    uint16_t                         position    = findKey(aKey);
+    uint16_t                         valueLength = 0;
+    const struct settingsIndexEntry *entry;
+
+    otEXPECT_ACTION((aIndex >= 0) && (aIndex < getValueCount(position, aKey)), error = OT_ERROR_NOT_FOUND);
+
+    entry       = &sIndex[position + aIndex];
+    valueLength = entry->length;
+
+    // only perform read if an input buffer was passed in
+    if (aValue != NULL && aValueLength != NULL)
+    {
+        utilsFlashRead(entry->address + sizeof(struct settingsRecord), aValue,
+                       (valueLength < *aValueLength) ? valueLength : *aValueLength);
+    }
+
+exit:
+    if (aValueLength != NULL)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError  error;
+    uint16_t position;
+    uint16_t count;
+    uint32_t address;
+
+    otEXPECT((error = reserveSpace(aValueLength)) == OT_ERROR_NONE);
+
+    position = findKey(aKey);
+    count    = getValueCount(position, aKey);
+    otEXPECT_ACTION((count > 0) || (sIndexLength < SETTINGS_CONFIG_INDEX_SIZE), error = OT_ERROR_NO_BUFS);
+
+    // The new value is written before the old ones are deleted, it supersedes them if this is interrupted.
+    otEXPECT((error = appendRecord(aKey, true, aValue, aValueLength, &address)) == OT_ERROR_NONE);
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        clearRecordFlag(sIndex[position + i].address, OT_SETTINGS_RECORD_DELETE_FLAG);
+    }
+
+    removeEntries(position, count);
+    error = insertEntry(position, aKey, aValueLength, address);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError  error;
+    uint16_t position;
+    uint16_t count;
+    uint32_t address;
+
+    otEXPECT_ACTION(sIndexLength < SETTINGS_CONFIG_INDEX_SIZE, error = OT_ERROR_NO_BUFS);
+    otEXPECT((error = reserveSpace(aValueLength)) == OT_ERROR_NONE);
+
+    position = findKey(aKey);
+    count    = getValueCount(position, aKey);
+
+    otEXPECT((error = appendRecord(aKey, (count == 0), aValue, aValueLength, &address)) == OT_ERROR_NONE);
+    error = insertEntry(position + count, aKey, aValueLength, address);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    otError  error    = OT_ERROR_NONE;
+    uint16_t position = findKey(aKey);
+    uint16_t count    = getValueCount(position, aKey);
+
+    if (aIndex == -1)
+    {
+        otEXPECT_ACTION(count > 0, error = OT_ERROR_NOT_FOUND);
+
+        for (uint16_t i = 0; i < count; i++)
+        {
+            clearRecordFlag(sIndex[position + i].address, OT_SETTINGS_RECORD_DELETE_FLAG);
+        }
+
+        removeEntries(position, count);
+    }
+    else
+    {
+        otEXPECT_ACTION((aIndex >= 0) && (aIndex < count), error = OT_ERROR_NOT_FOUND);
+
+        clearRecordFlag(sIndex[position + aIndex].address, OT_SETTINGS_RECORD_DELETE_FLAG);
+        removeEntries(position + (uint16_t)aIndex, 1);
+
+        if ((aIndex == 0) && (count > 1))
+        {
+            clearRecordFlag(sIndex[position].address, OT_SETTINGS_RECORD_FIRST_FLAG);
+        }
+    }
+
+exit:
+    return error;
+}
+
+void otPlatSettingsWipe(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    resetSettings();
+}
+
+#endif // OPENTHREAD_SETTINGS_WEAR_LEVELING && !OPENTHREAD_SETTINGS_RAM
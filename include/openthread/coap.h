@@ -60,6 +60,8 @@ extern "C" {
 
 #define OT_COAP_MAX_TOKEN_LENGTH 8 ///< Max token length as specified (RFC 7252).
 
+#define OT_COAP_RTT_HISTOGRAM_SIZE 8 ///< Number of buckets of the round-trip time histogram in `otCoapCounters`.
+
 /**
  * CoAP Type values.
  *
@@ -90,12 +92,13 @@ typedef enum otCoapCode
     OT_COAP_CODE_PUT    = OT_COAP_CODE(0, 3), ///< Put
     OT_COAP_CODE_DELETE = OT_COAP_CODE(0, 4), ///< Delete
 
-    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0), ///< 2.00
-    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1), ///< Created
-    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2), ///< Deleted
-    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3), ///< Valid
-    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4), ///< Changed
-    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5), ///< Content
+    OT_COAP_CODE_RESPONSE_MIN = OT_COAP_CODE(2, 0),  ///< 2.00
+    OT_COAP_CODE_CREATED      = OT_COAP_CODE(2, 1),  ///< Created
+    OT_COAP_CODE_DELETED      = OT_COAP_CODE(2, 2),  ///< Deleted
+    OT_COAP_CODE_VALID        = OT_COAP_CODE(2, 3),  ///< Valid
+    OT_COAP_CODE_CHANGED      = OT_COAP_CODE(2, 4),  ///< Changed
+    OT_COAP_CODE_CONTENT      = OT_COAP_CODE(2, 5),  ///< Content
+    OT_COAP_CODE_CONTINUE     = OT_COAP_CODE(2, 31), ///< Continue (RFC 7959)
 
     OT_COAP_CODE_BAD_REQUEST         = OT_COAP_CODE(4, 0),  ///< Bad Request
     OT_COAP_CODE_UNAUTHORIZED        = OT_COAP_CODE(4, 1),  ///< Unauthorized
@@ -104,6 +107,7 @@ typedef enum otCoapCode
     OT_COAP_CODE_NOT_FOUND           = OT_COAP_CODE(4, 4),  ///< Not Found
     OT_COAP_CODE_METHOD_NOT_ALLOWED  = OT_COAP_CODE(4, 5),  ///< Method Not Allowed
     OT_COAP_CODE_NOT_ACCEPTABLE      = OT_COAP_CODE(4, 6),  ///< Not Acceptable
+    OT_COAP_CODE_REQUEST_INCOMPLETE  = OT_COAP_CODE(4, 8),  ///< Request Entity Incomplete (RFC 7959)
     OT_COAP_CODE_PRECONDITION_FAILED = OT_COAP_CODE(4, 12), ///< Precondition Failed
     OT_COAP_CODE_REQUEST_TOO_LARGE   = OT_COAP_CODE(4, 13), ///< Request Entity Too Large
     OT_COAP_CODE_UNSUPPORTED_FORMAT  = OT_COAP_CODE(4, 15), ///< Unsupported Content-Format
@@ -134,6 +138,9 @@ typedef enum otCoapOptionType
     OT_COAP_OPTION_URI_QUERY      = 15, ///< Uri-Query
     OT_COAP_OPTION_ACCEPT         = 17, ///< Accept
     OT_COAP_OPTION_LOCATION_QUERY = 20, ///< Location-Query
+    OT_COAP_OPTION_BLOCK2         = 23, ///< Block2 (RFC 7959)
+    OT_COAP_OPTION_BLOCK1         = 27, ///< Block1 (RFC 7959)
+    OT_COAP_OPTION_SIZE2          = 28, ///< Size2 (RFC 7959)
     OT_COAP_OPTION_PROXY_URI      = 35, ///< Proxy-Uri
     OT_COAP_OPTION_PROXY_SCHEME   = 39, ///< Proxy-Scheme
     OT_COAP_OPTION_SIZE1          = 60, ///< Size1
@@ -332,6 +339,103 @@ typedef struct otCoapResource
     struct otCoapResource *mNext;    ///< The next CoAP resource in the list
 } otCoapResource;
 
+/**
+ * CoAP Block-wise transfer block sizes (RFC 7959), encoded as the SZX field of the Block1/Block2 options.
+ *
+ */
+typedef enum otCoapBlockSize
+{
+    OT_COAP_BLOCK_SIZE_16   = 0, ///< 16 bytes
+    OT_COAP_BLOCK_SIZE_32   = 1, ///< 32 bytes
+    OT_COAP_BLOCK_SIZE_64   = 2, ///< 64 bytes
+    OT_COAP_BLOCK_SIZE_128  = 3, ///< 128 bytes
+    OT_COAP_BLOCK_SIZE_256  = 4, ///< 256 bytes
+    OT_COAP_BLOCK_SIZE_512  = 5, ///< 512 bytes
+    OT_COAP_BLOCK_SIZE_1024 = 6, ///< 1024 bytes
+} otCoapBlockSize;
+
+/**
+ * This function pointer is called when a block of a block-wise transfer is received.
+ *
+ * It is called with each Block1 block of a request received by a block-wise resource, and with each Block2 block
+ * of a response received for a request sent with `otCoapSendRequestBlockWise()`. A block larger than 64 bytes is
+ * passed in consecutive parts, one call per part.
+ *
+ * @param[in]  aContext      A pointer to application-specific context.
+ * @param[in]  aBlock        A pointer to the block payload (or part of it).
+ * @param[in]  aPosition     The byte offset of @p aBlock within the whole body.
+ * @param[in]  aBlockLength  The length of @p aBlock in bytes.
+ * @param[in]  aMore         TRUE if more of the body follows, FALSE if this is the end of the last block.
+ * @param[in]  aTotalLength  The total body length if announced by the peer (Size1/Size2 option), 0 otherwise.
+ *
+ * @retval  OT_ERROR_NONE     The block was accepted.
+ * @retval  OT_ERROR_NO_BUFS  The body is too large for the receiver, the transfer is aborted.
+ *
+ */
+typedef otError (*otCoapBlockwiseReceiveHook)(void *         aContext,
+                                              const uint8_t *aBlock,
+                                              uint32_t       aPosition,
+                                              uint16_t       aBlockLength,
+                                              bool           aMore,
+                                              uint32_t       aTotalLength);
+
+/**
+ * This function pointer is called when the next block of a block-wise transfer is to be sent.
+ *
+ * A block larger than 64 bytes is requested in consecutive parts, one call per part.
+ *
+ * @param[in]     aContext      A pointer to application-specific context.
+ * @param[out]    aBlock        A pointer to the buffer to fill with the block payload (or part of it).
+ * @param[in]     aPosition     The byte offset of the requested data within the whole body.
+ * @param[inout]  aBlockLength  On input, the requested length (the size of @p aBlock). On output, the number of bytes
+ *                              written, which MUST equal the requested length unless @p aMore is set to FALSE.
+ * @param[out]    aMore         Set to TRUE if more of the body follows, FALSE if the body ends with these bytes.
+ *
+ * @retval  OT_ERROR_NONE          The block was written to @p aBlock.
+ * @retval  OT_ERROR_INVALID_ARGS  @p aPosition is beyond the end of the body.
+ *
+ */
+typedef otError (*otCoapBlockwiseTransmitHook)(void *    aContext,
+                                               uint8_t * aBlock,
+                                               uint32_t  aPosition,
+                                               uint16_t *aBlockLength,
+                                               bool *    aMore);
+
+/**
+ * This structure represents a CoAP resource with block-wise transfer support.
+ *
+ * Block1 blocks of a request are passed to @p mReceiveHook as they arrive and answered with 2.31 Continue; the
+ * request handler is called with the last block. Block2 follow-up requests for a block-wise response are served
+ * directly from @p mTransmitHook.
+ *
+ */
+typedef struct otCoapBlockwiseResource
+{
+    const char *                    mUriPath;      ///< The URI Path string
+    otCoapRequestHandler            mHandler;      ///< The callback for handling the (last block of a) request
+    otCoapBlockwiseReceiveHook      mReceiveHook;  ///< The callback for handling received Block1 blocks
+    otCoapBlockwiseTransmitHook     mTransmitHook; ///< The callback for providing Block2 blocks
+    void *                          mContext;      ///< Application-specific context
+    struct otCoapBlockwiseResource *mNext;         ///< The next CoAP block-wise resource in the list
+} otCoapBlockwiseResource;
+
+/**
+ * This structure represents the CoAP transmission counters.
+ *
+ * Round-trip times are measured from the first transmission of a confirmable message to its acknowledgment, for
+ * messages acknowledged after at most two retransmissions. Bucket 0 of @p mRttHistogram counts round-trip times below
+ * 64 ms, bucket `n` those from `32 << n` ms to `64 << n` ms, and the last bucket those of 4096 ms and above.
+ *
+ */
+typedef struct otCoapCounters
+{
+    uint32_t mTxConfirmable;                            ///< The number of confirmable messages sent.
+    uint32_t mTxRetransmissions;                        ///< The number of retransmissions.
+    uint32_t mTxTimeouts;                               ///< The number of confirmable messages never acknowledged.
+    uint32_t mTxDelayed;                                ///< The number of messages delayed by the NSTART limit.
+    uint32_t mRttHistogram[OT_COAP_RTT_HISTOGRAM_SIZE]; ///< Histogram of the measured round-trip times.
+} otCoapCounters;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -479,6 +583,46 @@ otError otCoapMessageAppendMaxAgeOption(otMessage *aMessage, uint32_t aMaxAge);
  */
 otError otCoapMessageAppendUriQueryOption(otMessage *aMessage, const char *aUriQuery);
 
+/**
+ * This function appends a Block1 option (RFC 7959).
+ *
+ * @param[inout]  aMessage  A pointer to the CoAP message.
+ * @param[in]     aNum      The block number.
+ * @param[in]     aMore     TRUE if more blocks follow.
+ * @param[in]     aSize     The block size.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapMessageAppendBlock1Option(otMessage *aMessage, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+/**
+ * This function appends a Block2 option (RFC 7959).
+ *
+ * @param[inout]  aMessage  A pointer to the CoAP message.
+ * @param[in]     aNum      The block number.
+ * @param[in]     aMore     TRUE if more blocks follow.
+ * @param[in]     aSize     The block size.
+ *
+ * @retval OT_ERROR_NONE          Successfully appended the option.
+ * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type.
+ * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+ *
+ */
+otError otCoapMessageAppendBlock2Option(otMessage *aMessage, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+/**
+ * This function returns the number of bytes of a block of a given block size.
+ *
+ * @param[in]  aSize  The block size.
+ *
+ * @returns The block size in bytes.
+ *
+ */
+uint16_t otCoapBlockSizeFromExponent(otCoapBlockSize aSize);
+
 /**
  * This function adds Payload Marker indicating beginning of the payload to the CoAP header.
  *
@@ -627,6 +771,40 @@ otError otCoapSendRequest(otInstance *          aInstance,
                           otCoapResponseHandler aHandler,
                           void *                aContext);
 
+/**
+ * This function sends a CoAP request using block-wise transfer (RFC 7959).
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is enabled.
+ *
+ * To upload a request body in blocks, @p aMessage MUST be a Confirmable request that carries a Block1 option with
+ * block number 0 as its last option and no payload; the body is then pulled block by block from @p aTransmitHook
+ * and each block is sent (and retransmitted) as its own Confirmable request once the server acknowledges the
+ * previous one with 2.31 Continue.
+ *
+ * If @p aReceiveHook is not NULL, a response carrying a Block2 option is passed block by block to @p aReceiveHook
+ * and the remaining blocks are requested automatically. @p aHandler is called once with the final response.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the message to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aHandler       A function pointer that shall be called on response reception or timeout.
+ * @param[in]  aContext       A pointer to arbitrary context information. May be NULL if not used.
+ * @param[in]  aTransmitHook  A function pointer that is called to provide Block1 blocks. May be NULL.
+ * @param[in]  aReceiveHook   A function pointer that is called with received Block2 blocks. May be NULL.
+ *
+ * @retval OT_ERROR_NONE          Successfully sent the first block of the CoAP request.
+ * @retval OT_ERROR_NO_BUFS       Failed to allocate retransmission data.
+ * @retval OT_ERROR_INVALID_ARGS  @p aTransmitHook is given but @p aMessage does not carry a Block1 option.
+ *
+ */
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook);
+
 /**
  * This function starts the CoAP server.
  *
@@ -669,6 +847,31 @@ otError otCoapAddResource(otInstance *aInstance, otCoapResource *aResource);
  */
 void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource);
 
+/**
+ * This function adds a block-wise resource to the CoAP server.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ * @retval OT_ERROR_NONE     Successfully added @p aResource.
+ * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+ *
+ */
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
+/**
+ * This function removes a block-wise resource from the CoAP server.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the block-wise resource.
+ *
+ */
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource);
+
 /**
  * This function sets the default handler for unhandled CoAP requests.
  *
@@ -692,6 +895,121 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
  */
 otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+/**
+ * This function sends a CoAP response from the server using block-wise transfer (RFC 7959).
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE` is enabled.
+ *
+ * @p aMessage MUST carry a Block2 option with block number 0 as its last option and no payload. The payload of the
+ * first block is pulled from @p aTransmitHook. Subsequent blocks are requested by the client with follow-up
+ * requests that are served from the `mTransmitHook` of the matching block-wise resource.
+ *
+ * @param[in]  aInstance      A pointer to an OpenThread instance.
+ * @param[in]  aMessage       A pointer to the CoAP response to send.
+ * @param[in]  aMessageInfo   A pointer to the message info associated with @p aMessage.
+ * @param[in]  aContext       A pointer to arbitrary context information passed to @p aTransmitHook.
+ * @param[in]  aTransmitHook  A function pointer that is called to provide the first block.
+ *
+ * @retval OT_ERROR_NONE          Successfully enqueued the CoAP response message.
+ * @retval OT_ERROR_NO_BUFS       Insufficient buffers available to send the CoAP response.
+ * @retval OT_ERROR_INVALID_ARGS  @p aMessage does not carry a Block2 option.
+ *
+ */
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockwiseTransmitHook aTransmitHook);
+
+/**
+ * This function aborts the CoAP transactions associated with a given response handler and context.
+ *
+ * The response handler is called with OT_ERROR_ABORT. This also cancels observations (RFC 7641) established by
+ * requests sent with @p aHandler and @p aContext: further notifications are rejected with a Reset message, which
+ * deregisters the client from the server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aHandler   The response handler the requests were sent with.
+ * @param[in]  aContext   The context the requests were sent with.
+ *
+ * @retval OT_ERROR_NONE       Successfully aborted the CoAP transactions.
+ * @retval OT_ERROR_NOT_FOUND  No CoAP transaction is associated with @p aHandler and @p aContext.
+ *
+ */
+otError otCoapAbortTransaction(otInstance *aInstance, otCoapResponseHandler aHandler, void *aContext);
+
+/**
+ * This function registers the sender of an Observe registration (RFC 7641) as an observer of a resource.
+ *
+ * A GET request carrying an Observe option with value 0 is a registration. The resource handler calls this function
+ * when it accepts the registration. Its response MUST then carry an Observe option with the value returned in
+ * @p aObserve. If the registration fails, the request should be answered as a plain GET, without Observe option.
+ *
+ * A GET request with an Observe option value of 1 deregisters the observer before it is handed to the resource.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE` is enabled.
+ *
+ * @param[in]   aInstance     A pointer to an OpenThread instance.
+ * @param[in]   aResource     A pointer to the observed resource.
+ * @param[in]   aRequest      A pointer to the registration request.
+ * @param[in]   aMessageInfo  A pointer to the message info associated with @p aRequest.
+ * @param[out]  aObserve      A pointer to where the Observe option value of the response is placed.
+ *
+ * @retval OT_ERROR_NONE          Successfully registered the observer.
+ * @retval OT_ERROR_INVALID_ARGS  @p aRequest is not an Observe registration.
+ * @retval OT_ERROR_NO_BUFS       The observer table is full.
+ *
+ */
+otError otCoapAddObserver(otInstance *          aInstance,
+                          const otCoapResource *aResource,
+                          otMessage *           aRequest,
+                          const otMessageInfo * aMessageInfo,
+                          uint32_t *            aObserve);
+
+/**
+ * This function notifies the observers of a resource of a new resource state (RFC 7641).
+ *
+ * @p aMessage is a template of the notifications: it holds their Type (confirmable or non-confirmable), a 2.xx
+ * Code, options and payload. The Token and Observe option are set for each observer.
+ *
+ * Notifications are sent after `OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL`. A template passed in the
+ * meantime replaces this one, so that only the latest resource state is sent. Observers that reject a notification,
+ * or do not acknowledge a confirmable notification, are removed.
+ *
+ * If the return value is OT_ERROR_NONE, OpenThread takes ownership of @p aMessage and the caller should no longer
+ * reference it. Otherwise, the caller retains ownership of @p aMessage.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aResource  A pointer to the resource whose state changed.
+ * @param[in]  aMessage   A pointer to the notification template.
+ *
+ * @retval OT_ERROR_NONE          Successfully scheduled the notifications.
+ * @retval OT_ERROR_INVALID_ARGS  The Code of @p aMessage is not a 2.xx success code.
+ * @retval OT_ERROR_NOT_FOUND     The resource has no observers.
+ *
+ */
+otError otCoapNotifyObservers(otInstance *aInstance, const otCoapResource *aResource, otMessage *aMessage);
+
+/**
+ * This function gets the transmission counters of the CoAP service.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the CoAP transmission counters.
+ *
+ */
+const otCoapCounters *otCoapGetCounters(otInstance *aInstance);
+
+/**
+ * This function resets the transmission counters of the CoAP service.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otCoapResetCounters(otInstance *aInstance);
+
 /**
  * @}
  *
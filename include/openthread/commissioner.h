@@ -110,6 +110,16 @@ typedef struct otCommissioningDataset
     bool mIsJoinerUdpPortSet : 1; ///< TRUE if Joiner UDP Port is set, FALSE otherwise.
 } otCommissioningDataset;
 
+/**
+ * This structure represents a Joiner entry to add with `otCommissionerAddJoiners()`.
+ *
+ */
+typedef struct otCommissionerJoiner
+{
+    otExtAddress mEui64; ///< The Joiner's IEEE EUI-64.
+    const char * mPskd;  ///< A pointer to the PSKd.
+} otCommissionerJoiner;
+
 /**
  * This function pointer is called whenever the commissioner state changes.
  *
@@ -182,6 +192,30 @@ otError otCommissionerAddJoiner(otInstance *        aInstance,
                                 const char *        aPSKd,
                                 uint32_t            aTimeout);
 
+/**
+ * This function adds a list of Joiner entries.
+ *
+ * The entries are added together: either all of them are added or, on error, none is. The Steering Data is sent to
+ * the Leader once for the whole list.
+ *
+ * @param[in]  aInstance          A pointer to an OpenThread instance.
+ * @param[in]  aJoiners           A pointer to an array of Joiner entries.
+ * @param[in]  aNumJoiners        The number of entries in @p aJoiners.
+ * @param[in]  aTimeout           A time after which the Joiners are automatically removed, in seconds.
+ *
+ * @retval OT_ERROR_NONE          Successfully added the Joiners.
+ * @retval OT_ERROR_NO_BUFS       No buffers available to add all the Joiners.
+ * @retval OT_ERROR_INVALID_ARGS  A PSKd in @p aJoiners is invalid.
+ * @retval OT_ERROR_INVALID_STATE The commissioner is not active.
+ *
+ * @note Only use this after successfully starting the Commissioner role with otCommissionerStart().
+ *
+ */
+otError otCommissionerAddJoiners(otInstance *                aInstance,
+                                 const otCommissionerJoiner *aJoiners,
+                                 uint16_t                    aNumJoiners,
+                                 uint32_t                    aTimeout);
+
 /**
  * This function removes a Joiner entry.
  *
@@ -380,6 +414,8 @@ otCommissionerState otCommissionerGetState(otInstance *aInstance);
  *
  * PSKc is used to establish the Commissioner Session.
  *
+ * The last generated PSKc is cached, a call with the same inputs returns it without the PBKDF2 derivation.
+ *
  * @param[in]  aInstance     A pointer to an OpenThread instance.
  * @param[in]  aPassPhrase   The commissioning passphrase.
  * @param[in]  aNetworkName  The network name for PSKc computation.
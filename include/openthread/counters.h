@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file defines the OpenThread performance counters API.
+ */
+
+#ifndef OPENTHREAD_COUNTERS_H_
+#define OPENTHREAD_COUNTERS_H_
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup api-counters
+ *
+ * @brief
+ *   This module includes functions for the performance counters registry.
+ *
+ *   The functions in this module require `OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE`.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This enumeration defines the counter types.
+ *
+ */
+typedef enum otCounterType
+{
+    OT_COUNTER_TYPE_EVENT           = 0, ///< Number of occurrences of an event.
+    OT_COUNTER_TYPE_HIGH_WATER_MARK = 1, ///< Largest value observed.
+} otCounterType;
+
+/**
+ * This structure represents a counter.
+ *
+ */
+typedef struct otCounter
+{
+    const char *  mName;  ///< The counter name.
+    otCounterType mType;  ///< The counter type.
+    uint32_t      mValue; ///< The counter value.
+} otCounter;
+
+/**
+ * This function returns the number of counters in the registry.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns The number of counters.
+ *
+ */
+uint16_t otCountersGetNumCounters(otInstance *aInstance);
+
+/**
+ * This function gets a counter from the registry.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[in]   aIndex     The counter index (from zero to `otCountersGetNumCounters()` - 1).
+ * @param[out]  aCounter   A pointer to output the counter.
+ *
+ * @retval OT_ERROR_NONE       Successfully retrieved the counter.
+ * @retval OT_ERROR_NOT_FOUND  @p aIndex is out of range.
+ *
+ */
+otError otCountersGetCounter(otInstance *aInstance, uint16_t aIndex, otCounter *aCounter);
+
+/**
+ * This function resets all counters in the registry to zero.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otCountersReset(otInstance *aInstance);
+
+/**
+ * @}
+ *
+ */
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_COUNTERS_H_
@@ -120,6 +120,7 @@ extern "C" {
  * @}
  *
  * @defgroup api-cli                 Command Line Interface
+ * @defgroup api-counters            Performance Counters
  * @defgroup api-crypto              Crypto
  * @defgroup api-entropy             Entropy Source
  * @defgroup api-factory-diagnostics Factory Diagnostics
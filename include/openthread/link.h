@@ -141,6 +141,18 @@ typedef struct otMacCounters
     uint32_t mRxErrOther;           ///< The number of received packets with other error.
 } otMacCounters;
 
+/**
+ * This structure represents the data poll statistics of a sleepy end device.
+ *
+ */
+typedef struct otPollStats
+{
+    uint32_t mPollsSent;      ///< The number of data polls acknowledged by the parent.
+    uint32_t mEmptyPolls;     ///< The number of data polls acknowledged without a pending frame.
+    uint32_t mAverageLatency; ///< The estimated average downlink latency in milliseconds.
+    uint32_t mPollPeriod;     ///< The current data poll period in milliseconds.
+} otPollStats;
+
 /**
  * This structure represents a received IEEE 802.15.4 Beacon.
  *
@@ -444,6 +456,64 @@ uint32_t otLinkGetPollPeriod(otInstance *aInstance);
  */
 otError otLinkSetPollPeriod(otInstance *aInstance, uint32_t aPollPeriod);
 
+/**
+ * Get the downlink latency budget of adaptive data polling.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns  The latency budget in milliseconds, or zero if adaptive data polling is disabled.
+ *
+ * @sa otLinkSetPollLatencyBudget
+ *
+ */
+uint32_t otLinkGetPollLatencyBudget(otInstance *aInstance);
+
+/**
+ * Set/clear the downlink latency budget of adaptive data polling for sleepy end device.
+ *
+ * A non-zero latency budget enables adaptive data polling: the data poll period follows the observed interval between
+ * the frames received from the parent, and is at most the latency budget. The budget replaces the user-specified poll
+ * period set with `otLinkSetPollPeriod()`. Zero disables adaptive data polling.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE` is enabled.
+ *
+ * @note A non-zero value should be no less than `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD` (500ms), and no more
+ *       than the maximal value 0x3FFFFFF ((1 << 26) - 1), otherwise it would be clipped by the maximal value.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aLatency   The latency budget in milliseconds.
+ *
+ * @retval OT_ERROR_NONE          Successfully set/cleared the latency budget.
+ * @retval OT_ERROR_INVALID_ARGS  If aLatency is invalid.
+ *
+ * @sa otLinkGetPollLatencyBudget
+ *
+ */
+otError otLinkSetPollLatencyBudget(otInstance *aInstance, uint32_t aLatency);
+
+/**
+ * Get the data poll statistics of sleepy end device.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE` is enabled.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aStats     A pointer to where the statistics are placed.
+ *
+ */
+void otLinkGetPollStats(otInstance *aInstance, otPollStats *aStats);
+
+/**
+ * Reset the data poll statistics of sleepy end device.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otLinkResetPollStats(otInstance *aInstance);
+
 /**
  * Get the IEEE 802.15.4 Short Address.
  *
@@ -146,6 +146,23 @@ typedef void (*otLinkRawReceiveDone)(otInstance *aInstance, otRadioFrame *aFrame
  */
 otError otLinkRawReceive(otInstance *aInstance, otLinkRawReceiveDone aCallback);
 
+/**
+ * Transitioning the radio from Sleep to Receive on multiple channels concurrently.
+ *
+ * This function is used when the radio provides OT_RADIO_CAPS_MULTI_CHANNEL_RX capability. The radio keeps receiving
+ * on all channels in @p aChannelMask until `otLinkRawReceive()` or `otLinkRawSleep()` is called.
+ *
+ * @param[in]  aInstance     A pointer to an OpenThread instance.
+ * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+ * @param[in]  aCallback     A pointer to a function called on receipt of a IEEE 802.15.4 frame.
+ *
+ * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+ * @retval OT_ERROR_INVALID_STATE    The radio was disabled or transmitting.
+ * @retval OT_ERROR_NOT_CAPABLE      The radio does not support receiving on multiple channels.
+ *
+ */
+otError otLinkRawReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask, otLinkRawReceiveDone aCallback);
+
 /**
  * The radio transitions from Transmit to Receive.
  * This method returns a pointer to the transmit buffer.
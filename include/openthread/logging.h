@@ -73,6 +73,97 @@ otLogLevel otLoggingGetLevel(void);
  */
 void otLoggingSetLevel(otLogLevel aLogLevel);
 
+#define OT_LOGGING_BINARY_MAX_RECORD_LENGTH 255 ///< Maximum length of a binary log record (in bytes).
+
+/**
+ * This structure represents the metadata of a decoded binary log record.
+ *
+ */
+typedef struct otLogBinaryRecordInfo
+{
+    uint32_t    mTimestamp; ///< The time the record was written (in milliseconds).
+    otLogLevel  mLogLevel;  ///< The log level.
+    otLogRegion mLogRegion; ///< The log region.
+} otLogBinaryRecordInfo;
+
+/**
+ * This function pointer is called when binary log records become available to read.
+ *
+ * The handler is called from within the logging call. It should only schedule `otLoggingBinaryRead()`.
+ *
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+typedef void (*otLoggingBinaryHandler)(void *aContext);
+
+/**
+ * This function registers the reader of binary log records.
+ *
+ * The handler is called when a record is written to an empty log buffer.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`.
+ *
+ * @param[in]  aHandler  A pointer to the handler function, or NULL to remove the handler.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+void otLoggingBinarySetHandler(otLoggingBinaryHandler aHandler, void *aContext);
+
+/**
+ * This function reads binary log records.
+ *
+ * Only whole records are read. Each record starts with its length in bytes (one byte). The caller should read until
+ * this function returns zero, with a buffer of at least `OT_LOGGING_BINARY_MAX_RECORD_LENGTH` bytes.
+ *
+ * The log buffer is not protected against concurrent access, so this function must be called from the context
+ * that writes the log records.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`.
+ *
+ * @param[out]  aBuffer  A pointer to a buffer to output the records.
+ * @param[in]   aLength  The size of @p aBuffer (in bytes).
+ *
+ * @returns The number of bytes read.
+ *
+ */
+uint16_t otLoggingBinaryRead(uint8_t *aBuffer, uint16_t aLength);
+
+/**
+ * This function formats a binary log record read by `otLoggingBinaryRead()`.
+ *
+ * Format strings are looked up in the running image, so this function only decodes records written by the same
+ * firmware. Records from a remote device are decoded with `tools/binary-log/ot-log-decode.py`.
+ *
+ * A memory dump record is formatted into several lines separated by `\n`.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`.
+ *
+ * @param[in]   aRecord  A pointer to the record.
+ * @param[in]   aLength  The length of the record (in bytes).
+ * @param[out]  aInfo    A pointer to output the record metadata.
+ * @param[out]  aString  A pointer to a buffer to output the NULL-terminated log string.
+ * @param[in]   aSize    The size of @p aString (in bytes).
+ *
+ * @retval OT_ERROR_NONE   Successfully formatted the record.
+ * @retval OT_ERROR_PARSE  The record is malformed, or its format string was not written by this image.
+ *
+ */
+otError otLoggingBinaryDecode(const uint8_t *        aRecord,
+                              uint16_t               aLength,
+                              otLogBinaryRecordInfo *aInfo,
+                              char *                 aString,
+                              uint16_t               aSize);
+
+/**
+ * This function returns the number of binary log records dropped because the log buffer was full.
+ *
+ * @note This function requires `OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`.
+ *
+ * @returns The number of dropped records.
+ *
+ */
+uint32_t otLoggingBinaryGetDropCount(void);
+
 /**
  * @}
  *
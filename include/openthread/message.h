@@ -382,6 +382,93 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * This enumeration defines the stages of a transmitted message recorded by latency tracing.
+ *
+ */
+typedef enum otMessageLatencyStage
+{
+    OT_MESSAGE_LATENCY_STAGE_ENQUEUED       = 0, ///< Enqueued for transmission by IPv6 or the mesh forwarder.
+    OT_MESSAGE_LATENCY_STAGE_ROUTE_RESOLVED = 1, ///< Next hop (or sleepy child) determined.
+    OT_MESSAGE_LATENCY_STAGE_TX_STARTED     = 2, ///< First frame of the message handed to the MAC.
+    OT_MESSAGE_LATENCY_STAGE_TX_DONE        = 3, ///< Last frame of the message transmitted (or failed).
+} otMessageLatencyStage;
+
+#define OT_MESSAGE_LATENCY_NUM_STAGES 4      ///< Number of latency tracing stages.
+#define OT_MESSAGE_LATENCY_HISTOGRAM_BINS 16 ///< Number of bins of a latency histogram.
+
+/**
+ * This structure represents the latency trace of a message delivered to one destination.
+ *
+ * A message sent to several sleepy children (and possibly also directly) produces one trace per delivery.
+ *
+ */
+typedef struct otMessageLatencyTrace
+{
+    uint32_t mTimestamps[OT_MESSAGE_LATENCY_NUM_STAGES]; ///< Time of each stage (in microseconds).
+    uint8_t  mStageMask;                                  ///< Recorded stages, bit `n` for `otMessageLatencyStage` n.
+    uint8_t  mPriority;                                   ///< The message priority level.
+    uint16_t mLength;                                     ///< The message length (in bytes).
+    bool     mIndirect;                                   ///< TRUE if delivered indirectly to a sleepy child.
+    bool     mTxSuccess;                                  ///< TRUE if all frames of the message were sent (and acked).
+} otMessageLatencyTrace;
+
+/**
+ * This structure represents the latency histograms of delivered messages.
+ *
+ * `mBins[s - 1]` holds the time from `OT_MESSAGE_LATENCY_STAGE_ENQUEUED` to stage `s`. Bin 0 counts latencies below
+ * 1 ms, bin `b` counts latencies in [2^(b-1), 2^b) ms, and the last bin also counts all longer latencies.
+ *
+ */
+typedef struct otMessageLatencyHistogram
+{
+    uint32_t mCount; ///< The number of traced deliveries.
+    uint32_t mBins[OT_MESSAGE_LATENCY_NUM_STAGES - 1][OT_MESSAGE_LATENCY_HISTOGRAM_BINS]; ///< Latency histograms.
+} otMessageLatencyHistogram;
+
+/**
+ * This function pointer is called when the delivery of a traced message completes.
+ *
+ * @param[in]  aTrace    A pointer to the latency trace.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+typedef void (*otMessageLatencyCallback)(const otMessageLatencyTrace *aTrace, void *aContext);
+
+/**
+ * This function registers a callback to receive the latency trace of each delivered message.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ * @param[in]  aCallback  A pointer to the callback function, or NULL to disable the callback.
+ * @param[in]  aContext   A pointer to application-specific context.
+ *
+ */
+void otMessageSetLatencyCallback(otInstance *aInstance, otMessageLatencyCallback aCallback, void *aContext);
+
+/**
+ * This function gets the latency histograms of delivered messages.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ * @returns A pointer to the latency histograms.
+ *
+ */
+const otMessageLatencyHistogram *otMessageGetLatencyHistogram(otInstance *aInstance);
+
+/**
+ * This function resets the latency histograms of delivered messages.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetLatencyHistogram(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -123,6 +123,7 @@ enum
     OT_RADIO_CAPS_ENERGY_SCAN      = 1 << 1, ///< Radio supports Energy Scans.
     OT_RADIO_CAPS_TRANSMIT_RETRIES = 1 << 2, ///< Radio supports tx retry logic with collision avoidance (CSMA).
     OT_RADIO_CAPS_CSMA_BACKOFF     = 1 << 3, ///< Radio supports CSMA backoff for frame transmission (but no retry).
+    OT_RADIO_CAPS_MULTI_CHANNEL_RX = 1 << 4, ///< Radio supports receiving on multiple channels concurrently.
 };
 
 #define OT_PANID_BROADCAST 0xffff ///< IEEE 802.15.4 Broadcast PAN ID
@@ -486,6 +487,25 @@ otError otPlatRadioSleep(otInstance *aInstance);
  */
 otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel);
 
+/**
+ * Transition the radio from Sleep to Receive on multiple channels concurrently.
+ *
+ * This function is used when radio provides OT_RADIO_CAPS_MULTI_CHANNEL_RX capability.
+ *
+ * The radio receives on all channels in @p aChannelMask until `otPlatRadioReceive()` or `otPlatRadioSleep()` is
+ * called. Received frames are reported through `otPlatRadioReceiveDone()` with `mChannel` set to the channel they
+ * were received on.
+ *
+ * @param[in]  aInstance     The OpenThread instance structure.
+ * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+ *
+ * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+ * @retval OT_ERROR_INVALID_STATE    The radio was disabled or transmitting.
+ * @retval OT_ERROR_NOT_IMPLEMENTED  The radio does not support receiving on multiple channels.
+ *
+ */
+otError otPlatRadioReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask);
+
 /**
  * The radio driver calls this method to notify OpenThread of a received frame.
  *
@@ -76,6 +76,10 @@
 #include <openthread/channel_monitor.h>
 #endif
 
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+#include <openthread/counters.h>
+#endif
+
 #if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_DEBUG_UART) && OPENTHREAD_POSIX
 #include <openthread/platform/debug_uart.h>
 #endif
@@ -150,6 +154,9 @@ const struct Command Interpreter::sCommands[] = {
     {"joinerport", &Interpreter::ProcessJoinerPort},
 #endif
     {"keysequence", &Interpreter::ProcessKeySequence},
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    {"latency", &Interpreter::ProcessLatency},
+#endif
     {"leaderdata", &Interpreter::ProcessLeaderData},
 #if OPENTHREAD_FTD
     {"leaderpartitionid", &Interpreter::ProcessLeaderPartitionId},
@@ -853,6 +860,9 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
     {
         mServer->OutputFormat("mac\r\n");
         mServer->OutputFormat("mle\r\n");
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+        mServer->OutputFormat("perf\r\n");
+#endif
     }
     else if (argc == 1)
     {
@@ -907,11 +917,28 @@ void Interpreter::ProcessCounters(int argc, char *argv[])
                                   mleCounters->mBetterPartitionAttachAttempts);
             mServer->OutputFormat("Parent Changes: %d\r\n", mleCounters->mParentChanges);
         }
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+        else if (strcmp(argv[0], "perf") == 0)
+        {
+            otCounter counter;
+
+            for (uint16_t index = 0; otCountersGetCounter(mInstance, index, &counter) == OT_ERROR_NONE; index++)
+            {
+                mServer->OutputFormat("%s: %u\r\n", counter.mName, counter.mValue);
+            }
+        }
+#endif
         else
         {
             ExitNow(error = OT_ERROR_INVALID_ARGS);
         }
     }
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+    else if (argc == 2 && strcmp(argv[0], "perf") == 0 && strcmp(argv[1], "reset") == 0)
+    {
+        otCountersReset(mInstance);
+    }
+#endif
     else
     {
         ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -1427,6 +1454,45 @@ exit:
     AppendResult(error);
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+void Interpreter::ProcessLatency(int argc, char *argv[])
+{
+    static const char *const kStageNames[] = {"route", "txstart", "txdone"};
+
+    otError error = OT_ERROR_NONE;
+
+    if (argc == 0)
+    {
+        const otMessageLatencyHistogram *histogram = otMessageGetLatencyHistogram(mInstance);
+
+        mServer->OutputFormat("count: %u\r\n", histogram->mCount);
+
+        for (uint8_t stage = 0; stage < OT_MESSAGE_LATENCY_NUM_STAGES - 1; stage++)
+        {
+            mServer->OutputFormat("%s:", kStageNames[stage]);
+
+            for (uint8_t bin = 0; bin < OT_MESSAGE_LATENCY_HISTOGRAM_BINS; bin++)
+            {
+                mServer->OutputFormat(" %u", histogram->mBins[stage][bin]);
+            }
+
+            mServer->OutputFormat("\r\n");
+        }
+    }
+    else if (strcmp(argv[0], "reset") == 0)
+    {
+        otMessageResetLatencyHistogram(mInstance);
+    }
+    else
+    {
+        ExitNow(error = OT_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    AppendResult(error);
+}
+#endif
+
 void Interpreter::ProcessLeaderData(int argc, char *argv[])
 {
     OT_UNUSED_VARIABLE(argc);
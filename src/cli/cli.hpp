@@ -256,6 +256,9 @@ private:
     void ProcessJoinerPort(int argc, char *argv[]);
 #endif
     void ProcessKeySequence(int argc, char *argv[]);
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    void ProcessLatency(int argc, char *argv[]);
+#endif
     void ProcessLeaderData(int argc, char *argv[]);
 #if OPENTHREAD_FTD
     void ProcessLeaderPartitionId(int argc, char *argv[]);
@@ -36,6 +36,7 @@
 #if OPENTHREAD_CONFIG_COAP_API_ENABLE
 
 #include <ctype.h>
+#include <stdlib.h>
 
 #include "cli/cli.hpp"
 #include "cli/cli_server.hpp"
@@ -45,15 +46,33 @@ namespace ot {
 namespace Cli {
 
 const struct Coap::Command Coap::sCommands[] = {
-    {"help", &Coap::ProcessHelp},    {"delete", &Coap::ProcessRequest}, {"get", &Coap::ProcessRequest},
-    {"post", &Coap::ProcessRequest}, {"put", &Coap::ProcessRequest},    {"resource", &Coap::ProcessResource},
-    {"start", &Coap::ProcessStart},  {"stop", &Coap::ProcessStop},
+    {"help", &Coap::ProcessHelp},
+    {"cancel", &Coap::ProcessCancel},
+    {"counters", &Coap::ProcessCounters},
+    {"delete", &Coap::ProcessRequest},
+    {"get", &Coap::ProcessRequest},
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    {"observe", &Coap::ProcessRequest},
+#endif
+    {"post", &Coap::ProcessRequest},
+    {"put", &Coap::ProcessRequest},
+    {"resource", &Coap::ProcessResource},
+    {"set", &Coap::ProcessSet},
+    {"start", &Coap::ProcessStart},
+    {"stop", &Coap::ProcessStop},
 };
 
 Coap::Coap(Interpreter &aInterpreter)
     : mInterpreter(aInterpreter)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    , mBlockWiseBodyLength(kDefaultBlockWiseBodyLength)
+#endif
 {
     memset(&mResource, 0, sizeof(mResource));
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    memset(&mResourceBlockWise, 0, sizeof(mResourceBlockWise));
+#endif
+    strlcpy(mResourceContent, "0", sizeof(mResourceContent));
 }
 
 void Coap::PrintPayload(otMessage *aMessage) const
@@ -82,6 +101,51 @@ void Coap::PrintPayload(otMessage *aMessage) const
     mInterpreter.mServer->OutputFormat("\r\n");
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+void Coap::PrintBlock(const uint8_t *aBlock, uint32_t aPosition, uint16_t aBlockLength, bool aMore) const
+{
+    uint16_t bytesToPrint;
+
+    mInterpreter.mServer->OutputFormat("coap block at %lu%s: ", static_cast<unsigned long>(aPosition),
+                                       aMore ? "" : " (last)");
+
+    while (aBlockLength > 0)
+    {
+        bytesToPrint = (aBlockLength < kMaxBufferSize) ? aBlockLength : static_cast<uint16_t>(kMaxBufferSize);
+        mInterpreter.OutputBytes(aBlock, static_cast<uint8_t>(bytesToPrint));
+
+        aBlock += bytesToPrint;
+        aBlockLength -= bytesToPrint;
+    }
+
+    mInterpreter.mServer->OutputFormat("\r\n");
+}
+
+otError Coap::ParseBlockSize(const char *aArgs, otCoapBlockSize &aSize)
+{
+    otError       error = OT_ERROR_INVALID_ARGS;
+    unsigned long length;
+    char *        endptr;
+
+    VerifyOrExit(strncmp(aArgs, "block-", sizeof("block-") - 1) == 0);
+
+    length = strtoul(aArgs + sizeof("block-") - 1, &endptr, 0);
+    VerifyOrExit(*endptr == '\0');
+
+    for (int size = OT_COAP_BLOCK_SIZE_16; size <= OT_COAP_BLOCK_SIZE_1024; size++)
+    {
+        if (otCoapBlockSizeFromExponent(static_cast<otCoapBlockSize>(size)) == length)
+        {
+            aSize = static_cast<otCoapBlockSize>(size);
+            ExitNow(error = OT_ERROR_NONE);
+        }
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 otError Coap::ProcessHelp(int argc, char *argv[])
 {
     OT_UNUSED_VARIABLE(argc);
@@ -95,6 +159,44 @@ otError Coap::ProcessHelp(int argc, char *argv[])
     return OT_ERROR_NONE;
 }
 
+otError Coap::ProcessCounters(int argc, char *argv[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (argc == 1)
+    {
+        const otCoapCounters *counters = otCoapGetCounters(mInterpreter.mInstance);
+
+        mInterpreter.mServer->OutputFormat("TxConfirmable: %lu\r\n",
+                                           static_cast<unsigned long>(counters->mTxConfirmable));
+        mInterpreter.mServer->OutputFormat("TxRetransmissions: %lu\r\n",
+                                           static_cast<unsigned long>(counters->mTxRetransmissions));
+        mInterpreter.mServer->OutputFormat("TxTimeouts: %lu\r\n", static_cast<unsigned long>(counters->mTxTimeouts));
+        mInterpreter.mServer->OutputFormat("TxDelayed: %lu\r\n", static_cast<unsigned long>(counters->mTxDelayed));
+        mInterpreter.mServer->OutputFormat("Rtt:\r\n");
+
+        for (uint8_t i = 0; i < OT_COAP_RTT_HISTOGRAM_SIZE - 1; i++)
+        {
+            mInterpreter.mServer->OutputFormat("    <%lums: %lu\r\n", 64UL << i,
+                                               static_cast<unsigned long>(counters->mRttHistogram[i]));
+        }
+
+        mInterpreter.mServer->OutputFormat(
+            "    >=%lums: %lu\r\n", 32UL << (OT_COAP_RTT_HISTOGRAM_SIZE - 1),
+            static_cast<unsigned long>(counters->mRttHistogram[OT_COAP_RTT_HISTOGRAM_SIZE - 1]));
+    }
+    else if (argc == 2 && strcmp(argv[1], "reset") == 0)
+    {
+        otCoapResetCounters(mInterpreter.mInstance);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
 otError Coap::ProcessResource(int argc, char *argv[])
 {
     otError error = OT_ERROR_NONE;
@@ -108,7 +210,27 @@ otError Coap::ProcessResource(int argc, char *argv[])
         mResource.mHandler = &Coap::HandleRequest;
 
         strlcpy(mUriPath, argv[1], kMaxUriLength);
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        mResourceBlockWise.mUriPath      = mUriPath;
+        mResourceBlockWise.mContext      = this;
+        mResourceBlockWise.mHandler      = &Coap::HandleRequest;
+        mResourceBlockWise.mReceiveHook  = &Coap::HandleBlockReceive;
+        mResourceBlockWise.mTransmitHook = &Coap::HandleBlockTransmit;
+
+        if (argc > 2)
+        {
+            long value;
+
+            SuccessOrExit(error = mInterpreter.ParseLong(argv[2], value));
+            VerifyOrExit(value > 0, error = OT_ERROR_INVALID_ARGS);
+            mBlockWiseBodyLength = static_cast<uint32_t>(value);
+        }
+
+        SuccessOrExit(error = otCoapAddBlockWiseResource(mInterpreter.mInstance, &mResourceBlockWise));
+#else
         SuccessOrExit(error = otCoapAddResource(mInterpreter.mInstance, &mResource));
+#endif
     }
     else
     {
@@ -119,6 +241,62 @@ exit:
     return OT_ERROR_NONE;
 }
 
+otError Coap::ProcessSet(int argc, char *argv[])
+{
+    otError    error   = OT_ERROR_NONE;
+    otMessage *message = NULL;
+
+    if (argc > 1)
+    {
+        VerifyOrExit(strlen(argv[1]) < sizeof(mResourceContent), error = OT_ERROR_INVALID_ARGS);
+        strlcpy(mResourceContent, argv[1], sizeof(mResourceContent));
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        message = otCoapNewMessage(mInterpreter.mInstance, NULL);
+        VerifyOrExit(message != NULL, error = OT_ERROR_NO_BUFS);
+
+        otCoapMessageInit(message, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_CONTENT);
+        SuccessOrExit(error = otCoapMessageSetPayloadMarker(message));
+        SuccessOrExit(
+            error = otMessageAppend(message, mResourceContent, static_cast<uint16_t>(strlen(mResourceContent))));
+
+        error = otCoapNotifyObservers(mInterpreter.mInstance, &mResource, message);
+
+        if (error == OT_ERROR_NONE)
+        {
+            // The message is now owned by the CoAP server.
+            message = NULL;
+        }
+        else if (error == OT_ERROR_NOT_FOUND)
+        {
+            // Nobody observes the resource.
+            error = OT_ERROR_NONE;
+        }
+#endif
+    }
+    else
+    {
+        mInterpreter.mServer->OutputFormat("%s\r\n", mResourceContent);
+    }
+
+exit:
+
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+otError Coap::ProcessCancel(int argc, char *argv[])
+{
+    OT_UNUSED_VARIABLE(argc);
+    OT_UNUSED_VARIABLE(argv);
+
+    return otCoapAbortTransaction(mInterpreter.mInstance, &Coap::HandleResponse, this);
+}
+
 otError Coap::ProcessStart(int argc, char *argv[])
 {
     OT_UNUSED_VARIABLE(argc);
@@ -132,7 +310,11 @@ otError Coap::ProcessStop(int argc, char *argv[])
     OT_UNUSED_VARIABLE(argc);
     OT_UNUSED_VARIABLE(argv);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapRemoveBlockWiseResource(mInterpreter.mInstance, &mResourceBlockWise);
+#else
     otCoapRemoveResource(mInterpreter.mInstance, &mResource);
+#endif
 
     return otCoapStop(mInterpreter.mInstance);
 }
@@ -149,6 +331,14 @@ otError Coap::ProcessRequest(int argc, char *argv[])
     otCoapType   coapType               = OT_COAP_TYPE_NON_CONFIRMABLE;
     otCoapCode   coapCode               = OT_COAP_CODE_GET;
     otIp6Address coapDestinationIp;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    bool                        coapBlock     = false;
+    otCoapBlockSize             coapBlockSize = OT_COAP_BLOCK_SIZE_16;
+    otCoapBlockwiseTransmitHook transmitHook  = NULL;
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    bool coapObserve = false;
+#endif
 
     VerifyOrExit(argc > 0, error = OT_ERROR_INVALID_ARGS);
 
@@ -169,6 +359,13 @@ otError Coap::ProcessRequest(int argc, char *argv[])
     {
         coapCode = OT_COAP_CODE_DELETE;
     }
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    else if (strcmp(argv[0], "observe") == 0)
+    {
+        coapCode    = OT_COAP_CODE_GET;
+        coapObserve = true;
+    }
+#endif
     else
     {
         ExitNow(error = OT_ERROR_INVALID_ARGS);
@@ -202,6 +399,14 @@ otError Coap::ProcessRequest(int argc, char *argv[])
         {
             coapType = OT_COAP_TYPE_CONFIRMABLE;
         }
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        else if (ParseBlockSize(argv[3], coapBlockSize) == OT_ERROR_NONE)
+        {
+            // Block-wise transfers are always confirmable, so that each block is retransmitted on its own.
+            coapType  = OT_COAP_TYPE_CONFIRMABLE;
+            coapBlock = true;
+        }
+#endif
     }
 
     message = otCoapNewMessage(mInterpreter.mInstance, NULL);
@@ -209,8 +414,51 @@ otError Coap::ProcessRequest(int argc, char *argv[])
 
     otCoapMessageInit(message, coapType, coapCode);
     otCoapMessageGenerateToken(message, ot::Coap::Message::kDefaultTokenLength);
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    if (coapObserve)
+    {
+        // Observe registration (RFC 7641), notifications are reported by `HandleResponse()` until cancelled.
+        SuccessOrExit(error = otCoapMessageAppendObserveOption(message, 0));
+    }
+#endif
+
     SuccessOrExit(error = otCoapMessageAppendUriPathOptions(message, coapUri));
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (coapBlock)
+    {
+        if (coapCode == OT_COAP_CODE_POST || coapCode == OT_COAP_CODE_PUT)
+        {
+            long blockCount = 1;
+
+            // The payload argument gives the number of blocks to send.
+            if (argc > 4)
+            {
+                SuccessOrExit(error = mInterpreter.ParseLong(argv[4], blockCount));
+                VerifyOrExit(blockCount > 0, error = OT_ERROR_INVALID_ARGS);
+            }
+
+            mBlockWiseBodyLength = static_cast<uint32_t>(blockCount) * otCoapBlockSizeFromExponent(coapBlockSize);
+
+            SuccessOrExit(error = otCoapMessageAppendBlock1Option(message, 0, true, coapBlockSize));
+            SuccessOrExit(error = otCoapMessageAppendUintOption(message, OT_COAP_OPTION_SIZE1, mBlockWiseBodyLength));
+            transmitHook = &Coap::HandleBlockTransmit;
+        }
+        else
+        {
+            SuccessOrExit(error = otCoapMessageAppendBlock2Option(message, 0, false, coapBlockSize));
+        }
+
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mPeerAddr = coapDestinationIp;
+        messageInfo.mPeerPort = OT_DEFAULT_COAP_PORT;
+
+        ExitNow(error = otCoapSendRequestBlockWise(mInterpreter.mInstance, message, &messageInfo, &Coap::HandleResponse,
+                                                   this, transmitHook, &Coap::HandleBlockReceive));
+    }
+#endif
+
     if (argc > 4)
     {
         payloadLength = static_cast<uint16_t>(strlen(argv[4]));
@@ -284,7 +532,6 @@ void Coap::HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
     otError    error           = OT_ERROR_NONE;
     otMessage *responseMessage = NULL;
     otCoapCode responseCode    = OT_COAP_CODE_EMPTY;
-    char       responseContent = '0';
 
     mInterpreter.mServer->OutputFormat("coap request from ");
     mInterpreter.OutputIp6Address(aMessageInfo->mPeerAddr);
@@ -315,6 +562,53 @@ void Coap::HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
 
     PrintPayload(aMessage);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (otCoapMessageGetCode(aMessage) == OT_COAP_CODE_GET)
+    {
+        const otCoapOption *option;
+
+        for (option = otCoapMessageGetFirstOption(aMessage); option != NULL;
+             option = otCoapMessageGetNextOption(aMessage))
+        {
+            if (option->mNumber == OT_COAP_OPTION_BLOCK2)
+            {
+                break;
+            }
+        }
+
+        if (option != NULL)
+        {
+            uint8_t         value[sizeof(uint32_t)] = {0};
+            otCoapBlockSize blockSize               = OT_COAP_BLOCK_SIZE_16;
+
+            // The client asked for a block-wise response, the blocks are provided by `HandleBlockTransmit()`.
+            VerifyOrExit(option->mLength <= sizeof(value), error = OT_ERROR_PARSE);
+            SuccessOrExit(error = otCoapMessageGetOptionValue(aMessage, value));
+
+            if (option->mLength > 0)
+            {
+                blockSize = static_cast<otCoapBlockSize>(value[option->mLength - 1] & 0x07);
+            }
+
+            responseCode    = OT_COAP_CODE_CONTENT;
+            responseMessage = otCoapNewMessage(mInterpreter.mInstance, NULL);
+            VerifyOrExit(responseMessage != NULL, error = OT_ERROR_NO_BUFS);
+
+            otCoapMessageInit(responseMessage, OT_COAP_TYPE_ACKNOWLEDGMENT, responseCode);
+            otCoapMessageSetMessageId(responseMessage, otCoapMessageGetMessageId(aMessage));
+            SuccessOrExit(error = otCoapMessageSetToken(responseMessage, otCoapMessageGetToken(aMessage),
+                                                        otCoapMessageGetTokenLength(aMessage)));
+            SuccessOrExit(error = otCoapMessageAppendBlock2Option(responseMessage, 0, true, blockSize));
+            SuccessOrExit(
+                error = otCoapMessageAppendUintOption(responseMessage, OT_COAP_OPTION_SIZE2, mBlockWiseBodyLength));
+
+            SuccessOrExit(error = otCoapSendResponseBlockWise(mInterpreter.mInstance, responseMessage, aMessageInfo,
+                                                              this, &Coap::HandleBlockTransmit));
+            ExitNow();
+        }
+    }
+#endif
+
     if (otCoapMessageGetType(aMessage) == OT_COAP_TYPE_CONFIRMABLE ||
         otCoapMessageGetCode(aMessage) == OT_COAP_CODE_GET)
     {
@@ -337,8 +631,20 @@ void Coap::HandleRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
 
         if (otCoapMessageGetCode(aMessage) == OT_COAP_CODE_GET)
         {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+            uint32_t observe;
+
+            // Only succeeds when the request carries an Observe registration.
+            if (otCoapAddObserver(mInterpreter.mInstance, &mResource, aMessage, aMessageInfo, &observe) ==
+                OT_ERROR_NONE)
+            {
+                SuccessOrExit(error = otCoapMessageAppendObserveOption(responseMessage, observe));
+            }
+#endif
+
             SuccessOrExit(error = otCoapMessageSetPayloadMarker(responseMessage));
-            SuccessOrExit(error = otMessageAppend(responseMessage, &responseContent, sizeof(responseContent)));
+            SuccessOrExit(error = otMessageAppend(responseMessage, mResourceContent,
+                                                  static_cast<uint16_t>(strlen(mResourceContent))));
         }
 
         SuccessOrExit(error = otCoapSendResponse(mInterpreter.mInstance, responseMessage, aMessageInfo));
@@ -382,6 +688,66 @@ void Coap::HandleResponse(otMessage *aMessage, const otMessageInfo *aMessageInfo
     }
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError Coap::HandleBlockReceive(void *         aContext,
+                                 const uint8_t *aBlock,
+                                 uint32_t       aPosition,
+                                 uint16_t       aBlockLength,
+                                 bool           aMore,
+                                 uint32_t       aTotalLength)
+{
+    return static_cast<Coap *>(aContext)->HandleBlockReceive(aBlock, aPosition, aBlockLength, aMore, aTotalLength);
+}
+
+otError Coap::HandleBlockReceive(const uint8_t *aBlock,
+                                 uint32_t       aPosition,
+                                 uint16_t       aBlockLength,
+                                 bool           aMore,
+                                 uint32_t       aTotalLength)
+{
+    OT_UNUSED_VARIABLE(aTotalLength);
+
+    PrintBlock(aBlock, aPosition, aBlockLength, aMore);
+
+    return OT_ERROR_NONE;
+}
+
+otError Coap::HandleBlockTransmit(void *    aContext,
+                                  uint8_t * aBlock,
+                                  uint32_t  aPosition,
+                                  uint16_t *aBlockLength,
+                                  bool *    aMore)
+{
+    return static_cast<Coap *>(aContext)->HandleBlockTransmit(aBlock, aPosition, aBlockLength, aMore);
+}
+
+otError Coap::HandleBlockTransmit(uint8_t *aBlock, uint32_t aPosition, uint16_t *aBlockLength, bool *aMore)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aPosition < mBlockWiseBodyLength, error = OT_ERROR_INVALID_ARGS);
+
+    if (mBlockWiseBodyLength - aPosition <= *aBlockLength)
+    {
+        *aBlockLength = static_cast<uint16_t>(mBlockWiseBodyLength - aPosition);
+        *aMore        = false;
+    }
+    else
+    {
+        *aMore = true;
+    }
+
+    // Fill the block with a test pattern derived from the position in the body.
+    for (uint16_t i = 0; i < *aBlockLength; i++)
+    {
+        aBlock[i] = static_cast<uint8_t>(aPosition + i);
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
 } // namespace Cli
 } // namespace ot
 
@@ -72,8 +72,9 @@ public:
 private:
     enum
     {
-        kMaxUriLength  = 32,
-        kMaxBufferSize = 16
+        kMaxUriLength               = 32,
+        kMaxBufferSize              = 16,
+        kDefaultBlockWiseBodyLength = 2048,
     };
 
     struct Command
@@ -83,10 +84,17 @@ private:
     };
 
     void PrintPayload(otMessage *aMessage) const;
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    void           PrintBlock(const uint8_t *aBlock, uint32_t aPosition, uint16_t aBlockLength, bool aMore) const;
+    static otError ParseBlockSize(const char *aArgs, otCoapBlockSize &aSize);
+#endif
 
+    otError ProcessCancel(int argc, char *argv[]);
+    otError ProcessCounters(int argc, char *argv[]);
     otError ProcessHelp(int argc, char *argv[]);
     otError ProcessRequest(int argc, char *argv[]);
     otError ProcessResource(int argc, char *argv[]);
+    otError ProcessSet(int argc, char *argv[]);
     otError ProcessStart(int argc, char *argv[]);
     otError ProcessStop(int argc, char *argv[]);
 
@@ -96,11 +104,37 @@ private:
     static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aError);
     void        HandleResponse(otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aError);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    static otError HandleBlockReceive(void *         aContext,
+                                      const uint8_t *aBlock,
+                                      uint32_t       aPosition,
+                                      uint16_t       aBlockLength,
+                                      bool           aMore,
+                                      uint32_t       aTotalLength);
+    otError        HandleBlockReceive(const uint8_t *aBlock,
+                                      uint32_t       aPosition,
+                                      uint16_t       aBlockLength,
+                                      bool           aMore,
+                                      uint32_t       aTotalLength);
+
+    static otError HandleBlockTransmit(void *    aContext,
+                                       uint8_t * aBlock,
+                                       uint32_t  aPosition,
+                                       uint16_t *aBlockLength,
+                                       bool *    aMore);
+    otError        HandleBlockTransmit(uint8_t *aBlock, uint32_t aPosition, uint16_t *aBlockLength, bool *aMore);
+#endif
+
     static const Command sCommands[];
     Interpreter &        mInterpreter;
 
     otCoapResource mResource;
-    char           mUriPath[kMaxUriLength];
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapBlockwiseResource mResourceBlockWise;
+    uint32_t                mBlockWiseBodyLength;
+#endif
+    char mUriPath[kMaxUriLength];
+    char mResourceContent[kMaxBufferSize];
 };
 
 } // namespace Cli
@@ -114,6 +114,23 @@ otError otCoapMessageAppendUriQueryOption(otMessage *aMessage, const char *aUriQ
     return static_cast<Coap::Message *>(aMessage)->AppendUriQueryOption(aUriQuery);
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapMessageAppendBlock1Option(otMessage *aMessage, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Message *>(aMessage)->AppendBlockOption(OT_COAP_OPTION_BLOCK1, aNum, aMore, aSize);
+}
+
+otError otCoapMessageAppendBlock2Option(otMessage *aMessage, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    return static_cast<Coap::Message *>(aMessage)->AppendBlockOption(OT_COAP_OPTION_BLOCK2, aNum, aMore, aSize);
+}
+
+uint16_t otCoapBlockSizeFromExponent(otCoapBlockSize aSize)
+{
+    return Coap::Message::BlockSizeFromExponent(aSize);
+}
+#endif
+
 otError otCoapMessageSetPayloadMarker(otMessage *aMessage)
 {
     return static_cast<Coap::Message *>(aMessage)->SetPayloadMarker();
@@ -182,6 +199,23 @@ otError otCoapSendRequest(otInstance *          aInstance,
                                                      aContext);
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapSendRequestBlockWise(otInstance *                aInstance,
+                                   otMessage *                 aMessage,
+                                   const otMessageInfo *       aMessageInfo,
+                                   otCoapResponseHandler       aHandler,
+                                   void *                      aContext,
+                                   otCoapBlockwiseTransmitHook aTransmitHook,
+                                   otCoapBlockwiseReceiveHook  aReceiveHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendMessage(*static_cast<Coap::Message *>(aMessage),
+                                                     *static_cast<const Ip6::MessageInfo *>(aMessageInfo), aHandler,
+                                                     aContext, aTransmitHook, aReceiveHook);
+}
+#endif
+
 otError otCoapStart(otInstance *aInstance, uint16_t aPort)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -210,6 +244,22 @@ void otCoapRemoveResource(otInstance *aInstance, otCoapResource *aResource)
     instance.GetApplicationCoap().RemoveResource(*static_cast<Coap::Resource *>(aResource));
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AddBlockWiseResource(*static_cast<Coap::ResourceBlockWise *>(aResource));
+}
+
+void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetApplicationCoap().RemoveBlockWiseResource(*static_cast<Coap::ResourceBlockWise *>(aResource));
+}
+#endif
+
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -225,4 +275,63 @@ otError otCoapSendResponse(otInstance *aInstance, otMessage *aMessage, const otM
                                                      *static_cast<const Ip6::MessageInfo *>(aMessageInfo));
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError otCoapSendResponseBlockWise(otInstance *                aInstance,
+                                    otMessage *                 aMessage,
+                                    const otMessageInfo *       aMessageInfo,
+                                    void *                      aContext,
+                                    otCoapBlockwiseTransmitHook aTransmitHook)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().SendMessage(*static_cast<Coap::Message *>(aMessage),
+                                                     *static_cast<const Ip6::MessageInfo *>(aMessageInfo), NULL,
+                                                     aContext, aTransmitHook, NULL);
+}
+#endif
+
+otError otCoapAbortTransaction(otInstance *aInstance, otCoapResponseHandler aHandler, void *aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AbortTransaction(aHandler, aContext);
+}
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+otError otCoapAddObserver(otInstance *          aInstance,
+                          const otCoapResource *aResource,
+                          otMessage *           aRequest,
+                          const otMessageInfo * aMessageInfo,
+                          uint32_t *            aObserve)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().AddObserver(*static_cast<const Coap::Resource *>(aResource),
+                                                     *static_cast<Coap::Message *>(aRequest),
+                                                     *static_cast<const Ip6::MessageInfo *>(aMessageInfo), *aObserve);
+}
+
+otError otCoapNotifyObservers(otInstance *aInstance, const otCoapResource *aResource, otMessage *aMessage)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.GetApplicationCoap().NotifyObservers(*static_cast<const Coap::Resource *>(aResource),
+                                                         *static_cast<Coap::Message *>(aMessage));
+}
+#endif
+
+const otCoapCounters *otCoapGetCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetApplicationCoap().GetCounters();
+}
+
+void otCoapResetCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.GetApplicationCoap().ResetCounters();
+}
+
 #endif // OPENTHREAD_CONFIG_COAP_API_ENABLE
@@ -81,6 +81,16 @@ otError otCommissionerAddJoiner(otInstance *aInstance, const otExtAddress *aEui6
                                                            aTimeout);
 }
 
+otError otCommissionerAddJoiners(otInstance *                aInstance,
+                                 const otCommissionerJoiner *aJoiners,
+                                 uint16_t                    aNumJoiners,
+                                 uint32_t                    aTimeout)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<MeshCoP::Commissioner>().AddJoiners(aJoiners, aNumJoiners, aTimeout);
+}
+
 otError otCommissionerRemoveJoiner(otInstance *aInstance, const otExtAddress *aEui64)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -187,9 +197,9 @@ otError otCommissionerGeneratePSKc(otInstance *           aInstance,
                                    const otExtendedPanId *aExtPanId,
                                    uint8_t *              aPSKc)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    Instance &instance = *static_cast<Instance *>(aInstance);
 
-    return MeshCoP::Commissioner::GeneratePSKc(aPassPhrase, aNetworkName,
-                                               *static_cast<const Mac::ExtendedPanId *>(aExtPanId), aPSKc);
+    return instance.Get<MeshCoP::Commissioner>().GetPSKc(aPassPhrase, aNetworkName,
+                                                         *static_cast<const Mac::ExtendedPanId *>(aExtPanId), aPSKc);
 }
 #endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
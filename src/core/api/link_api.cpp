@@ -173,6 +173,36 @@ otError otLinkSetPollPeriod(otInstance *aInstance, uint32_t aPollPeriod)
     return instance.Get<DataPollSender>().SetExternalPollPeriod(aPollPeriod);
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+uint32_t otLinkGetPollLatencyBudget(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<DataPollSender>().GetLatencyBudget();
+}
+
+otError otLinkSetPollLatencyBudget(otInstance *aInstance, uint32_t aLatency)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<DataPollSender>().SetLatencyBudget(aLatency);
+}
+
+void otLinkGetPollStats(otInstance *aInstance, otPollStats *aStats)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<DataPollSender>().GetPollStats(*aStats);
+}
+
+void otLinkResetPollStats(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<DataPollSender>().ResetPollStats();
+}
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+
 otError otLinkSendDataRequest(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
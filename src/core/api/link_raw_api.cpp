@@ -100,6 +100,11 @@ otError otLinkRawReceive(otInstance *aInstance, otLinkRawReceiveDone aCallback)
     return static_cast<Instance *>(aInstance)->Get<Mac::LinkRaw>().Receive(aCallback);
 }
 
+otError otLinkRawReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask, otLinkRawReceiveDone aCallback)
+{
+    return static_cast<Instance *>(aInstance)->Get<Mac::LinkRaw>().ReceiveMultiChannel(aChannelMask, aCallback);
+}
+
 otRadioFrame *otLinkRawGetTransmitBuffer(otInstance *aInstance)
 {
     return &static_cast<Instance *>(aInstance)->Get<Mac::LinkRaw>().GetTransmitFrame();
@@ -34,6 +34,8 @@
 #include "openthread-core-config.h"
 
 #include <openthread/logging.h>
+
+#include "common/binary_log.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 
@@ -54,3 +56,29 @@ void otLoggingSetLevel(otLogLevel aLogLevel)
     Instance::Get().SetLogLevel(aLogLevel);
 }
 #endif
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+void otLoggingBinarySetHandler(otLoggingBinaryHandler aHandler, void *aContext)
+{
+    BinaryLog::SetHandler(aHandler, aContext);
+}
+
+uint16_t otLoggingBinaryRead(uint8_t *aBuffer, uint16_t aLength)
+{
+    return BinaryLog::Read(aBuffer, aLength);
+}
+
+otError otLoggingBinaryDecode(const uint8_t *        aRecord,
+                              uint16_t               aLength,
+                              otLogBinaryRecordInfo *aInfo,
+                              char *                 aString,
+                              uint16_t               aSize)
+{
+    return BinaryLog::Decode(aRecord, aLength, *aInfo, aString, aSize);
+}
+
+uint32_t otLoggingBinaryGetDropCount(void)
+{
+    return BinaryLog::GetDropCount();
+}
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
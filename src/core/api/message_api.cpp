@@ -218,4 +218,27 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+void otMessageSetLatencyCallback(otInstance *aInstance, otMessageLatencyCallback aCallback, void *aContext)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Utils::LatencyTracer>().SetCallback(aCallback, aContext);
+}
+
+const otMessageLatencyHistogram *otMessageGetLatencyHistogram(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Utils::LatencyTracer>().GetHistogram();
+}
+
+void otMessageResetLatencyHistogram(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Utils::LatencyTracer>().ResetHistogram();
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -34,6 +34,7 @@
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
 #include "common/random.hpp"
+#include "common/tlvs.hpp"
 #include "net/ip6.hpp"
 #include "net/udp6.hpp"
 #include "thread/thread_netif.hpp"
@@ -49,7 +50,13 @@ namespace Coap {
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
     , mRetransmissionTimer(aInstance, &Coap::HandleRetransmissionTimer, this)
-    , mResources(NULL)
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    , mBlockWiseResources(NULL)
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    , mObserveTimer(aInstance, &Coap::HandleObserveTimer, this)
+    , mObserveSequence(0)
+#endif
     , mContext(NULL)
     , mInterceptor(NULL)
     , mResponsesQueue(aInstance)
@@ -57,7 +64,26 @@ CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     , mDefaultHandlerContext(NULL)
     , mSender(aSender)
 {
+    memset(mResources, 0, sizeof(mResources));
+    memset(&mCounters, 0, sizeof(mCounters));
     mMessageId = Random::NonCrypto::GetUint16();
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mRttEntries); i++)
+    {
+        mRttEntries[i].mInUse = false;
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        mObservers[i].mResource     = NULL;
+        mObservers[i].mNotification = NULL;
+        mObservers[i].mCoapBase     = this;
+        mObservers[i].mInFlight     = false;
+    }
+#endif
 }
 
 void CoapBase::ClearRequestsAndResponses(void)
@@ -66,6 +92,20 @@ void CoapBase::ClearRequestsAndResponses(void)
     Message *    messageToRemove;
     CoapMetadata coapMetadata;
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    RemoveObservers(NULL);
+    mObserveTimer.Stop();
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // Remove the waiting messages first, so that none is sent when the pending messages are removed.
+    while ((messageToRemove = static_cast<Message *>(mWaitingRequests.GetHead())) != NULL)
+    {
+        coapMetadata.ReadFrom(*messageToRemove);
+        FinalizeCoapTransaction(*messageToRemove, coapMetadata, NULL, NULL, OT_ERROR_ABORT);
+    }
+#endif
+
     // Remove all pending messages.
     while (message != NULL)
     {
@@ -79,17 +119,33 @@ void CoapBase::ClearRequestsAndResponses(void)
     mResponsesQueue.DequeueAllResponses();
 }
 
+uint8_t CoapBase::GetResourceBucket(const char *aUriPath)
+{
+    uint16_t hash = 0;
+
+    OT_STATIC_ASSERT((kResourceHashBuckets & (kResourceHashBuckets - 1)) == 0,
+                     "OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS must be a power of two");
+
+    while (*aUriPath != '\0')
+    {
+        hash = static_cast<uint16_t>((hash << 5) + hash + static_cast<uint8_t>(*aUriPath++));
+    }
+
+    return static_cast<uint8_t>((hash ^ (hash >> 8)) & (kResourceHashBuckets - 1));
+}
+
 otError CoapBase::AddResource(Resource &aResource)
 {
-    otError error = OT_ERROR_NONE;
+    otError    error = OT_ERROR_NONE;
+    Resource *&head  = mResources[GetResourceBucket(aResource.mUriPath)];
 
-    for (Resource *cur = mResources; cur; cur = cur->GetNext())
+    for (Resource *cur = head; cur; cur = cur->GetNext())
     {
         VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
     }
 
-    aResource.mNext = mResources;
-    mResources      = &aResource;
+    aResource.mNext = head;
+    head            = &aResource;
 
 exit:
     return error;
@@ -97,13 +153,58 @@ exit:
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
-    if (mResources == &aResource)
+    Resource *&head = mResources[GetResourceBucket(aResource.mUriPath)];
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    RemoveObservers(&aResource);
+#endif
+
+    if (head == &aResource)
+    {
+        head = aResource.GetNext();
+    }
+    else
+    {
+        for (Resource *cur = head; cur; cur = cur->GetNext())
+        {
+            if (cur->mNext == &aResource)
+            {
+                cur->mNext = aResource.mNext;
+                ExitNow();
+            }
+        }
+    }
+
+exit:
+    aResource.mNext = NULL;
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError CoapBase::AddBlockWiseResource(ResourceBlockWise &aResource)
+{
+    otError error = OT_ERROR_NONE;
+
+    for (ResourceBlockWise *cur = mBlockWiseResources; cur; cur = cur->GetNext())
+    {
+        VerifyOrExit(cur != &aResource, error = OT_ERROR_ALREADY);
+    }
+
+    aResource.mNext     = mBlockWiseResources;
+    mBlockWiseResources = &aResource;
+
+exit:
+    return error;
+}
+
+void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
+{
+    if (mBlockWiseResources == &aResource)
     {
-        mResources = aResource.GetNext();
+        mBlockWiseResources = aResource.GetNext();
     }
     else
     {
-        for (Resource *cur = mResources; cur; cur = cur->GetNext())
+        for (ResourceBlockWise *cur = mBlockWiseResources; cur; cur = cur->GetNext())
         {
             if (cur->mNext == &aResource)
             {
@@ -116,6 +217,12 @@ void CoapBase::RemoveResource(Resource &aResource)
 exit:
     aResource.mNext = NULL;
 }
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+void CoapBase::ResetCounters(void)
+{
+    memset(&mCounters, 0, sizeof(mCounters));
+}
 
 void CoapBase::SetDefaultHandler(otCoapRequestHandler aHandler, void *aContext)
 {
@@ -134,16 +241,41 @@ exit:
     return message;
 }
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 otError CoapBase::SendMessage(Message &               aMessage,
                               const Ip6::MessageInfo &aMessageInfo,
                               otCoapResponseHandler   aHandler,
                               void *                  aContext)
+{
+    return SendMessage(aMessage, aMessageInfo, aHandler, aContext, NULL, NULL);
+}
+
+otError CoapBase::SendMessage(Message &                   aMessage,
+                              const Ip6::MessageInfo &    aMessageInfo,
+                              otCoapResponseHandler       aHandler,
+                              void *                      aContext,
+                              otCoapBlockwiseTransmitHook aTransmitHook,
+                              otCoapBlockwiseReceiveHook  aReceiveHook)
+#else
+otError CoapBase::SendMessage(Message &               aMessage,
+                              const Ip6::MessageInfo &aMessageInfo,
+                              otCoapResponseHandler   aHandler,
+                              void *                  aContext)
+#endif
 {
     otError      error;
     CoapMetadata coapMetadata;
     Message *    storedCopy = NULL;
     uint16_t     copyLength = 0;
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    if (aTransmitHook != NULL)
+    {
+        // The block payload MUST be in place before a response is cached below.
+        SuccessOrExit(error = FillBlock(aMessage, aTransmitHook, aContext));
+    }
+#endif
+
     if ((aMessage.GetType() == OT_COAP_TYPE_ACKNOWLEDGMENT || aMessage.GetType() == OT_COAP_TYPE_RESET) &&
         aMessage.GetCode() != OT_COAP_CODE_EMPTY)
     {
@@ -168,17 +300,66 @@ otError CoapBase::SendMessage(Message &               aMessage,
     {
         // As we do not retransmit non confirmable messages, create a copy of header only, for token information.
         copyLength = aMessage.GetOptionStart();
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        if (aReceiveHook != NULL)
+        {
+            // Keep the options as well, they are needed to request the next blocks of the response.
+            copyLength = aMessage.GetHeaderLength();
+        }
+#endif
     }
 
     if (copyLength > 0)
     {
         coapMetadata = CoapMetadata(aMessage.IsConfirmable(), aMessageInfo, aHandler, aContext);
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        coapMetadata.mBlockwiseTransmitHook = aMessage.IsRequest() ? aTransmitHook : NULL;
+        coapMetadata.mBlockwiseReceiveHook  = aReceiveHook;
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        {
+            uint32_t observe;
+
+            coapMetadata.mObserve = (aMessage.GetCode() == OT_COAP_CODE_GET &&
+                                     aMessage.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE &&
+                                     observe == kObserveRegister);
+        }
+#endif
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        if (coapMetadata.mConfirmable && !coapMetadata.mDestinationAddress.IsMulticast())
+        {
+            RttEntry &rttEntry = GetRttEntry(coapMetadata.mDestinationAddress);
+            uint32_t  rto      = rttEntry.mEstimator.GetRto(coapMetadata.mTransmitTime);
+
+            coapMetadata.mRetransmissionTimeout = CoapMetadata::GetInitialTimeout(rto);
+            coapMetadata.mNextTimerShot         = coapMetadata.mTransmitTime + coapMetadata.mRetransmissionTimeout;
+            coapMetadata.mBackoffFactor         = RttEstimator::GetBackoffFactor(rto);
+
+            if (GetOutstandingCount(coapMetadata.mDestinationAddress) >= kNStart)
+            {
+                // Hold the message back until an outstanding message to the destination completes.
+                VerifyOrExit((storedCopy = CopyMessage(aMessage, copyLength, coapMetadata)) != NULL,
+                             error = OT_ERROR_NO_BUFS);
+                mWaitingRequests.Enqueue(*storedCopy);
+
+                mCounters.mTxDelayed++;
+                aMessage.Free();
+                ExitNow(error = OT_ERROR_NONE);
+            }
+        }
+#endif
         VerifyOrExit((storedCopy = CopyAndEnqueueMessage(aMessage, copyLength, coapMetadata)) != NULL,
                      error = OT_ERROR_NO_BUFS);
     }
 
     SuccessOrExit(error = Send(aMessage, aMessageInfo));
 
+    if (coapMetadata.mConfirmable)
+    {
+        mCounters.mTxConfirmable++;
+    }
+
 exit:
 
     if (error != OT_ERROR_NONE && storedCopy != NULL)
@@ -214,24 +395,22 @@ exit:
     return error;
 }
 
-otError CoapBase::SendHeaderResponse(Message::Code aCode, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+otError CoapBase::InitResponseHeader(Message &aResponse, Message::Code aCode, const Message &aRequest)
 {
-    otError  error   = OT_ERROR_NONE;
-    Message *message = NULL;
+    otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aRequest.IsRequest(), error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
 
     switch (aRequest.GetType())
     {
     case OT_COAP_TYPE_CONFIRMABLE:
-        message->Init(OT_COAP_TYPE_ACKNOWLEDGMENT, aCode);
-        message->SetMessageId(aRequest.GetMessageId());
+        aResponse.Init(OT_COAP_TYPE_ACKNOWLEDGMENT, aCode);
+        aResponse.SetMessageId(aRequest.GetMessageId());
         break;
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
-        message->Init(OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
-        message->SetMessageId(mMessageId++);
+        aResponse.Init(OT_COAP_TYPE_NON_CONFIRMABLE, aCode);
+        aResponse.SetMessageId(mMessageId++);
         break;
 
     default:
@@ -239,7 +418,21 @@ otError CoapBase::SendHeaderResponse(Message::Code aCode, const Message &aReques
         break;
     }
 
-    SuccessOrExit(error = message->SetToken(aRequest.GetToken(), aRequest.GetTokenLength()));
+    error = aResponse.SetToken(aRequest.GetToken(), aRequest.GetTokenLength());
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendHeaderResponse(Message::Code aCode, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    otError  error   = OT_ERROR_NONE;
+    Message *message = NULL;
+
+    VerifyOrExit(aRequest.IsRequest(), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = InitResponseHeader(*message, aCode, aRequest));
 
     SuccessOrExit(error = SendMessage(*message, aMessageInfo));
 
@@ -272,6 +465,15 @@ void CoapBase::HandleRetransmissionTimer(void)
         nextMessage = static_cast<Message *>(message->GetNext());
         coapMetadata.ReadFrom(*message);
 
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        if (coapMetadata.mObserveEstablished)
+        {
+            // An established observation awaits notifications until it is cancelled.
+            message = nextMessage;
+            continue;
+        }
+#endif
+
         if (coapMetadata.IsLater(now))
         {
             uint32_t diff = TimerMilli::Elapsed(now, coapMetadata.mNextTimerShot);
@@ -285,7 +487,12 @@ void CoapBase::HandleRetransmissionTimer(void)
         {
             // Increment retransmission counter and timer.
             coapMetadata.mRetransmissionCount++;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+            coapMetadata.mRetransmissionTimeout = coapMetadata.mRetransmissionTimeout * coapMetadata.mBackoffFactor /
+                                                  RttEstimator::kBackoffFactorDivisor;
+#else
             coapMetadata.mRetransmissionTimeout *= 2;
+#endif
             coapMetadata.mNextTimerShot = now + coapMetadata.mRetransmissionTimeout;
             coapMetadata.UpdateIn(*message);
 
@@ -303,10 +510,16 @@ void CoapBase::HandleRetransmissionTimer(void)
                 messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
 
                 SendCopy(*message, messageInfo);
+                mCounters.mTxRetransmissions++;
             }
         }
         else
         {
+            if (coapMetadata.mConfirmable && !coapMetadata.mAcknowledged)
+            {
+                mCounters.mTxTimeouts++;
+            }
+
             // No expected response or acknowledgment.
             FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, OT_ERROR_RESPONSE_TIMEOUT);
         }
@@ -316,7 +529,8 @@ void CoapBase::HandleRetransmissionTimer(void)
 
     if (nextDelta != TimerMilli::kForeverDt)
     {
-        mRetransmissionTimer.Start(nextDelta);
+        // Messages sent by the response handlers may have set the timer already.
+        StartRetransmissionTimer(nextDelta);
     }
 }
 
@@ -328,6 +542,10 @@ void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
 {
     DequeueMessage(aRequest);
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    SendWaitingRequests();
+#endif
+
     if (aCoapMetadata.mResponseHandler != NULL)
     {
         aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, aResponse, aMessageInfo, aResult);
@@ -341,6 +559,21 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
     Message *    nextMessage;
     CoapMetadata coapMetadata;
 
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // Abort the waiting messages first, so that none of them is sent when a pending message is aborted.
+    for (message = static_cast<Message *>(mWaitingRequests.GetHead()); message != NULL; message = nextMessage)
+    {
+        nextMessage = static_cast<Message *>(message->GetNext());
+        coapMetadata.ReadFrom(*message);
+
+        if (coapMetadata.mResponseHandler == aHandler && coapMetadata.mResponseContext == aContext)
+        {
+            FinalizeCoapTransaction(*message, coapMetadata, NULL, NULL, OT_ERROR_ABORT);
+            error = OT_ERROR_NONE;
+        }
+    }
+#endif
+
     for (message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL; message = nextMessage)
     {
         nextMessage = static_cast<Message *>(message->GetNext());
@@ -356,9 +589,7 @@ otError CoapBase::AbortTransaction(otCoapResponseHandler aHandler, void *aContex
     return error;
 }
 
-Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
-                                         uint16_t            aCopyLength,
-                                         const CoapMetadata &aCoapMetadata)
+Message *CoapBase::CopyMessage(const Message &aMessage, uint16_t aCopyLength, const CoapMetadata &aCoapMetadata)
 {
     otError  error       = OT_ERROR_NONE;
     Message *messageCopy = NULL;
@@ -369,41 +600,52 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
     // Append the copy with retransmission data.
     SuccessOrExit(error = aCoapMetadata.AppendTo(*messageCopy));
 
-    // Setup the timer.
-    if (mRetransmissionTimer.IsRunning())
-    {
-        uint32_t alarmFireTime;
-
-        // If timer is already running, check if it should be restarted with earlier fire time.
-        alarmFireTime = mRetransmissionTimer.GetFireTime();
+exit:
 
-        if (aCoapMetadata.IsEarlier(alarmFireTime))
-        {
-            mRetransmissionTimer.Start(aCoapMetadata.mRetransmissionTimeout);
-        }
-    }
-    else
+    if (error != OT_ERROR_NONE && messageCopy != NULL)
     {
-        mRetransmissionTimer.Start(aCoapMetadata.mRetransmissionTimeout);
+        messageCopy->Free();
+        messageCopy = NULL;
     }
 
+    return messageCopy;
+}
+
+Message *CoapBase::CopyAndEnqueueMessage(const Message &     aMessage,
+                                         uint16_t            aCopyLength,
+                                         const CoapMetadata &aCoapMetadata)
+{
+    Message *messageCopy;
+
+    VerifyOrExit((messageCopy = CopyMessage(aMessage, aCopyLength, aCoapMetadata)) != NULL);
+
+    StartRetransmissionTimer(aCoapMetadata.mRetransmissionTimeout);
+
     // Enqueue the message.
     mPendingRequests.Enqueue(*messageCopy);
 
 exit:
+    return messageCopy;
+}
 
-    if (error != OT_ERROR_NONE && messageCopy != NULL)
+void CoapBase::StartRetransmissionTimer(uint32_t aDelay)
+{
+    // If timer is already running, check if it should be restarted with earlier fire time.
+    if (!mRetransmissionTimer.IsRunning() ||
+        static_cast<int32_t>(TimerMilli::GetNow() + aDelay - mRetransmissionTimer.GetFireTime()) < 0)
     {
-        messageCopy->Free();
-        messageCopy = NULL;
+        mRetransmissionTimer.Start(aDelay);
     }
-
-    return messageCopy;
 }
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // The message is either pending or waiting for an outstanding message to complete.
+    aMessage.GetMessageQueue()->Dequeue(aMessage);
+#else
     mPendingRequests.Dequeue(aMessage);
+#endif
 
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == NULL))
     {
@@ -440,6 +682,140 @@ exit:
     return error;
 }
 
+void CoapBase::HandleRtt(const CoapMetadata &aCoapMetadata)
+{
+    uint32_t now    = TimerMilli::GetNow();
+    uint32_t rtt    = now - aCoapMetadata.mTransmitTime;
+    uint8_t  bucket = 0;
+
+    // The round-trip time is too ambiguous after more retransmissions.
+    VerifyOrExit(aCoapMetadata.mRetransmissionCount <= RttEstimator::kMaxWeakRetransmissions);
+
+    for (uint32_t bound = kRttHistogramFirstBound; rtt >= bound && bucket < OT_COAP_RTT_HISTOGRAM_SIZE - 1; bound <<= 1)
+    {
+        bucket++;
+    }
+
+    mCounters.mRttHistogram[bucket]++;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    {
+        RttEntry *rttEntry = FindRttEntry(aCoapMetadata.mDestinationAddress);
+
+        if (rttEntry != NULL)
+        {
+            rttEntry->mEstimator.Update(rtt, aCoapMetadata.mRetransmissionCount, now);
+        }
+    }
+#endif
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+CoapBase::RttEntry *CoapBase::FindRttEntry(const Ip6::Address &aAddress)
+{
+    RttEntry *rttEntry = NULL;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mRttEntries); i++)
+    {
+        if (mRttEntries[i].mInUse && mRttEntries[i].mPeerAddress == aAddress)
+        {
+            ExitNow(rttEntry = &mRttEntries[i]);
+        }
+    }
+
+exit:
+    return rttEntry;
+}
+
+CoapBase::RttEntry &CoapBase::GetRttEntry(const Ip6::Address &aAddress)
+{
+    uint32_t  now      = TimerMilli::GetNow();
+    RttEntry *rttEntry = FindRttEntry(aAddress);
+
+    if (rttEntry == NULL)
+    {
+        // Use a free entry, or replace the least recently used one.
+        rttEntry = &mRttEntries[0];
+
+        for (size_t i = 0; i < OT_ARRAY_LENGTH(mRttEntries) && rttEntry->mInUse; i++)
+        {
+            if (!mRttEntries[i].mInUse ||
+                static_cast<int32_t>(mRttEntries[i].mLastUsed - rttEntry->mLastUsed) < 0)
+            {
+                rttEntry = &mRttEntries[i];
+            }
+        }
+
+        rttEntry->mPeerAddress = aAddress;
+        rttEntry->mInUse       = true;
+        rttEntry->mEstimator.Reset();
+    }
+
+    rttEntry->mLastUsed = now;
+
+    return *rttEntry;
+}
+
+uint8_t CoapBase::GetOutstandingCount(const Ip6::Address &aAddress) const
+{
+    uint8_t      count = 0;
+    CoapMetadata coapMetadata;
+
+    for (const Message *message = static_cast<Message *>(mPendingRequests.GetHead()); message != NULL;
+         message                = static_cast<Message *>(message->GetNext()))
+    {
+        coapMetadata.ReadFrom(*message);
+
+        if (coapMetadata.mConfirmable && !coapMetadata.mAcknowledged &&
+            coapMetadata.mDestinationAddress == aAddress)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void CoapBase::SendWaitingRequests(void)
+{
+    Message *        message;
+    Message *        nextMessage;
+    CoapMetadata     coapMetadata;
+    Ip6::MessageInfo messageInfo;
+
+    for (message = static_cast<Message *>(mWaitingRequests.GetHead()); message != NULL; message = nextMessage)
+    {
+        nextMessage = static_cast<Message *>(message->GetNext());
+        coapMetadata.ReadFrom(*message);
+
+        if (GetOutstandingCount(coapMetadata.mDestinationAddress) >= kNStart)
+        {
+            continue;
+        }
+
+        // Time the exchange from its actual first transmission.
+        coapMetadata.mTransmitTime  = TimerMilli::GetNow();
+        coapMetadata.mNextTimerShot = coapMetadata.mTransmitTime + coapMetadata.mRetransmissionTimeout;
+        coapMetadata.UpdateIn(*message);
+
+        mWaitingRequests.Dequeue(*message);
+        mPendingRequests.Enqueue(*message);
+        StartRetransmissionTimer(coapMetadata.mRetransmissionTimeout);
+
+        messageInfo.SetPeerAddr(coapMetadata.mDestinationAddress);
+        messageInfo.SetPeerPort(coapMetadata.mDestinationPort);
+        messageInfo.SetSockAddr(coapMetadata.mSourceAddress);
+
+        // A failed transmission is recovered by the retransmissions.
+        SendCopy(*message, messageInfo);
+        mCounters.mTxConfirmable++;
+    }
+}
+#endif // OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+
 Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       CoapMetadata &          aCoapMetadata)
@@ -487,6 +863,10 @@ exit:
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = static_cast<Message &>(aMessage);
+    TlvIndex tlvIndex;
+
+    // The TLVs of the payload are indexed for the request and response handlers.
+    tlvIndex.Attach(message);
 
     if (message.ParseHeader() != OT_ERROR_NONE)
     {
@@ -512,6 +892,13 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
 
     if (request == NULL)
     {
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        if (aMessage.GetType() == OT_COAP_TYPE_RESET)
+        {
+            // A reset may reject a non-confirmable notification.
+            HandleObserveReset(aMessage, aMessageInfo);
+        }
+#endif
         ExitNow();
     }
 
@@ -527,35 +914,46 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         break;
 
     case OT_COAP_TYPE_ACKNOWLEDGMENT:
-        if (aMessage.IsEmpty())
+        if (coapMetadata.mConfirmable && !coapMetadata.mAcknowledged)
         {
-            // Empty acknowledgment.
-            if (coapMetadata.mConfirmable)
-            {
-                coapMetadata.mAcknowledged = true;
-                coapMetadata.UpdateIn(*request);
-            }
+            HandleRtt(coapMetadata);
+
+            coapMetadata.mAcknowledged = true;
+            coapMetadata.UpdateIn(*request);
+        }
 
+        if (aMessage.IsEmpty())
+        {
             // Remove the message if response is not expected, otherwise await response.
             if (coapMetadata.mResponseHandler == NULL)
             {
                 DequeueMessage(*request);
             }
+            else if (request->IsResponse())
+            {
+                // A confirmable response (e.g. a notification) is complete once acknowledged.
+                FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+            }
         }
         else if (aMessage.IsResponse() && aMessage.IsTokenEqual(*request))
         {
             // Piggybacked response.
-            FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+            HandleResponse(*request, coapMetadata, aMessage, aMessageInfo);
         }
 
         // Silently ignore acknowledgments carrying requests (RFC 7252, p. 4.2)
         // or with no token match (RFC 7252, p. 5.3.2)
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        // The acknowledged message is no longer outstanding.
+        SendWaitingRequests();
+#endif
         break;
 
     case OT_COAP_TYPE_CONFIRMABLE:
         // Send empty ACK if it is a CON message.
         SendAck(aMessage, aMessageInfo);
-        FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+        HandleResponse(*request, coapMetadata, aMessage, aMessageInfo);
         break;
 
     case OT_COAP_TYPE_NON_CONFIRMABLE:
@@ -568,7 +966,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
         }
         else
         {
-            FinalizeCoapTransaction(*request, coapMetadata, &aMessage, &aMessageInfo, OT_ERROR_NONE);
+            HandleResponse(*request, coapMetadata, aMessage, aMessageInfo);
         }
 
         break;
@@ -586,44 +984,83 @@ exit:
     }
 }
 
-void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+void CoapBase::HandleResponse(Message &               aRequest,
+                              const CoapMetadata &    aCoapMetadata,
+                              Message &               aResponse,
+                              const Ip6::MessageInfo &aMessageInfo)
 {
-    char     uriPath[Resource::kMaxReceivedUriPath];
-    char *   curUriPath     = uriPath;
-    Message *cachedResponse = NULL;
-    otError  error          = OT_ERROR_NOT_FOUND;
+    otError error = OT_ERROR_NONE;
 
-    if (mInterceptor != NULL)
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    if (ProcessObserveNotification(aRequest, aCoapMetadata, aResponse, aMessageInfo))
     {
-        SuccessOrExit(error = mInterceptor(aMessage, aMessageInfo, mContext));
+        ExitNow();
     }
+#endif
 
-    switch (mResponsesQueue.GetMatchedResponseCopy(aMessage, aMessageInfo, &cachedResponse))
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    switch (error = ProcessBlockWiseResponse(aRequest, aCoapMetadata, aResponse))
     {
     case OT_ERROR_NONE:
-        error = Send(*cachedResponse, aMessageInfo);
-        // fall through
-        ;
-
-    case OT_ERROR_NO_BUFS:
+        // The request for the next block replaced this one.
+        DequeueMessage(aRequest);
         ExitNow();
 
     case OT_ERROR_NOT_FOUND:
+        // Not a block-wise exchange, or its last block.
+        error = OT_ERROR_NONE;
+        break;
+
     default:
+        otLogInfoCoapErr(error, "Failed to continue block-wise transfer");
         break;
     }
+#endif
 
-    for (const otCoapOption *option = aMessage.GetFirstOption(); option != NULL; option = aMessage.GetNextOption())
-    {
-        switch (option->mNumber)
-        {
-        case OT_COAP_OPTION_URI_PATH:
-            if (curUriPath != uriPath)
-            {
-                *curUriPath++ = '/';
-            }
+    FinalizeCoapTransaction(aRequest, aCoapMetadata, &aResponse, &aMessageInfo, error);
 
-            VerifyOrExit(option->mLength < sizeof(uriPath) - static_cast<size_t>(curUriPath + 1 - uriPath));
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE || OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+exit:
+    return;
+#endif
+}
+
+void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    char           uriPath[Resource::kMaxReceivedUriPath];
+    char *         curUriPath     = uriPath;
+    const Message *cachedResponse = NULL;
+    Message *      responseCopy   = NULL;
+    otError        error          = OT_ERROR_NOT_FOUND;
+
+    if (mInterceptor != NULL)
+    {
+        SuccessOrExit(error = mInterceptor(aMessage, aMessageInfo, mContext));
+    }
+
+    if ((cachedResponse = mResponsesQueue.FindMatchedResponse(aMessage, aMessageInfo)) != NULL)
+    {
+        // Duplicate request, retransmit the cached response. The cached message stays in the
+        // cache, only the copy handed to the lower layers is allocated here.
+        VerifyOrExit((responseCopy = cachedResponse->Clone(cachedResponse->GetLength() -
+                                                           sizeof(EnqueuedResponseHeader))) != NULL,
+                     error = OT_ERROR_NO_BUFS);
+        SuccessOrExit(error = Send(*responseCopy, aMessageInfo));
+        responseCopy = NULL;
+        ExitNow();
+    }
+
+    for (const otCoapOption *option = aMessage.GetFirstOption(); option != NULL; option = aMessage.GetNextOption())
+    {
+        switch (option->mNumber)
+        {
+        case OT_COAP_OPTION_URI_PATH:
+            if (curUriPath != uriPath)
+            {
+                *curUriPath++ = '/';
+            }
+
+            VerifyOrExit(option->mLength < sizeof(uriPath) - static_cast<size_t>(curUriPath + 1 - uriPath));
 
             aMessage.GetOptionValue(curUriPath);
             curUriPath += option->mLength;
@@ -636,7 +1073,31 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
 
     curUriPath[0] = '\0';
 
-    for (const Resource *resource = mResources; resource; resource = resource->GetNext())
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    {
+        uint32_t observe;
+
+        if (aMessage.GetCode() == OT_COAP_CODE_GET &&
+            aMessage.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE && observe == kObserveDeregister)
+        {
+            // Deregistration, the request is then processed as a plain GET (RFC 7641, section 3.6).
+            RemoveObserver(aMessage, aMessageInfo);
+        }
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    for (const ResourceBlockWise *resource = mBlockWiseResources; resource; resource = resource->GetNext())
+    {
+        if (strcmp(resource->mUriPath, uriPath) == 0)
+        {
+            error = ProcessBlockWiseRequest(*resource, aMessage, aMessageInfo);
+            ExitNow();
+        }
+    }
+#endif
+
+    for (const Resource *resource = mResources[GetResourceBucket(uriPath)]; resource; resource = resource->GetNext())
     {
         if (strcmp(resource->mUriPath, uriPath) == 0)
         {
@@ -663,13 +1124,657 @@ exit:
             SendNotFound(aMessage, aMessageInfo);
         }
 
-        if (cachedResponse != NULL)
+        if (responseCopy != NULL)
+        {
+            responseCopy->Free();
+        }
+    }
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otCoapBlockSize CoapBase::GetMaxBlockSize(void)
+{
+    uint8_t size = OT_COAP_BLOCK_SIZE_1024;
+
+    OT_STATIC_ASSERT(kMaxBlockLength >= 16 && kMaxBlockLength <= 1024 && (kMaxBlockLength & (kMaxBlockLength - 1)) == 0,
+                     "OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH must be a power of two between 16 and 1024");
+
+    while (Message::BlockSizeFromExponent(static_cast<otCoapBlockSize>(size)) > kMaxBlockLength)
+    {
+        size--;
+    }
+
+    return static_cast<otCoapBlockSize>(size);
+}
+
+otError CoapBase::FillBlock(Message &aMessage, otCoapBlockwiseTransmitHook aTransmitHook, void *aContext)
+{
+    otError         error;
+    uint16_t        number = aMessage.IsRequest() ? OT_COAP_OPTION_BLOCK1 : OT_COAP_OPTION_BLOCK2;
+    uint8_t         buf[kBlockChunkLength];
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+    uint16_t        blockLength;
+    uint16_t        length = 0;
+    uint16_t        chunkLength;
+    uint16_t        maxChunkLength;
+
+    VerifyOrExit(aMessage.ReadBlockOptionValues(number, num, more, size) == OT_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aMessage.GetLength() == aMessage.GetHeaderLength(), error = OT_ERROR_INVALID_ARGS);
+
+    // We never send blocks larger than we are able to buffer.
+    if (size > GetMaxBlockSize())
+    {
+        num <<= (size - GetMaxBlockSize());
+        size = GetMaxBlockSize();
+    }
+
+    // The option is re-encoded before the payload, since a larger block number may need a longer value. Only the
+    // More flag is updated once the block is filled, which keeps the value length.
+    SuccessOrExit(error = aMessage.UpdateBlockOption(number, num, true, size));
+
+    blockLength = Message::BlockSizeFromExponent(size);
+
+    // The block is pulled from the hook in parts, which are appended to the message as they come.
+    do
+    {
+        maxChunkLength = blockLength - length;
+
+        if (maxChunkLength > sizeof(buf))
+        {
+            maxChunkLength = sizeof(buf);
+        }
+
+        chunkLength = maxChunkLength;
+        SuccessOrExit(error = aTransmitHook(aContext, buf, num * blockLength + length, &chunkLength, &more));
+        VerifyOrExit(chunkLength <= maxChunkLength, error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(more == false || chunkLength == maxChunkLength, error = OT_ERROR_INVALID_ARGS);
+
+        if (chunkLength > 0)
+        {
+            if (length == 0)
+            {
+                SuccessOrExit(error = aMessage.SetPayloadMarker());
+            }
+
+            SuccessOrExit(error = aMessage.Append(buf, chunkLength));
+            length += chunkLength;
+        }
+    } while (more && length < blockLength);
+
+    if (!more)
+    {
+        SuccessOrExit(error = aMessage.UpdateBlockOption(number, num, false, size));
+    }
+
+exit:
+    return error;
+}
+
+otError CoapBase::PassBlock(const Message &            aMessage,
+                            otCoapBlockwiseReceiveHook aReceiveHook,
+                            void *                     aContext,
+                            uint32_t                   aPosition,
+                            uint16_t                   aLength,
+                            bool                       aMore,
+                            uint32_t                   aTotalLength)
+{
+    otError  error;
+    uint8_t  buf[kBlockChunkLength];
+    uint16_t offset = aMessage.GetOffset();
+    uint16_t chunkLength;
+
+    // The block is passed to the hook in parts, so that it is never buffered as a whole.
+    do
+    {
+        chunkLength = (aLength < sizeof(buf)) ? aLength : static_cast<uint16_t>(sizeof(buf));
+        aMessage.Read(offset, chunkLength, buf);
+        aLength -= chunkLength;
+
+        SuccessOrExit(error = aReceiveHook(aContext, buf, aPosition, chunkLength, aMore || aLength > 0, aTotalLength));
+
+        offset += chunkLength;
+        aPosition += chunkLength;
+    } while (aLength > 0);
+
+exit:
+    return error;
+}
+
+otError CoapBase::ProcessBlockWiseResponse(Message &aRequest, const CoapMetadata &aCoapMetadata, Message &aResponse)
+{
+    otError         error   = OT_ERROR_NOT_FOUND;
+    Message *       request = NULL;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+
+    VerifyOrExit(aCoapMetadata.mBlockwiseTransmitHook != NULL || aCoapMetadata.mBlockwiseReceiveHook != NULL);
+
+    // Work on a copy of the request trimmed to its header, so that neither the payload nor the appended
+    // `CoapMetadata` is mistaken for options.
+    VerifyOrExit((request = aRequest.Clone(aRequest.GetHeaderLength())) != NULL, error = OT_ERROR_NO_BUFS);
+
+    if (aCoapMetadata.mBlockwiseTransmitHook != NULL &&
+        (aResponse.GetCode() == OT_COAP_CODE_CONTINUE || aResponse.GetCode() == OT_COAP_CODE_REQUEST_TOO_LARGE))
+    {
+        uint32_t        requestNum;
+        bool            requestMore;
+        otCoapBlockSize requestSize;
+
+        SuccessOrExit(error = request->ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, requestNum, requestMore, requestSize));
+
+        // The server may ask for a smaller block size, the block number then counts smaller blocks.
+        if (aResponse.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, size) != OT_ERROR_NONE ||
+            size > requestSize)
+        {
+            size = requestSize;
+        }
+
+        if (aResponse.GetCode() == OT_COAP_CODE_CONTINUE)
+        {
+            // The server acknowledged a Block1 block and asks for the next one.
+            VerifyOrExit(requestMore, error = OT_ERROR_PARSE);
+            num = (requestNum + 1) << (requestSize - size);
+        }
+        else
+        {
+            // The block was too large for the server, it is sent again in blocks of the size the server indicated
+            // (RFC 7959, section 2.9.3). Without a smaller size, the response completes the transaction.
+            VerifyOrExit(size < requestSize, error = OT_ERROR_NOT_FOUND);
+            num = requestNum << (requestSize - size);
+        }
+
+        SuccessOrExit(error = SendNextBlockRequest(*request, aCoapMetadata, OT_COAP_OPTION_BLOCK1, num, size));
+    }
+    else if (aCoapMetadata.mBlockwiseReceiveHook != NULL &&
+             aResponse.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, size) == OT_ERROR_NONE)
+    {
+        uint16_t length      = aResponse.GetLength() - aResponse.GetOffset();
+        uint32_t totalLength = 0;
+
+        VerifyOrExit(length <= Message::BlockSizeFromExponent(size), error = OT_ERROR_PARSE);
+        VerifyOrExit(!more || length == Message::BlockSizeFromExponent(size), error = OT_ERROR_PARSE);
+
+        aResponse.ReadUintOption(OT_COAP_OPTION_SIZE2, totalLength);
+
+        SuccessOrExit(error = PassBlock(aResponse, aCoapMetadata.mBlockwiseReceiveHook, aCoapMetadata.mResponseContext,
+                                        num * Message::BlockSizeFromExponent(size), length, more, totalLength));
+
+        // The response carrying the last block completes the transaction.
+        VerifyOrExit(more, error = OT_ERROR_NOT_FOUND);
+
+        SuccessOrExit(error = SendNextBlockRequest(*request, aCoapMetadata, OT_COAP_OPTION_BLOCK2, num + 1, size));
+    }
+
+exit:
+
+    if (request != NULL)
+    {
+        request->Free();
+    }
+
+    return error;
+}
+
+otError CoapBase::SendNextBlockRequest(Message &           aRequest,
+                                       const CoapMetadata &aCoapMetadata,
+                                       uint16_t            aNumber,
+                                       uint32_t            aNum,
+                                       otCoapBlockSize     aSize)
+{
+    otError          error   = OT_ERROR_NONE;
+    Message *        message = NULL;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    message->SetLinkSecurityEnabled(aRequest.IsLinkSecurityEnabled());
+    SuccessOrExit(error = message->SetPriority(aRequest.GetPriority()));
+
+    // Each block is sent as a new request, with a new Message ID but the same Token.
+    message->Init(aRequest.GetType(), aRequest.GetCode());
+    SuccessOrExit(error = message->SetToken(aRequest.GetToken(), aRequest.GetTokenLength()));
+    SuccessOrExit(error = message->AppendOptionsWithBlock(aRequest, aNumber, aNum, aNumber == OT_COAP_OPTION_BLOCK1,
+                                                          aSize));
+
+    messageInfo.SetPeerAddr(aCoapMetadata.mDestinationAddress);
+    messageInfo.SetPeerPort(aCoapMetadata.mDestinationPort);
+    messageInfo.SetSockAddr(aCoapMetadata.mSourceAddress);
+
+    SuccessOrExit(error = SendMessage(*message, messageInfo, aCoapMetadata.mResponseHandler,
+                                      aCoapMetadata.mResponseContext,
+                                      (aNumber == OT_COAP_OPTION_BLOCK1) ? aCoapMetadata.mBlockwiseTransmitHook : NULL,
+                                      aCoapMetadata.mBlockwiseReceiveHook));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+otError CoapBase::ProcessBlockWiseRequest(const ResourceBlockWise &aResource,
+                                          Message &                aMessage,
+                                          const Ip6::MessageInfo & aMessageInfo)
+{
+    otError         error = OT_ERROR_NONE;
+    uint32_t        num;
+    bool            more;
+    otCoapBlockSize size;
+
+    if (aResource.mReceiveHook != NULL &&
+        aMessage.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, size) == OT_ERROR_NONE)
+    {
+        uint16_t length      = aMessage.GetLength() - aMessage.GetOffset();
+        uint32_t totalLength = 0;
+
+        if (size > GetMaxBlockSize())
+        {
+            // Ask the client to continue with blocks we are able to buffer (RFC 7959, section 2.9.3).
+            ExitNow(error = SendBlockResponse(OT_COAP_CODE_REQUEST_TOO_LARGE, aMessage, aMessageInfo,
+                                              OT_COAP_OPTION_BLOCK1, 0, GetMaxBlockSize(), NULL, NULL));
+        }
+
+        if (length > Message::BlockSizeFromExponent(size) || (more && length != Message::BlockSizeFromExponent(size)))
+        {
+            ExitNow(error = SendHeaderResponse(OT_COAP_CODE_BAD_REQUEST, aMessage, aMessageInfo));
+        }
+
+        aMessage.ReadUintOption(OT_COAP_OPTION_SIZE1, totalLength);
+
+        if (PassBlock(aMessage, aResource.mReceiveHook, aResource.mContext, num * Message::BlockSizeFromExponent(size),
+                      length, more, totalLength) != OT_ERROR_NONE)
+        {
+            ExitNow(error = SendHeaderResponse(OT_COAP_CODE_REQUEST_TOO_LARGE, aMessage, aMessageInfo));
+        }
+
+        if (more)
+        {
+            ExitNow(error = SendBlockResponse(OT_COAP_CODE_CONTINUE, aMessage, aMessageInfo, OT_COAP_OPTION_BLOCK1,
+                                              num, size, NULL, NULL));
+        }
+
+        // The last block is handed to the resource handler, which sends the final response.
+    }
+    else if (aResource.mTransmitHook != NULL &&
+             aMessage.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, size) == OT_ERROR_NONE && num > 0)
+    {
+        // Follow-up request for the next block of a block-wise response, served directly from the transmit hook.
+        ExitNow(error = SendBlockResponse(OT_COAP_CODE_CONTENT, aMessage, aMessageInfo, OT_COAP_OPTION_BLOCK2, num,
+                                          size, aResource.mTransmitHook, aResource.mContext));
+    }
+
+    aResource.HandleRequest(aMessage, aMessageInfo);
+
+exit:
+    return error;
+}
+
+otError CoapBase::SendBlockResponse(Message::Code               aCode,
+                                    const Message &             aRequest,
+                                    const Ip6::MessageInfo &    aMessageInfo,
+                                    uint16_t                    aNumber,
+                                    uint32_t                    aNum,
+                                    otCoapBlockSize             aSize,
+                                    otCoapBlockwiseTransmitHook aTransmitHook,
+                                    void *                      aContext)
+{
+    otError  error   = OT_ERROR_NONE;
+    Message *message = NULL;
+
+    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    SuccessOrExit(error = InitResponseHeader(*message, aCode, aRequest));
+    SuccessOrExit(error = message->AppendBlockOption(aNumber, aNum, aCode == OT_COAP_CODE_CONTINUE, aSize));
+
+    SuccessOrExit(error = SendMessage(*message, aMessageInfo, NULL, aContext, aTransmitHook, NULL));
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+otError CoapBase::AddObserver(const Resource &        aResource,
+                              Message &               aRequest,
+                              const Ip6::MessageInfo &aMessageInfo,
+                              uint32_t &              aObserve)
+{
+    otError   error    = OT_ERROR_NONE;
+    Observer *observer = NULL;
+    uint32_t  observe;
+
+    VerifyOrExit(aRequest.GetCode() == OT_COAP_CODE_GET, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(aRequest.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE &&
+                     observe == kObserveRegister,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    // A new registration of the same client for the same resource replaces the existing one.
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        if (mObservers[i].IsInUse())
+        {
+            if (mObservers[i].Matches(aMessageInfo, aResource))
+            {
+                observer = &mObservers[i];
+                break;
+            }
+        }
+        else if (observer == NULL)
+        {
+            observer = &mObservers[i];
+        }
+    }
+
+    VerifyOrExit(observer != NULL, error = OT_ERROR_NO_BUFS);
+
+    if (!observer->IsInUse())
+    {
+        observer->mNotification = NULL;
+        observer->mInFlight     = false;
+        observer->mMessageId    = 0;
+    }
+
+    observer->mPeerAddress = aMessageInfo.GetPeerAddr();
+    observer->mSockAddress = aMessageInfo.GetSockAddr();
+    observer->mPeerPort    = aMessageInfo.GetPeerPort();
+    observer->mResource    = &aResource;
+    observer->mTokenLength = aRequest.GetTokenLength();
+    memcpy(observer->mToken, aRequest.GetToken(), observer->mTokenLength);
+
+    // Notifications carry strictly increasing values.
+    aObserve = mObserveSequence;
+
+exit:
+    return error;
+}
+
+otError CoapBase::NotifyObservers(const Resource &aResource, Message &aMessage)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    VerifyOrExit(aMessage.GetCode() >= OT_COAP_CODE_RESPONSE_MIN && aMessage.GetCode() < OT_COAP_CODE_BAD_REQUEST,
+                 error = OT_ERROR_INVALID_ARGS);
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        if (mObservers[i].mResource == &aResource)
+        {
+            // Replaces any notification still waiting to be sent, only the latest state is of interest.
+            mObservers[i].mNotification = &aMessage;
+            error                       = OT_ERROR_NONE;
+        }
+    }
+
+    SuccessOrExit(error);
+
+    mNotifications.Enqueue(aMessage);
+    FreeUnusedNotifications();
+
+    if (!mObserveTimer.IsRunning())
+    {
+        mObserveTimer.Start(kObserveCoalescingInterval);
+    }
+
+exit:
+    return error;
+}
+
+bool CoapBase::IsObserveFresh(uint32_t aLastSequence, uint32_t aSequence)
+{
+    // RFC 7641, section 3.4 (the 128 seconds rule is not applied).
+    return (aLastSequence < aSequence && aSequence - aLastSequence < kObserveSequenceHalfRange) ||
+           (aLastSequence > aSequence && aLastSequence - aSequence > kObserveSequenceHalfRange);
+}
+
+bool CoapBase::ProcessObserveNotification(Message &               aRequest,
+                                          const CoapMetadata &    aCoapMetadata,
+                                          Message &               aResponse,
+                                          const Ip6::MessageInfo &aMessageInfo)
+{
+    bool         handled      = false;
+    CoapMetadata coapMetadata = aCoapMetadata;
+    uint32_t     observe;
+
+    VerifyOrExit(aCoapMetadata.mObserve && aCoapMetadata.mResponseHandler != NULL);
+
+    // Responses without an Observe option, or with an error code, end the observation.
+    VerifyOrExit(aResponse.GetCode() < OT_COAP_CODE_BAD_REQUEST);
+    VerifyOrExit(aResponse.ReadUintOption(OT_COAP_OPTION_OBSERVE, observe) == OT_ERROR_NONE);
+
+    handled = true;
+
+    // Notifications older than the latest one are dropped.
+    VerifyOrExit(!aCoapMetadata.mObserveEstablished || IsObserveFresh(aCoapMetadata.mObserveSequence, observe));
+
+    coapMetadata.mObserveSequence    = observe;
+    coapMetadata.mObserveEstablished = true;
+    coapMetadata.mAcknowledged       = true;
+    coapMetadata.UpdateIn(aRequest);
+
+    aCoapMetadata.mResponseHandler(aCoapMetadata.mResponseContext, &aResponse, &aMessageInfo, OT_ERROR_NONE);
+
+exit:
+    return handled;
+}
+
+void CoapBase::RemoveObserver(Observer &aObserver)
+{
+    bool inFlight = aObserver.mInFlight;
+
+    aObserver.mResource     = NULL;
+    aObserver.mNotification = NULL;
+    aObserver.mInFlight     = false;
+
+    if (inFlight)
+    {
+        AbortTransaction(&CoapBase::HandleNotificationResult, &aObserver);
+    }
+
+    FreeUnusedNotifications();
+}
+
+void CoapBase::RemoveObservers(const Resource *aResource)
+{
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        if (mObservers[i].IsInUse() && (aResource == NULL || mObservers[i].mResource == aResource))
+        {
+            RemoveObserver(mObservers[i]);
+        }
+    }
+}
+
+void CoapBase::RemoveObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo)
+{
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        Observer &observer = mObservers[i];
+
+        if (observer.IsInUse() && observer.mPeerAddress == aMessageInfo.GetPeerAddr() &&
+            observer.mPeerPort == aMessageInfo.GetPeerPort() && observer.mTokenLength == aRequest.GetTokenLength() &&
+            memcmp(observer.mToken, aRequest.GetToken(), observer.mTokenLength) == 0)
+        {
+            RemoveObserver(observer);
+        }
+    }
+}
+
+void CoapBase::HandleObserveReset(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        Observer &observer = mObservers[i];
+
+        if (observer.IsInUse() && observer.mMessageId == aMessage.GetMessageId() &&
+            observer.mPeerAddress == aMessageInfo.GetPeerAddr())
+        {
+            otLogInfoCoap("Observer rejected notification, removed");
+            RemoveObserver(observer);
+        }
+    }
+}
+
+void CoapBase::FreeUnusedNotifications(void)
+{
+    Message *message = static_cast<Message *>(mNotifications.GetHead());
+    Message *nextMessage;
+
+    for (; message != NULL; message = nextMessage)
+    {
+        bool used = false;
+
+        nextMessage = static_cast<Message *>(message->GetNext());
+
+        for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
         {
-            cachedResponse->Free();
+            if (mObservers[i].mNotification == message)
+            {
+                used = true;
+                break;
+            }
+        }
+
+        if (!used)
+        {
+            mNotifications.Dequeue(*message);
+            message->Free();
         }
     }
 }
 
+otError CoapBase::SendNotification(Observer &aObserver)
+{
+    otError          error        = OT_ERROR_NONE;
+    Message &        notification = *aObserver.mNotification;
+    uint16_t         length       = notification.GetLength() - notification.GetHeaderLength();
+    Message *        message      = NULL;
+    uint16_t         messageId;
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrExit((message = NewMessage()) != NULL, error = OT_ERROR_NO_BUFS);
+
+    message->SetLinkSecurityEnabled(notification.IsLinkSecurityEnabled());
+    SuccessOrExit(error = message->SetPriority(notification.GetPriority()));
+
+    messageId = mMessageId++;
+    message->Init(notification.GetType(), notification.GetCode());
+    message->SetMessageId(messageId);
+    SuccessOrExit(error = message->SetToken(aObserver.mToken, aObserver.mTokenLength));
+
+    mObserveSequence = (mObserveSequence + 1) & kObserveSequenceMask;
+    SuccessOrExit(error = message->AppendOptionsWithObserve(notification, mObserveSequence));
+
+    if (length > 0)
+    {
+        SuccessOrExit(error = message->SetPayloadMarker());
+        SuccessOrExit(error = message->SetLength(message->GetLength() + length));
+        notification.CopyTo(notification.GetHeaderLength(), message->GetLength() - length, length, *message);
+    }
+
+    messageInfo.SetPeerAddr(aObserver.mPeerAddress);
+    messageInfo.SetPeerPort(aObserver.mPeerPort);
+    messageInfo.SetSockAddr(aObserver.mSockAddress);
+
+    if (message->IsConfirmable())
+    {
+        SuccessOrExit(error = SendMessage(*message, messageInfo, &CoapBase::HandleNotificationResult, &aObserver));
+        aObserver.mInFlight = true;
+    }
+    else
+    {
+        SuccessOrExit(error = SendMessage(*message, messageInfo));
+    }
+
+    aObserver.mMessageId    = messageId;
+    aObserver.mNotification = NULL;
+
+exit:
+
+    if (error != OT_ERROR_NONE && message != NULL)
+    {
+        message->Free();
+    }
+
+    return error;
+}
+
+void CoapBase::HandleObserveTimer(Timer &aTimer)
+{
+    static_cast<Coap *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleObserveTimer();
+}
+
+void CoapBase::HandleObserveTimer(void)
+{
+    bool retry = false;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mObservers); i++)
+    {
+        Observer &observer = mObservers[i];
+
+        // Observers still awaiting an acknowledgment get the latest state once it arrives.
+        if (observer.IsInUse() && observer.mNotification != NULL && !observer.mInFlight &&
+            SendNotification(observer) != OT_ERROR_NONE)
+        {
+            retry = true;
+        }
+    }
+
+    FreeUnusedNotifications();
+
+    if (retry)
+    {
+        mObserveTimer.Start(TimerMilli::SecToMsec(kAckTimeout));
+    }
+}
+
+void CoapBase::HandleNotificationResult(void *               aContext,
+                                        otMessage *          aMessage,
+                                        const otMessageInfo *aMessageInfo,
+                                        otError              aResult)
+{
+    Observer &observer = *static_cast<Observer *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    observer.mCoapBase->HandleNotificationResult(observer, aResult);
+}
+
+void CoapBase::HandleNotificationResult(Observer &aObserver, otError aResult)
+{
+    // The entry may have been removed since the notification was sent.
+    VerifyOrExit(aObserver.IsInUse() && aObserver.mInFlight);
+
+    aObserver.mInFlight = false;
+
+    if (aResult != OT_ERROR_NONE)
+    {
+        otLogInfoCoapErr(aResult, "Notification failed, observer removed");
+        RemoveObserver(aObserver);
+    }
+    else if (aObserver.mNotification != NULL && !mObserveTimer.IsRunning())
+    {
+        mObserveTimer.Start(kObserveCoalescingInterval);
+    }
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+
 CoapMetadata::CoapMetadata(bool                    aConfirmable,
                            const Ip6::MessageInfo &aMessageInfo,
                            otCoapResponseHandler   aHandler,
@@ -681,24 +1786,140 @@ CoapMetadata::CoapMetadata(bool                    aConfirmable,
     mResponseHandler       = aHandler;
     mResponseContext       = aContext;
     mRetransmissionCount   = 0;
-    mRetransmissionTimeout = TimerMilli::SecToMsec(kAckTimeout);
-    mRetransmissionTimeout += Random::NonCrypto::GetUint32InRange(
-        0, TimerMilli::SecToMsec(kAckTimeout) * kAckRandomFactorNumerator / kAckRandomFactorDenominator -
-               TimerMilli::SecToMsec(kAckTimeout) + 1);
+    mRetransmissionTimeout = GetInitialTimeout(TimerMilli::SecToMsec(kAckTimeout));
+    mTransmitTime          = TimerMilli::GetNow();
 
     if (aConfirmable)
     {
         // Set next retransmission timeout.
-        mNextTimerShot = TimerMilli::GetNow() + mRetransmissionTimeout;
+        mNextTimerShot = mTransmitTime + mRetransmissionTimeout;
     }
     else
     {
         // Set overall response timeout.
-        mNextTimerShot = TimerMilli::GetNow() + kMaxTransmitWait;
+        mNextTimerShot = mTransmitTime + kMaxTransmitWait;
     }
 
     mAcknowledged = false;
     mConfirmable  = aConfirmable;
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    // Binary exponential backoff (RFC 7252) unless the destination has an RTT estimate.
+    mBackoffFactor = 2 * RttEstimator::kBackoffFactorDivisor;
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    mObserveSequence    = 0;
+    mObserve            = false;
+    mObserveEstablished = false;
+#endif
+}
+
+uint32_t CoapMetadata::GetInitialTimeout(uint32_t aRetransmissionTimeout)
+{
+    // Random value between the timeout and ACK_RANDOM_FACTOR times the timeout.
+    return aRetransmissionTimeout +
+           Random::NonCrypto::GetUint32InRange(0, aRetransmissionTimeout * kAckRandomFactorNumerator /
+                                                          kAckRandomFactorDenominator -
+                                                      aRetransmissionTimeout + 1);
+}
+
+void RttEstimator::Reset(void)
+{
+    mRto          = kDefaultRto;
+    mLastUpdate   = TimerMilli::GetNow();
+    mStrongSrtt   = 0;
+    mStrongRttVar = 0;
+    mWeakSrtt     = 0;
+    mWeakRttVar   = 0;
+    mStrongValid  = false;
+    mWeakValid    = false;
+}
+
+uint32_t RttEstimator::GetRto(uint32_t aNow)
+{
+    uint32_t age = aNow - mLastUpdate;
+
+    if (mRto < kSmallRto && age >= kSmallRtoAgingMultiple * mRto)
+    {
+        mRto *= 2;
+        mLastUpdate = aNow;
+    }
+    else if (mRto > kLargeRto && age >= kLargeRtoAgingMultiple * mRto)
+    {
+        mRto        = (mRto + kDefaultRto) / 2;
+        mLastUpdate = aNow;
+    }
+
+    return mRto;
+}
+
+void RttEstimator::Update(uint32_t aRtt, uint8_t aRetransmissionCount, uint32_t aNow)
+{
+    uint32_t estimate;
+
+    VerifyOrExit(aRetransmissionCount <= kMaxWeakRetransmissions);
+
+    if (aRetransmissionCount == 0)
+    {
+        estimate = Estimate(mStrongSrtt, mStrongRttVar, mStrongValid, aRtt, kStrongK);
+        mRto     = (estimate + mRto) / 2;
+    }
+    else
+    {
+        estimate = Estimate(mWeakSrtt, mWeakRttVar, mWeakValid, aRtt, kWeakK);
+        mRto     = (estimate + 3 * mRto) / 4;
+    }
+
+    if (mRto < kMinRto)
+    {
+        mRto = kMinRto;
+    }
+    else if (mRto > kMaxRto)
+    {
+        mRto = kMaxRto;
+    }
+
+    mLastUpdate = aNow;
+
+exit:
+    return;
+}
+
+uint32_t RttEstimator::Estimate(uint32_t &aSrtt, uint32_t &aRttVar, bool &aValid, uint32_t aRtt, uint8_t aK)
+{
+    // RFC 6298, with the RTTVAR multiplier K of the estimator.
+    if (aValid)
+    {
+        uint32_t delta = (aSrtt > aRtt) ? (aSrtt - aRtt) : (aRtt - aSrtt);
+
+        aRttVar = (3 * aRttVar + delta) / 4;
+        aSrtt   = (7 * aSrtt + aRtt) / 8;
+    }
+    else
+    {
+        aSrtt   = aRtt;
+        aRttVar = aRtt / 2;
+        aValid  = true;
+    }
+
+    return aSrtt + aK * aRttVar;
+}
+
+uint8_t RttEstimator::GetBackoffFactor(uint32_t aRto)
+{
+    uint8_t factor = 2 * kBackoffFactorDivisor;
+
+    if (aRto < kSmallRto)
+    {
+        factor = 3 * kBackoffFactorDivisor;
+    }
+    else if (aRto > kLargeRto)
+    {
+        factor = 3 * kBackoffFactorDivisor / 2;
+    }
+
+    return factor;
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
@@ -707,73 +1928,49 @@ ResponsesQueue::ResponsesQueue(Instance &aInstance)
 {
 }
 
-otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
-                                               const Ip6::MessageInfo &aMessageInfo,
-                                               Message **              aResponse)
+const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
 {
-    otError                error = OT_ERROR_NOT_FOUND;
-    Message *              message;
+    const Message *        message;
+    uint16_t               messageId = aRequest.GetMessageId();
     EnqueuedResponseHeader enqueuedResponseHeader;
-    Ip6::MessageInfo       messageInfo;
 
-    for (message = static_cast<Message *>(mQueue.GetHead()); message != NULL;
-         message = static_cast<Message *>(message->GetNext()))
+    for (message = static_cast<const Message *>(mQueue.GetHead()); message != NULL;
+         message = static_cast<const Message *>(message->GetNext()))
     {
-        enqueuedResponseHeader.ReadFrom(*message);
-        messageInfo = enqueuedResponseHeader.GetMessageInfo();
-
-        // Check source endpoint
-        if (messageInfo.GetPeerPort() != aMessageInfo.GetPeerPort())
+        // Check Message Id first, it is kept in the CoAP header help data and needs no read from the message buffers.
+        if (message->GetMessageId() != messageId)
         {
             continue;
         }
 
-        if (messageInfo.GetPeerAddr() != aMessageInfo.GetPeerAddr())
+        enqueuedResponseHeader.ReadFrom(*message);
+
+        // Check source endpoint
+        if (enqueuedResponseHeader.GetMessageInfo().GetPeerPort() != aMessageInfo.GetPeerPort())
         {
             continue;
         }
 
-        // Check Message Id
-        if (message->GetMessageId() != aRequest.GetMessageId())
+        if (enqueuedResponseHeader.GetMessageInfo().GetPeerAddr() != aMessageInfo.GetPeerAddr())
         {
             continue;
         }
 
-        VerifyOrExit((*aResponse = message->Clone(message->GetLength() - sizeof(EnqueuedResponseHeader))) != NULL,
-                     error = OT_ERROR_NO_BUFS);
-
-        error = OT_ERROR_NONE;
         break;
     }
 
-exit:
-    return error;
+    return message;
 }
 
 void ResponsesQueue::EnqueueResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    otError                error          = OT_ERROR_NONE;
-    Message *              cachedResponse = NULL;
-    Message *              responseCopy   = NULL;
+    otError                error        = OT_ERROR_NONE;
+    Message *              responseCopy = NULL;
     EnqueuedResponseHeader enqueuedResponseHeader(aMessageInfo);
     uint16_t               messageCount;
     uint16_t               bufferCount;
 
-    switch (GetMatchedResponseCopy(aMessage, aMessageInfo, &cachedResponse))
-    {
-    case OT_ERROR_NOT_FOUND:
-        break;
-
-    case OT_ERROR_NONE:
-        assert(cachedResponse != NULL);
-        cachedResponse->Free();
-
-        // fall through
-
-    case OT_ERROR_NO_BUFS:
-    default:
-        ExitNow();
-    }
+    VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == NULL);
 
     mQueue.GetInfo(messageCount, bufferCount);
 
@@ -68,7 +68,7 @@ enum
     kAckRandomFactorNumerator   = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_NUMERATOR,
     kAckRandomFactorDenominator = OPENTHREAD_CONFIG_COAP_ACK_RANDOM_FACTOR_DENOMINATOR,
     kMaxRetransmit              = OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT,
-    kNStart                     = 1,
+    kNStart                     = OPENTHREAD_CONFIG_COAP_NSTART,
     kDefaultLeisure             = 5,
     kProbingRate                = 1,
 
@@ -104,9 +104,24 @@ public:
         , mResponseContext(NULL)
         , mNextTimerShot(0)
         , mRetransmissionTimeout(0)
+        , mTransmitTime(0)
         , mRetransmissionCount(0)
         , mAcknowledged(false)
-        , mConfirmable(false){};
+        , mConfirmable(false)
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        , mBackoffFactor(0)
+#endif
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        , mBlockwiseTransmitHook(NULL)
+        , mBlockwiseReceiveHook(NULL)
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        , mObserveSequence(0)
+        , mObserve(false)
+        , mObserveEstablished(false)
+#endif
+    {
+    }
 
     /**
      * This constructor initializes the object with specific values.
@@ -180,6 +195,8 @@ public:
     bool IsLater(uint32_t aTime) const { return (static_cast<int32_t>(aTime - mNextTimerShot) < 0); }
 
 private:
+    static uint32_t GetInitialTimeout(uint32_t aRetransmissionTimeout);
+
     Ip6::Address          mSourceAddress;         ///< IPv6 address of the message source.
     Ip6::Address          mDestinationAddress;    ///< IPv6 address of the message destination.
     uint16_t              mDestinationPort;       ///< UDP port of the message destination.
@@ -187,11 +204,113 @@ private:
     void *                mResponseContext;       ///< A pointer to arbitrary context information.
     uint32_t              mNextTimerShot;         ///< Time when the timer should shoot for this message.
     uint32_t              mRetransmissionTimeout; ///< Delay that is applied to next retransmission.
+    uint32_t              mTransmitTime;          ///< Time of the first transmission.
     uint8_t               mRetransmissionCount;   ///< Number of retransmissions.
     bool                  mAcknowledged : 1;      ///< Information that request was acknowledged.
     bool                  mConfirmable : 1;       ///< Information that message is confirmable.
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    uint8_t mBackoffFactor; ///< Factor applied to the timeout on each retransmission, in halves.
+#endif
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    otCoapBlockwiseTransmitHook mBlockwiseTransmitHook; ///< Provides the next Block1 block, NULL if not block-wise.
+    otCoapBlockwiseReceiveHook  mBlockwiseReceiveHook;  ///< Consumes received Block2 blocks, NULL if not block-wise.
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    uint32_t mObserveSequence;        ///< Observe option value of the latest notification.
+    bool     mObserve : 1;            ///< Information that the request is an Observe registration (RFC 7641).
+    bool     mObserveEstablished : 1; ///< Information that a notification was received for the registration.
+#endif
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements the round-trip time estimation of a destination, as specified by CoCoA
+ * (draft-ietf-core-cocoa).
+ *
+ * The retransmission timeout (RTO) is derived from two estimators: a strong one, fed with round-trip times of
+ * messages acknowledged without retransmission, and a weak one, fed with round-trip times of messages acknowledged
+ * after one or two retransmissions, measured from the first transmission.
+ *
+ */
+class RttEstimator
+{
+public:
+    enum
+    {
+        kDefaultRto             = kAckTimeout * 1000, ///< Initial RTO (in milliseconds).
+        kMinRto                 = 100,                ///< Lower bound of the RTO (in milliseconds).
+        kMaxRto                 = 60000,              ///< Upper bound of the RTO (in milliseconds).
+        kMaxWeakRetransmissions = 2,                  ///< Retransmissions after which a round-trip time is ignored.
+        kBackoffFactorDivisor   = 2,                  ///< Divisor of the values returned by GetBackoffFactor().
+    };
+
+    /**
+     * This constructor initializes the estimator.
+     *
+     */
+    RttEstimator(void) { Reset(); }
+
+    /**
+     * This method discards all measurements and restores the default RTO.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method returns the RTO.
+     *
+     * An RTO below 1 second is doubled, and an RTO above 3 seconds moves half-way to the default RTO, when it was not
+     * updated for respectively 16 or 4 times its value.
+     *
+     * @param[in]  aNow  The current time (in milliseconds).
+     *
+     * @returns The RTO (in milliseconds).
+     *
+     */
+    uint32_t GetRto(uint32_t aNow);
+
+    /**
+     * This method updates the RTO with a round-trip time measurement.
+     *
+     * @param[in]  aRtt                  The round-trip time (in milliseconds) from the first transmission.
+     * @param[in]  aRetransmissionCount  The number of retransmissions before the acknowledgment.
+     * @param[in]  aNow                  The current time (in milliseconds).
+     *
+     */
+    void Update(uint32_t aRtt, uint8_t aRetransmissionCount, uint32_t aNow);
+
+    /**
+     * This method returns the variable backoff factor applied to the timeout of each retransmission.
+     *
+     * @param[in]  aRto  The RTO used for the first transmission (in milliseconds).
+     *
+     * @returns The backoff factor, in halves (3 for 1.5, 4 for 2, 6 for 3).
+     *
+     */
+    static uint8_t GetBackoffFactor(uint32_t aRto);
+
+private:
+    enum
+    {
+        kStrongK               = 4,    // RTTVAR multiplier of the strong estimator.
+        kWeakK                 = 1,    // RTTVAR multiplier of the weak estimator.
+        kSmallRto              = 1000, // RTO below which the backoff is faster and the RTO ages up.
+        kLargeRto              = 3000, // RTO above which the backoff is slower and the RTO ages down.
+        kSmallRtoAgingMultiple = 16,   // Age of a small RTO (in multiples of the RTO) before it is doubled.
+        kLargeRtoAgingMultiple = 4,    // Age of a large RTO (in multiples of the RTO) before it is reduced.
+    };
+
+    static uint32_t Estimate(uint32_t &aSrtt, uint32_t &aRttVar, bool &aValid, uint32_t aRtt, uint8_t aK);
+
+    uint32_t mRto;
+    uint32_t mLastUpdate;
+    uint32_t mStrongSrtt;
+    uint32_t mStrongRttVar;
+    uint32_t mWeakSrtt;
+    uint32_t mWeakRttVar;
+    bool     mStrongValid;
+    bool     mWeakValid;
+};
+
 /**
  * This class implements CoAP resource handling.
  *
@@ -244,6 +363,115 @@ private:
     }
 };
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+/**
+ * This class implements CoAP resource handling with block-wise transfer (RFC 7959) support.
+ *
+ */
+class ResourceBlockWise : public otCoapBlockwiseResource
+{
+    friend class CoapBase;
+
+public:
+    /**
+     * This constructor initializes the resource.
+     *
+     * @param[in]  aUriPath       A pointer to a NULL-terminated string for the Uri-Path.
+     * @param[in]  aHandler       A function pointer that is called when receiving a CoAP message for @p aUriPath.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     * @param[in]  aReceiveHook   A function pointer that is called with each received Block1 block.
+     * @param[in]  aTransmitHook  A function pointer that is called to provide Block2 blocks.
+     *
+     */
+    ResourceBlockWise(const char *                aUriPath,
+                      otCoapRequestHandler        aHandler,
+                      void *                      aContext,
+                      otCoapBlockwiseReceiveHook  aReceiveHook,
+                      otCoapBlockwiseTransmitHook aTransmitHook)
+    {
+        mUriPath      = aUriPath;
+        mHandler      = aHandler;
+        mContext      = aContext;
+        mReceiveHook  = aReceiveHook;
+        mTransmitHook = aTransmitHook;
+        mNext         = NULL;
+    }
+
+    /**
+     * This method returns a pointer to the next resource.
+     *
+     * @returns A Pointer to the next resource.
+     *
+     */
+    ResourceBlockWise *GetNext(void) const { return static_cast<ResourceBlockWise *>(mNext); }
+
+    /**
+     * This method returns a pointer to the Uri-Path.
+     *
+     * @returns A Pointer to the Uri-Path.
+     *
+     */
+    const char *GetUriPath(void) const { return mUriPath; }
+
+private:
+    void HandleRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
+    {
+        mHandler(mContext, &aMessage, &aMessageInfo);
+    }
+};
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+class CoapBase;
+
+/**
+ * This class represents a client observing a CoAP resource (RFC 7641).
+ *
+ */
+class Observer
+{
+    friend class CoapBase;
+
+public:
+    /**
+     * This method indicates whether or not the entry is in use.
+     *
+     * @retval TRUE   If the entry is in use.
+     * @retval FALSE  If the entry is free.
+     *
+     */
+    bool IsInUse(void) const { return mResource != NULL; }
+
+    /**
+     * This method indicates whether or not the entry matches a given client and resource.
+     *
+     * @param[in]  aMessageInfo  The message info identifying the client.
+     * @param[in]  aResource     The resource.
+     *
+     * @retval TRUE   If the entry matches @p aMessageInfo and @p aResource.
+     * @retval FALSE  Otherwise.
+     *
+     */
+    bool Matches(const Ip6::MessageInfo &aMessageInfo, const Resource &aResource) const
+    {
+        return mResource == &aResource && mPeerAddress == aMessageInfo.GetPeerAddr() &&
+               mPeerPort == aMessageInfo.GetPeerPort();
+    }
+
+private:
+    Ip6::Address    mPeerAddress;                     ///< IPv6 address of the client.
+    Ip6::Address    mSockAddress;                     ///< Local IPv6 address the registration was received on.
+    uint16_t        mPeerPort;                        ///< UDP port of the client.
+    uint16_t        mMessageId;                       ///< Message ID of the latest notification.
+    const Resource *mResource;                        ///< The observed resource, NULL if the entry is free.
+    Message *       mNotification;                    ///< Notification waiting to be sent, NULL if none.
+    CoapBase *      mCoapBase;                        ///< The CoAP server owning the entry.
+    uint8_t         mToken[OT_COAP_MAX_TOKEN_LENGTH]; ///< Token of the registration.
+    uint8_t         mTokenLength;                     ///< Token length of the registration.
+    bool            mInFlight;                        ///< A confirmable notification awaits acknowledgment.
+};
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+
 /**
  * This class implements metadata required for caching CoAP responses.
  *
@@ -369,18 +597,17 @@ public:
     void DequeueAllResponses(void);
 
     /**
-     * Get a copy of CoAP response from the cache that matches given Message ID and source endpoint.
+     * Find a CoAP response in the cache that matches given Message ID and source endpoint.
+     *
+     * The returned message remains owned by the cache. Its length includes the trailing `EnqueuedResponseHeader`.
      *
      * @param[in]  aRequest      The CoAP message containing Message ID.
      * @param[in]  aMessageInfo  The message info containing source endpoint address and port.
-     * @param[out] aResponse     A pointer to a copy of a cached CoAP response matching given arguments.
      *
-     * @retval OT_ERROR_NONE       Matching response found and successfully created a copy.
-     * @retval OT_ERROR_NO_BUFS    Matching response found but there is not sufficient buffer to create a copy.
-     * @retval OT_ERROR_NOT_FOUND  Matching response not found.
+     * @returns A pointer to the cached CoAP response matching given arguments, or NULL if not found.
      *
      */
-    otError GetMatchedResponseCopy(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo, Message **aResponse);
+    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
 
     /**
      * Get a reference to the cached CoAP responses queue.
@@ -471,6 +698,27 @@ public:
      */
     void RemoveResource(Resource &aResource);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method adds a block-wise resource to the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     * @retval OT_ERROR_NONE     Successfully added @p aResource.
+     * @retval OT_ERROR_ALREADY  The @p aResource was already added.
+     *
+     */
+    otError AddBlockWiseResource(ResourceBlockWise &aResource);
+
+    /**
+     * This method removes a block-wise resource from the CoAP server.
+     *
+     * @param[in]  aResource  A reference to the resource.
+     *
+     */
+    void RemoveBlockWiseResource(ResourceBlockWise &aResource);
+#endif
+
     /* This function sets the default handler for unhandled CoAP requests.
      *
      * @param[in]  aHandler   A function pointer that shall be called when an unhandled request arrives.
@@ -512,6 +760,38 @@ public:
                         otCoapResponseHandler   aHandler = NULL,
                         void *                  aContext = NULL);
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method sends a CoAP message using block-wise transfer (RFC 7959).
+     *
+     * If @p aTransmitHook is not NULL, @p aMessage MUST carry a Block1 option (for a request) or a Block2 option (for
+     * a response) as its last option and no payload. The payload of the block indicated by that option is pulled from
+     * @p aTransmitHook. For a request, the remaining blocks are sent once the server acknowledges each block with
+     * 2.31 Continue.
+     *
+     * If @p aReceiveHook is not NULL, the blocks of a response carrying a Block2 option are passed to
+     * @p aReceiveHook and the remaining blocks are requested automatically.
+     *
+     * @param[in]  aMessage       A reference to the message to send.
+     * @param[in]  aMessageInfo   A reference to the message info associated with @p aMessage.
+     * @param[in]  aHandler       A function pointer that shall be called on response reception or time-out.
+     * @param[in]  aContext       A pointer to arbitrary context information.
+     * @param[in]  aTransmitHook  A function pointer that is called to provide the block payload, or NULL.
+     * @param[in]  aReceiveHook   A function pointer that is called with each received Block2 block, or NULL.
+     *
+     * @retval OT_ERROR_NONE          Successfully sent CoAP message.
+     * @retval OT_ERROR_NO_BUFS       Failed to allocate retransmission data.
+     * @retval OT_ERROR_INVALID_ARGS  @p aTransmitHook is given but @p aMessage does not carry a Block option.
+     *
+     */
+    otError SendMessage(Message &                   aMessage,
+                        const Ip6::MessageInfo &    aMessageInfo,
+                        otCoapResponseHandler       aHandler,
+                        void *                      aContext,
+                        otCoapBlockwiseTransmitHook aTransmitHook,
+                        otCoapBlockwiseReceiveHook  aReceiveHook);
+#endif
+
     /**
      * This method sends a CoAP reset message.
      *
@@ -605,6 +885,66 @@ public:
      */
     otError AbortTransaction(otCoapResponseHandler aHandler, void *aContext);
 
+    /**
+     * This method returns the transmission counters.
+     *
+     * @returns A reference to the transmission counters.
+     *
+     */
+    const otCoapCounters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the transmission counters.
+     *
+     */
+    void ResetCounters(void);
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    /**
+     * This method registers the sender of a GET request with an Observe option value of 0 as an observer of a
+     * resource (RFC 7641).
+     *
+     * This method is called by the resource handler when it accepts the registration. The response MUST then carry
+     * an Observe option with the value returned in @p aObserve. An existing registration of the same client for the
+     * same resource is replaced.
+     *
+     * @param[in]   aResource     The observed resource.
+     * @param[in]   aRequest      The registration request.
+     * @param[in]   aMessageInfo  The message info associated with @p aRequest.
+     * @param[out]  aObserve      The Observe option value to include in the response.
+     *
+     * @retval OT_ERROR_NONE          Successfully registered the observer.
+     * @retval OT_ERROR_INVALID_ARGS  @p aRequest is not an Observe registration.
+     * @retval OT_ERROR_NO_BUFS       The observer table is full, the request should be answered as a plain GET.
+     *
+     */
+    otError AddObserver(const Resource &        aResource,
+                        Message &               aRequest,
+                        const Ip6::MessageInfo &aMessageInfo,
+                        uint32_t &              aObserve);
+
+    /**
+     * This method notifies the observers of a resource of a new resource state.
+     *
+     * @p aMessage is a template holding the Type, Code, options and payload of the notifications. Its Token and
+     * Observe option are set for each observer. Notifications are sent after
+     * `OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL`, a template passed in the meantime replaces this one.
+     * A confirmable notification is not sent to an observer before the previous one was acknowledged, and an
+     * observer is removed when it rejects a notification or a confirmable notification times out.
+     *
+     * On success, this method takes ownership of @p aMessage.
+     *
+     * @param[in]  aResource  The resource whose state changed.
+     * @param[in]  aMessage   The notification template.
+     *
+     * @retval OT_ERROR_NONE          Successfully scheduled the notifications.
+     * @retval OT_ERROR_INVALID_ARGS  The Code of @p aMessage is not a 2.xx success code.
+     * @retval OT_ERROR_NOT_FOUND     The resource has no observers.
+     *
+     */
+    otError NotifyObservers(const Resource &aResource, Message &aMessage);
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+
     /**
      * This method sets interceptor to be called before processing a CoAP packet.
      *
@@ -655,11 +995,54 @@ protected:
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
+    enum
+    {
+        kResourceHashBuckets = OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS,
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+        kMaxBlockLength   = OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH,
+        kBlockChunkLength = 64, ///< Block payloads are passed to and from the hooks in parts of this length.
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+        kMaxObservers              = OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS,
+        kObserveCoalescingInterval = OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL,
+        kObserveSequenceMask       = 0xffffff,
+        kObserveSequenceHalfRange  = 1 << 23,
+        kObserveRegister           = 0,
+        kObserveDeregister         = 1,
+#endif
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+        kMaxRttDestinations = OPENTHREAD_CONFIG_COAP_MAX_RTT_DESTINATIONS,
+#endif
+        kRttHistogramFirstBound = 64, // Upper bound (in milliseconds) of the first RTT histogram bucket.
+    };
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    struct RttEntry
+    {
+        Ip6::Address mPeerAddress;
+        RttEstimator mEstimator;
+        uint32_t     mLastUsed;
+        bool         mInUse;
+    };
+#endif
+
+    static uint8_t GetResourceBucket(const char *aUriPath);
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
+    Message *CopyMessage(const Message &aMessage, uint16_t aCopyLength, const CoapMetadata &aCoapMetadata);
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const CoapMetadata &aCoapMetadata);
+    void     StartRetransmissionTimer(uint32_t aDelay);
     void     DequeueMessage(Message &aMessage);
+    void     HandleRtt(const CoapMetadata &aCoapMetadata);
+
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    RttEntry *FindRttEntry(const Ip6::Address &aAddress);
+    RttEntry &GetRttEntry(const Ip6::Address &aAddress);
+    uint8_t   GetOutstandingCount(const Ip6::Address &aAddress) const;
+    void      SendWaitingRequests(void);
+#endif
     Message *FindRelatedRequest(const Message &         aResponse,
                                 const Ip6::MessageInfo &aMessageInfo,
                                 CoapMetadata &          aCoapMetadata);
@@ -671,6 +1054,66 @@ private:
 
     void ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void HandleResponse(Message &               aRequest,
+                        const CoapMetadata &    aCoapMetadata,
+                        Message &               aResponse,
+                        const Ip6::MessageInfo &aMessageInfo);
+
+    otError InitResponseHeader(Message &aResponse, Message::Code aCode, const Message &aRequest);
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    static otCoapBlockSize GetMaxBlockSize(void);
+
+    otError FillBlock(Message &aMessage, otCoapBlockwiseTransmitHook aTransmitHook, void *aContext);
+    otError PassBlock(const Message &            aMessage,
+                      otCoapBlockwiseReceiveHook aReceiveHook,
+                      void *                     aContext,
+                      uint32_t                   aPosition,
+                      uint16_t                   aLength,
+                      bool                       aMore,
+                      uint32_t                   aTotalLength);
+    otError ProcessBlockWiseResponse(Message &aRequest, const CoapMetadata &aCoapMetadata, Message &aResponse);
+    otError SendNextBlockRequest(Message &           aRequest,
+                                 const CoapMetadata &aCoapMetadata,
+                                 uint16_t            aNumber,
+                                 uint32_t            aNum,
+                                 otCoapBlockSize     aSize);
+    otError ProcessBlockWiseRequest(const ResourceBlockWise &aResource,
+                                    Message &                aMessage,
+                                    const Ip6::MessageInfo & aMessageInfo);
+    otError SendBlockResponse(Message::Code               aCode,
+                              const Message &             aRequest,
+                              const Ip6::MessageInfo &    aMessageInfo,
+                              uint16_t                    aNumber,
+                              uint32_t                    aNum,
+                              otCoapBlockSize             aSize,
+                              otCoapBlockwiseTransmitHook aTransmitHook,
+                              void *                      aContext);
+#endif
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    static bool IsObserveFresh(uint32_t aLastSequence, uint32_t aSequence);
+
+    bool ProcessObserveNotification(Message &               aRequest,
+                                    const CoapMetadata &    aCoapMetadata,
+                                    Message &               aResponse,
+                                    const Ip6::MessageInfo &aMessageInfo);
+    void RemoveObserver(Observer &aObserver);
+    void RemoveObservers(const Resource *aResource);
+    void RemoveObserver(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+    void HandleObserveReset(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void FreeUnusedNotifications(void);
+    otError SendNotification(Observer &aObserver);
+
+    static void HandleObserveTimer(Timer &aTimer);
+    void        HandleObserveTimer(void);
+
+    static void HandleNotificationResult(void *               aContext,
+                                         otMessage *          aMessage,
+                                         const otMessageInfo *aMessageInfo,
+                                         otError              aResult);
+    void        HandleNotificationResult(Observer &aObserver, otError aResult);
+#endif
 
     otError SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError SendEmptyMessage(Message::Type aType, const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
@@ -693,8 +1136,22 @@ private:
     MessageQueue      mPendingRequests;
     uint16_t          mMessageId;
     TimerMilliContext mRetransmissionTimer;
-
-    Resource *mResources;
+    otCoapCounters    mCounters;
+#if OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+    MessageQueue mWaitingRequests;
+    RttEntry     mRttEntries[kMaxRttDestinations];
+#endif
+
+    Resource *mResources[kResourceHashBuckets];
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    ResourceBlockWise *mBlockWiseResources;
+#endif
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    Observer          mObservers[kMaxObservers];
+    MessageQueue      mNotifications;
+    TimerMilliContext mObserveTimer;
+    uint32_t          mObserveSequence;
+#endif
 
     void *         mContext;
     Interceptor    mInterceptor;
@@ -207,6 +207,241 @@ otError Message::AppendUriQueryOption(const char *aUriQuery)
     return AppendStringOption(OT_COAP_OPTION_URI_QUERY, aUriQuery);
 }
 
+otError Message::ReadUintOption(uint16_t aNumber, uint32_t &aValue)
+{
+    otError             error = OT_ERROR_NOT_FOUND;
+    const otCoapOption *option;
+    uint8_t             buf[sizeof(uint32_t)];
+
+    for (option = GetFirstOption(); option != NULL; option = GetNextOption())
+    {
+        if (option->mNumber == aNumber)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(option != NULL);
+    VerifyOrExit(option->mLength <= sizeof(buf), error = OT_ERROR_PARSE);
+
+    memset(buf, 0, sizeof(buf));
+    SuccessOrExit(error = GetOptionValue(&buf[sizeof(buf) - option->mLength]));
+    aValue = Encoding::BigEndian::ReadUint32(buf);
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+otError Message::EncodeBlockOption(uint32_t        aNum,
+                                   bool            aMore,
+                                   otCoapBlockSize aSize,
+                                   uint8_t *       aValue,
+                                   uint16_t &      aLength)
+{
+    otError  error = OT_ERROR_NONE;
+    uint8_t  buf[sizeof(uint32_t)];
+    uint32_t value;
+
+    VerifyOrExit(aNum <= kBlockMaxNum && aSize <= OT_COAP_BLOCK_SIZE_1024, error = OT_ERROR_INVALID_ARGS);
+
+    // The value is always encoded in at least one byte, which holds the More flag and block size.
+    value   = (aNum << kBlockNumOffset) | (aMore ? kBlockMoreFlag : 0) | static_cast<uint32_t>(aSize);
+    aLength = (aNum < (1 << 4)) ? 1 : ((aNum < (1 << 12)) ? 2 : 3);
+
+    Encoding::BigEndian::WriteUint32(value, buf);
+    memcpy(aValue, &buf[sizeof(buf) - aLength], aLength);
+
+exit:
+    return error;
+}
+
+otError Message::AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    otError  error;
+    uint8_t  value[sizeof(uint32_t)];
+    uint16_t length;
+
+    SuccessOrExit(error = EncodeBlockOption(aNum, aMore, aSize, value, length));
+    error = AppendOption(aNumber, length, value);
+
+exit:
+    return error;
+}
+
+otError Message::ReadBlockOptionValues(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aSize)
+{
+    otError  error = OT_ERROR_NONE;
+    uint32_t value;
+
+    SuccessOrExit(error = ReadUintOption(aNumber, value));
+    VerifyOrExit(value <= ((kBlockMaxNum << kBlockNumOffset) | kBlockMoreFlag | kBlockSizeMask),
+                 error = OT_ERROR_PARSE);
+    VerifyOrExit((value & kBlockSizeMask) != kBlockReservedSize, error = OT_ERROR_PARSE);
+
+    aNum  = value >> kBlockNumOffset;
+    aMore = (value & kBlockMoreFlag) != 0;
+    aSize = static_cast<otCoapBlockSize>(value & kBlockSizeMask);
+
+exit:
+    return error;
+}
+
+otError Message::UpdateBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize)
+{
+    otError             error;
+    const otCoapOption *option;
+    uint16_t            optionOffset = GetHelpData().mHeaderOffset + GetOptionStart();
+    uint16_t            endOffset;
+    uint16_t            oldLength;
+    uint16_t            length;
+    uint8_t             value[sizeof(uint32_t)];
+    uint8_t             byte;
+
+    SuccessOrExit(error = EncodeBlockOption(aNum, aMore, aSize, value, length));
+
+    for (option = GetFirstOption(); option != NULL; option = GetNextOption())
+    {
+        if (option->mNumber == aNumber)
+        {
+            break;
+        }
+
+        optionOffset = GetHelpData().mNextOptionOffset;
+    }
+
+    VerifyOrExit(option != NULL && option->mLength <= sizeof(uint32_t), error = OT_ERROR_NOT_FOUND);
+
+    oldLength = option->mLength;
+    endOffset = GetHelpData().mNextOptionOffset;
+
+    // Move the content following the option when the value length changes.
+    if (length > oldLength)
+    {
+        SuccessOrExit(error = SetLength(GetLength() + length - oldLength));
+
+        for (uint16_t offset = GetLength() - (length - oldLength); offset > endOffset; offset--)
+        {
+            Read(offset - 1, sizeof(byte), &byte);
+            Write(offset - 1 + length - oldLength, sizeof(byte), &byte);
+        }
+    }
+    else if (length < oldLength)
+    {
+        for (uint16_t offset = endOffset; offset < GetLength(); offset++)
+        {
+            Read(offset, sizeof(byte), &byte);
+            Write(offset - (oldLength - length), sizeof(byte), &byte);
+        }
+
+        SuccessOrExit(error = SetLength(GetLength() - (oldLength - length)));
+    }
+
+    GetHelpData().mHeaderLength += length - oldLength;
+
+    if (GetOffset() >= endOffset)
+    {
+        SetOffset(GetOffset() + length - oldLength);
+    }
+
+    // A Block option value is at most four bytes, so its length is held in the first byte of the option header.
+    Read(optionOffset, sizeof(byte), &byte);
+    byte = static_cast<uint8_t>((byte & ~kOptionLengthMask) | length);
+    Write(optionOffset, sizeof(byte), &byte);
+    Write(endOffset - oldLength, length, value);
+
+exit:
+    return error;
+}
+
+otError Message::AppendOptionsWithBlock(Message &       aMessage,
+                                        uint16_t        aNumber,
+                                        uint32_t        aNum,
+                                        bool            aMore,
+                                        otCoapBlockSize aSize)
+{
+    otError  error         = OT_ERROR_NONE;
+    bool     blockAppended = false;
+    uint16_t number;
+
+    for (const otCoapOption *option = aMessage.GetFirstOption(); option != NULL; option = aMessage.GetNextOption())
+    {
+        number = option->mNumber;
+
+        if (number == OT_COAP_OPTION_BLOCK1 || number == OT_COAP_OPTION_BLOCK2 || number == OT_COAP_OPTION_SIZE1 ||
+            number == OT_COAP_OPTION_SIZE2)
+        {
+            continue;
+        }
+
+        if (!blockAppended && number > aNumber)
+        {
+            SuccessOrExit(error = AppendBlockOption(aNumber, aNum, aMore, aSize));
+            blockAppended = true;
+        }
+
+        SuccessOrExit(error = AppendOptionFrom(aMessage));
+    }
+
+    if (!blockAppended)
+    {
+        error = AppendBlockOption(aNumber, aNum, aMore, aSize);
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+otError Message::AppendOptionsWithObserve(Message &aMessage, uint32_t aObserve)
+{
+    otError error           = OT_ERROR_NONE;
+    bool    observeAppended = false;
+
+    for (const otCoapOption *option = aMessage.GetFirstOption(); option != NULL; option = aMessage.GetNextOption())
+    {
+        if (option->mNumber == OT_COAP_OPTION_OBSERVE)
+        {
+            continue;
+        }
+
+        if (!observeAppended && option->mNumber > OT_COAP_OPTION_OBSERVE)
+        {
+            SuccessOrExit(error = AppendObserveOption(aObserve));
+            observeAppended = true;
+        }
+
+        SuccessOrExit(error = AppendOptionFrom(aMessage));
+    }
+
+    if (!observeAppended)
+    {
+        error = AppendObserveOption(aObserve);
+    }
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE || OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+otError Message::AppendOptionFrom(const Message &aMessage)
+{
+    otError             error  = OT_ERROR_NONE;
+    const otCoapOption &option = aMessage.GetHelpData().mOption;
+    uint8_t             value[kMaxCopiedOptionLength];
+
+    // Appends the option that the option iterator of `aMessage` currently points to.
+    VerifyOrExit(option.mLength <= sizeof(value), error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = aMessage.GetOptionValue(value));
+    error = AppendOption(option.mNumber, option.mLength, value);
+
+exit:
+    return error;
+}
+#endif
+
 const otCoapOption *Message::GetFirstOption(void)
 {
     const otCoapOption *option = NULL;
@@ -379,6 +379,124 @@ public:
      */
     otError AppendUriQueryOption(const char *aUriQuery);
 
+    /**
+     * This method reads the value of an unsigned integer CoAP option.
+     *
+     * @param[in]   aNumber  The CoAP Option number.
+     * @param[out]  aValue   The option value.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option value.
+     * @retval OT_ERROR_NOT_FOUND  The message does not carry the option.
+     * @retval OT_ERROR_PARSE      The option value is longer than four bytes.
+     *
+     */
+    otError ReadUintOption(uint16_t aNumber, uint32_t &aValue);
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    /**
+     * This method appends a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]  aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum     The block number.
+     * @param[in]  aMore    TRUE if more blocks follow.
+     * @param[in]  aSize    The block size.
+     *
+     * @retval OT_ERROR_NONE          Successfully appended the option.
+     * @retval OT_ERROR_INVALID_ARGS  The option type is not equal or greater than the last option type, or @p aNum
+     *                                does not fit in the option.
+     * @retval OT_ERROR_NO_BUFS       The option length exceeds the buffer size.
+     *
+     */
+    otError AppendBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method reads the values of a Block1 or Block2 option (RFC 7959).
+     *
+     * @param[in]   aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[out]  aNum     The block number.
+     * @param[out]  aMore    TRUE if more blocks follow.
+     * @param[out]  aSize    The block size.
+     *
+     * @retval OT_ERROR_NONE       Successfully read the option values.
+     * @retval OT_ERROR_NOT_FOUND  The message does not carry the option.
+     * @retval OT_ERROR_PARSE      The option value is malformed.
+     *
+     */
+    otError ReadBlockOptionValues(uint16_t aNumber, uint32_t &aNum, bool &aMore, otCoapBlockSize &aSize);
+
+    /**
+     * This method re-encodes the value of a Block1 or Block2 option in place.
+     *
+     * The content following the option is moved when the encoded value changes length.
+     *
+     * @param[in]  aNumber  The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum     The block number.
+     * @param[in]  aMore    TRUE if more blocks follow.
+     * @param[in]  aSize    The block size.
+     *
+     * @retval OT_ERROR_NONE          Successfully updated the option.
+     * @retval OT_ERROR_NOT_FOUND     The message does not carry the option.
+     * @retval OT_ERROR_INVALID_ARGS  @p aNum does not fit in the option.
+     * @retval OT_ERROR_NO_BUFS       Insufficient buffers to grow the option.
+     *
+     */
+    otError UpdateBlockOption(uint16_t aNumber, uint32_t aNum, bool aMore, otCoapBlockSize aSize);
+
+    /**
+     * This method appends all CoAP options of another message, replacing any Block1, Block2, Size1 and Size2
+     * options with a single given Block option.
+     *
+     * This is used to build the follow-up request for the next block of a block-wise transfer. The options of
+     * @p aMessage are iterated up to its end, so it MUST NOT contain anything but a CoAP header, options and an
+     * optional payload marker.
+     *
+     * @param[in]  aMessage  The message to copy the options from.
+     * @param[in]  aNumber   The CoAP Option number, `OT_COAP_OPTION_BLOCK1` or `OT_COAP_OPTION_BLOCK2`.
+     * @param[in]  aNum      The block number.
+     * @param[in]  aMore     TRUE if more blocks follow.
+     * @param[in]  aSize     The block size.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the options.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers, or an option of @p aMessage is too long to be copied.
+     *
+     */
+    otError AppendOptionsWithBlock(Message &       aMessage,
+                                   uint16_t        aNumber,
+                                   uint32_t        aNum,
+                                   bool            aMore,
+                                   otCoapBlockSize aSize);
+
+    /**
+     * This method returns the number of bytes of a block of a given block size.
+     *
+     * @param[in]  aSize  The block size.
+     *
+     * @returns The block size in bytes.
+     *
+     */
+    static uint16_t BlockSizeFromExponent(otCoapBlockSize aSize)
+    {
+        return static_cast<uint16_t>(1 << (static_cast<uint8_t>(aSize) + kBlockSizeExponentOffset));
+    }
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    /**
+     * This method appends all CoAP options of another message, replacing any Observe option with a given one.
+     *
+     * This is used to build a notification (RFC 7641) from the options of a template message. The options of
+     * @p aMessage are iterated up to its header length.
+     *
+     * @param[in]  aMessage  The message to copy the options from.
+     * @param[in]  aObserve  The Observe option value.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the options.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers, or an option of @p aMessage is too long to be copied.
+     *
+     */
+    otError AppendOptionsWithObserve(Message &aMessage, uint32_t aObserve);
+#endif
+
     /**
      * This method returns a pointer to the first option.
      *
@@ -419,6 +537,14 @@ public:
      */
     uint16_t GetOptionStart(void) const { return kMinHeaderLength + GetTokenLength(); }
 
+    /**
+     * This method returns the length of the CoAP header including options and the payload marker, if any.
+     *
+     * @returns The length of the CoAP header.
+     *
+     */
+    uint16_t GetHeaderLength(void) const { return GetHelpData().mHeaderLength; }
+
     /**
      * This method parses CoAP header and moves offset end of CoAP header.
      *
@@ -543,6 +669,7 @@ private:
     {
         kOptionDeltaOffset = 4,                         ///< Delta Offset
         kOptionDeltaMask   = 0xf << kOptionDeltaOffset, ///< Delta Mask
+        kOptionLengthMask  = 0xf,                       ///< Length Mask
 
         kMaxTokenLength = OT_COAP_MAX_TOKEN_LENGTH,
 
@@ -564,6 +691,14 @@ private:
         kOption2ByteExtensionOffset = 269, ///< Delta/Length offset as specified (RFC 7252).
 
         kHelpDataAlignment = sizeof(uint16_t), ///< Alignment of help data.
+
+        kBlockSizeExponentOffset = 4,       ///< Block size is 2^(SZX + 4) bytes (RFC 7959).
+        kBlockMoreFlag           = 0x08,    ///< More flag in the last byte of a Block option value (RFC 7959).
+        kBlockSizeMask           = 0x07,    ///< SZX mask in the last byte of a Block option value (RFC 7959).
+        kBlockNumOffset          = 4,       ///< Offset of the block number in a Block option value (RFC 7959).
+        kBlockMaxNum             = 0xfffff, ///< Largest block number (RFC 7959).
+        kBlockReservedSize       = 7,       ///< Reserved SZX value (RFC 7959).
+        kMaxCopiedOptionLength   = 64,      ///< Longest option value copied from another message.
     };
 
     /**
@@ -593,6 +728,14 @@ private:
         uint16_t     mHeaderLength;
     };
 
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+    static otError EncodeBlockOption(uint32_t        aNum,
+                                     bool            aMore,
+                                     otCoapBlockSize aSize,
+                                     uint8_t *       aValue,
+                                     uint16_t &      aLength);
+#endif
+
     const HelpData &GetHelpData(void) const
     {
         OT_STATIC_ASSERT(sizeof(mBuffer.mHead.mInfo) + sizeof(HelpData) + kHelpDataAlignment <= sizeof(mBuffer),
@@ -602,6 +745,10 @@ private:
     }
 
     HelpData &GetHelpData(void) { return const_cast<HelpData &>(static_cast<const Message *>(this)->GetHelpData()); }
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE || OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+    otError AppendOptionFrom(const Message &aMessage);
+#endif
 };
 
 /**
@@ -174,10 +174,14 @@ otError CoapSecure::SendMessage(Message &               aMessage,
 
 otError CoapSecure::Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    OT_UNUSED_VARIABLE(aMessageInfo);
+    otError       error;
+    Ip6::SockAddr peer;
 
-    otError error;
+    // The peer is appended to the message, to select the DTLS session when the message is transmitted.
+    peer.mAddress = aMessageInfo.GetPeerAddr();
+    peer.mPort    = aMessageInfo.GetPeerPort();
 
+    SuccessOrExit(error = aMessage.Append(&peer, sizeof(peer)));
     SuccessOrExit(error = mTransmitQueue.Enqueue(aMessage));
     mTransmitTask.Post();
 
@@ -227,8 +231,10 @@ void CoapSecure::HandleTransmit(Tasklet &aTasklet)
 
 void CoapSecure::HandleTransmit(void)
 {
-    otError      error   = OT_ERROR_NONE;
-    ot::Message *message = mTransmitQueue.GetHead();
+    otError       error   = OT_ERROR_NONE;
+    ot::Message * message = mTransmitQueue.GetHead();
+    Ip6::SockAddr peer;
+    uint16_t      length;
 
     VerifyOrExit(message != NULL);
     mTransmitQueue.Dequeue(*message);
@@ -238,7 +244,11 @@ void CoapSecure::HandleTransmit(void)
         mTransmitTask.Post();
     }
 
-    SuccessOrExit(error = mDtls.Send(*message, message->GetLength()));
+    length = message->GetLength() - sizeof(peer);
+    message->Read(length, sizeof(peer), &peer);
+    SuccessOrExit(error = message->SetLength(length));
+
+    SuccessOrExit(error = mDtls.Send(*message, length, peer));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -117,14 +117,29 @@ public:
     otError Connect(const Ip6::SockAddr &aSockAddr, ConnectedCallback aCallback, void *aContext);
 
     /**
-     * This method indicates whether or not the DTLS session is active.
+     * This method indicates whether or not a DTLS session is active.
      *
-     * @retval TRUE  If DTLS session is active.
-     * @retval FALSE If DTLS session is not active.
+     * @retval TRUE  If a DTLS session is active.
+     * @retval FALSE If no DTLS session is active.
      *
      */
     bool IsConnectionActive(void) const { return mDtls.IsConnectionActive(); }
 
+    /**
+     * This method indicates whether or not the DTLS session with a given peer is active.
+     *
+     * @param[in]  aPeerAddr  A reference to the peer IPv6 address.
+     * @param[in]  aPeerPort  The peer UDP port.
+     *
+     * @retval TRUE  If the DTLS session with the peer is active.
+     * @retval FALSE If the DTLS session with the peer is not active.
+     *
+     */
+    bool IsConnectionActive(const Ip6::Address &aPeerAddr, uint16_t aPeerPort) const
+    {
+        return mDtls.IsConnectionActive(aPeerAddr, aPeerPort);
+    }
+
     /**
      * This method indicates whether or not the DTLS session is connected.
      *
@@ -135,7 +150,7 @@ public:
     bool IsConnected(void) const { return mDtls.IsConnected(); }
 
     /**
-     * This method stops the DTLS connection.
+     * This method stops all DTLS connections.
      *
      */
     void Disconnect(void) { mDtls.Disconnect(); }
@@ -305,6 +320,8 @@ public:
     /**
      * This method returns the DTLS session's peer address.
      *
+     * While a DTLS callback is running, this is the peer of the session that invoked it.
+     *
      * @return DTLS session's message info.
      *
      */
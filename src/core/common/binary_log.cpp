@@ -0,0 +1,861 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements binary logging with deferred formatting.
+ */
+
+#include "binary_log.hpp"
+
+#include <ctype.h>
+#include <stdio.h>
+#include "utils/wrap_string.h"
+
+#include <openthread/platform/alarm-milli.h>
+
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+#include "utils/static_assert.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+using ot::Encoding::LittleEndian::ReadUint16;
+using ot::Encoding::LittleEndian::ReadUint32;
+using ot::Encoding::LittleEndian::WriteUint16;
+using ot::Encoding::LittleEndian::WriteUint32;
+
+namespace ot {
+namespace BinaryLog {
+
+enum
+{
+    kBufferSize       = OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE,
+    kBufferMask       = kBufferSize - 1,
+    kTypeShift        = 4,
+    kTruncatedFlag    = 1 << 3,
+    kLevelMask        = kTruncatedFlag - 1,
+    kDumpHeaderLength = sizeof(uint16_t) + sizeof(uint16_t), ///< Dump length and chunk offset.
+    kDumpChunkLength  = 240,                                 ///< Multiple of the 16 bytes shown per dump line.
+    kDumpWidth        = 72,
+    kMaxSpecLength    = 32,
+};
+
+OT_STATIC_ASSERT((kBufferSize & kBufferMask) == 0 && kBufferSize <= 32768 &&
+                     kBufferSize >= OT_LOGGING_BINARY_MAX_RECORD_LENGTH,
+                 "OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE must be a power of two between 256 and 32768");
+OT_STATIC_ASSERT(kHeaderLength + kDumpHeaderLength + kDumpChunkLength <= kMaxRecordLength,
+                 "dump chunk does not fit in a record");
+
+/**
+ * This structure represents a conversion specification within a format string.
+ *
+ */
+struct Conversion
+{
+    const char *mStart;     ///< The `%` character.
+    const char *mLength;    ///< The length modifier (or the specifier if there is no length modifier).
+    const char *mEnd;       ///< The character after the specifier.
+    uint8_t     mNumStars;  ///< The number of `*` (width and precision given as arguments).
+    bool        mWide;      ///< Whether the argument is a 64-bit integer (`l`, `ll`, `j`, `z` or `t`).
+    char        mSpecifier; ///< The conversion specifier.
+};
+
+// The ring buffer indices are neither atomic nor ordered with the buffer accesses by memory barriers. Records are
+// therefore written and read from the same context (see `BinaryLog`).
+static uint8_t                sBuffer[kBufferSize];
+static uint16_t               sHead;
+static uint16_t               sTail;
+static uint32_t               sDropCount;
+static uint32_t               sPendingDrops;
+static uintptr_t              sFormatStart; ///< Address of the lowest format string written to a record.
+static uintptr_t              sFormatEnd;   ///< Address after the end of the highest format string.
+static otLoggingBinaryHandler sHandler;
+static void *                 sHandlerContext;
+
+/**
+ * This function returns the string that format strings are referenced from.
+ *
+ * The host decoder locates the same string in the firmware image to resolve the format strings.
+ *
+ */
+static const char *GetAnchor(void)
+{
+    return "OpenThread-BinaryLog-Anchor";
+}
+
+/**
+ * This function returns the offset of a format string (or dump id) from the anchor string.
+ *
+ * The format string is added to the range of format strings that `GetFormat()` resolves.
+ *
+ */
+static uint32_t GetFormatOffset(const char *aFormat)
+{
+    uintptr_t start = reinterpret_cast<uintptr_t>(aFormat);
+    uintptr_t end   = start + strlen(aFormat) + 1;
+
+    if (sFormatStart == sFormatEnd)
+    {
+        sFormatStart = start;
+        sFormatEnd   = end;
+    }
+    else
+    {
+        sFormatStart = (start < sFormatStart) ? start : sFormatStart;
+        sFormatEnd   = (end > sFormatEnd) ? end : sFormatEnd;
+    }
+
+    return static_cast<uint32_t>(start - reinterpret_cast<uintptr_t>(GetAnchor()));
+}
+
+/**
+ * This function resolves the offset of a format string (or dump id) from the anchor string.
+ *
+ * Only offsets within the range of format strings written to records are resolved. The range ends with the null
+ * character of a format string, so a resolved string is terminated within the range.
+ *
+ * @param[in]  aOffset  The offset from the anchor string.
+ *
+ * @returns A pointer to the format string, or NULL if @p aOffset is not within the range of format strings.
+ *
+ */
+static const char *GetFormat(uint32_t aOffset)
+{
+    intptr_t  delta  = static_cast<int32_t>(aOffset);
+    uintptr_t format = reinterpret_cast<uintptr_t>(GetAnchor()) + static_cast<uintptr_t>(delta);
+
+    if (format < sFormatStart || format >= sFormatEnd)
+    {
+        format = 0;
+    }
+
+    return reinterpret_cast<const char *>(format);
+}
+
+/**
+ * This function finds the next conversion specification in a format string.
+ *
+ * @param[in]   aString      A pointer to the format string.
+ * @param[out]  aConversion  A reference to output the conversion specification.
+ *
+ * @retval TRUE   Found a conversion specification.
+ * @retval FALSE  There is no (complete) conversion specification left in @p aString.
+ *
+ */
+static bool FindConversion(const char *aString, Conversion &aConversion)
+{
+    const char *cur = strchr(aString, '%');
+
+    VerifyOrExit(cur != NULL);
+
+    aConversion.mStart    = cur++;
+    aConversion.mNumStars = 0;
+    aConversion.mWide     = false;
+
+    while (*cur != '\0' && strchr("-+ #0", *cur) != NULL)
+    {
+        cur++;
+    }
+
+    // Width, then precision.
+    for (uint8_t field = 0; field < 2; field++)
+    {
+        if (field == 1)
+        {
+            if (*cur != '.')
+            {
+                break;
+            }
+
+            cur++;
+        }
+
+        if (*cur == '*')
+        {
+            aConversion.mNumStars++;
+            cur++;
+        }
+        else
+        {
+            while (isdigit(static_cast<unsigned char>(*cur)))
+            {
+                cur++;
+            }
+        }
+    }
+
+    aConversion.mLength = cur;
+
+    while (*cur != '\0' && strchr("hljztL", *cur) != NULL)
+    {
+        aConversion.mWide = aConversion.mWide || (strchr("ljzt", *cur) != NULL);
+        cur++;
+    }
+
+    VerifyOrExit(*cur != '\0', cur = NULL);
+
+    aConversion.mSpecifier = *cur++;
+    aConversion.mEnd       = cur;
+
+exit:
+    return cur != NULL;
+}
+
+static uint8_t WriteHeader(uint8_t *aRecord, uint8_t aType, otLogLevel aLogLevel, otLogRegion aLogRegion, uint32_t aId)
+{
+    aRecord[1] = static_cast<uint8_t>((aType << kTypeShift) | (static_cast<uint8_t>(aLogLevel) & kLevelMask));
+    aRecord[2] = static_cast<uint8_t>(aLogRegion);
+    WriteUint32(otPlatAlarmMilliGetNow(), &aRecord[3]);
+    WriteUint32(aId, &aRecord[7]);
+
+    return kHeaderLength;
+}
+
+static bool AppendUint32(uint8_t *aRecord, uint8_t &aLength, uint32_t aValue)
+{
+    bool rval = (aLength + sizeof(uint32_t) <= kMaxRecordLength);
+
+    if (rval)
+    {
+        WriteUint32(aValue, &aRecord[aLength]);
+        aLength += sizeof(uint32_t);
+    }
+
+    return rval;
+}
+
+static bool AppendUint64(uint8_t *aRecord, uint8_t &aLength, uint64_t aValue)
+{
+    bool rval = (aLength + sizeof(uint64_t) <= kMaxRecordLength);
+
+    if (rval)
+    {
+        WriteUint32(static_cast<uint32_t>(aValue), &aRecord[aLength]);
+        WriteUint32(static_cast<uint32_t>(aValue >> 32), &aRecord[aLength + sizeof(uint32_t)]);
+        aLength += sizeof(uint64_t);
+    }
+
+    return rval;
+}
+
+static bool AppendString(uint8_t *aRecord, uint8_t &aLength, const char *aString)
+{
+    size_t length = strlen(aString);
+    bool   rval   = (aLength + sizeof(uint8_t) + length <= kMaxRecordLength);
+
+    if (aLength < kMaxRecordLength)
+    {
+        if (!rval)
+        {
+            length = kMaxRecordLength - aLength - sizeof(uint8_t);
+        }
+
+        aRecord[aLength++] = static_cast<uint8_t>(length);
+        memcpy(&aRecord[aLength], aString, length);
+        aLength += static_cast<uint8_t>(length);
+    }
+
+    return rval;
+}
+
+static otError Push(const uint8_t *aRecord, uint8_t aLength, bool &aWasEmpty)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t head  = sHead;
+    uint16_t used  = static_cast<uint16_t>(head - sTail);
+
+    VerifyOrExit(kBufferSize - used >= aLength, error = OT_ERROR_NO_BUFS);
+
+    aWasEmpty = aWasEmpty || (used == 0);
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        sBuffer[(head + i) & kBufferMask] = aRecord[i];
+    }
+
+    sHead = static_cast<uint16_t>(head + aLength);
+
+exit:
+    return error;
+}
+
+static void Commit(uint8_t *aRecord, uint8_t aLength)
+{
+    otError error    = OT_ERROR_NONE;
+    bool    wasEmpty = false;
+
+    aRecord[0] = aLength;
+
+    if (sPendingDrops != 0)
+    {
+        uint8_t drop[kHeaderLength + sizeof(uint32_t)];
+        uint8_t length = WriteHeader(drop, kTypeDrop, OT_LOG_LEVEL_WARN, OT_LOG_REGION_CORE, 0);
+
+        AppendUint32(drop, length, sPendingDrops);
+        drop[0] = length;
+
+        SuccessOrExit(error = Push(drop, length, wasEmpty));
+        sPendingDrops = 0;
+    }
+
+    error = Push(aRecord, aLength, wasEmpty);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        sPendingDrops++;
+        sDropCount++;
+    }
+
+    if (wasEmpty && sHandler != NULL)
+    {
+        sHandler(sHandlerContext);
+    }
+}
+
+void Write(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs)
+{
+    uint8_t     record[kMaxRecordLength];
+    uint8_t     length = WriteHeader(record, kTypeLog, aLogLevel, aLogRegion, GetFormatOffset(aFormat));
+    const char *cur    = aFormat;
+    bool        fits   = true;
+    Conversion  conversion;
+
+    while (fits && FindConversion(cur, conversion))
+    {
+        cur = conversion.mEnd;
+
+        for (uint8_t i = 0; fits && i < conversion.mNumStars; i++)
+        {
+            fits = AppendUint32(record, length, static_cast<uint32_t>(va_arg(aArgs, int)));
+        }
+
+        VerifyOrExit(fits);
+
+        switch (conversion.mSpecifier)
+        {
+        case 'd':
+        case 'i':
+            if (!conversion.mWide)
+            {
+                fits = AppendUint32(record, length, static_cast<uint32_t>(va_arg(aArgs, int)));
+            }
+            else if (conversion.mLength[0] == 'l' && conversion.mLength[1] == 'l')
+            {
+                fits = AppendUint64(record, length, static_cast<uint64_t>(va_arg(aArgs, long long)));
+            }
+            else if (conversion.mLength[0] == 'l')
+            {
+                fits = AppendUint64(record, length, static_cast<uint64_t>(va_arg(aArgs, long)));
+            }
+            else if (conversion.mLength[0] == 'j')
+            {
+                fits = AppendUint64(record, length, static_cast<uint64_t>(va_arg(aArgs, intmax_t)));
+            }
+            else
+            {
+                fits = AppendUint64(record, length, static_cast<uint64_t>(va_arg(aArgs, ptrdiff_t)));
+            }
+
+            break;
+
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'c':
+            if (!conversion.mWide)
+            {
+                fits = AppendUint32(record, length, va_arg(aArgs, unsigned int));
+            }
+            else if (conversion.mLength[0] == 'l' && conversion.mLength[1] == 'l')
+            {
+                fits = AppendUint64(record, length, va_arg(aArgs, unsigned long long));
+            }
+            else if (conversion.mLength[0] == 'l')
+            {
+                fits = AppendUint64(record, length, va_arg(aArgs, unsigned long));
+            }
+            else if (conversion.mLength[0] == 'j')
+            {
+                fits = AppendUint64(record, length, va_arg(aArgs, uintmax_t));
+            }
+            else
+            {
+                fits = AppendUint64(record, length, va_arg(aArgs, size_t));
+            }
+
+            break;
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double   value = (conversion.mLength[0] == 'L') ? static_cast<double>(va_arg(aArgs, long double))
+                                                            : va_arg(aArgs, double);
+            uint64_t bits;
+
+            OT_STATIC_ASSERT(sizeof(bits) == sizeof(value), "double must be 64 bits");
+            memcpy(&bits, &value, sizeof(bits));
+            fits = AppendUint64(record, length, bits);
+            break;
+        }
+
+        case 'p':
+            fits = AppendUint64(record, length, reinterpret_cast<uintptr_t>(va_arg(aArgs, void *)));
+            break;
+
+        case 's':
+        {
+            const char *string = va_arg(aArgs, const char *);
+
+            fits = AppendString(record, length, (string != NULL) ? string : "(null)");
+            break;
+        }
+
+        case 'n':
+            va_arg(aArgs, void *);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+exit:
+    if (!fits)
+    {
+        record[1] |= kTruncatedFlag;
+    }
+
+    Commit(record, length);
+}
+
+void WriteDump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, size_t aLength)
+{
+    const uint8_t *buf    = static_cast<const uint8_t *>(aBuf);
+    uint16_t       length = (aLength < 0xffff) ? static_cast<uint16_t>(aLength) : 0xffff;
+    uint16_t       offset = 0;
+
+    VerifyOrExit(otLoggingGetLevel() >= aLogLevel);
+
+    do
+    {
+        uint8_t  record[kMaxRecordLength];
+        uint8_t  recordLength = WriteHeader(record, kTypeDump, aLogLevel, aLogRegion, GetFormatOffset(aId));
+        uint16_t chunkLength  = length - offset;
+
+        if (chunkLength > kDumpChunkLength)
+        {
+            chunkLength = kDumpChunkLength;
+        }
+
+        WriteUint16(length, &record[recordLength]);
+        WriteUint16(offset, &record[recordLength + sizeof(uint16_t)]);
+        recordLength += kDumpHeaderLength;
+        memcpy(&record[recordLength], buf + offset, chunkLength);
+        recordLength += static_cast<uint8_t>(chunkLength);
+
+        Commit(record, recordLength);
+        offset += chunkLength;
+    } while (offset < length);
+
+exit:
+    return;
+}
+
+void SetHandler(otLoggingBinaryHandler aHandler, void *aContext)
+{
+    sHandler        = aHandler;
+    sHandlerContext = aContext;
+}
+
+uint16_t Read(uint8_t *aBuffer, uint16_t aLength)
+{
+    uint16_t tail   = sTail;
+    uint16_t head   = sHead;
+    uint16_t length = 0;
+
+    while (tail != head)
+    {
+        uint8_t recordLength = sBuffer[tail & kBufferMask];
+
+        VerifyOrExit(length + recordLength <= aLength);
+
+        for (uint8_t i = 0; i < recordLength; i++)
+        {
+            aBuffer[length++] = sBuffer[(tail + i) & kBufferMask];
+        }
+
+        tail = static_cast<uint16_t>(tail + recordLength);
+    }
+
+exit:
+    sTail = tail;
+    return length;
+}
+
+uint32_t GetDropCount(void)
+{
+    return sDropCount;
+}
+
+/**
+ * This class appends formatted text to a caller-provided buffer, clamping at its end.
+ *
+ */
+class Output
+{
+public:
+    Output(char *aString, uint16_t aSize)
+        : mString(aString)
+        , mSize(aSize)
+        , mLength(0)
+    {
+        mString[0] = '\0';
+    }
+
+    void Append(const char *aFormat, ...)
+    {
+        va_list args;
+        int     len;
+
+        va_start(args, aFormat);
+        len = vsnprintf(mString + mLength, static_cast<size_t>(mSize - mLength), aFormat, args);
+        va_end(args);
+
+        if (len > 0)
+        {
+            mLength = (len < mSize - mLength) ? static_cast<uint16_t>(mLength + len) : static_cast<uint16_t>(mSize - 1);
+        }
+    }
+
+private:
+    char *   mString;
+    uint16_t mSize;
+    uint16_t mLength;
+};
+
+static otError DecodeLog(const char *aFormat, const uint8_t *aArgs, uint16_t aLength, bool aTruncated, Output &aOutput)
+{
+    otError        error = OT_ERROR_NONE;
+    const uint8_t *end   = aArgs + aLength;
+    const char *   cur   = aFormat;
+    Conversion     conversion;
+
+    while (FindConversion(cur, conversion))
+    {
+        char        specBuffer[kMaxSpecLength];
+        Output      spec(specBuffer, sizeof(specBuffer));
+        const char *field = conversion.mStart;
+
+        aOutput.Append("%.*s", static_cast<int>(conversion.mStart - cur), cur);
+        cur = conversion.mEnd;
+
+        if (conversion.mSpecifier == '%')
+        {
+            aOutput.Append("%%");
+            continue;
+        }
+
+        // Rebuild the specification with the `*` values taken from the record, and with the length modifier
+        // matching the size of the recorded argument.
+
+        while (field < conversion.mLength)
+        {
+            bool    precision = (field[0] == '.' && field[1] == '*');
+            int32_t value;
+
+            if (precision)
+            {
+                field++;
+            }
+
+            if (*field != '*')
+            {
+                spec.Append("%c", *field++);
+                continue;
+            }
+
+            VerifyOrExit(end - aArgs >= static_cast<ptrdiff_t>(sizeof(uint32_t)), error = OT_ERROR_PARSE);
+            value = static_cast<int32_t>(ReadUint32(aArgs));
+            aArgs += sizeof(uint32_t);
+            field++;
+
+            // A negative width is a `-` flag followed by a positive width, a negative precision is taken as if the
+            // precision were omitted.
+            if (!precision)
+            {
+                spec.Append("%d", static_cast<int>(value));
+            }
+            else if (value >= 0)
+            {
+                spec.Append(".%d", static_cast<int>(value));
+            }
+        }
+
+        switch (conversion.mSpecifier)
+        {
+        case 'd':
+        case 'i':
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'c':
+        case 'p':
+        {
+            bool     wide = conversion.mWide || (conversion.mSpecifier == 'p');
+            uint16_t size = wide ? sizeof(uint64_t) : sizeof(uint32_t);
+            uint64_t value;
+
+            VerifyOrExit(end - aArgs >= size, error = OT_ERROR_PARSE);
+            value = ReadUint32(aArgs);
+
+            if (wide)
+            {
+                value |= static_cast<uint64_t>(ReadUint32(aArgs + sizeof(uint32_t))) << 32;
+            }
+
+            aArgs += size;
+
+            if (conversion.mSpecifier == 'p')
+            {
+                spec.Append("p");
+                aOutput.Append(specBuffer, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            }
+            else if (wide)
+            {
+                spec.Append("ll%c", conversion.mSpecifier);
+                aOutput.Append(specBuffer, static_cast<unsigned long long>(value));
+            }
+            else
+            {
+                spec.Append("%.*s%c", static_cast<int>(conversion.mEnd - 1 - conversion.mLength), conversion.mLength,
+                            conversion.mSpecifier);
+                aOutput.Append(specBuffer, static_cast<unsigned int>(value));
+            }
+
+            break;
+        }
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            uint64_t bits;
+            double   value;
+
+            VerifyOrExit(end - aArgs >= static_cast<ptrdiff_t>(sizeof(uint64_t)), error = OT_ERROR_PARSE);
+            bits = ReadUint32(aArgs) | (static_cast<uint64_t>(ReadUint32(aArgs + sizeof(uint32_t))) << 32);
+            aArgs += sizeof(uint64_t);
+            memcpy(&value, &bits, sizeof(value));
+
+            spec.Append("%c", conversion.mSpecifier);
+            aOutput.Append(specBuffer, value);
+            break;
+        }
+
+        case 's':
+        {
+            char    string[kMaxRecordLength];
+            uint8_t length;
+
+            VerifyOrExit(aArgs < end, error = OT_ERROR_PARSE);
+            length = *aArgs++;
+            VerifyOrExit(end - aArgs >= length, error = OT_ERROR_PARSE);
+            memcpy(string, aArgs, length);
+            string[length] = '\0';
+            aArgs += length;
+
+            spec.Append("s");
+            aOutput.Append(specBuffer, string);
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    aOutput.Append("%s", cur);
+
+exit:
+    if (error == OT_ERROR_PARSE && aTruncated)
+    {
+        aOutput.Append("...");
+        error = OT_ERROR_NONE;
+    }
+
+    return error;
+}
+
+static void DecodeDumpLine(const uint8_t *aBuf, uint16_t aLength, Output &aOutput)
+{
+    aOutput.Append("\n|");
+
+    for (uint16_t i = 0; i < 16; i++)
+    {
+        if (i < aLength)
+        {
+            aOutput.Append(" %02X", aBuf[i]);
+        }
+        else
+        {
+            aOutput.Append(" ..");
+        }
+
+        if (!((i + 1) % 8))
+        {
+            aOutput.Append(" |");
+        }
+    }
+
+    aOutput.Append(" ");
+
+    for (uint16_t i = 0; i < 16; i++)
+    {
+        char c = static_cast<char>(0x7f & aBuf[i]);
+
+        aOutput.Append("%c", (i < aLength && isprint(c)) ? c : '.');
+    }
+}
+
+static otError DecodeDump(const char *aId, const uint8_t *aData, uint16_t aLength, Output &aOutput)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t length;
+    uint16_t offset;
+
+    VerifyOrExit(aLength >= kDumpHeaderLength, error = OT_ERROR_PARSE);
+    length = ReadUint16(aData);
+    offset = ReadUint16(aData + sizeof(uint16_t));
+    aData += kDumpHeaderLength;
+    aLength -= kDumpHeaderLength;
+    VerifyOrExit(offset + aLength <= length, error = OT_ERROR_PARSE);
+
+    if (offset == 0)
+    {
+        size_t idLength = strlen(aId);
+        int    padding  = (idLength < kDumpWidth - 10) ? static_cast<int>((kDumpWidth - idLength) / 2) : 5;
+
+        aOutput.Append("%.*s", padding - 5, "====================================");
+        aOutput.Append("[%s len=%03u]", aId, length);
+        aOutput.Append("%.*s", padding - 4, "====================================");
+    }
+    else
+    {
+        aOutput.Append("[%s offset=%u]", aId, offset);
+    }
+
+    for (uint16_t i = 0; i < aLength; i += 16)
+    {
+        DecodeDumpLine(aData + i, (aLength - i < 16) ? aLength - i : 16, aOutput);
+    }
+
+    if (offset + aLength == length)
+    {
+        aOutput.Append("\n%.*s", static_cast<int>(kDumpWidth),
+                       "------------------------------------------------------------------------");
+    }
+
+exit:
+    return error;
+}
+
+otError Decode(const uint8_t *aRecord, uint16_t aLength, otLogBinaryRecordInfo &aInfo, char *aString, uint16_t aSize)
+{
+    otError        error = OT_ERROR_NONE;
+    Output         output(aString, aSize);
+    uint8_t        type;
+    bool           truncated;
+    const char *   format;
+    const uint8_t *data;
+    uint16_t       length;
+
+    VerifyOrExit(aLength >= kHeaderLength && aRecord[0] == aLength, error = OT_ERROR_PARSE);
+
+    type             = aRecord[1] >> kTypeShift;
+    truncated        = (aRecord[1] & kTruncatedFlag) != 0;
+    aInfo.mLogLevel  = static_cast<otLogLevel>(aRecord[1] & kLevelMask);
+    aInfo.mLogRegion = static_cast<otLogRegion>(aRecord[2]);
+    aInfo.mTimestamp = ReadUint32(&aRecord[3]);
+    format           = GetFormat(ReadUint32(&aRecord[7]));
+    data             = aRecord + kHeaderLength;
+    length           = aLength - kHeaderLength;
+
+    switch (type)
+    {
+    case kTypeLog:
+        VerifyOrExit(format != NULL, error = OT_ERROR_PARSE);
+        error = DecodeLog(format, data, length, truncated, output);
+        break;
+
+    case kTypeDump:
+        VerifyOrExit(format != NULL, error = OT_ERROR_PARSE);
+        error = DecodeDump(format, data, length, output);
+        break;
+
+    case kTypeDrop:
+        VerifyOrExit(length == sizeof(uint32_t), error = OT_ERROR_PARSE);
+        output.Append("Dropped %u log records", static_cast<unsigned int>(ReadUint32(data)));
+        break;
+
+    default:
+        error = OT_ERROR_PARSE;
+        break;
+    }
+
+exit:
+    return error;
+}
+
+} // namespace BinaryLog
+} // namespace ot
+
+extern "C" void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    ot::BinaryLog::Write(aLogLevel, aLogRegion, aFormat, args);
+    va_end(args);
+}
+
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for binary logging with deferred formatting.
+ */
+
+#ifndef BINARY_LOG_HPP_
+#define BINARY_LOG_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/logging.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-logging
+ *
+ * @{
+ *
+ */
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+/**
+ * This namespace includes binary logging functions.
+ *
+ * Instead of formatting a log line at the call site, a log call stores a record holding the offset of the format
+ * string (relative to an anchor string in the same image) and the raw arguments into a ring buffer. The reader
+ * formats the records later (`Decode()`), or sends them to a host which formats them using the firmware image.
+ *
+ * Record format (multi-byte fields are little-endian):
+ *
+ *   Offset  Size  Field
+ *   0       1     Record length (in bytes, including this field).
+ *   1       1     Bits 0-2: log level, bit 3: arguments truncated, bits 4-7: record type.
+ *   2       1     Log region.
+ *   3       4     Timestamp (in milliseconds).
+ *   7       4     Offset of the format string (or dump id) from the anchor string.
+ *   11      -     Arguments.
+ *
+ * Arguments of a log record follow the conversions of the format string: `*` width or precision and integers are
+ * 4 bytes, integers with `l`, `ll`, `j`, `z`, or `t` length modifier, pointers and doubles are 8 bytes, and a
+ * string is a length byte followed by its characters.
+ *
+ * A dump record holds the total dump length (2 bytes), the offset of the chunk within the dump (2 bytes), and the
+ * chunk bytes. A drop record holds the number of records dropped while the buffer was full (4 bytes).
+ *
+ * The buffer is not protected against concurrent access: records must be written and read from the same context
+ * (e.g. `otPlatLog()` must not be called from an interrupt handler).
+ *
+ */
+namespace BinaryLog {
+
+enum
+{
+    kHeaderLength    = 11,  ///< Length of the record header.
+    kMaxRecordLength = OT_LOGGING_BINARY_MAX_RECORD_LENGTH, ///< Maximum length of a record.
+};
+
+enum
+{
+    kTypeLog  = 0, ///< A log line.
+    kTypeDump = 1, ///< A chunk of a memory dump.
+    kTypeDrop = 2, ///< A count of dropped records.
+};
+
+/**
+ * This function writes a log record.
+ *
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aFormat     A pointer to the format string, which must be a string literal.
+ * @param[in]  aArgs       Arguments for the format specification.
+ *
+ */
+void Write(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, va_list aArgs);
+
+/**
+ * This function writes a memory dump as one or more dump records.
+ *
+ * @param[in]  aLogLevel   The log level.
+ * @param[in]  aLogRegion  The log region.
+ * @param[in]  aId         A pointer to the dump id, which must be a string literal.
+ * @param[in]  aBuf        A pointer to the buffer.
+ * @param[in]  aLength     Number of bytes in the buffer.
+ *
+ */
+void WriteDump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, size_t aLength);
+
+/**
+ * This function registers the reader handler.
+ *
+ * @param[in]  aHandler  A pointer to the handler function, or NULL to remove the handler.
+ * @param[in]  aContext  A pointer to application-specific context.
+ *
+ */
+void SetHandler(otLoggingBinaryHandler aHandler, void *aContext);
+
+/**
+ * This function reads whole records from the ring buffer.
+ *
+ * @param[out]  aBuffer  A pointer to a buffer to output the records.
+ * @param[in]   aLength  The size of @p aBuffer (in bytes).
+ *
+ * @returns The number of bytes read.
+ *
+ */
+uint16_t Read(uint8_t *aBuffer, uint16_t aLength);
+
+/**
+ * This function formats a record.
+ *
+ * @param[in]   aRecord  A pointer to the record.
+ * @param[in]   aLength  The length of the record (in bytes).
+ * @param[out]  aInfo    A reference to output the record metadata.
+ * @param[out]  aString  A pointer to a buffer to output the NULL-terminated log string.
+ * @param[in]   aSize    The size of @p aString (in bytes).
+ *
+ * @retval OT_ERROR_NONE   Successfully formatted the record.
+ * @retval OT_ERROR_PARSE  The record is malformed, or its format string was not written by this image.
+ *
+ */
+otError Decode(const uint8_t *aRecord, uint16_t aLength, otLogBinaryRecordInfo &aInfo, char *aString, uint16_t aSize);
+
+/**
+ * This function returns the number of records dropped because the ring buffer was full.
+ *
+ * @returns The number of dropped records.
+ *
+ */
+uint32_t GetDropCount(void);
+
+} // namespace BinaryLog
+
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // BINARY_LOG_HPP_
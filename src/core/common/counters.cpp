@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the performance counters registry.
+ */
+
+#include "counters.hpp"
+
+#include "utils/wrap_string.h"
+
+#include "common/code_utils.hpp"
+
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+
+namespace ot {
+
+// Must follow the order of `Counters::Id`.
+const Counters::Entry Counters::sEntries[kNumCounters] = {
+    {"TaskletRuns", OT_COUNTER_TYPE_EVENT},
+    {"TimerFires", OT_COUNTER_TYPE_EVENT},
+    {"MessageBuffersInUse", OT_COUNTER_TYPE_HIGH_WATER_MARK},
+    {"SendQueueMessages", OT_COUNTER_TYPE_HIGH_WATER_MARK},
+    {"AesCcmOperations", OT_COUNTER_TYPE_EVENT},
+    {"HmacSha256Operations", OT_COUNTER_TYPE_EVENT},
+    {"ReassemblyDrops", OT_COUNTER_TYPE_EVENT},
+    {"AddressQueries", OT_COUNTER_TYPE_EVENT},
+    {"AddressQueryRetries", OT_COUNTER_TYPE_EVENT},
+    {"SettingsWrites", OT_COUNTER_TYPE_EVENT},
+    {"SettingsCoalesced", OT_COUNTER_TYPE_EVENT},
+    {"ChildUpdatesSent", OT_COUNTER_TYPE_EVENT},
+    {"ChildUpdatesDeferred", OT_COUNTER_TYPE_EVENT},
+    {"ChildUpdatesQueued", OT_COUNTER_TYPE_HIGH_WATER_MARK},
+    {"RouteTlvRebuilds", OT_COUNTER_TYPE_EVENT},
+    {"RouteTlvReuses", OT_COUNTER_TYPE_EVENT},
+    {"MleSecuredMessages", OT_COUNTER_TYPE_EVENT},
+    {"MleSecuredBytes", OT_COUNTER_TYPE_EVENT},
+    {"FrameBurstFrames", OT_COUNTER_TYPE_EVENT},
+};
+
+Counters::Counters(void)
+{
+    Reset();
+}
+
+otError Counters::GetCounter(uint16_t aIndex, otCounter &aCounter) const
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aIndex < kNumCounters, error = OT_ERROR_NOT_FOUND);
+
+    aCounter.mName  = sEntries[aIndex].mName;
+    aCounter.mType  = sEntries[aIndex].mType;
+    aCounter.mValue = mValues[aIndex];
+
+exit:
+    return error;
+}
+
+void Counters::Reset(void)
+{
+    memset(mValues, 0, sizeof(mValues));
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the performance counters registry.
+ */
+
+#ifndef COUNTERS_HPP_
+#define COUNTERS_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/counters.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-counters
+ *
+ * @brief
+ *   This module includes definitions for the performance counters registry.
+ *
+ * @{
+ *
+ */
+
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+
+/**
+ * This macro increments an event counter.
+ *
+ * @param[in]  aInstance  A reference to the OpenThread instance.
+ * @param[in]  aId        The counter id (a `Counters::Id` without the `Counters::` prefix).
+ *
+ */
+#define OT_COUNTER_INCREMENT(aInstance, aId) (aInstance).Get<Counters>().Increment(Counters::aId)
+
+/**
+ * This macro adds a value to an event counter.
+ *
+ * @param[in]  aInstance  A reference to the OpenThread instance.
+ * @param[in]  aId        The counter id (a `Counters::Id` without the `Counters::` prefix).
+ * @param[in]  aValue     The value to add. It is not evaluated when the counters are disabled.
+ *
+ */
+#define OT_COUNTER_ADD(aInstance, aId, aValue) (aInstance).Get<Counters>().Add(Counters::aId, aValue)
+
+/**
+ * This macro updates a high-water mark counter.
+ *
+ * @param[in]  aInstance  A reference to the OpenThread instance.
+ * @param[in]  aId        The counter id (a `Counters::Id` without the `Counters::` prefix).
+ * @param[in]  aValue     The current value. It is not evaluated when the counters are disabled.
+ *
+ */
+#define OT_COUNTER_UPDATE_HIGH_WATER_MARK(aInstance, aId, aValue) \
+    (aInstance).Get<Counters>().UpdateHighWaterMark(Counters::aId, aValue)
+
+/**
+ * This class implements the performance counters registry.
+ *
+ * A module adds a counter by adding its id to `Id` and its name and type to the table in `counters.cpp`, and updates
+ * it with `OT_COUNTER_INCREMENT()`, `OT_COUNTER_ADD()` or `OT_COUNTER_UPDATE_HIGH_WATER_MARK()`.
+ *
+ */
+class Counters
+{
+public:
+    /**
+     * This enumeration defines the counter ids.
+     *
+     */
+    enum Id
+    {
+        kTaskletRuns,          ///< Tasklets run.
+        kTimerFires,           ///< Timers fired.
+        kMessageBuffersInUse,  ///< High-water mark of message buffers in use.
+        kSendQueueMessages,    ///< High-water mark of messages in the mesh forwarder send queue.
+        kAesCcmOperations,     ///< AES-CCM encryptions and decryptions (MAC and MLE).
+        kHmacSha256Operations, ///< HMAC-SHA256 computations (key derivation).
+        kReassemblyDrops,      ///< 6LoWPAN reassemblies dropped.
+        kAddressQueries,       ///< Address Query messages sent.
+        kAddressQueryRetries,  ///< Address Query messages re-sent after a failed query.
+        kSettingsWrites,       ///< Settings writes deferred to the write-behind tasklet.
+        kSettingsCoalesced,    ///< Settings writes coalesced with a pending write to the same key.
+        kChildUpdatesSent,     ///< Child Update Requests sent to update the Network Data of sleepy children.
+        kChildUpdatesDeferred, ///< Network Data updates of sleepy children deferred by the outstanding limit.
+        kChildUpdatesQueued,   ///< High-water mark of queued Network Data Child Update Requests.
+        kRouteTlvRebuilds,     ///< Route TLVs filled from the router table.
+        kRouteTlvReuses,       ///< Route TLVs reused from the cache because the router table did not change.
+        kMleSecuredMessages,   ///< MLE messages encrypted or decrypted.
+        kMleSecuredBytes,      ///< Bytes of MLE message payload encrypted or decrypted.
+        kFrameBurstFrames,     ///< Frames sent to sleepy children in a burst, without waiting for a data poll.
+        kNumCounters,          ///< Number of counters.
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    Counters(void);
+
+    /**
+     * This method increments an event counter.
+     *
+     * @param[in]  aId  The counter id.
+     *
+     */
+    void Increment(Id aId) { mValues[aId]++; }
+
+    /**
+     * This method adds a value to an event counter.
+     *
+     * @param[in]  aId     The counter id.
+     * @param[in]  aValue  The value to add.
+     *
+     */
+    void Add(Id aId, uint32_t aValue) { mValues[aId] += aValue; }
+
+    /**
+     * This method updates a high-water mark counter.
+     *
+     * @param[in]  aId     The counter id.
+     * @param[in]  aValue  The current value.
+     *
+     */
+    void UpdateHighWaterMark(Id aId, uint32_t aValue)
+    {
+        if (aValue > mValues[aId])
+        {
+            mValues[aId] = aValue;
+        }
+    }
+
+    /**
+     * This method gets a counter.
+     *
+     * @param[in]   aIndex    The counter index.
+     * @param[out]  aCounter  A reference to output the counter.
+     *
+     * @retval OT_ERROR_NONE       Successfully retrieved the counter.
+     * @retval OT_ERROR_NOT_FOUND  @p aIndex is out of range.
+     *
+     */
+    otError GetCounter(uint16_t aIndex, otCounter &aCounter) const;
+
+    /**
+     * This method resets all counters to zero.
+     *
+     */
+    void Reset(void);
+
+private:
+    struct Entry
+    {
+        const char *  mName;
+        otCounterType mType;
+    };
+
+    static const Entry sEntries[kNumCounters];
+
+    uint32_t mValues[kNumCounters];
+};
+
+#else // OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+
+#define OT_COUNTER_INCREMENT(aInstance, aId)
+#define OT_COUNTER_ADD(aInstance, aId, aValue)
+#define OT_COUNTER_UPDATE_HIGH_WATER_MARK(aInstance, aId, aValue)
+
+#endif // OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // COUNTERS_HPP_
@@ -65,6 +65,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
     , mTimerMicroScheduler(*this)
 #endif
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+    , mCounters()
+#endif
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 #if !OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE && !OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
     , mHeap()
@@ -98,6 +101,9 @@ Instance::Instance(void)
 #if OPENTHREAD_CONFIG_ANNOUNCE_SENDER_ENABLE
     , mAnnounceSender(*this)
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    , mLatencyTracer(*this)
+#endif
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
     , mLinkRaw(*this)
@@ -163,6 +169,9 @@ exit:
 
 void Instance::Reset(void)
 {
+#if OPENTHREAD_MTD || OPENTHREAD_FTD
+    Get<Settings>().Flush();
+#endif
     otPlatReset(this);
 }
 
@@ -44,6 +44,7 @@
 #include <openthread/heap.h>
 #include <openthread/platform/logging.h>
 
+#include "common/counters.hpp"
 #include "common/random_manager.hpp"
 #include "diags/factory_diags.hpp"
 
@@ -71,6 +72,9 @@
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
 #include "utils/channel_monitor.hpp"
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+#include "utils/latency_tracer.hpp"
+#endif
 #endif // OPENTHREAD_FTD || OPENTHREAD_MTD
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
 #include "common/extension.hpp"
@@ -328,6 +332,7 @@ private:
     //
     // Tasklet and Timer Schedulers are first to ensure other
     // objects/classes can use them from their constructors.
+    // Counters follow, as any object may update them.
 
     TaskletScheduler    mTaskletScheduler;
     TimerMilliScheduler mTimerMilliScheduler;
@@ -335,6 +340,10 @@ private:
     TimerMicroScheduler mTimerMicroScheduler;
 #endif
 
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+    Counters mCounters;
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     // RandomManager is initialized before other objects. Note that it
     // requires MbedTls which itself may use Heap.
@@ -390,6 +399,10 @@ private:
     AnnounceSender mAnnounceSender;
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Utils::LatencyTracer mLatencyTracer;
+#endif
+
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
     Mac::LinkRaw mLinkRaw;
@@ -519,6 +532,13 @@ template <> inline DataPollHandler &Instance::Get(void)
     return mThreadNetif.mMeshForwarder.mIndirectSender.mDataPollHandler;
 }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+template <> inline VirtualReassembler &Instance::Get(void)
+{
+    return mThreadNetif.mMeshForwarder.mVirtualReassembler;
+}
+#endif
+
 template <> inline AddressResolver &Instance::Get(void)
 {
     return mThreadNetif.mAddressResolver;
@@ -698,6 +718,13 @@ template <> inline Utils::ChannelManager &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+template <> inline Utils::LatencyTracer &Instance::Get(void)
+{
+    return mLatencyTracer;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_BORDER_AGENT_ENABLE
 template <> inline MeshCoP::BorderAgent &Instance::Get(void)
 {
@@ -751,6 +778,13 @@ template <> inline TimerMicroScheduler &Instance::Get(void)
 }
 #endif
 
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+template <> inline Counters &Instance::Get(void)
+{
+    return mCounters;
+}
+#endif
+
 #if OPENTHREAD_ENABLE_VENDOR_EXTENSION
 template <> inline Extension::ExtensionBase &Instance::Get(void)
 {
@@ -33,6 +33,7 @@
 
 #include "logging.hpp"
 
+#include "common/binary_log.hpp"
 #include "common/instance.hpp"
 
 /*
@@ -52,6 +53,13 @@ extern "C" {
 #endif
 
 #if OPENTHREAD_CONFIG_LOG_PKT_DUMP == 1
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+void otDump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const void *aBuf, const size_t aLength)
+{
+    ot::BinaryLog::WriteDump(aLogLevel, aLogRegion, aId, aBuf, aLength);
+}
+#else  // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 /**
  * This static method outputs a line of the memory dump.
  *
@@ -150,6 +158,8 @@ void otDump(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aId, const
 
     otLogDump("%s", buf);
 }
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
 #else  // OPENTHREAD_CONFIG_LOG_PKT_DUMP
 void otDump(otLogLevel, otLogRegion, const char *, const void *, const size_t)
 {
@@ -119,6 +119,10 @@ void MessagePool::Free(Message *aMessage)
 {
     assert(aMessage->Next() == NULL && aMessage->Prev() == NULL);
 
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    FreeBuffers(aMessage->mBuffer.mHead.mInfo.mChildMask);
+#endif
+
     FreeBuffers(static_cast<Buffer *>(aMessage));
 }
 
@@ -127,6 +131,15 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
     Buffer *buffer = NULL;
 
     SuccessOrExit(ReclaimBuffers(1, aPriority));
+    buffer = AllocateBuffer();
+
+exit:
+    return buffer;
+}
+
+Buffer *MessagePool::AllocateBuffer(void)
+{
+    Buffer *buffer = NULL;
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
 
@@ -140,6 +153,8 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
         mFreeBuffers = mFreeBuffers->GetNextBuffer();
         buffer->SetNextBuffer(NULL);
         mNumFreeBuffers--;
+        OT_COUNTER_UPDATE_HIGH_WATER_MARK(GetInstance(), kMessageBuffersInUse,
+                                          static_cast<uint32_t>(kNumBuffers - mNumFreeBuffers));
     }
 
 #endif
@@ -149,7 +164,6 @@ Buffer *MessagePool::NewBuffer(uint8_t aPriority)
         otLogInfoMem("No available message buffer");
     }
 
-exit:
     return buffer;
 }
 
@@ -285,6 +299,7 @@ otError Message::SetLength(uint16_t aLength)
 
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
     mBuffer.mHead.mInfo.mLength = aLength;
+    InvalidateTlvIndex();
 
     // Correct offset in case shorter length is set.
     if (GetOffset() > aLength)
@@ -296,6 +311,14 @@ exit:
     return error;
 }
 
+void Message::InvalidateTlvIndex(void)
+{
+    if (GetTlvIndex() != NULL)
+    {
+        GetTlvIndex()->Invalidate();
+    }
+}
+
 uint8_t Message::GetBufferCount(void) const
 {
     uint8_t rval = 1;
@@ -448,6 +471,7 @@ void Message::RemoveHeader(uint16_t aLength)
 
     mBuffer.mHead.mInfo.mReserved += aLength;
     mBuffer.mHead.mInfo.mLength -= aLength;
+    InvalidateTlvIndex();
 
     if (mBuffer.mHead.mInfo.mOffset > aLength)
     {
@@ -545,6 +569,8 @@ int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
 
     assert(aOffset + aLength <= GetLength());
 
+    InvalidateTlvIndex();
+
     if (aOffset + aLength >= GetLength())
     {
         aLength = GetLength() - aOffset;
@@ -611,6 +637,78 @@ int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
     return bytesCopied;
 }
 
+void Message::GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk)
+{
+    aChunk.mData   = NULL;
+    aChunk.mLength = 0;
+    aChunk.mBuffer = this;
+
+    VerifyOrExit(aOffset < GetLength(), aLength = 0);
+
+    if (aLength > GetLength() - aOffset)
+    {
+        aLength = GetLength() - aOffset;
+    }
+
+    aOffset += GetReserved();
+
+    // special case first buffer
+    if (aOffset < kHeadBufferDataSize)
+    {
+        aChunk.mData   = GetFirstData() + aOffset;
+        aChunk.mLength = kHeadBufferDataSize - aOffset;
+    }
+    else
+    {
+        aOffset -= kHeadBufferDataSize;
+
+        // advance to offset
+        aChunk.mBuffer = GetNextBuffer();
+
+        while (aOffset >= kBufferDataSize)
+        {
+            assert(aChunk.mBuffer != NULL);
+
+            aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+            aOffset -= kBufferDataSize;
+        }
+
+        assert(aChunk.mBuffer != NULL);
+
+        aChunk.mData   = aChunk.mBuffer->GetData() + aOffset;
+        aChunk.mLength = kBufferDataSize - aOffset;
+    }
+
+    if (aChunk.mLength > aLength)
+    {
+        aChunk.mLength = aLength;
+    }
+
+    aLength -= aChunk.mLength;
+
+exit:
+    return;
+}
+
+void Message::GetNextChunk(uint16_t &aLength, Chunk &aChunk)
+{
+    aChunk.mData   = NULL;
+    aChunk.mLength = 0;
+
+    VerifyOrExit(aLength > 0);
+
+    aChunk.mBuffer = aChunk.mBuffer->GetNextBuffer();
+    assert(aChunk.mBuffer != NULL);
+
+    aChunk.mData   = aChunk.mBuffer->GetData();
+    aChunk.mLength = (aLength < kBufferDataSize) ? aLength : static_cast<uint16_t>(kBufferDataSize);
+
+    aLength -= aChunk.mLength;
+
+exit:
+    return;
+}
+
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
     uint16_t bytesCopied = 0;
@@ -665,6 +763,96 @@ exit:
     return messageCopy;
 }
 
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
+bool Message::GetChildMask(uint16_t aChildIndex) const
+{
+    const MessageInfo &info = mBuffer.mHead.mInfo;
+    bool               rval;
+
+    assert(aChildIndex < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    if (info.mChildMask != NULL)
+    {
+        rval = (info.mChildMask->GetData()[aChildIndex / 8] & (0x80 >> (aChildIndex % 8))) != 0;
+    }
+    else
+    {
+        rval = (info.mChildIndex == aChildIndex + 1);
+    }
+
+    return rval;
+}
+
+void Message::ClearChildMask(uint16_t aChildIndex)
+{
+    MessageInfo &info = mBuffer.mHead.mInfo;
+
+    assert(aChildIndex < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    if (info.mChildMask != NULL)
+    {
+        uint8_t *mask = info.mChildMask->GetData();
+
+        mask[aChildIndex / 8] &= ~(0x80 >> (aChildIndex % 8));
+
+        for (uint16_t i = 0; i < kChildMaskBytes; i++)
+        {
+            VerifyOrExit(mask[i] == 0);
+        }
+
+        // The mask buffer is freed once no child is pending, so that `IsChildPending()` does not read it.
+        GetMessagePool()->FreeBuffers(info.mChildMask);
+        info.mChildMask = NULL;
+    }
+    else if (info.mChildIndex == aChildIndex + 1)
+    {
+        info.mChildIndex = 0;
+    }
+
+exit:
+    return;
+}
+
+otError Message::SetChildMask(uint16_t aChildIndex)
+{
+    OT_STATIC_ASSERT(static_cast<int>(kChildMaskBytes) <= static_cast<int>(kBufferDataSize),
+                     "child mask does not fit in a message buffer");
+
+    MessageInfo &info  = mBuffer.mHead.mInfo;
+    otError      error = OT_ERROR_NONE;
+    uint8_t *    mask;
+
+    assert(aChildIndex < OPENTHREAD_CONFIG_MLE_MAX_CHILDREN);
+
+    if (info.mChildMask == NULL)
+    {
+        VerifyOrExit(info.mChildIndex != 0 && info.mChildIndex != aChildIndex + 1, info.mChildIndex = aChildIndex + 1);
+
+        // A second child, move to a bit-vector. The buffer is not reclaimed from the send queue as this message
+        // may be the one that would be evicted.
+        VerifyOrExit((info.mChildMask = GetMessagePool()->AllocateBuffer()) != NULL, error = OT_ERROR_NO_BUFS);
+        info.mChildMask->SetNextBuffer(NULL);
+
+        mask = info.mChildMask->GetData();
+        memset(mask, 0, kChildMaskBytes);
+        mask[(info.mChildIndex - 1) / 8] |= 0x80 >> ((info.mChildIndex - 1) % 8);
+        info.mChildIndex = 0;
+    }
+
+    info.mChildMask->GetData()[aChildIndex / 8] |= 0x80 >> (aChildIndex % 8);
+
+exit:
+    return error;
+}
+
+bool Message::IsChildPending(void) const
+{
+    return (mBuffer.mHead.mInfo.mChildMask != NULL) || (mBuffer.mHead.mInfo.mChildIndex != 0);
+}
+
+#else // OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
 bool Message::GetChildMask(uint16_t aChildIndex) const
 {
     assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
@@ -677,10 +865,12 @@ void Message::ClearChildMask(uint16_t aChildIndex)
     mBuffer.mHead.mInfo.mChildMask[aChildIndex / 8] &= ~(0x80 >> (aChildIndex % 8));
 }
 
-void Message::SetChildMask(uint16_t aChildIndex)
+otError Message::SetChildMask(uint16_t aChildIndex)
 {
     assert(aChildIndex < sizeof(mBuffer.mHead.mInfo.mChildMask) * 8);
     mBuffer.mHead.mInfo.mChildMask[aChildIndex / 8] |= 0x80 >> (aChildIndex % 8);
+
+    return OT_ERROR_NONE;
 }
 
 bool Message::IsChildPending(void) const
@@ -699,6 +889,8 @@ exit:
     return rval;
 }
 
+#endif // OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aValue)
 {
     uint16_t result = aChecksum + aValue;
@@ -886,6 +1078,7 @@ void MessageQueue::GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) cons
 }
 
 PriorityQueue::PriorityQueue(void)
+    : mNumMessages(0)
 {
     for (int priority = 0; priority < Message::kNumPriorities; priority++)
     {
@@ -980,6 +1173,7 @@ otError PriorityQueue::Enqueue(Message &aMessage)
     }
 
     mTails[priority] = &aMessage;
+    mNumMessages++;
 
 exit:
     return error;
@@ -1015,6 +1209,7 @@ otError PriorityQueue::Dequeue(Message &aMessage)
     aMessage.Prev()         = NULL;
 
     aMessage.SetMessageQueue(NULL);
+    mNumMessages--;
 
 exit:
     return error;
@@ -68,6 +68,7 @@ enum
     kChildMaskBytes = BitVectorBytes(OPENTHREAD_CONFIG_MLE_MAX_CHILDREN),
 };
 
+class Buffer;
 class Message;
 class MessagePool;
 class MessageQueue;
@@ -87,6 +88,7 @@ struct MessageInfo
         MessageQueue * mMessage;  ///< Identifies the message queue (if any) where this message is queued.
         PriorityQueue *mPriority; ///< Identifies the priority queue (if any) where this message is queued.
     } mQueue;                     ///< Identifies the queue (if any) where this message is queued.
+    TlvIndex *mTlvIndex;          ///< The TLV index attached to this message (if any).
 
     uint32_t mDatagramTag;    ///< The datagram tag used for 6LoWPAN fragmentation or identification used for IPv6
                               ///< fragmentation.
@@ -95,8 +97,13 @@ struct MessageInfo
     uint16_t    mOffset;      ///< A byte offset within the message.
     RssAverager mRssAverager; ///< The averager maintaining the received signal strength (RSS) average.
 
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    Buffer * mChildMask;  ///< A buffer with a bit-vector of the sleepy children to receive this (if more than one).
+    uint16_t mChildIndex; ///< The child table index plus one of the only sleepy child to receive this (zero if none).
+#else
     uint8_t mChildMask[kChildMaskBytes]; ///< A bit-vector to indicate which sleepy children need to receive this.
-    uint8_t mTimeout;                    ///< Seconds remaining before dropping the message.
+#endif
+    uint8_t mTimeout; ///< Seconds remaining before dropping the message.
     union
     {
         uint16_t mPanId;   ///< Used for MLE Discover Request and Response messages.
@@ -116,6 +123,10 @@ struct MessageInfo
     uint8_t mTimeSyncSeq;       ///< The time sync sequence.
     int64_t mNetworkTimeOffset; ///< The time offset to the Thread network time, in microseconds.
 #endif
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    uint32_t mLatencyTimestamps[OT_MESSAGE_LATENCY_NUM_STAGES]; ///< Time of each latency stage (in microseconds).
+    uint8_t  mLatencyStageMask;                                 ///< Bit-vector of the recorded latency stages.
+#endif
 };
 
 /**
@@ -438,6 +449,61 @@ public:
      */
     int Write(uint16_t aOffset, uint16_t aLength, const void *aBuf);
 
+    /**
+     * This class represents a contiguous range of the message data, within a single message buffer.
+     *
+     */
+    class Chunk
+    {
+        friend class Message;
+
+    public:
+        /**
+         * This method returns a pointer to the data of the chunk.
+         *
+         * @returns A pointer to the data.
+         *
+         */
+        uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the length of the chunk.
+         *
+         * @returns The length of the chunk in bytes.
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+    private:
+        uint8_t *mData;
+        uint16_t mLength;
+        Buffer * mBuffer;
+    };
+
+    /**
+     * This method gets the first chunk of a range of the message data.
+     *
+     * The chunks give access to the message data in place, so that it is processed without copying it to and from a
+     * separate buffer. A range is processed by calling `GetNextChunk()` until it returns an empty chunk.
+     *
+     * @param[in]     aOffset  Byte offset within the message of the range.
+     * @param[inout]  aLength  On input, the length of the range. On output, the length of the range after the chunk.
+     * @param[out]    aChunk   A reference to output the chunk. It is empty if the range is empty.
+     *
+     */
+    void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &aChunk);
+
+    /**
+     * This method gets the next chunk of a range of the message data.
+     *
+     * @param[inout]  aLength  On input, the length of the range after @p aChunk. On output, the length of the range
+     *                         after the next chunk.
+     * @param[inout]  aChunk   On input, the previous chunk. On output, the next chunk, or an empty chunk at the end
+     *                         of the range.
+     *
+     */
+    void GetNextChunk(uint16_t &aLength, Chunk &aChunk);
+
     /**
      * This method copies bytes from one message to another.
      *
@@ -518,8 +584,11 @@ public:
      *
      * @param[in]  aChildIndex  The index into the child table.
      *
+     * @retval OT_ERROR_NONE     Successfully scheduled forwarding of the message to the child.
+     * @retval OT_ERROR_NO_BUFS  Insufficient message buffers to track the children (large child table only).
+     *
      */
-    void SetChildMask(uint16_t aChildIndex);
+    otError SetChildMask(uint16_t aChildIndex);
 
     /**
      * This method returns whether or not the message forwarding is scheduled for at least one child.
@@ -586,6 +655,24 @@ public:
      */
     void SetTimeout(uint8_t aTimeout) { mBuffer.mHead.mInfo.mTimeout = aTimeout; }
 
+    /**
+     * This method returns the TLV index attached to the message.
+     *
+     * @returns A pointer to the TLV index, or NULL if none is attached.
+     *
+     */
+    TlvIndex *GetTlvIndex(void) const { return mBuffer.mHead.mInfo.mTlvIndex; }
+
+    /**
+     * This method sets the TLV index attached to the message.
+     *
+     * The index is invalidated whenever the message content or length is changed.
+     *
+     * @param[in]  aTlvIndex  A pointer to the TLV index, or NULL to detach it.
+     *
+     */
+    void SetTlvIndex(TlvIndex *aTlvIndex) { mBuffer.mHead.mInfo.mTlvIndex = aTlvIndex; }
+
     /**
      * This method decrements the timeout.
      *
@@ -791,6 +878,64 @@ public:
     uint8_t GetTimeSyncSeq(void) const { return mBuffer.mHead.mInfo.mTimeSyncSeq; }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    /**
+     * This method indicates whether or not a latency stage has been recorded.
+     *
+     * @param[in]  aStage  The latency stage (`otMessageLatencyStage`).
+     *
+     * @retval TRUE   If @p aStage has been recorded.
+     * @retval FALSE  If @p aStage has not been recorded.
+     *
+     */
+    bool IsLatencyStageRecorded(uint8_t aStage) const
+    {
+        return (mBuffer.mHead.mInfo.mLatencyStageMask & (1U << aStage)) != 0;
+    }
+
+    /**
+     * This method returns the bit-vector of the recorded latency stages.
+     *
+     * @returns The bit-vector of the recorded latency stages, bit `n` for stage `n`.
+     *
+     */
+    uint8_t GetLatencyStageMask(void) const { return mBuffer.mHead.mInfo.mLatencyStageMask; }
+
+    /**
+     * This method returns the time a latency stage was recorded.
+     *
+     * @param[in]  aStage  The latency stage (`otMessageLatencyStage`).
+     *
+     * @returns The time @p aStage was recorded (in microseconds).
+     *
+     */
+    uint32_t GetLatencyTimestamp(uint8_t aStage) const { return mBuffer.mHead.mInfo.mLatencyTimestamps[aStage]; }
+
+    /**
+     * This method records the time of a latency stage.
+     *
+     * @param[in]  aStage      The latency stage (`otMessageLatencyStage`).
+     * @param[in]  aTimestamp  The time of @p aStage (in microseconds).
+     *
+     */
+    void SetLatencyTimestamp(uint8_t aStage, uint32_t aTimestamp)
+    {
+        mBuffer.mHead.mInfo.mLatencyTimestamps[aStage] = aTimestamp;
+        mBuffer.mHead.mInfo.mLatencyStageMask |= static_cast<uint8_t>(1U << aStage);
+    }
+
+    /**
+     * This method clears recorded latency stages.
+     *
+     * @param[in]  aStageMask  The bit-vector of latency stages to clear.
+     *
+     */
+    void ClearLatencyStages(uint8_t aStageMask)
+    {
+        mBuffer.mHead.mInfo.mLatencyStageMask &= static_cast<uint8_t>(~aStageMask);
+    }
+#endif // OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
 private:
     /**
      * This method returns a pointer to the message pool to which this message belongs
@@ -894,6 +1039,12 @@ private:
      *
      */
     otError ResizeMessage(uint16_t aLength);
+
+    /**
+     * This method invalidates the TLV index attached to the message (if any), after its content has changed.
+     *
+     */
+    void InvalidateTlvIndex(void);
 };
 
 /**
@@ -1059,6 +1210,16 @@ public:
      */
     void GetInfo(uint16_t &aMessageCount, uint16_t &aBufferCount) const;
 
+    /**
+     * This method returns the number of messages enqueued.
+     *
+     * Unlike `GetInfo()`, this method does not iterate over the messages.
+     *
+     * @returns The number of messages enqueued.
+     *
+     */
+    uint16_t GetNumMessages(void) const { return mNumMessages; }
+
     /**
      * This method returns the tail of the list (last message in the list)
      *
@@ -1094,6 +1255,7 @@ private:
 
 private:
     Message *mTails[Message::kNumPriorities]; ///< Tail pointers associated with different priority levels.
+    uint16_t mNumMessages;                    ///< Number of messages enqueued.
 };
 
 /**
@@ -1164,6 +1326,7 @@ private:
     };
 
     Buffer *NewBuffer(uint8_t aPriority);
+    Buffer *AllocateBuffer(void);
     void    FreeBuffers(Buffer *aBuffer);
     otError ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
 
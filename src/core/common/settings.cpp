@@ -38,7 +38,9 @@
 #include "utils/wrap_string.h"
 
 #include "common/code_utils.hpp"
+#include "common/debug.hpp"
 #include "common/instance.hpp"
+#include "common/locator-getters.hpp"
 #include "common/logging.hpp"
 #include "meshcop/dataset.hpp"
 #include "thread/mle.hpp"
@@ -75,6 +77,18 @@ void SettingsBase::LogChildInfo(const char *aAction, const ChildInfo &aChildInfo
                   aChildInfo.mMode);
 }
 
+void SettingsBase::LogRouterTableInfo(const char *aAction, const RouterTableInfo &aRouterTableInfo) const
+{
+    otLogInfoCore("Non-volatile: %s RouterTableInfo {pid:0x%x, keyseq:0x%x, routes:%u}", aAction,
+                  aRouterTableInfo.mPartitionId, aRouterTableInfo.mKeySequence, aRouterTableInfo.mNumRoutes);
+}
+
+void SettingsBase::LogAddressCacheInfo(const char *aAction, const AddressCacheInfo &aAddressCacheInfo) const
+{
+    otLogInfoCore("Non-volatile: %s AddressCacheInfo {pid:0x%x, entries:%u}", aAction, aAddressCacheInfo.mPartitionId,
+                  aAddressCacheInfo.mNumEntries);
+}
+
 #endif // #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_INFO)
 
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_WARN)
@@ -92,6 +106,34 @@ void SettingsBase::LogFailure(otError error, const char *aText, bool aIsDelete)
 
 // LCOV_EXCL_STOP
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+const Settings::PendingKey Settings::sPendingKeys[kNumPendingKeys] = {
+    {kKeyActiveDataset, 0, MeshCoP::Dataset::kMaxSize},
+    {kKeyPendingDataset, MeshCoP::Dataset::kMaxSize, MeshCoP::Dataset::kMaxSize},
+    {kKeyNetworkInfo, 2 * MeshCoP::Dataset::kMaxSize, sizeof(NetworkInfo)},
+    {kKeyParentInfo, 2 * MeshCoP::Dataset::kMaxSize + sizeof(NetworkInfo), sizeof(ParentInfo)},
+    {kKeySlaacIidSecretKey, 2 * MeshCoP::Dataset::kMaxSize + sizeof(NetworkInfo) + sizeof(ParentInfo), kSlaacKeySize},
+    {kKeyRouterTableInfo, 2 * MeshCoP::Dataset::kMaxSize + sizeof(NetworkInfo) + sizeof(ParentInfo) + kSlaacKeySize,
+     kRouterTableInfoSize},
+    {kKeyAddressCacheInfo,
+     2 * MeshCoP::Dataset::kMaxSize + sizeof(NetworkInfo) + sizeof(ParentInfo) + kSlaacKeySize + kRouterTableInfoSize,
+     kAddressCacheInfoSize},
+};
+
+#endif
+
+Settings::Settings(Instance &aInstance)
+    : SettingsBase(aInstance)
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    , mFlushTasklet(aInstance, &Settings::HandleFlushTasklet, this)
+#endif
+{
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    ClearPending();
+#endif
+}
+
 void Settings::Init(void)
 {
     otPlatSettingsInit(&GetInstance());
@@ -99,11 +141,15 @@ void Settings::Init(void)
 
 void Settings::Deinit(void)
 {
+    Flush();
     otPlatSettingsDeinit(&GetInstance());
 }
 
 void Settings::Wipe(void)
 {
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    ClearPending();
+#endif
     otPlatSettingsWipe(&GetInstance());
     otLogInfoCore("Non-volatile: Wiped all info");
 }
@@ -224,6 +270,79 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
+otError Settings::ReadRouterTableInfo(RouterTableInfo &aRouterTableInfo) const
+{
+    uint16_t size = sizeof(RouterTableInfo);
+    otError  error;
+
+    SuccessOrExit(error = ReadValue(kKeyRouterTableInfo, &aRouterTableInfo, size));
+    VerifyOrExit(size == sizeof(RouterTableInfo), error = OT_ERROR_NOT_FOUND);
+    LogRouterTableInfo("Read", aRouterTableInfo);
+
+exit:
+    return error;
+}
+
+otError Settings::SaveRouterTableInfo(const RouterTableInfo &aRouterTableInfo)
+{
+    otError error;
+
+    // The caller only saves the snapshot when it changed.
+    SuccessOrExit(error = Save(kKeyRouterTableInfo, &aRouterTableInfo, sizeof(RouterTableInfo)));
+    LogRouterTableInfo("Saved", aRouterTableInfo);
+
+exit:
+    LogFailure(error, "saving RouterTableInfo", false);
+    return error;
+}
+
+otError Settings::ReadAddressCacheInfo(AddressCacheInfo &aAddressCacheInfo) const
+{
+    uint16_t size = sizeof(AddressCacheInfo);
+    otError  error;
+
+    SuccessOrExit(error = ReadValue(kKeyAddressCacheInfo, &aAddressCacheInfo, size));
+    VerifyOrExit(size == sizeof(AddressCacheInfo), error = OT_ERROR_NOT_FOUND);
+    LogAddressCacheInfo("Read", aAddressCacheInfo);
+
+exit:
+    return error;
+}
+
+otError Settings::SaveAddressCacheInfo(const AddressCacheInfo &aAddressCacheInfo)
+{
+    otError error;
+
+    SuccessOrExit(error = Save(kKeyAddressCacheInfo, &aAddressCacheInfo, sizeof(AddressCacheInfo)));
+    LogAddressCacheInfo("Saved", aAddressCacheInfo);
+
+exit:
+    LogFailure(error, "saving AddressCacheInfo", false);
+    return error;
+}
+
+otError Settings::DeleteRouterTableInfo(void)
+{
+    otError error      = Delete(kKeyRouterTableInfo);
+    otError cacheError = Delete(kKeyAddressCacheInfo);
+
+    if (error == OT_ERROR_NOT_FOUND)
+    {
+        error = cacheError;
+    }
+
+    SuccessOrExit(error);
+    otLogInfoCore("Non-volatile: Deleted RouterTableInfo");
+
+exit:
+    LogFailure(error, "deleting RouterTableInfo", true);
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
 otError Settings::AddChildInfo(const ChildInfo &aChildInfo)
 {
     otError error;
@@ -252,6 +371,9 @@ Settings::ChildInfoIterator::ChildInfoIterator(Instance &aInstance)
     : SettingsBase(aInstance)
     , mIndex(0)
     , mIsDone(false)
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    , mIsPending(false)
+#endif
 {
     Reset();
 }
@@ -260,6 +382,9 @@ void Settings::ChildInfoIterator::Reset(void)
 {
     mIndex  = 0;
     mIsDone = false;
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    mIsPending = false;
+#endif
     Read();
 }
 
@@ -277,6 +402,20 @@ otError Settings::ChildInfoIterator::Delete(void)
     otError error = OT_ERROR_NONE;
 
     VerifyOrExit(!mIsDone, error = OT_ERROR_INVALID_STATE);
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    if (mIsPending)
+    {
+        Settings &settings = Get<Settings>();
+
+        settings.mNumChildInfos--;
+        memmove(&settings.mChildInfos[mIndex], &settings.mChildInfos[mIndex + 1],
+                (settings.mNumChildInfos - mIndex) * sizeof(ChildInfo));
+        LogChildInfo("Removed", mChildInfo);
+        ExitNow();
+    }
+#endif
+
     SuccessOrExit(error = otPlatSettingsDelete(&GetInstance(), kKeyChildInfo, mIndex));
     LogChildInfo("Removed", mChildInfo);
 
@@ -290,9 +429,39 @@ void Settings::ChildInfoIterator::Read(void)
     uint16_t size = sizeof(ChildInfo);
     otError  error;
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    const Settings &settings = Get<Settings>();
+
+    // Pending entries follow the stored ones, unless all stored entries are pending deletion.
+    if (!mIsPending)
+    {
+        error = OT_ERROR_NOT_FOUND;
+
+        if (!settings.mChildInfoDeleteAll)
+        {
+            error = otPlatSettingsGet(&GetInstance(), kKeyChildInfo, mIndex, reinterpret_cast<uint8_t *>(&mChildInfo),
+                                      &size);
+        }
+
+        if ((error != OT_ERROR_NONE) || (size < sizeof(ChildInfo)))
+        {
+            mIsPending = true;
+            mIndex     = 0;
+        }
+    }
+
+    if (mIsPending)
+    {
+        VerifyOrExit(mIndex < settings.mNumChildInfos, error = OT_ERROR_NOT_FOUND);
+        mChildInfo = settings.mChildInfos[mIndex];
+        error      = OT_ERROR_NONE;
+    }
+#else
     SuccessOrExit(error = otPlatSettingsGet(&GetInstance(), kKeyChildInfo, mIndex,
                                             reinterpret_cast<uint8_t *>(&mChildInfo), &size));
     VerifyOrExit(size >= sizeof(ChildInfo), error = OT_ERROR_NOT_FOUND);
+#endif
+
     LogChildInfo("Read", mChildInfo);
 
 exit:
@@ -304,7 +473,7 @@ otError Settings::ReadFixedSize(Key aKey, void *aBuffer, uint16_t aExpectedSize)
     uint16_t size = aExpectedSize;
     otError  error;
 
-    SuccessOrExit(error = otPlatSettingsGet(&GetInstance(), aKey, 0, reinterpret_cast<uint8_t *>(aBuffer), &size));
+    SuccessOrExit(error = ReadValue(aKey, aBuffer, size));
     VerifyOrExit(size >= aExpectedSize, error = OT_ERROR_NOT_FOUND);
 
 exit:
@@ -316,13 +485,239 @@ otError Settings::Read(Key aKey, void *aBuffer, uint16_t aMaxBufferSize, uint16_
     uint16_t size = aMaxBufferSize;
     otError  error;
 
-    SuccessOrExit(error = otPlatSettingsGet(&GetInstance(), aKey, 0, reinterpret_cast<uint8_t *>(aBuffer), &size));
+    SuccessOrExit(error = ReadValue(aKey, aBuffer, size));
     aReadSize = (size <= aMaxBufferSize) ? size : aMaxBufferSize;
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+otError Settings::ReadValue(Key aKey, void *aBuffer, uint16_t &aSize) const
+{
+    otError error = OT_ERROR_NONE;
+    int     index = FindPendingKey(aKey);
+
+    if ((index >= 0) && (mPendingWrites[index].mState != kPendingNone))
+    {
+        const PendingWrite &pending = mPendingWrites[index];
+
+        VerifyOrExit(pending.mState == kPendingSave, error = OT_ERROR_NOT_FOUND);
+        memcpy(aBuffer, &mPendingValues[sPendingKeys[index].mOffset],
+               (aSize < pending.mLength) ? aSize : pending.mLength);
+        aSize = pending.mLength;
+        ExitNow();
+    }
+
+    error = otPlatSettingsGet(&GetInstance(), aKey, 0, reinterpret_cast<uint8_t *>(aBuffer), &aSize);
+
+exit:
+    return error;
+}
+
+otError Settings::Save(Key aKey, const void *aValue, uint16_t aSize)
+{
+    return SetPending(aKey, kPendingSave, aValue, aSize);
+}
+
+otError Settings::Add(Key aKey, const void *aValue, uint16_t aSize)
+{
+    OT_UNUSED_VARIABLE(aKey);
+
+    assert((aKey == kKeyChildInfo) && (aSize == sizeof(ChildInfo)));
+
+    if (mNumChildInfos == kMaxChildInfos)
+    {
+        Flush();
+    }
+
+    EnqueuePending(kChildInfoPending);
+    memcpy(&mChildInfos[mNumChildInfos++], aValue, aSize);
+    OT_COUNTER_INCREMENT(GetInstance(), kSettingsWrites);
+
+    return OT_ERROR_NONE;
+}
+
+otError Settings::Delete(Key aKey)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aKey == kKeyChildInfo)
+    {
+        if (!EnqueuePending(kChildInfoPending))
+        {
+            OT_COUNTER_INCREMENT(GetInstance(), kSettingsCoalesced);
+        }
+
+        // Pending entries are dropped, stored entries are deleted when flushed.
+        mChildInfoDeleteAll = true;
+        mNumChildInfos      = 0;
+        OT_COUNTER_INCREMENT(GetInstance(), kSettingsWrites);
+        ExitNow();
+    }
+
+    error = SetPending(aKey, kPendingDelete, NULL, 0);
+
+exit:
+    return error;
+}
+
+int Settings::FindPendingKey(Key aKey) const
+{
+    int index = -1;
+
+    for (int i = 0; i < kNumPendingKeys; i++)
+    {
+        if (sPendingKeys[i].mKey == aKey)
+        {
+            ExitNow(index = i);
+        }
+    }
+
+exit:
+    return index;
+}
+
+otError Settings::SetPending(Key aKey, PendingState aState, const void *aValue, uint16_t aSize)
+{
+    otError error = OT_ERROR_NONE;
+    int     index = FindPendingKey(aKey);
+
+    assert(index >= 0);
+    VerifyOrExit(aSize <= sPendingKeys[index].mMaxSize, error = OT_ERROR_NO_BUFS);
+
+    if (mPendingWrites[index].mState == kPendingNone)
+    {
+        EnqueuePending(static_cast<uint8_t>(index));
+    }
+    else
+    {
+        // The pending write keeps its position, only the latest value is written.
+        OT_COUNTER_INCREMENT(GetInstance(), kSettingsCoalesced);
+    }
+
+    mPendingWrites[index].mState  = static_cast<uint8_t>(aState);
+    mPendingWrites[index].mLength = aSize;
+
+    if (aState == kPendingSave)
+    {
+        memcpy(&mPendingValues[sPendingKeys[index].mOffset], aValue, aSize);
+    }
+
+    OT_COUNTER_INCREMENT(GetInstance(), kSettingsWrites);
+
+exit:
+    return error;
+}
+
+bool Settings::EnqueuePending(uint8_t aIndex)
+{
+    bool queued = false;
+
+    // Each key is queued at most once, a pending write keeps its position until it is flushed.
+    for (uint8_t i = 0; i < mNumPendingOrder; i++)
+    {
+        VerifyOrExit(mPendingOrder[i] != aIndex);
+    }
+
+    assert(mNumPendingOrder < sizeof(mPendingOrder));
+    mPendingOrder[mNumPendingOrder++] = aIndex;
+    mFlushTasklet.Post();
+    queued = true;
+
+exit:
+    return queued;
+}
+
+void Settings::ClearPending(void)
+{
+    memset(mPendingWrites, 0, sizeof(mPendingWrites));
+    mNumPendingOrder    = 0;
+    mChildInfoDeleteAll = false;
+    mNumChildInfos      = 0;
+}
+
+void Settings::Flush(void)
+{
+    while (mNumPendingOrder > 0)
+    {
+        FlushNext();
+    }
+}
+
+void Settings::FlushNext(void)
+{
+    uint8_t index;
+    otError error;
+
+    VerifyOrExit(mNumPendingOrder > 0);
+
+    index = mPendingOrder[0];
+    mNumPendingOrder--;
+    memmove(&mPendingOrder[0], &mPendingOrder[1], mNumPendingOrder);
+
+    if (index == kChildInfoPending)
+    {
+        if (mChildInfoDeleteAll)
+        {
+            error = otPlatSettingsDelete(&GetInstance(), kKeyChildInfo, -1);
+            LogFailure(error, "deleting all ChildInfo", true);
+        }
+
+        for (uint8_t i = 0; i < mNumChildInfos; i++)
+        {
+            error = otPlatSettingsAdd(&GetInstance(), kKeyChildInfo, reinterpret_cast<const uint8_t *>(&mChildInfos[i]),
+                                      sizeof(ChildInfo));
+            LogFailure(error, "adding ChildInfo", false);
+        }
+
+        mChildInfoDeleteAll = false;
+        mNumChildInfos      = 0;
+    }
+    else
+    {
+        PendingWrite &pending = mPendingWrites[index];
+
+        if (pending.mState == kPendingSave)
+        {
+            error = otPlatSettingsSet(&GetInstance(), sPendingKeys[index].mKey,
+                                      &mPendingValues[sPendingKeys[index].mOffset], pending.mLength);
+            LogFailure(error, "writing pending settings", false);
+        }
+        else
+        {
+            error = otPlatSettingsDelete(&GetInstance(), sPendingKeys[index].mKey, -1);
+            LogFailure(error, "deleting pending settings", true);
+        }
+
+        pending.mState = kPendingNone;
+    }
+
+exit:
+    return;
+}
+
+void Settings::HandleFlushTasklet(Tasklet &aTasklet)
+{
+    Settings &settings = aTasklet.GetOwner<Settings>();
+
+    // Only one key is written per run, so that other tasklets run between the (possibly slow) flash writes.
+    settings.FlushNext();
+
+    if (settings.mNumPendingOrder > 0)
+    {
+        settings.mFlushTasklet.Post();
+    }
+}
+
+#else // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+otError Settings::ReadValue(Key aKey, void *aBuffer, uint16_t &aSize) const
+{
+    return otPlatSettingsGet(&GetInstance(), aKey, 0, reinterpret_cast<uint8_t *>(aBuffer), &aSize);
+}
+
 otError Settings::Save(Key aKey, const void *aValue, uint16_t aSize)
 {
     return otPlatSettingsSet(&GetInstance(), aKey, reinterpret_cast<const uint8_t *>(aValue), aSize);
@@ -338,4 +733,6 @@ otError Settings::Delete(Key aKey)
     return otPlatSettingsDelete(&GetInstance(), aKey, -1);
 }
 
+#endif // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
 } // namespace ot
@@ -37,11 +37,16 @@
 #include "openthread-core-config.h"
 
 #include "common/locator.hpp"
+#include "common/tasklet.hpp"
 #include "mac/mac_frame.hpp"
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+#include "meshcop/dataset.hpp"
+#endif
 #include "thread/mle.hpp"
 #if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
 #include "utils/slaac_address.hpp"
 #endif
+#include "utils/static_assert.hpp"
 
 namespace ot {
 
@@ -80,6 +85,11 @@ public:
      *
      */
 
+    enum
+    {
+        kMaxValueSize = 255, ///< Max value size supported by the flash settings (`OT_SETTINGS_BLOCK_DATA_SIZE`).
+    };
+
     /**
      * This structure represents the device's own network information for settings storage.
      *
@@ -118,6 +128,66 @@ public:
         uint8_t         mMode;       ///< The MLE device mode
     };
 
+    /**
+     * This structure represents the routes of the router table snapshot for settings storage.
+     *
+     * The value is only used when its size matches, since the array size depends on the build configuration.
+     *
+     */
+    struct RouterTableInfo
+    {
+        /**
+         * This structure represents a router table entry.
+         *
+         */
+        struct Route
+        {
+            uint8_t mRouterId;    ///< Router ID
+            uint8_t mNextHop;     ///< Router ID of the next hop
+            uint8_t mCost;        ///< Route cost through the next hop
+            uint8_t mLinkQuality; ///< Link quality out (bits 2-3) and in (bits 0-1), zero if not a neighbor
+        };
+
+        uint32_t mPartitionId;               ///< Partition ID
+        uint32_t mKeySequence;               ///< Key Sequence
+        uint8_t  mNumRoutes;                 ///< Number of entries in `mRoutes`
+        Route    mRoutes[Mle::kMaxRouters];  ///< Router table entries
+    };
+
+    /**
+     * This structure represents the EID-to-RLOC cache of the router table snapshot for settings storage.
+     *
+     * It is saved with its own key, so that each value fits in a settings record.
+     *
+     */
+    struct AddressCacheInfo
+    {
+        /**
+         * This structure represents an EID-to-RLOC cache entry.
+         *
+         */
+        struct Entry
+        {
+            Ip6::Address mTarget; ///< EID
+            uint16_t     mRloc16; ///< RLOC16
+        };
+
+        enum
+        {
+            kMaxValueEntries = (kMaxValueSize - sizeof(uint32_t) - sizeof(uint8_t)) / sizeof(Entry),
+            kMaxEntries      = (OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES < kMaxValueEntries)
+                              ? OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
+                              : kMaxValueEntries, ///< Max number of entries, the most recently used are saved
+        };
+
+        uint32_t mPartitionId;          ///< Partition ID of the `RouterTableInfo` saved with it
+        uint8_t  mNumEntries;           ///< Number of entries in `mEntries`, most recently used first
+        Entry    mEntries[kMaxEntries]; ///< EID-to-RLOC cache entries
+    };
+
+    OT_STATIC_ASSERT(sizeof(RouterTableInfo) <= kMaxValueSize, "RouterTableInfo does not fit in a settings record");
+    OT_STATIC_ASSERT(sizeof(AddressCacheInfo) <= kMaxValueSize, "AddressCacheInfo does not fit in a settings record");
+
 protected:
     /**
      * This enumeration defines the keys of settings.
@@ -132,6 +202,8 @@ protected:
         kKeyChildInfo         = 0x0005, ///< Child information
         kKeyReserved          = 0x0006, ///< Reserved (previously auto-start)
         kKeySlaacIidSecretKey = 0x0007, ///< Secret key used by SLAAC module for generating semantically opaque IID
+        kKeyRouterTableInfo   = 0x0008, ///< Router table snapshot
+        kKeyAddressCacheInfo  = 0x0009, ///< EID-to-RLOC cache snapshot
     };
 
     explicit SettingsBase(Instance &aInstance)
@@ -143,10 +215,14 @@ protected:
     void LogNetworkInfo(const char *aAction, const NetworkInfo &aNetworkInfo) const;
     void LogParentInfo(const char *aAction, const ParentInfo &aParentInfo) const;
     void LogChildInfo(const char *aAction, const ChildInfo &aChildInfo) const;
+    void LogRouterTableInfo(const char *aAction, const RouterTableInfo &aRouterTableInfo) const;
+    void LogAddressCacheInfo(const char *aAction, const AddressCacheInfo &aAddressCacheInfo) const;
 #else
     void LogNetworkInfo(const char *, const NetworkInfo &) const {}
     void LogParentInfo(const char *, const ParentInfo &) const {}
     void LogChildInfo(const char *, const ChildInfo &) const {}
+    void LogRouterTableInfo(const char *, const RouterTableInfo &) const {}
+    void LogAddressCacheInfo(const char *, const AddressCacheInfo &) const {}
 #endif
 
 #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_WARN) && (OPENTHREAD_CONFIG_LOG_UTIL != 0)
@@ -169,10 +245,7 @@ public:
      * @param[in]  aInstance     A reference to the OpenThread instance.
      *
      */
-    explicit Settings(Instance &aInstance)
-        : SettingsBase(aInstance)
-    {
-    }
+    explicit Settings(Instance &aInstance);
 
     /**
      * This method initializes the platform settings (non-volatile) module.
@@ -196,6 +269,21 @@ public:
      */
     void Wipe(void);
 
+    /**
+     * This method writes all pending settings to the non-volatile store.
+     *
+     * Pending writes are written in the order they were first made, writes to the same key are coalesced.
+     *
+     * @note Without `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE`, settings are written immediately and this method
+     * does nothing.
+     *
+     */
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    void Flush(void);
+#else
+    void Flush(void) {}
+#endif
+
     /**
      * This method saves the Operational Dataset (active or pending).
      *
@@ -338,6 +426,65 @@ public:
 
 #endif // OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
+    /**
+     * This method saves the router table snapshot.
+     *
+     * @param[in]   aRouterTableInfo      A reference to a `RouterTableInfo` structure to be saved.
+     *
+     * @retval OT_ERROR_NONE              Successfully saved the router table snapshot in settings.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError SaveRouterTableInfo(const RouterTableInfo &aRouterTableInfo);
+
+    /**
+     * This method reads the router table snapshot.
+     *
+     * @param[out]   aRouterTableInfo     A reference to a `RouterTableInfo` structure to output the read content.
+     *
+     * @retval OT_ERROR_NONE              Successfully read the router table snapshot.
+     * @retval OT_ERROR_NOT_FOUND         No corresponding value in the setting store, or the value has another size.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError ReadRouterTableInfo(RouterTableInfo &aRouterTableInfo) const;
+
+    /**
+     * This method saves the EID-to-RLOC cache of the router table snapshot.
+     *
+     * @param[in]   aAddressCacheInfo     A reference to a `AddressCacheInfo` structure to be saved.
+     *
+     * @retval OT_ERROR_NONE              Successfully saved the EID-to-RLOC cache snapshot in settings.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError SaveAddressCacheInfo(const AddressCacheInfo &aAddressCacheInfo);
+
+    /**
+     * This method reads the EID-to-RLOC cache of the router table snapshot.
+     *
+     * @param[out]   aAddressCacheInfo    A reference to a `AddressCacheInfo` structure to output the read content.
+     *
+     * @retval OT_ERROR_NONE              Successfully read the EID-to-RLOC cache snapshot.
+     * @retval OT_ERROR_NOT_FOUND         No corresponding value in the setting store, or the value has another size.
+     * @retval OT_ERROR_NOT_IMPLEMENTED   The platform does not implement settings functionality.
+     *
+     */
+    otError ReadAddressCacheInfo(AddressCacheInfo &aAddressCacheInfo) const;
+
+    /**
+     * This method deletes the router table snapshot, including its EID-to-RLOC cache, from settings.
+     *
+     * @retval OT_ERROR_NONE             Successfully deleted the value.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The platform does not implement settings functionality.
+     *
+     */
+    otError DeleteRouterTableInfo(void);
+
+#endif // OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
     /**
      * This method adds a Child Info entry to settings.
      *
@@ -440,9 +587,75 @@ public:
         ChildInfo mChildInfo;
         uint8_t   mIndex;
         bool      mIsDone;
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        bool mIsPending; // Whether `mIndex` is an index in the pending Child Info entries.
+#endif
     };
 
 private:
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    enum
+    {
+        kNumPendingKeys   = 7, // Keys with a single value (Datasets, NetworkInfo, ParentInfo, SLAAC key, snapshot).
+        kChildInfoPending = kNumPendingKeys,
+        kMaxChildInfos    = OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_CHILD_INFO_ENTRIES,
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+        kSlaacKeySize = sizeof(Utils::Slaac::IidSecretKey),
+#else
+        kSlaacKeySize = 0,
+#endif
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+        kRouterTableInfoSize  = sizeof(RouterTableInfo),
+        kAddressCacheInfoSize = sizeof(AddressCacheInfo),
+#else
+        kRouterTableInfoSize  = 0,
+        kAddressCacheInfoSize = 0,
+#endif
+        kPendingValuesSize = 2 * MeshCoP::Dataset::kMaxSize + sizeof(NetworkInfo) + sizeof(ParentInfo) + kSlaacKeySize +
+                             kRouterTableInfoSize + kAddressCacheInfoSize,
+    };
+
+    enum PendingState
+    {
+        kPendingNone,
+        kPendingSave,
+        kPendingDelete,
+    };
+
+    struct PendingKey
+    {
+        uint16_t mKey;
+        uint16_t mOffset;
+        uint16_t mMaxSize;
+    };
+
+    struct PendingWrite
+    {
+        uint16_t mLength;
+        uint8_t  mState;
+    };
+
+    int     FindPendingKey(Key aKey) const;
+    otError SetPending(Key aKey, PendingState aState, const void *aValue, uint16_t aSize);
+    bool    EnqueuePending(uint8_t aIndex);
+    void    FlushNext(void);
+    void    ClearPending(void);
+
+    static void HandleFlushTasklet(Tasklet &aTasklet);
+
+    static const PendingKey sPendingKeys[kNumPendingKeys];
+
+    PendingWrite mPendingWrites[kNumPendingKeys];
+    uint8_t      mPendingOrder[kNumPendingKeys + 1]; // Indices in `mPendingWrites` (or `kChildInfoPending`), oldest first.
+    uint8_t      mNumPendingOrder;
+    bool         mChildInfoDeleteAll;
+    uint8_t      mNumChildInfos;
+    ChildInfo    mChildInfos[kMaxChildInfos];
+    uint8_t      mPendingValues[kPendingValuesSize];
+    Tasklet      mFlushTasklet;
+#endif
+
+    otError ReadValue(Key aKey, void *aBuffer, uint16_t &aSize) const;
     otError ReadFixedSize(Key aKey, void *aBuffer, uint16_t aExpectedSize) const;
     otError Read(Key aKey, void *aBuffer, uint16_t aMaxBufferSize, uint16_t &aReadSize) const;
     otError Save(Key aKey, const void *aValue, uint16_t aSize);
@@ -110,6 +110,7 @@ void TaskletScheduler::ProcessQueuedTasklets(void)
 
     while ((cur = PopTasklet()) != NULL)
     {
+        OT_COUNTER_INCREMENT(cur->GetInstance(), kTaskletRuns);
         cur->RunTask();
 
         // only process tasklets that were queued at the time this method was called
@@ -176,6 +176,7 @@ void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
         if (!IsStrictlyBefore(aAlarmApi.AlarmGetNow(), timer->mFireTime))
         {
             Remove(*timer, aAlarmApi);
+            OT_COUNTER_INCREMENT(timer->GetInstance(), kTimerFires);
             timer->Fired();
         }
         else
@@ -34,21 +34,29 @@
 #include "tlvs.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/debug.hpp"
 #include "common/message.hpp"
 
 namespace ot {
 
 otError Tlv::Get(const Message &aMessage, uint8_t aType, uint16_t aMaxLength, Tlv &aTlv)
 {
-    otError  error = OT_ERROR_NOT_FOUND;
+    otError  error;
     uint16_t offset;
+    uint16_t valueOffset;
+    uint16_t length;
 
-    SuccessOrExit(error = GetOffset(aMessage, aType, offset));
-    aMessage.Read(offset, sizeof(Tlv), &aTlv);
+    SuccessOrExit(error = TlvIndex::Scan(aMessage, aMessage.GetOffset(), aType, 0, offset, valueOffset, length));
 
-    if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
+    // An extended TLV is copied as if its length was `kExtendedLength`.
+    if (valueOffset - offset == sizeof(ExtendedTlv))
     {
-        aMaxLength = sizeof(aTlv) + aTlv.GetLength();
+        length = kExtendedLength;
+    }
+
+    if (aMaxLength > sizeof(aTlv) + length)
+    {
+        aMaxLength = sizeof(aTlv) + length;
     }
 
     aMessage.Read(offset, aMaxLength, &aTlv);
@@ -59,79 +67,187 @@ exit:
 
 otError Tlv::GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset)
 {
-    otError  error  = OT_ERROR_NOT_FOUND;
-    uint16_t offset = aMessage.GetOffset();
-    uint16_t end    = aMessage.GetLength();
+    uint16_t valueOffset;
+    uint16_t length;
+
+    return TlvIndex::Scan(aMessage, aMessage.GetOffset(), aType, 0, aOffset, valueOffset, length);
+}
+
+otError Tlv::GetValueOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset, uint16_t &aLength)
+{
+    uint16_t offset;
+
+    return TlvIndex::Scan(aMessage, aMessage.GetOffset(), aType, 0, offset, aOffset, aLength);
+}
+
+TlvIndex::TlvIndex(void)
+    : mMessage(NULL)
+    , mPrevious(NULL)
+    , mStart(0)
+    , mEnd(0)
+    , mScanOffset(0)
+    , mNumEntries(0)
+    , mIsBuilt(false)
+{
+}
+
+void TlvIndex::Attach(Message &aMessage)
+{
+    Detach();
+
+    mMessage  = &aMessage;
+    mIsBuilt  = false;
+    mPrevious = aMessage.GetTlvIndex();
+    aMessage.SetTlvIndex(this);
+}
+
+void TlvIndex::Detach(void)
+{
+    VerifyOrExit(mMessage != NULL);
+
+    assert(mMessage->GetTlvIndex() == this);
+    mMessage->SetTlvIndex(mPrevious);
+    mMessage  = NULL;
+    mPrevious = NULL;
+
+exit:
+    return;
+}
+
+TlvIndex *TlvIndex::GetAttached(const Message &aMessage)
+{
+    return aMessage.GetTlvIndex();
+}
+
+otError TlvIndex::ReadHeader(const Message &aMessage,
+                             uint16_t       aOffset,
+                             uint8_t &      aType,
+                             uint8_t &      aHeaderLength,
+                             uint16_t &     aLength)
+{
+    otError  error = OT_ERROR_PARSE;
+    uint16_t end   = aMessage.GetLength();
     Tlv      tlv;
 
-    while (offset + sizeof(tlv) <= end)
-    {
-        uint32_t length = sizeof(tlv);
+    VerifyOrExit(aOffset + sizeof(tlv) <= end);
+    aMessage.Read(aOffset, sizeof(tlv), &tlv);
 
-        aMessage.Read(offset, sizeof(tlv), &tlv);
+    aType         = tlv.GetType();
+    aHeaderLength = sizeof(tlv);
+    aLength       = tlv.GetLength();
 
-        if (tlv.GetLength() != kExtendedLength)
-        {
-            length += tlv.GetLength();
-        }
-        else
-        {
-            uint16_t extLength;
+    if (aLength == Tlv::kExtendedLength)
+    {
+        VerifyOrExit(aOffset + sizeof(ExtendedTlv) <= end);
+        aMessage.Read(aOffset + sizeof(tlv), sizeof(aLength), &aLength);
+        aHeaderLength = sizeof(ExtendedTlv);
+        aLength       = HostSwap16(aLength);
+    }
 
-            VerifyOrExit(sizeof(extLength) == aMessage.Read(offset + sizeof(tlv), sizeof(extLength), &extLength));
-            length += sizeof(extLength) + HostSwap16(extLength);
-        }
+    VerifyOrExit(static_cast<uint32_t>(aOffset) + aHeaderLength + aLength <= end);
+    error = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
 
-        VerifyOrExit(offset + length <= end);
+otError TlvIndex::Scan(const Message &aMessage,
+                       uint16_t       aStart,
+                       uint8_t        aType,
+                       uint8_t        aInstance,
+                       uint16_t &     aOffset,
+                       uint16_t &     aValueOffset,
+                       uint16_t &     aLength)
+{
+    otError   error = OT_ERROR_NOT_FOUND;
+    TlvIndex *index = GetAttached(aMessage);
+    uint16_t  offset;
+    uint8_t   type;
+    uint8_t   headerLength;
+    uint16_t  length;
+
+    if (index != NULL && aStart == aMessage.GetOffset())
+    {
+        ExitNow(error = index->Find(aType, aInstance, aOffset, aValueOffset, aLength));
+    }
 
-        if (tlv.GetType() == aType)
+    for (offset = aStart; ReadHeader(aMessage, offset, type, headerLength, length) == OT_ERROR_NONE;
+         offset += headerLength + length)
+    {
+        if (type == aType && aInstance-- == 0)
         {
-            aOffset = offset;
+            aOffset      = offset;
+            aValueOffset = offset + headerLength;
+            aLength      = length;
             ExitNow(error = OT_ERROR_NONE);
         }
-
-        offset += static_cast<uint16_t>(length);
     }
 
 exit:
     return error;
 }
 
-otError Tlv::GetValueOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset, uint16_t &aLength)
+void TlvIndex::Build(void)
 {
-    otError  error  = OT_ERROR_NOT_FOUND;
-    uint16_t offset = aMessage.GetOffset();
-    uint16_t end    = aMessage.GetLength();
-    Tlv      tlv;
-
-    while (offset + sizeof(tlv) <= end)
-    {
-        uint16_t length;
+    uint16_t offset = mMessage->GetOffset();
+    uint16_t length;
+    uint8_t  type;
+    uint8_t  headerLength;
 
-        aMessage.Read(offset, sizeof(tlv), &tlv);
-        offset += sizeof(tlv);
-        length = tlv.GetLength();
+    mStart      = offset;
+    mEnd        = mMessage->GetLength();
+    mNumEntries = 0;
 
-        if (length == kExtendedLength)
+    while (ReadHeader(*mMessage, offset, type, headerLength, length) == OT_ERROR_NONE)
+    {
+        if (mNumEntries == OT_ARRAY_LENGTH(mEntries))
         {
-            VerifyOrExit(offset + sizeof(length) <= end);
-            aMessage.Read(offset, sizeof(length), &length);
-            offset += sizeof(length);
-            length = HostSwap16(length);
+            // The TLVs past the index are found by reading the message from here.
+            mScanOffset = offset;
+            ExitNow();
         }
 
-        VerifyOrExit(length <= end - offset);
+        mEntries[mNumEntries].mOffset       = offset;
+        mEntries[mNumEntries].mLength       = length;
+        mEntries[mNumEntries].mType         = type;
+        mEntries[mNumEntries].mHeaderLength = headerLength;
+        mNumEntries++;
+
+        offset += headerLength + length;
+    }
+
+    // The search stops at the end of the message or at a malformed TLV.
+    mScanOffset = mEnd;
+
+exit:
+    mIsBuilt = true;
+}
+
+otError TlvIndex::Find(uint8_t aType, uint8_t aInstance, uint16_t &aOffset, uint16_t &aValueOffset, uint16_t &aLength)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+
+    if (!mIsBuilt || mStart != mMessage->GetOffset())
+    {
+        Build();
+    }
 
-        if (tlv.GetType() == aType)
+    for (const Entry *entry = mEntries; entry < &mEntries[mNumEntries]; entry++)
+    {
+        if (entry->mType == aType && aInstance-- == 0)
         {
-            aOffset = offset;
-            aLength = length;
+            aOffset      = entry->mOffset;
+            aValueOffset = entry->mOffset + entry->mHeaderLength;
+            aLength      = entry->mLength;
             ExitNow(error = OT_ERROR_NONE);
         }
-
-        offset += length;
     }
 
+    VerifyOrExit(mScanOffset < mEnd);
+
+    // `Scan()` does not use the index when it does not start from the message offset.
+    error = Scan(*mMessage, mScanOffset, aType, aInstance, aOffset, aValueOffset, aLength);
+
 exit:
     return error;
 }
@@ -185,6 +185,8 @@ protected:
     };
 
 private:
+    friend class TlvIndex;
+
     uint8_t mType;
     uint8_t mLength;
 } OT_TOOL_PACKED_END;
@@ -215,6 +217,128 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements an index of the TLVs in a received message.
+ *
+ * While an index is attached to a message, `Tlv::Get()`, `Tlv::GetOffset()` and `Tlv::GetValueOffset()` look up the
+ * TLVs of that message in the index instead of reading the message from its offset for each TLV. The index is built
+ * on the first lookup, in a single pass over the message. The message invalidates it when its content or length is
+ * changed, and it is built again on the next lookup (or if the offset of the message changes).
+ *
+ * An index stays attached until it is detached or destroyed, so it is declared on the stack of a receive handler.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    TlvIndex(void);
+
+    /**
+     * This destructor detaches the index.
+     *
+     */
+    ~TlvIndex(void) { Detach(); }
+
+    /**
+     * This method attaches the index to a message.
+     *
+     * @param[in]  aMessage  A reference to the message. It must not be freed while the index is attached.
+     *
+     */
+    void Attach(Message &aMessage);
+
+    /**
+     * This method detaches the index.
+     *
+     * Indexes attached to the same message must be detached in the reverse order they were attached.
+     *
+     */
+    void Detach(void);
+
+    /**
+     * This method invalidates the index, so that it is built again on the next lookup.
+     *
+     */
+    void Invalidate(void) { mIsBuilt = false; }
+
+    /**
+     * This method finds a TLV.
+     *
+     * @param[in]   aType         The Type value to search for.
+     * @param[in]   aInstance     The number of TLVs with Type @p aType to skip (to find duplicate TLVs).
+     * @param[out]  aOffset       A reference to the offset of the TLV.
+     * @param[out]  aValueOffset  A reference to the offset of the value.
+     * @param[out]  aLength       A reference to the length of the value.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV.
+     *
+     */
+    otError Find(uint8_t aType, uint8_t aInstance, uint16_t &aOffset, uint16_t &aValueOffset, uint16_t &aLength);
+
+    /**
+     * This static method returns the index attached to a message.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     * @returns A pointer to the index, or NULL if no index is attached to @p aMessage.
+     *
+     */
+    static TlvIndex *GetAttached(const Message &aMessage);
+
+    /**
+     * This static method finds a TLV by reading a message.
+     *
+     * @param[in]   aMessage      A reference to the message.
+     * @param[in]   aStart        The offset to search from.
+     * @param[in]   aType         The Type value to search for.
+     * @param[in]   aInstance     The number of TLVs with Type @p aType to skip (to find duplicate TLVs).
+     * @param[out]  aOffset       A reference to the offset of the TLV.
+     * @param[out]  aValueOffset  A reference to the offset of the value.
+     * @param[out]  aLength       A reference to the length of the value.
+     *
+     * @retval OT_ERROR_NONE       Successfully found the TLV.
+     * @retval OT_ERROR_NOT_FOUND  Could not find the TLV.
+     *
+     */
+    static otError Scan(const Message &aMessage,
+                        uint16_t       aStart,
+                        uint8_t        aType,
+                        uint8_t        aInstance,
+                        uint16_t &     aOffset,
+                        uint16_t &     aValueOffset,
+                        uint16_t &     aLength);
+
+private:
+    struct Entry
+    {
+        uint16_t mOffset;
+        uint16_t mLength;
+        uint8_t  mType;
+        uint8_t  mHeaderLength;
+    };
+
+    static otError ReadHeader(const Message &aMessage,
+                              uint16_t       aOffset,
+                              uint8_t &      aType,
+                              uint8_t &      aHeaderLength,
+                              uint16_t &     aLength);
+    void           Build(void);
+
+    Message * mMessage;
+    TlvIndex *mPrevious;
+    uint16_t  mStart;
+    uint16_t  mEnd;
+    uint16_t  mScanOffset;
+    uint8_t   mNumEntries;
+    bool      mIsBuilt;
+    Entry     mEntries[OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES];
+};
+
 } // namespace ot
 
 #endif // TLVS_HPP_
@@ -77,6 +77,42 @@
 #define OPENTHREAD_CONFIG_COAP_MAX_RETRANSMIT 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+ *
+ * Define to 1 to enable CoAP congestion control.
+ *
+ * The initial retransmission timeout of confirmable messages is then estimated per destination from measured
+ * round-trip times (CoCoA, draft-ietf-core-cocoa), and the number of outstanding confirmable messages per destination
+ * is limited to `OPENTHREAD_CONFIG_COAP_NSTART`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE
+#define OPENTHREAD_CONFIG_COAP_CONGESTION_CONTROL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_NSTART
+ *
+ * Maximum number of outstanding confirmable messages per destination when congestion control is enabled (RFC7252
+ * default value of NSTART is 1). Further messages wait until an outstanding one is acknowledged or times out.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_NSTART
+#define OPENTHREAD_CONFIG_COAP_NSTART 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_RTT_DESTINATIONS
+ *
+ * Number of destinations a CoAP agent keeps round-trip time estimates for when congestion control is enabled. The
+ * least recently used estimate is replaced when a message is sent to a new destination.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_RTT_DESTINATIONS
+#define OPENTHREAD_CONFIG_COAP_MAX_RTT_DESTINATIONS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
  *
@@ -89,6 +125,19 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
+ *
+ * Number of hash buckets used by a CoAP agent to dispatch received requests to registered resources.
+ *
+ * Resources are distributed across the buckets by a hash of their Uri-Path, so that dispatching a request only
+ * compares the Uri-Path against resources in one bucket. Must be a power of two.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS
+#define OPENTHREAD_CONFIG_COAP_RESOURCE_HASH_BUCKETS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -109,4 +158,57 @@
 #define OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+ *
+ * Define to 1 to enable CoAP block-wise transfer (RFC 7959) support in the application CoAP API.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
+#define OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH
+ *
+ * The largest CoAP block size (in bytes) used for block-wise transfer. Must be a power of two between 16 and 1024.
+ *
+ * Blocks are held in message buffers, and passed to and from the block-wise hooks in parts of at most 64 bytes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH
+#define OPENTHREAD_CONFIG_COAP_MAX_BLOCK_LENGTH 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+ *
+ * Define to 1 to enable CoAP Observe (RFC 7641) support.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE
+#define OPENTHREAD_CONFIG_COAP_OBSERVE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+ *
+ * The maximum number of observers a CoAP server keeps track of, across all of its resources.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS
+#define OPENTHREAD_CONFIG_COAP_MAX_OBSERVERS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL
+ *
+ * The delay (in milliseconds) between a resource change and the notification of its observers. Changes within this
+ * interval are coalesced, only the latest resource state is sent.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL
+#define OPENTHREAD_CONFIG_COAP_OBSERVE_COALESCING_INTERVAL 100
+#endif
+
 #endif // CONFIG_COAP_H_
@@ -55,4 +55,16 @@
 #define OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+ *
+ * The delay (in milliseconds) from a change of the Joiner entries to sending the Steering Data to the Leader.
+ *
+ * Changes made within the delay are sent in a single MGMT_COMMISSIONER_SET.req.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY
+#define OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY 100
+#endif
+
 #endif // CONFIG_COMMISSIONER_H_
@@ -46,6 +46,7 @@
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_APP
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
  * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL
+ * - @sa OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
  * - and others
  *
  * Note:
@@ -70,6 +71,19 @@
 #define OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED 3
 /** Log output for NCP goes to Spinel `STREAM_LOG` property (for CLI platform defined function is expected) */
 #define OPENTHREAD_CONFIG_LOG_OUTPUT_NCP_SPINEL 4
+/** Log output is recorded in binary form (format string ID and raw arguments) and formatted by the reader */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY 5
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+ *
+ * The size (in bytes) of the ring buffer holding binary log records when `OPENTHREAD_CONFIG_LOG_OUTPUT` is
+ * `OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY`. It must be a power of two, no larger than 32768.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE 2048
+#endif
 
 /**
  * @def OPENTHREAD_CONFIG_LOG_LEVEL
@@ -226,4 +226,80 @@
 #define OPENTHREAD_CONFIG_MAC_RETX_POLL_PERIOD 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+ *
+ * Define as 1 to scan all channels at once when the radio supports receiving on multiple channels concurrently
+ * (`OT_RADIO_CAPS_MULTI_CHANNEL_RX`).
+ *
+ * An Active Scan or an MLE Discovery then moves to the next channel shortly after each Beacon Request or Discovery
+ * Request and waits for the responses of all channels once, after the last channel. Scans are unchanged with radios
+ * without the capability.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+#define OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_DWELL
+ *
+ * The time (in milliseconds) a multi-channel scan stays on a channel after sending the request, before sending the
+ * request on the next channel.
+ *
+ * The radio cannot receive while it transmits, so the immediate responses (Beacons) to a request are lost if the
+ * request on the next channel is being sent when they arrive.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_DWELL
+#define OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_DWELL 20
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+ *
+ * Define as 1 to support adaptive data poll scheduling on sleepy end devices, along with the data poll statistics.
+ *
+ * When a latency budget is set (`otLinkSetPollLatencyBudget()`), the poll period follows the observed interval between
+ * downlink frames, bounded by the latency budget, instead of the fixed user-specified poll period.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD
+ *
+ * The minimum adaptive data poll period (in milliseconds).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD 500
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+ *
+ * Define as 1 to support sending several frames per data poll between a parent and a sleepy child.
+ *
+ * A child advertises the number of frames it accepts per data poll in its Child ID Request and Child Update Request.
+ * After a data poll, a parent that supports it sends the queued frames back to back, up to the agreed limit, and the
+ * child keeps its receiver on while the frame pending bit is set instead of sending a data poll for each frame.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+#define OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES
+ *
+ * The maximum number of frames sent or received per data poll (must be between 1 and 15).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES
+#define OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES 4
+#endif
+
 #endif // CONFIG_MAC_H_
@@ -58,6 +58,34 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+ *
+ * Define to 1 to support a large child table (hundreds of children).
+ *
+ * When enabled, the child table keeps a hashed index of the RLOC16 and extended address of its children so that
+ * lookups do not scan the table, and a message keeps the set of sleepy children it is pending for in a separate
+ * message buffer (only when it is pending for more than one child) instead of a bit-vector sized by
+ * `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN` in the metadata of every message.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MAX_OUTSTANDING_CHILD_UPDATES
+ *
+ * The maximum number of Child Update Request messages queued at a time to update the Network Data of sleepy children.
+ *
+ * When the Network Data changes, further sleepy children are updated as the queued messages are delivered, so that a
+ * parent with many sleepy children does not run out of message buffers.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_MAX_OUTSTANDING_CHILD_UPDATES
+#define OPENTHREAD_CONFIG_MLE_MAX_OUTSTANDING_CHILD_UPDATES 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
@@ -240,4 +268,30 @@
 #define OPENTHREAD_CONFIG_MLE_INFORM_PREVIOUS_PARENT_ON_REATTACH 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+ *
+ * Define as 1 for a router to save a snapshot of its routes, link qualities and EID-to-RLOC cache in settings.
+ *
+ * After a reset, the snapshot is restored when the router re-attaches to the same partition with the same key
+ * sequence. Routes to and through router IDs that are still allocated are restored, so the router forwards using its
+ * previous routes as soon as the links to its neighbors are re-established, instead of waiting for MLE Advertisements
+ * to rebuild them.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL
+ *
+ * The interval (in seconds) at which the router table snapshot is taken. The snapshot is only written to settings
+ * when it changed.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL
+#define OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL 300
+#endif
+
 #endif // CONFIG_MLE_H_
@@ -181,6 +181,45 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+ *
+ * Define to 1 to record per-message timestamps (enqueued, route resolved, first tx attempt, and tx done) in the
+ * message metadata, and to report them through `otMessageSetLatencyCallback()` and latency histograms.
+ *
+ * Timestamps use the microsecond timer when `OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE` is set, and the millisecond
+ * timer otherwise.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+ *
+ * Define to 1 to enable the performance counters registry (tasklet runs, timer fires, crypto operations, queue
+ * high-water marks, etc.), readable through the `otCounters*` API.
+ *
+ * When disabled, the counter updates compile to nothing.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+#define OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES
+ *
+ * The maximum number of TLVs indexed when parsing a received MLE or CoAP message.
+ *
+ * TLVs past this number are still found, by reading the rest of the message.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -260,6 +299,20 @@
 #define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS
+ *
+ * The maximum number of concurrent DTLS sessions of a DTLS server (e.g. the Commissioner handshaking with several
+ * Joiners, or the Border Agent serving several Commissioner candidates).
+ *
+ * Each session holds its own mbedTLS SSL context, which is allocated from the heap while the session is active. The
+ * default `OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE` grows with the number of sessions.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS
+#define OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
  *
@@ -268,9 +321,10 @@
  */
 #ifndef OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
-#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (3072 * sizeof(void *))
+#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE \
+    ((3072 + 1568 * (OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS - 1)) * sizeof(void *))
 #else
-#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (1568 * sizeof(void *))
+#define OPENTHREAD_CONFIG_HEAP_INTERNAL_SIZE (1568 * OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS * sizeof(void *))
 #endif
 #endif
 
@@ -326,6 +380,31 @@
 #define OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH "tmp"
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+ *
+ * Define to 1 to defer settings writes to a tasklet, so that `otPlatSettings*` writes (and flash page erases) are not
+ * done from the protocol paths. Repeated writes to the same key are coalesced into a single write.
+ *
+ * Pending writes are read back by `Settings`, and are written on `Settings::Flush()`, on reset and on de-init.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_CHILD_INFO_ENTRIES
+ *
+ * The number of Child Info entries that can be added before the pending settings writes are flushed.
+ *
+ * Applicable only if `OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_CHILD_INFO_ENTRIES
+#define OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_CHILD_INFO_ENTRIES 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -371,6 +450,31 @@
 #define OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES 8
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+ *
+ * Define to 1 to enable virtual reassembly on a parent: 6LoWPAN fragments whose mesh destination is an
+ * rx-on-when-idle minimal child are forwarded to the child as they arrive (removing the mesh header and rewriting
+ * the datagram tag) instead of being reassembled, decompressed, and re-fragmented by the parent.
+ *
+ * Datagrams that would need their LOWPAN_IPHC header rewritten (source address derived from the mesh originator)
+ * and datagrams for sleepy children still go through full reassembly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_VIRTUAL_REASSEMBLY_ENTRIES
+ *
+ * The number of fragmented datagrams that may be forwarded concurrently through virtual reassembly.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NUM_VIRTUAL_REASSEMBLY_ENTRIES
+#define OPENTHREAD_CONFIG_NUM_VIRTUAL_REASSEMBLY_ENTRIES 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_RADIO_915MHZ_OQPSK_SUPPORT
  *
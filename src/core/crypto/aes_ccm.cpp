@@ -35,13 +35,25 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/message.hpp"
 
 namespace ot {
 namespace Crypto {
 
+AesCcm::AesCcm(void)
+    : mKeyEcb(&mEcb)
+{
+}
+
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, 8 * aKeyLength);
+    mKeyEcb = &mEcb;
+}
+
+void AesCcm::SetKey(AesEcb &aEcb)
+{
+    mKeyEcb = &aEcb;
 }
 
 otError AesCcm::Init(uint32_t    aHeaderLength,
@@ -120,7 +132,7 @@ otError AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeyEcb->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -179,7 +191,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -193,7 +205,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyEcb->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -220,7 +232,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeyEcb->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -237,7 +249,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyEcb->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -250,7 +262,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeyEcb->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -261,6 +273,16 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool
     }
 }
 
+void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, bool aEncrypt)
+{
+    Message::Chunk chunk;
+
+    for (aMessage.GetFirstChunk(aOffset, aLength, chunk); chunk.GetLength() > 0; aMessage.GetNextChunk(aLength, chunk))
+    {
+        Payload(chunk.GetData(), chunk.GetData(), chunk.GetLength(), aEncrypt);
+    }
+}
+
 void AesCcm::Finalize(void *aTag, uint8_t *aTagLength)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(aTag);
@@ -269,7 +291,7 @@ void AesCcm::Finalize(void *aTag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        mKeyEcb->Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
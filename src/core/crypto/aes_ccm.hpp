@@ -43,6 +43,9 @@
 #include "crypto/aes_ecb.hpp"
 
 namespace ot {
+
+class Message;
+
 namespace Crypto {
 
 /**
@@ -59,6 +62,12 @@ namespace Crypto {
 class AesCcm
 {
 public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void);
+
     /**
      * This method sets the key.
      *
@@ -68,6 +77,17 @@ public:
      */
     void SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method sets the key from an AES ECB object prepared with the key.
+     *
+     * The key is used without expanding it again. @p aEcb is used until the next call to `SetKey()` and must not
+     * change before the computation is finalized.
+     *
+     * @param[in]  aEcb  A reference to the AES ECB object.
+     *
+     */
+    void SetKey(AesEcb &aEcb);
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -107,6 +127,17 @@ public:
      */
     void Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool aEncrypt);
 
+    /**
+     * This method processes the payload in place within a message.
+     *
+     * @param[inout]  aMessage  A reference to the message.
+     * @param[in]     aOffset   Byte offset within @p aMessage of the payload.
+     * @param[in]     aLength   Payload length in bytes.
+     * @param[in]     aEncrypt  TRUE on encrypt and FALSE on decrypt.
+     *
+     */
+    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, bool aEncrypt);
+
     /**
      * This method generates the tag.
      *
@@ -123,6 +154,7 @@ private:
     };
 
     AesEcb   mEcb;
+    AesEcb * mKeyEcb;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
@@ -34,6 +34,7 @@
 #include "pbkdf2_cmac.h"
 
 #include "common/debug.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "utils/wrap_string.h"
 
 #include <mbedtls/cmac.h>
@@ -48,19 +49,50 @@ void otPbkdf2Cmac(const uint8_t *aPassword,
                   uint16_t       aKeyLen,
                   uint8_t *      aKey)
 {
-    const size_t kBlockSize = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t      prfInput[OT_PBKDF2_SALT_MAX_LEN + 4]; // Salt || INT(), for U1 calculation
-    long         prfOne[kBlockSize / sizeof(long)];
-    long         prfTwo[kBlockSize / sizeof(long)];
-    long         keyBlock[kBlockSize / sizeof(long)];
-    uint32_t     blockCounter = 0;
-    uint8_t *    key          = aKey;
-    uint16_t     keyLen       = aKeyLen;
-    uint16_t     useLen       = 0;
+    const size_t       kBlockSize = ot::Crypto::AesEcb::kBlockSize;
+    uint8_t            prfInput[OT_PBKDF2_SALT_MAX_LEN + 4]; // Salt || INT(), for U1 calculation
+    uint8_t            prfKey[kBlockSize];
+    uint8_t            subKey[kBlockSize];
+    uint8_t            prf[kBlockSize];
+    uint8_t            keyBlock[kBlockSize];
+    ot::Crypto::AesEcb aes;
+    uint8_t            msb;
+    uint32_t           blockCounter = 0;
+    uint8_t *          key          = aKey;
+    uint16_t           keyLen       = aKeyLen;
+    uint16_t           useLen       = 0;
 
+    assert(aSaltLen <= OT_PBKDF2_SALT_MAX_LEN);
     memcpy(prfInput, aSalt, aSaltLen);
-    assert(aIterationCounter % 2 == 0);
-    aIterationCounter /= 2;
+
+    // The AES-CMAC-PRF-128 key (RFC 4615) is the password if it is 128 bits long, its AES-CMAC with a zero key
+    // otherwise. It is the same for all iterations, so it is derived only once.
+    if (aPasswordLen == kBlockSize)
+    {
+        memcpy(prfKey, aPassword, kBlockSize);
+    }
+    else
+    {
+        memset(prf, 0, sizeof(prf));
+        mbedtls_aes_cmac_prf_128(prf, kBlockSize, aPassword, aPasswordLen, prfKey);
+    }
+
+    aes.SetKey(prfKey, 8 * kBlockSize);
+
+    // Generate the CMAC subkey K1 (RFC 4493), used for messages of exactly one block.
+    memset(prf, 0, sizeof(prf));
+    aes.Encrypt(prf, subKey);
+    msb = subKey[0] & 0x80;
+
+    for (size_t i = 0; i < kBlockSize; i++)
+    {
+        subKey[i] = static_cast<uint8_t>(subKey[i] << 1) | ((i + 1 < kBlockSize) ? (subKey[i + 1] >> 7) : 0);
+    }
+
+    if (msb)
+    {
+        subKey[kBlockSize - 1] ^= 0x87;
+    }
 
     while (keyLen)
     {
@@ -71,30 +103,22 @@ void otPbkdf2Cmac(const uint8_t *aPassword,
         prfInput[aSaltLen + 3] = static_cast<uint8_t>(blockCounter);
 
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, prfInput, aSaltLen + 4,
-                                 reinterpret_cast<uint8_t *>(keyBlock));
-
-        // Calculate U_2
-        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(keyBlock), kBlockSize,
-                                 reinterpret_cast<uint8_t *>(prfOne));
-
-        for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
-        {
-            keyBlock[j] ^= prfOne[j];
-        }
+        mbedtls_aes_cmac_prf_128(prfKey, kBlockSize, prfInput, aSaltLen + 4, prf);
+        memcpy(keyBlock, prf, kBlockSize);
 
         for (uint32_t i = 1; i < aIterationCounter; ++i)
         {
-            // Calculate U_{2 * i - 1}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfOne), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfTwo));
-            // Calculate U_{2 * i}
-            mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, reinterpret_cast<const uint8_t *>(prfTwo), kBlockSize,
-                                     reinterpret_cast<uint8_t *>(prfOne));
-
-            for (uint32_t j = 0; j < kBlockSize / sizeof(long); ++j)
+            // Calculate U_{i + 1}, the CMAC of the single block U_i is AES(U_i XOR K1).
+            for (size_t j = 0; j < kBlockSize; ++j)
+            {
+                prf[j] ^= subKey[j];
+            }
+
+            aes.Encrypt(prf, prf);
+
+            for (size_t j = 0; j < kBlockSize; ++j)
             {
-                keyBlock[j] ^= prfOne[j] ^ prfTwo[j];
+                keyBlock[j] ^= prf[j];
             }
         }
 
@@ -67,6 +67,18 @@ inline void DataPollHandler::Callbacks::HandleFrameChangeDone(Child &aChild)
     Get<IndirectSender>().HandleFrameChangeDone(aChild);
 }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+inline void DataPollHandler::Callbacks::StartFrameBurst(Child &aChild)
+{
+    Get<IndirectSender>().StartFrameBurst(aChild);
+}
+
+inline bool DataPollHandler::Callbacks::ContinueFrameBurst(const Mac::TxFrame &aFrame, Child &aChild)
+{
+    return Get<IndirectSender>().ContinueFrameBurst(aFrame, aChild);
+}
+#endif
+
 //---------------------------------------------------------
 
 DataPollHandler::DataPollHandler(Instance &aInstance)
@@ -154,6 +166,10 @@ void DataPollHandler::HandleDataPoll(Mac::RxFrame &aFrame)
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    mCallbacks.StartFrameBurst(*child);
+#endif
+
     if (mIndirectTxChild == NULL)
     {
         mIndirectTxChild = child;
@@ -209,6 +225,17 @@ void DataPollHandler::HandleSentFrame(const Mac::TxFrame &aFrame, otError aError
     mIndirectTxChild = NULL;
     HandleSentFrame(aFrame, aError, *child);
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    // The child stays awake for the next frame of a burst, so it is
+    // handled as if the child had sent a data poll (after any other
+    // pending data polls received earlier).
+
+    if ((aError == OT_ERROR_NONE) && mCallbacks.ContinueFrameBurst(aFrame, *child))
+    {
+        child->SetDataPollPending(true);
+    }
+#endif
+
 exit:
     ProcessPendingPolls();
 }
@@ -193,6 +193,29 @@ public:
          *
          */
         void HandleFrameChangeDone(Child &aChild);
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        /**
+         * This callback method notifies that a data poll from a child starts a new burst of frames.
+         *
+         * @param[in]  aChild     The child which sent the data poll.
+         *
+         */
+        void StartFrameBurst(Child &aChild);
+
+        /**
+         * This callback method indicates whether the next frame should be sent to a child without waiting for a data
+         * poll, after a frame was transmitted to the child successfully.
+         *
+         * @param[in]  aFrame     The transmitted frame.
+         * @param[in]  aChild     The child to which the frame was transmitted.
+         *
+         * @retval TRUE   The next frame should be sent to the child as part of the current burst.
+         * @retval FALSE  The next frame should wait for a data poll from the child.
+         *
+         */
+        bool ContinueFrameBurst(const Mac::TxFrame &aFrame, Child &aChild);
+#endif
     };
 
     /**
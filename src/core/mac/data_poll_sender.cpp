@@ -59,6 +59,20 @@ DataPollSender::DataPollSender(Instance &aInstance)
     , mPollTimeoutCounter(0)
     , mPollTxFailureCounter(0)
     , mRemainingFastPolls(0)
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    , mFollowUpPoll(false)
+    , mLatencyBudget(0)
+    , mAdaptivePollPeriod(0)
+    , mLastPollTime(0)
+    , mPollsSent(0)
+    , mEmptyPolls(0)
+    , mLatencyCount(0)
+    , mLatencySum(0)
+#endif
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    , mFrameBurstLimit(0)
+    , mFrameBurstCount(0)
+#endif
 {
 }
 
@@ -70,6 +84,12 @@ otError DataPollSender::StartPolling(void)
     VerifyOrExit(!Get<Mle::MleRouter>().IsRxOnWhenIdle(), error = OT_ERROR_INVALID_STATE);
 
     mEnabled = true;
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    mAdaptivePollPeriod = mLatencyBudget;
+    mLastPollTime       = TimerMilli::GetNow();
+#endif
+
     ScheduleNextPoll(kRecalculatePollPeriod);
 
 exit:
@@ -86,6 +106,9 @@ void DataPollSender::StopPolling(void)
     mRemainingFastPolls   = 0;
     mFastPollsUsers       = 0;
     mEnabled              = false;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    mFollowUpPoll = false;
+#endif
 }
 
 otError DataPollSender::SendDataPoll(void)
@@ -192,11 +215,13 @@ uint32_t DataPollSender::GetKeepAlivePollPeriod(void) const
     return period;
 }
 
-void DataPollSender::HandlePollSent(Mac::TxFrame &aFrame, otError aError)
+void DataPollSender::HandlePollSent(Mac::TxFrame &aFrame, otError aError, bool aFramePending)
 {
     Mac::Address macDest;
     bool         shouldRecalculatePollPeriod = false;
 
+    OT_UNUSED_VARIABLE(aFramePending);
+
     VerifyOrExit(mEnabled);
 
     aFrame.GetDstAddr(macDest);
@@ -213,6 +238,19 @@ void DataPollSender::HandlePollSent(Mac::TxFrame &aFrame, otError aError)
     {
     case OT_ERROR_NONE:
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        mFrameBurstCount = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+        HandlePollAck(aFramePending);
+
+        if (mLatencyBudget != 0)
+        {
+            shouldRecalculatePollPeriod = true;
+        }
+#endif
+
         if (mRemainingFastPolls != 0)
         {
             mRemainingFastPolls--;
@@ -263,6 +301,10 @@ void DataPollSender::HandlePollSent(Mac::TxFrame &aFrame, otError aError)
         break;
     }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    mFollowUpPoll = false;
+#endif
+
     if (shouldRecalculatePollPeriod)
     {
         ScheduleNextPoll(kRecalculatePollPeriod);
@@ -286,6 +328,9 @@ void DataPollSender::HandlePollTimeout(void)
 
     if (mPollTimeoutCounter < kQuickPollsAfterTimeout)
     {
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+        mFollowUpPoll = true;
+#endif
         SendDataPoll();
     }
     else
@@ -305,6 +350,9 @@ void DataPollSender::CheckFramePending(Mac::RxFrame &aFrame)
 
     if (aFrame.GetFramePending())
     {
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+        mFollowUpPoll = true;
+#endif
         SendDataPoll();
     }
 
@@ -312,6 +360,46 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+void DataPollSender::SetFrameBurstLimit(uint8_t aMaxFrames)
+{
+    if (aMaxFrames > OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES)
+    {
+        aMaxFrames = OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES;
+    }
+
+    mFrameBurstLimit = aMaxFrames;
+    mFrameBurstCount = 0;
+}
+
+bool DataPollSender::ContinueFrameBurst(const Mac::RxFrame &aFrame)
+{
+    bool         shouldContinue = false;
+    Router &     parent         = *Get<Mle::MleRouter>().GetParentCandidate();
+    Mac::Address srcAddr;
+
+    VerifyOrExit(mEnabled && (mFrameBurstCount < mFrameBurstLimit));
+
+    // Only frames from the parent that was polled are part of the burst.
+    aFrame.GetSrcAddr(srcAddr);
+    VerifyOrExit((srcAddr.IsExtended() && (srcAddr.GetExtended() == parent.GetExtAddress())) ||
+                 (srcAddr.IsShort() && (srcAddr.GetShort() == parent.GetRloc16())));
+
+    mFrameBurstCount++;
+
+    // The parent keeps the same count, and ends the burst once the
+    // agreed number of frames is sent for the data poll.
+
+    VerifyOrExit(aFrame.GetFramePending() && (mFrameBurstCount < mFrameBurstLimit));
+
+    mPollTimeoutCounter = 0;
+    shouldContinue      = true;
+
+exit:
+    return shouldContinue;
+}
+#endif
+
 void DataPollSender::RecalculatePollPeriod(void)
 {
     if (mEnabled)
@@ -453,7 +541,15 @@ uint32_t DataPollSender::CalculatePollPeriod(void) const
         UpdateIfLarger(period, kFastPollPeriod);
     }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    if (mLatencyBudget != 0)
+    {
+        UpdateIfLarger(period, mAdaptivePollPeriod);
+    }
+    else if (mExternalPollPeriod != 0)
+#else
     if (mExternalPollPeriod != 0)
+#endif
     {
         UpdateIfLarger(period, mExternalPollPeriod);
     }
@@ -477,4 +573,131 @@ uint32_t DataPollSender::GetDefaultPollPeriod(void) const
            static_cast<uint32_t>(kRetxPollPeriod) * kMaxPollRetxAttempts;
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+
+otError DataPollSender::SetLatencyBudget(uint32_t aLatency)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aLatency != 0)
+    {
+        VerifyOrExit(aLatency >= kMinAdaptivePollPeriod, error = OT_ERROR_INVALID_ARGS);
+
+        // Clipped by the maximal value.
+        if (aLatency > kMaxExternalPeriod)
+        {
+            aLatency = kMaxExternalPeriod;
+        }
+    }
+
+    if (mLatencyBudget != aLatency)
+    {
+        mLatencyBudget      = aLatency;
+        mAdaptivePollPeriod = aLatency;
+
+        if (mEnabled)
+        {
+            ScheduleNextPoll(kRecalculatePollPeriod);
+        }
+    }
+
+exit:
+    return error;
+}
+
+void DataPollSender::GetPollStats(otPollStats &aStats) const
+{
+    aStats.mPollsSent      = mPollsSent;
+    aStats.mEmptyPolls     = mEmptyPolls;
+    aStats.mAverageLatency = (mLatencyCount != 0) ? static_cast<uint32_t>(mLatencySum / mLatencyCount) : 0;
+    aStats.mPollPeriod     = mPollPeriod;
+}
+
+void DataPollSender::ResetPollStats(void)
+{
+    mPollsSent    = 0;
+    mEmptyPolls   = 0;
+    mLatencyCount = 0;
+    mLatencySum   = 0;
+}
+
+void DataPollSender::HandlePollAck(bool aFramePending)
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    mPollsSent++;
+
+    if (!aFramePending)
+    {
+        mEmptyPolls++;
+    }
+    else if (!mFollowUpPoll)
+    {
+        // The frame was queued on the parent at some time since the previous poll.
+        mLatencySum += (now - mLastPollTime) / 2;
+        mLatencyCount++;
+    }
+
+    mLastPollTime = now;
+
+    // Only the polls sent with the adaptive poll period drive it. A pending
+    // frame indicates downlink frames arrive faster than the poll period,
+    // an empty poll that they arrive slower. The steps settle at about 60%
+    // of the polls finding a pending frame.
+    VerifyOrExit(mLatencyBudget != 0 && !mFollowUpPoll);
+    VerifyOrExit(!mAttachMode && !mRetxMode && mRemainingFastPolls == 0);
+
+    if (aFramePending)
+    {
+        mAdaptivePollPeriod -= mAdaptivePollPeriod / 4;
+    }
+    else
+    {
+        mAdaptivePollPeriod += mAdaptivePollPeriod / 2;
+    }
+
+    if (mAdaptivePollPeriod > GetMaxAdaptivePollPeriod())
+    {
+        mAdaptivePollPeriod = GetMaxAdaptivePollPeriod();
+    }
+
+    if (mAdaptivePollPeriod < kMinAdaptivePollPeriod)
+    {
+        mAdaptivePollPeriod = kMinAdaptivePollPeriod;
+    }
+
+exit:
+    return;
+}
+
+uint32_t DataPollSender::GetMaxAdaptivePollPeriod(void) const
+{
+    uint32_t maxPeriod = mLatencyBudget;
+    Router * parent    = Get<Mle::MleRouter>().GetParentCandidate();
+
+    // A lost data poll or frame delays the frame by another poll period,
+    // so weaker links to the parent use a shorter maximum period to stay
+    // within the latency budget.
+    if (parent != NULL)
+    {
+        switch (parent->GetLinkInfo().GetLinkQuality())
+        {
+        case 3:
+            break;
+
+        case 2:
+            maxPeriod -= maxPeriod / 4;
+            break;
+
+        default:
+            maxPeriod /= 2;
+            break;
+        }
+    }
+
+    return maxPeriod;
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+
 } // namespace ot
@@ -36,6 +36,8 @@
 
 #include "openthread-core-config.h"
 
+#include <openthread/link.h>
+
 #include "common/code_utils.hpp"
 #include "common/locator.hpp"
 #include "common/timer.hpp"
@@ -150,11 +152,12 @@ public:
      * In case of transmit failure, the data poll sender may choose to send the next data poll more quickly (up to
      * some fixed number of attempts).
      *
-     * @param[in] aFrame     The data poll frame.
-     * @param[in] aError     Error status of a data poll message transmission.
+     * @param[in] aFrame         The data poll frame.
+     * @param[in] aError         Error status of a data poll message transmission.
+     * @param[in] aFramePending  TRUE if the ack of the data poll indicated a pending frame, FALSE otherwise.
      *
      */
-    void HandlePollSent(Mac::TxFrame &aFrame, otError aError);
+    void HandlePollSent(Mac::TxFrame &aFrame, otError aError, bool aFramePending);
 
     /**
      * This method informs the data poll sender that a data poll timeout happened, i.e., when the ack in response to
@@ -242,6 +245,78 @@ public:
      */
     uint32_t GetDefaultPollPeriod(void) const;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    /**
+     * This method sets/clears the downlink latency budget of adaptive data polling.
+     *
+     * A non-zero latency budget enables adaptive data polling. The poll period is then shortened after each data poll
+     * whose ack indicates a pending frame and lengthened after each empty data poll, so that it follows the rate of
+     * the downlink frames. It is bounded by `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD` and the latency budget,
+     * itself shortened on weak links to the parent, and replaces the user-specified poll period. Value of zero
+     * disables adaptive data polling.
+     *
+     * @param[in]  aLatency  The latency budget in milliseconds.
+     *
+     * @retval OT_ERROR_NONE           Successfully set/cleared the latency budget.
+     * @retval OT_ERROR_INVALID_ARGS   If a non-zero @p aLatency is below the minimum adaptive poll period.
+     *
+     */
+    otError SetLatencyBudget(uint32_t aLatency);
+
+    /**
+     * This method gets the downlink latency budget of adaptive data polling.
+     *
+     * @returns  The latency budget in milliseconds, or zero if adaptive data polling is disabled.
+     *
+     */
+    uint32_t GetLatencyBudget(void) const { return mLatencyBudget; }
+
+    /**
+     * This method gets the data poll statistics.
+     *
+     * The average downlink latency is estimated as half the time between the data poll that retrieved a frame and
+     * the previous data poll, averaged over the frames retrieved by a scheduled data poll.
+     *
+     * @param[out]  aStats  A reference to where the statistics are placed.
+     *
+     */
+    void GetPollStats(otPollStats &aStats) const;
+
+    /**
+     * This method resets the data poll statistics.
+     *
+     */
+    void ResetPollStats(void);
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    /**
+     * This method sets the maximum number of frames the parent sends per data poll.
+     *
+     * The limit is agreed with the parent in MLE (Frame Burst TLV) and is capped to
+     * `OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES`. Value of zero or one indicates that a data poll is sent for each
+     * frame.
+     *
+     * @param[in]  aMaxFrames  The maximum number of frames per data poll.
+     *
+     */
+    void SetFrameBurstLimit(uint8_t aMaxFrames);
+
+    /**
+     * This method informs the data poll sender that a frame was received while waiting for data after a data poll,
+     * and indicates whether the parent sends the next frame without waiting for another data poll.
+     *
+     * Frames whose source is not the parent (by extended or short address) are not counted in the burst.
+     *
+     * @param[in]  aFrame  The received frame.
+     *
+     * @retval TRUE   The parent sends the next frame as part of the current burst (receiver should stay on).
+     * @retval FALSE  The next frame, if any, is retrieved with a data poll.
+     *
+     */
+    bool ContinueFrameBurst(const Mac::RxFrame &aFrame);
+#endif
+
 private:
     enum // Poll period under different conditions (in milliseconds).
     {
@@ -253,6 +328,13 @@ private:
                                                  ///< i.e. (0x3FFFFF)ms, about 18.64 hours.
     };
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    enum
+    {
+        kMinAdaptivePollPeriod = OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD, ///< Minimum adaptive poll period.
+    };
+#endif
+
     enum
     {
         kQuickPollsAfterTimeout = 5, ///< Maximum number of quick data poll tx in case of back-to-back poll timeouts.
@@ -268,6 +350,10 @@ private:
 
     void        ScheduleNextPoll(PollPeriodSelector aPollPeriodSelector);
     uint32_t    CalculatePollPeriod(void) const;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    void     HandlePollAck(bool aFramePending);
+    uint32_t GetMaxAdaptivePollPeriod(void) const;
+#endif
     static void HandlePollTimer(Timer &aTimer);
     static void UpdateIfLarger(uint32_t &aPreiod, uint32_t aNewPeriod);
 
@@ -284,6 +370,22 @@ private:
     uint8_t mPollTimeoutCounter : 4;   //< Poll timeouts counter (0 to `kQuickPollsAfterTimout`).
     uint8_t mPollTxFailureCounter : 4; //< Poll tx failure counter (0 to `kMaxPollRetxAttempts`).
     uint8_t mRemainingFastPolls : 4;   //< Number of remaining fast polls when in transient fast polling mode.
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    bool     mFollowUpPoll;       //< Indicates whether the poll in progress retrieves a further frame.
+    uint32_t mLatencyBudget;      //< Latency budget of adaptive polling (in milliseconds), zero if disabled.
+    uint32_t mAdaptivePollPeriod; //< Adaptive poll period (in milliseconds).
+    uint32_t mLastPollTime;       //< Time of the last acknowledged poll.
+    uint32_t mPollsSent;          //< Number of acknowledged polls.
+    uint32_t mEmptyPolls;         //< Number of polls acknowledged without a pending frame.
+    uint32_t mLatencyCount;       //< Number of frames included in `mLatencySum`.
+    uint64_t mLatencySum;         //< Sum of the estimated downlink latencies (in milliseconds).
+#endif
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    uint8_t mFrameBurstLimit : 4; //< Maximum number of frames the parent sends per data poll.
+    uint8_t mFrameBurstCount : 4; //< Number of frames received since the last data poll.
+#endif
 };
 
 /**
@@ -149,6 +149,19 @@ exit:
     return error;
 }
 
+otError LinkRaw::ReceiveMultiChannel(uint32_t aChannelMask, otLinkRawReceiveDone aCallback)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(IsEnabled(), error = OT_ERROR_INVALID_STATE);
+
+    SuccessOrExit(error = mSubMac.ReceiveMultiChannel(aChannelMask));
+    mReceiveDoneCallback = aCallback;
+
+exit:
+    return error;
+}
+
 void LinkRaw::InvokeReceiveDone(RxFrame *aFrame, otError aError)
 {
     otLogDebgMac("LinkRaw::ReceiveDone(%d bytes), error:%s", (aFrame != NULL) ? aFrame->mLength : 0,
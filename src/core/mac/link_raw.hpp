@@ -103,6 +103,19 @@ public:
      */
     otError Receive(otLinkRawReceiveDone aCallback);
 
+    /**
+     * This method starts a (recurring) Receive on multiple channels concurrently on the link-layer.
+     *
+     * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+     * @param[in]  aCallback     A pointer to a function called on receipt of a IEEE 802.15.4 frame.
+     *
+     * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+     * @retval OT_ERROR_INVALID_STATE    The radio was disabled or transmitting.
+     * @retval OT_ERROR_NOT_CAPABLE      The radio does not support receiving on multiple channels.
+     *
+     */
+    otError ReceiveMultiChannel(uint32_t aChannelMask, otLinkRawReceiveDone aCallback);
+
     /**
      * This method invokes the mReceiveDoneCallback, if set.
      *
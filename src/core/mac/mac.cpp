@@ -87,6 +87,9 @@ Mac::Mac(Instance &aInstance)
 #if OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS
     , mShouldDelaySleep(false)
     , mDelayingSleep(false)
+#endif
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    , mScanMultiChannel(false)
 #endif
     , mOperation(kOperationIdle)
     , mBeaconSequence(Random::NonCrypto::GetUint8())
@@ -96,6 +99,9 @@ Mac::Mac(Instance &aInstance)
     , mPanChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
     , mRadioChannel(OPENTHREAD_CONFIG_DEFAULT_CHANNEL)
     , mRadioChannelAcquisitionId(0)
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    , mRadioChannelMask()
+#endif
     , mSupportedChannelMask(Get<Radio>().GetSupportedChannelMask())
     , mScanChannel(Radio::kChannelMin)
     , mScanDuration(0)
@@ -262,6 +268,14 @@ exit:
 
 void Mac::PerformActiveScan(void)
 {
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    if (mEnabled && mScanChannel == ChannelMask::kChannelIteratorFirst)
+    {
+        // Receive the beacons from all channels while the beacon requests are sent on each channel.
+        mScanMultiChannel = (mSubMac.ReceiveMultiChannel(mScanChannelMask.GetMask()) == OT_ERROR_NONE);
+    }
+#endif
+
     if (UpdateScanChannel() == OT_ERROR_NONE)
     {
         // If there are more channels to scan, send the beacon request.
@@ -269,6 +283,14 @@ void Mac::PerformActiveScan(void)
     }
     else
     {
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+        if (mScanMultiChannel)
+        {
+            mScanMultiChannel = false;
+            mSubMac.Receive(mRadioChannel);
+        }
+#endif
+
         mSubMac.SetPanId(mPanId);
         FinishOperation();
         mActiveScanHandler(GetInstance(), NULL);
@@ -425,12 +447,34 @@ otError Mac::ReleaseRadioChannel(void)
 
     mRadioChannelAcquisitionId = 0;
     mRadioChannel              = mPanChannel;
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    mRadioChannelMask.Clear();
+#endif
+
+    UpdateIdleMode();
+
+exit:
+    return error;
+}
+
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+otError Mac::SetRadioChannelMask(uint16_t aAcquisitionId, const ChannelMask &aChannelMask)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mRadioChannelAcquisitionId && aAcquisitionId == mRadioChannelAcquisitionId,
+                 error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(mSubMac.GetRadioCaps() & OT_RADIO_CAPS_MULTI_CHANNEL_RX, error = OT_ERROR_NOT_CAPABLE);
+
+    mRadioChannelMask = aChannelMask;
+    mRadioChannelMask.Intersect(mSupportedChannelMask);
 
     UpdateIdleMode();
 
 exit:
     return error;
 }
+#endif
 
 void Mac::SetSupportedChannelMask(const ChannelMask &aMask)
 {
@@ -576,6 +620,12 @@ void Mac::UpdateIdleMode(void)
         mSubMac.Sleep();
         otLogDebgMac("Idle mode: Radio sleeping");
     }
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    else if (!mRadioChannelMask.IsEmpty() && mSubMac.ReceiveMultiChannel(mRadioChannelMask.GetMask()) == OT_ERROR_NONE)
+    {
+        otLogDebgMac("Idle mode: Radio receiving on channels %s", mRadioChannelMask.ToString().AsCString());
+    }
+#endif
     else
     {
         mSubMac.Receive(mRadioChannel);
@@ -977,6 +1027,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame, bool aProcessAesCcm)
 
     if (aProcessAesCcm)
     {
+        OT_COUNTER_INCREMENT(GetInstance(), kAesCcmOperations);
         ProcessTransmitAesCcm(aFrame, extAddress);
     }
 
@@ -1253,6 +1304,21 @@ void Mac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, otError aError
     {
     case kOperationActiveScan:
         mCounters.mTxBeaconRequest++;
+
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+        if (mScanMultiChannel)
+        {
+            uint8_t channel = mScanChannel;
+
+            // Wait for the beacons once, after the beacon request is sent on the last channel.
+            if (mScanChannelMask.GetNextChannel(channel) == OT_ERROR_NONE)
+            {
+                mTimer.Start(OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_DWELL);
+                break;
+            }
+        }
+#endif
+
         mTimer.Start(mScanDuration);
         break;
 
@@ -1263,11 +1329,14 @@ void Mac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, otError aError
         break;
 
     case kOperationTransmitPoll:
+    {
+        bool framePending = false;
+
         assert(aFrame.GetAckRequest());
 
         if ((aError == OT_ERROR_NONE) && (aAckFrame != NULL))
         {
-            bool framePending = aAckFrame->GetFramePending();
+            framePending = aAckFrame->GetFramePending();
 
             if (mEnabled && framePending)
             {
@@ -1280,9 +1349,10 @@ void Mac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, otError aError
 
         mCounters.mTxDataPoll++;
         FinishOperation();
-        Get<DataPollSender>().HandlePollSent(aFrame, aError);
+        Get<DataPollSender>().HandlePollSent(aFrame, aError, framePending);
         PerformNextOperation();
         break;
+    }
 
     case kOperationTransmitDataDirect:
         mCounters.mTxData++;
@@ -1457,6 +1527,7 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
     aesCcm.SetKey(macKey, 16);
+    OT_COUNTER_INCREMENT(GetInstance(), kAesCcmOperations);
 
     error = aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     VerifyOrExit(error == OT_ERROR_NONE, error = OT_ERROR_SECURITY);
@@ -1505,6 +1576,9 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
 #if OPENTHREAD_CONFIG_MAC_FILTER_ENABLE
     int8_t rssi = OT_MAC_FILTER_FIXED_RSS_DISABLED;
 #endif // OPENTHREAD_CONFIG_MAC_FILTER_ENABLE
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    bool waitForBurst = false;
+#endif
 
     mCounters.mRxTotal++;
 
@@ -1632,7 +1706,22 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    // While waiting for data after a data poll, the parent may send
+    // the next frame of a burst without another data poll.
+
+    if ((mOperation == kOperationWaitingForData) && !dstaddr.IsNone())
+    {
+        waitForBurst = Get<DataPollSender>().ContinueFrameBurst(*aFrame);
+    }
+
+    if (!waitForBurst)
+    {
+        Get<DataPollSender>().CheckFramePending(*aFrame);
+    }
+#else
     Get<DataPollSender>().CheckFramePending(*aFrame);
+#endif
 
     if (neighbor != NULL)
     {
@@ -1696,6 +1785,17 @@ void Mac::HandleReceivedFrame(RxFrame *aFrame, otError aError)
         {
             mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+            if (waitForBurst)
+            {
+                // Keep waiting for the next frame of the burst, with
+                // a new data poll on timeout.
+                mTimer.Start(kDataPollTimeout);
+                SuccessOrExit(error);
+                break;
+            }
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_STAY_AWAKE_BETWEEN_FRAGMENTS
             if (!mRxOnWhenIdle && !mPromiscuous && aFrame->GetFramePending())
             {
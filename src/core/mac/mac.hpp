@@ -347,6 +347,24 @@ public:
      */
     otError ReleaseRadioChannel(void);
 
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    /**
+     * This method makes the radio receive on multiple channels concurrently while idle. It can only be called after
+     * successfully calling `AcquireRadioChannel()`, and lasts until `ReleaseRadioChannel()` is called.
+     *
+     * Frames are still transmitted on the Radio Channel.
+     *
+     * @param[in]  aAcquisitionId  The AcquisitionId returned by `AcquireRadioChannel()`.
+     * @param[in]  aChannelMask    The channels to receive on.
+     *
+     * @retval OT_ERROR_NONE           Successfully set the channels to receive on.
+     * @retval OT_ERROR_INVALID_STATE  The acquisition ID is incorrect.
+     * @retval OT_ERROR_NOT_CAPABLE    The radio does not support receiving on multiple channels.
+     *
+     */
+    otError SetRadioChannelMask(uint16_t aAcquisitionId, const ChannelMask &aChannelMask);
+#endif
+
     /**
      * This method returns the supported channel mask.
      *
@@ -702,6 +720,9 @@ private:
     bool mShouldDelaySleep : 1;
     bool mDelayingSleep : 1;
 #endif
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    bool mScanMultiChannel : 1;
+#endif
 
     Operation     mOperation;
     uint8_t       mBeaconSequence;
@@ -711,6 +732,9 @@ private:
     uint8_t       mPanChannel;
     uint8_t       mRadioChannel;
     uint16_t      mRadioChannelAcquisitionId;
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    ChannelMask mRadioChannelMask;
+#endif
     ChannelMask   mSupportedChannelMask;
     ExtendedPanId mExtendedPanId;
     otNetworkName mNetworkName;
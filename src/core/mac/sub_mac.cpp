@@ -55,6 +55,7 @@ SubMac::SubMac(Instance &aInstance)
     , mRxOnWhenBackoff(true)
     , mEnergyScanMaxRssi(kInvalidRssiValue)
     , mEnergyScanEndTime(0)
+    , mRxChannelMask(0)
     , mTransmitFrame(Get<Radio>().GetTransmitBuffer())
     , mCallbacks(aInstance)
     , mPcapCallback(NULL)
@@ -164,6 +165,7 @@ otError SubMac::Sleep(void)
         ExitNow();
     }
 
+    mRxChannelMask = 0;
     SetState(kStateSleep);
 
 exit:
@@ -180,6 +182,28 @@ otError SubMac::Receive(uint8_t aChannel)
         ExitNow();
     }
 
+    mRxChannelMask = 0;
+    SetState(kStateReceive);
+
+exit:
+    return error;
+}
+
+otError SubMac::ReceiveMultiChannel(uint32_t aChannelMask)
+{
+    otError error;
+
+    VerifyOrExit(RadioSupportsMultiChannelRx(), error = OT_ERROR_NOT_CAPABLE);
+
+    error = Get<Radio>().ReceiveMultiChannel(aChannelMask);
+
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnMac("RadioReceiveMultiChannel() failed, error: %s", otThreadErrorToString(error));
+        ExitNow();
+    }
+
+    mRxChannelMask = aChannelMask;
     SetState(kStateReceive);
 
 exit:
@@ -376,6 +400,12 @@ void SubMac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, otError aEr
 
     mTransmitRetries = 0;
 
+    if (mRxChannelMask != 0)
+    {
+        // The radio was moved to the channel of the frame for the transmission.
+        Get<Radio>().ReceiveMultiChannel(mRxChannelMask);
+    }
+
     SetState(kStateReceive);
 
     mCallbacks.TransmitDone(aFrame, aAckFrame, aError);
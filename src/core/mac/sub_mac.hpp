@@ -303,6 +303,21 @@ public:
      */
     otError Receive(uint8_t aChannel);
 
+    /**
+     * This method transitions the radio to Receive on multiple channels concurrently.
+     *
+     * The radio receives on all channels in @p aChannelMask, except while transmitting, until `Receive()` or `Sleep()`
+     * is called.
+     *
+     * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+     *
+     * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+     * @retval OT_ERROR_INVALID_STATE    The radio was disabled or transmitting.
+     * @retval OT_ERROR_NOT_CAPABLE      The radio does not support receiving on multiple channels.
+     *
+     */
+    otError ReceiveMultiChannel(uint32_t aChannelMask);
+
     /**
      * This method gets the radio transmit frame.
      *
@@ -379,6 +394,7 @@ private:
     bool RadioSupportsRetries(void) const { return ((mRadioCaps & OT_RADIO_CAPS_TRANSMIT_RETRIES) != 0); }
     bool RadioSupportsAckTimeout(void) const { return ((mRadioCaps & OT_RADIO_CAPS_ACK_TIMEOUT) != 0); }
     bool RadioSupportsEnergyScan(void) const { return ((mRadioCaps & OT_RADIO_CAPS_ENERGY_SCAN) != 0); }
+    bool RadioSupportsMultiChannelRx(void) const { return ((mRadioCaps & OT_RADIO_CAPS_MULTI_CHANNEL_RX) != 0); }
 
     bool ShouldHandleCsmaBackOff(void) const;
     bool ShouldHandleAckTimeout(void) const;
@@ -412,6 +428,7 @@ private:
     bool               mRxOnWhenBackoff;
     int8_t             mEnergyScanMaxRssi;
     uint32_t           mEnergyScanEndTime;
+    uint32_t           mRxChannelMask;
     TxFrame &          mTransmitFrame;
     Callbacks          mCallbacks;
     otLinkPcapCallback mPcapCallback;
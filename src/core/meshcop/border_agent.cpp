@@ -57,12 +57,18 @@ public:
      *
      * @param[in]   aBorderAgent    A reference to the border agent.
      * @param[in]   aHeader         A reference to the request header.
+     * @param[in]   aMessageInfo    A reference to the message info of the request.
      * @param[in]   aPetition       Whether this request is a petition.
      * @param[in]   aSeparate       Whether this original request expects separate response.
      *
      */
-    ForwardContext(BorderAgent &aBorderAgent, const Coap::Message &aMessage, bool aPetition, bool aSeparate)
+    ForwardContext(BorderAgent &           aBorderAgent,
+                   const Coap::Message &   aMessage,
+                   const Ip6::MessageInfo &aMessageInfo,
+                   bool                    aPetition,
+                   bool                    aSeparate)
         : mBorderAgent(aBorderAgent)
+        , mMessageInfo(aMessageInfo)
         , mMessageId(aMessage.GetMessageId())
         , mPetition(aPetition)
         , mSeparate(aSeparate)
@@ -97,6 +103,14 @@ public:
      */
     uint16_t GetMessageId(void) const { return mMessageId; }
 
+    /**
+     * This method returns the message info of the original request.
+     *
+     * @returns A reference to the message info of the original request, i.e. the DTLS peer to respond to.
+     *
+     */
+    const Ip6::MessageInfo &GetMessageInfo(void) const { return mMessageInfo; }
+
     /**
      * This method generate the response header according to the saved metadata.
      *
@@ -128,13 +142,14 @@ private:
     {
         kMaxTokenLength = OT_COAP_MAX_TOKEN_LENGTH, ///< The max token size
     };
-    BorderAgent &mBorderAgent;
-    uint16_t     mMessageId;              ///< The CoAP Message ID of the original request.
-    bool         mPetition : 1;           ///< Whether the forwarding request is leader petition.
-    bool         mSeparate : 1;           ///< Whether the original request expects separate response.
-    uint8_t      mTokenLength : 4;        ///< The CoAP Token Length of the original request.
-    uint8_t      mType : 2;               ///< The CoAP Type of the original request.
-    uint8_t      mToken[kMaxTokenLength]; ///< The CoAP Token of the original request.
+    BorderAgent &    mBorderAgent;
+    Ip6::MessageInfo mMessageInfo;            ///< The message info of the original request.
+    uint16_t         mMessageId;              ///< The CoAP Message ID of the original request.
+    bool             mPetition : 1;           ///< Whether the forwarding request is leader petition.
+    bool             mSeparate : 1;           ///< Whether the original request expects separate response.
+    uint8_t          mTokenLength : 4;        ///< The CoAP Token Length of the original request.
+    uint8_t          mType : 2;               ///< The CoAP Type of the original request.
+    uint8_t          mToken[kMaxTokenLength]; ///< The CoAP Token of the original request.
 };
 
 static Coap::Message::Code CoapCodeFromError(otError aError)
@@ -166,7 +181,7 @@ static void SendErrorMessage(Coap::CoapSecure &aCoapSecure, ForwardContext &aFor
 
     VerifyOrExit((message = NewMeshCoPMessage(aCoapSecure)) != NULL, error = OT_ERROR_NO_BUFS);
     SuccessOrExit(error = aForwardContext.ToHeader(*message, CoapCodeFromError(aError)));
-    SuccessOrExit(error = aCoapSecure.SendMessage(*message, aCoapSecure.GetPeerAddress()));
+    SuccessOrExit(error = aCoapSecure.SendMessage(*message, aForwardContext.GetMessageInfo()));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -180,10 +195,11 @@ exit:
     }
 }
 
-static void SendErrorMessage(Coap::CoapSecure &   aCoapSecure,
-                             const Coap::Message &aRequest,
-                             bool                 aSeparate,
-                             otError              aError)
+static void SendErrorMessage(Coap::CoapSecure &      aCoapSecure,
+                             const Coap::Message &   aRequest,
+                             const Ip6::MessageInfo &aMessageInfo,
+                             bool                    aSeparate,
+                             otError                 aError)
 {
     otError        error   = OT_ERROR_NONE;
     Coap::Message *message = NULL;
@@ -202,7 +218,7 @@ static void SendErrorMessage(Coap::CoapSecure &   aCoapSecure,
     message->SetMessageId(aSeparate ? 0 : aRequest.GetMessageId());
     SuccessOrExit(error = message->SetToken(aRequest.GetToken(), aRequest.GetTokenLength()));
 
-    SuccessOrExit(error = aCoapSecure.SendMessage(*message, aCoapSecure.GetPeerAddress()));
+    SuccessOrExit(error = aCoapSecure.SendMessage(*message, aMessageInfo));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -252,6 +268,9 @@ void BorderAgent::HandleCoapResponse(void *               aContext,
                                                                sessionIdTlv.GetCommissionerSessionId());
             instance.Get<ThreadNetif>().AddUnicastAddress(borderAgent.mCommissionerAloc);
             instance.Get<Ip6::Udp>().AddReceiver(borderAgent.mUdpReceiver);
+
+            // Relayed and proxied messages are forwarded to the commissioner whose petition was accepted.
+            borderAgent.mCommissionerPeer = forwardContext.GetMessageInfo();
         }
     }
 
@@ -262,7 +281,7 @@ void BorderAgent::HandleCoapResponse(void *               aContext,
         SuccessOrExit(error = message->SetPayloadMarker());
     }
 
-    SuccessOrExit(error = borderAgent.ForwardToCommissioner(*message, *response));
+    SuccessOrExit(error = borderAgent.ForwardToCommissioner(*message, *response, forwardContext.GetMessageInfo()));
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -439,7 +458,7 @@ bool BorderAgent::HandleUdpReceive(const Message &aMessage, const Ip6::MessageIn
         SuccessOrExit(error = message->AppendTlv(tlv));
     }
 
-    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(*message, Get<Coap::CoapSecure>().GetPeerAddress()));
+    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(*message, mCommissionerPeer));
 
     otLogInfoMeshCoP("Sent to commissioner on %s", OT_URI_PATH_PROXY_RX);
 
@@ -470,7 +489,7 @@ void BorderAgent::HandleRelayReceive(const Coap::Message &aMessage)
         SuccessOrExit(error = message->SetPayloadMarker());
     }
 
-    SuccessOrExit(error = ForwardToCommissioner(*message, aMessage));
+    SuccessOrExit(error = ForwardToCommissioner(*message, aMessage, mCommissionerPeer));
     otLogInfoMeshCoP("Sent to commissioner on %s", OT_URI_PATH_RELAY_RX);
 
 exit:
@@ -480,7 +499,9 @@ exit:
     }
 }
 
-otError BorderAgent::ForwardToCommissioner(Coap::Message &aForwardMessage, const Message &aMessage)
+otError BorderAgent::ForwardToCommissioner(Coap::Message &         aForwardMessage,
+                                           const Message &         aMessage,
+                                           const Ip6::MessageInfo &aMessageInfo)
 {
     otError  error  = OT_ERROR_NONE;
     uint16_t offset = 0;
@@ -489,8 +510,7 @@ otError BorderAgent::ForwardToCommissioner(Coap::Message &aForwardMessage, const
     SuccessOrExit(error = aForwardMessage.SetLength(offset + aMessage.GetLength() - aMessage.GetOffset()));
     aMessage.CopyTo(aMessage.GetOffset(), offset, aMessage.GetLength() - aMessage.GetOffset(), aForwardMessage);
 
-    SuccessOrExit(error =
-                      Get<Coap::CoapSecure>().SendMessage(aForwardMessage, Get<Coap::CoapSecure>().GetPeerAddress()));
+    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(aForwardMessage, aMessageInfo));
 
     otLogInfoMeshCoP("Sent to commissioner");
 
@@ -581,7 +601,7 @@ otError BorderAgent::ForwardToLeader(const Coap::Message &   aMessage,
     forwardContext = static_cast<ForwardContext *>(GetInstance().HeapCAlloc(1, sizeof(ForwardContext)));
     VerifyOrExit(forwardContext != NULL, error = OT_ERROR_NO_BUFS);
 
-    forwardContext = new (forwardContext) ForwardContext(*this, aMessage, aPetition, aSeparate);
+    forwardContext = new (forwardContext) ForwardContext(*this, aMessage, aMessageInfo, aPetition, aSeparate);
 
     SuccessOrExit(error = message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST, aPath));
 
@@ -622,7 +642,7 @@ exit:
 
         otLogWarnMeshCoP("Failed to forward to leader: %s", otThreadErrorToString(error));
 
-        SendErrorMessage(Get<Coap::CoapSecure>(), aMessage, aSeparate, error);
+        SendErrorMessage(Get<Coap::CoapSecure>(), aMessage, aMessageInfo, aSeparate, error);
     }
 
     return error;
@@ -638,9 +658,22 @@ void BorderAgent::HandleConnected(bool aConnected)
     }
     else
     {
+        const Ip6::MessageInfo &peer = Get<Coap::CoapSecure>().GetPeerAddress();
+
         otLogInfoMeshCoP("Commissioner disconnected");
-        Get<ThreadNetif>().RemoveUnicastAddress(mCommissionerAloc);
-        SetState(OT_BORDER_AGENT_STATE_STARTED);
+
+        // Other commissioner candidates may still be connected, only the accepted one owns the Commissioner ALOC.
+        if (peer.GetPeerAddr() == mCommissionerPeer.GetPeerAddr() &&
+            peer.GetPeerPort() == mCommissionerPeer.GetPeerPort())
+        {
+            Get<ThreadNetif>().RemoveUnicastAddress(mCommissionerAloc);
+            new (&mCommissionerPeer) Ip6::MessageInfo();
+        }
+
+        if (!Get<Coap::CoapSecure>().IsConnected())
+        {
+            SetState(OT_BORDER_AGENT_STATE_STARTED);
+        }
     }
 }
 
@@ -683,6 +716,7 @@ void BorderAgent::HandleTimeout(void)
 {
     if (Get<Coap::CoapSecure>().IsConnected())
     {
+        // The keep-alive timer is shared, so all commissioner sessions are reset.
         Get<Coap::CoapSecure>().Disconnect();
         otLogWarnMeshCoP("Reset commissioner session");
     }
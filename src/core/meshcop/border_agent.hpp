@@ -112,7 +112,9 @@ private:
                                 const char *            aPath,
                                 bool                    aPetition,
                                 bool                    aSeparate);
-    otError     ForwardToCommissioner(Coap::Message &aForwardMessage, const Message &aMessage);
+    otError     ForwardToCommissioner(Coap::Message &         aForwardMessage,
+                                      const Message &         aMessage,
+                                      const Ip6::MessageInfo &aMessageInfo);
     void        HandleKeepAlive(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void        HandleRelayTransmit(const Coap::Message &aMessage);
     void        HandleRelayReceive(const Coap::Message &aMessage);
@@ -132,7 +134,7 @@ private:
         kRestartDelay     = 1 * 1000,  ///< Delay to restart border agent service.
     };
 
-    Ip6::MessageInfo mMessageInfo;
+    Ip6::MessageInfo mCommissionerPeer; ///< The DTLS peer of the accepted commissioner petition.
 
     Coap::Resource mCommissionerPetition;
     Coap::Resource mCommissionerKeepAlive;
@@ -56,8 +56,7 @@ namespace MeshCoP {
 
 Commissioner::Commissioner(Instance &aInstance)
     : InstanceLocator(aInstance)
-    , mJoinerPort(0)
-    , mJoinerRloc(0)
+    , mCommissionerSetTimer(aInstance, HandleCommissionerSetTimer, this)
     , mJoinerExpirationTimer(aInstance, HandleJoinerExpirationTimer, this)
     , mTimer(aInstance, HandleTimer, this)
     , mSessionId(0)
@@ -68,12 +67,13 @@ Commissioner::Commissioner(Instance &aInstance)
     , mAnnounceBegin(aInstance)
     , mEnergyScan(aInstance)
     , mPanIdQuery(aInstance)
+    , mPSKcCacheValid(false)
     , mStateCallback(NULL)
     , mJoinerCallback(NULL)
     , mCallbackContext(NULL)
     , mState(OT_COMMISSIONER_STATE_DISABLED)
 {
-    memset(mJoiners, 0, sizeof(mJoiners));
+    memset(mJoinerSessions, 0, sizeof(mJoinerSessions));
 
     mCommissionerAloc.mPrefixLength       = 64;
     mCommissionerAloc.mPreferred          = true;
@@ -132,7 +132,8 @@ void Commissioner::HandleCoapsConnected(bool aConnected)
 
     event = aConnected ? OT_COMMISSIONER_JOINER_CONNECTED : OT_COMMISSIONER_JOINER_END;
 
-    memcpy(&joinerId, mJoinerIid, sizeof(joinerId));
+    // The DTLS peer address is the one of the session reporting the event.
+    memcpy(&joinerId, Get<Coap::CoapSecure>().GetPeerAddress().GetPeerAddr().GetIid(), sizeof(joinerId));
     joinerId.m8[0] ^= 0x2;
 
     SignalJoinerEvent(event, joinerId);
@@ -190,8 +191,6 @@ otError Commissioner::SendCommissionerSet(void)
 {
     otError                error;
     otCommissioningDataset dataset;
-    SteeringDataTlv        steeringData;
-    Mac::ExtAddress        joinerId;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
@@ -201,31 +200,9 @@ otError Commissioner::SendCommissionerSet(void)
     dataset.mSessionId      = mSessionId;
     dataset.mIsSessionIdSet = true;
 
-    // compute bloom filter
-    steeringData.Init();
-    steeringData.Clear();
-
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
-    {
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
-
-        if (mJoiners[i].mAny)
-        {
-            steeringData.SetLength(1);
-            steeringData.Set();
-            break;
-        }
-
-        ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-        steeringData.ComputeBloomFilter(joinerId);
-    }
-
     // set bloom filter
-    dataset.mSteeringData.mLength = steeringData.GetSteeringDataLength();
-    memcpy(dataset.mSteeringData.m8, steeringData.GetValue(), dataset.mSteeringData.mLength);
+    dataset.mSteeringData.mLength = mJoinerTable.GetSteeringData().GetSteeringDataLength();
+    memcpy(dataset.mSteeringData.m8, mJoinerTable.GetSteeringData().GetValue(), dataset.mSteeringData.mLength);
     dataset.mIsSteeringDataSet = true;
 
     SuccessOrExit(error = SendMgmtCommissionerSetRequest(dataset, NULL, 0));
@@ -234,52 +211,49 @@ exit:
     return error;
 }
 
-void Commissioner::ClearJoiners(void)
+void Commissioner::ScheduleCommissionerSet(void)
 {
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    // The timer is not restarted, so a stream of changes is sent at least every `kCommissionerSetDelay`.
+    if (!mCommissionerSetTimer.IsRunning())
     {
-        mJoiners[i].mValid = false;
+        mCommissionerSetTimer.Start(kCommissionerSetDelay);
     }
+}
 
+void Commissioner::HandleCommissionerSetTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<Commissioner>().SendCommissionerSet();
+}
+
+void Commissioner::ClearJoiners(void)
+{
+    mJoinerTable.Clear();
+    UpdateJoinerExpirationTimer();
+
+    // Sent right away, the commissioner may be stopping.
+    mCommissionerSetTimer.Stop();
     SendCommissionerSet();
 }
 
 otError Commissioner::AddJoiner(const Mac::ExtAddress *aEui64, const char *aPSKd, uint32_t aTimeout)
 {
-    otError error = OT_ERROR_NO_BUFS;
+    otError              error = OT_ERROR_NONE;
+    JoinerTable::Joiner *joiner;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
     VerifyOrExit(strlen(aPSKd) <= Dtls::kPskMaxLength, error = OT_ERROR_INVALID_ARGS);
-    RemoveJoiner(aEui64, 0); // remove immediately
 
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    if ((joiner = mJoinerTable.Find(aEui64)) != NULL)
     {
-        if (mJoiners[i].mValid)
-        {
-            continue;
-        }
-
-        if (aEui64 != NULL)
-        {
-            memcpy(&mJoiners[i].mEui64, aEui64, sizeof(mJoiners[i].mEui64));
-            mJoiners[i].mAny = false;
-        }
-        else
-        {
-            mJoiners[i].mAny = true;
-        }
-
-        (void)strlcpy(mJoiners[i].mPsk, aPSKd, sizeof(mJoiners[i].mPsk));
-        mJoiners[i].mValid          = true;
-        mJoiners[i].mExpirationTime = TimerMilli::GetNow() + TimerMilli::SecToMsec(aTimeout);
-
-        UpdateJoinerExpirationTimer();
+        RemoveJoinerEntry(*joiner);
+    }
 
-        SendCommissionerSet();
+    VerifyOrExit(mJoinerTable.Add(aEui64, aPSKd, TimerMilli::GetNow() + TimerMilli::SecToMsec(aTimeout)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
 
-        ExitNow(error = OT_ERROR_NONE);
-    }
+    UpdateJoinerExpirationTimer();
+    ScheduleCommissionerSet();
 
 exit:
     if (error == OT_ERROR_NONE)
@@ -297,64 +271,95 @@ exit:
     return error;
 }
 
-otError Commissioner::RemoveJoiner(const Mac::ExtAddress *aEui64, uint32_t aDelay)
+otError Commissioner::AddJoiners(const otCommissionerJoiner *aJoiners, uint16_t aNumJoiners, uint32_t aTimeout)
 {
-    otError error = OT_ERROR_NOT_FOUND;
+    otError  error          = OT_ERROR_NONE;
+    uint32_t expirationTime = TimerMilli::GetNow() + TimerMilli::SecToMsec(aTimeout);
+    uint16_t numNeeded      = 0;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
 
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    // Check all entries first, so that none is added on error. An existing entry is replaced in place.
+    for (uint16_t i = 0; i < aNumJoiners; i++)
     {
-        Mac::ExtAddress joinerId;
+        const Mac::ExtAddress &eui64 = static_cast<const Mac::ExtAddress &>(aJoiners[i].mEui64);
 
-        if (!mJoiners[i].mValid)
-        {
-            continue;
-        }
+        VerifyOrExit(aJoiners[i].mPskd != NULL && strlen(aJoiners[i].mPskd) <= Dtls::kPskMaxLength,
+                     error = OT_ERROR_INVALID_ARGS);
 
-        if (aEui64 != NULL)
-        {
-            if (memcmp(&mJoiners[i].mEui64, aEui64, sizeof(mJoiners[i].mEui64)))
-            {
-                continue;
-            }
-        }
-        else if (!mJoiners[i].mAny)
+        if (mJoinerTable.Find(&eui64) == NULL)
         {
-            continue;
+            numNeeded++;
         }
+    }
+
+    VerifyOrExit(numNeeded <= mJoinerTable.GetNumFree(), error = OT_ERROR_NO_BUFS);
 
-        if (aDelay > 0)
+    for (uint16_t i = 0; i < aNumJoiners; i++)
+    {
+        const Mac::ExtAddress &eui64 = static_cast<const Mac::ExtAddress &>(aJoiners[i].mEui64);
+        JoinerTable::Joiner *  joiner;
+
+        if ((joiner = mJoinerTable.Find(&eui64)) != NULL)
         {
-            uint32_t now = TimerMilli::GetNow();
-
-            if ((static_cast<int32_t>(mJoiners[i].mExpirationTime - now) > 0) &&
-                (static_cast<uint32_t>(mJoiners[i].mExpirationTime - now) > TimerMilli::SecToMsec(aDelay)))
-            {
-                mJoiners[i].mExpirationTime = now + TimerMilli::SecToMsec(aDelay);
-                UpdateJoinerExpirationTimer();
-            }
+            RemoveJoinerEntry(*joiner);
         }
-        else
+
+        joiner = mJoinerTable.Add(&eui64, aJoiners[i].mPskd, expirationTime);
+        assert(joiner != NULL);
+    }
+
+    UpdateJoinerExpirationTimer();
+    ScheduleCommissionerSet();
+
+    otLogInfoMeshCoP("Added %d Joiners", aNumJoiners);
+
+exit:
+    return error;
+}
+
+void Commissioner::RemoveJoinerEntry(JoinerTable::Joiner &aJoiner)
+{
+    Mac::ExtAddress joinerId = aJoiner.mJoinerId;
+
+    if (aJoiner.mAny)
+    {
+        otLogInfoMeshCoP("Removed Joiner (*)");
+    }
+    else
+    {
+        otLogInfoMeshCoP("Removed Joiner (%s)", aJoiner.mEui64.ToString().AsCString());
+    }
+
+    mJoinerTable.Remove(aJoiner);
+    UpdateJoinerExpirationTimer();
+    ScheduleCommissionerSet();
+
+    SignalJoinerEvent(OT_COMMISSIONER_JOINER_REMOVED, joinerId);
+}
+
+otError Commissioner::RemoveJoiner(const Mac::ExtAddress *aEui64, uint32_t aDelay)
+{
+    otError              error = OT_ERROR_NONE;
+    JoinerTable::Joiner *joiner;
+
+    VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit((joiner = mJoinerTable.Find(aEui64)) != NULL, error = OT_ERROR_NOT_FOUND);
+
+    if (aDelay > 0)
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        if ((static_cast<int32_t>(joiner->mExpirationTime - now) > 0) &&
+            (static_cast<uint32_t>(joiner->mExpirationTime - now) > TimerMilli::SecToMsec(aDelay)))
         {
-            mJoiners[i].mValid = false;
+            joiner->mExpirationTime = now + TimerMilli::SecToMsec(aDelay);
             UpdateJoinerExpirationTimer();
-            SendCommissionerSet();
-
-            if (aEui64)
-            {
-                otLogInfoMeshCoP("Removed Joiner (%s)", aEui64->ToString().AsCString());
-            }
-            else
-            {
-                otLogInfoMeshCoP("Removed Joiner (*)");
-            }
-
-            ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-            SignalJoinerEvent(OT_COMMISSIONER_JOINER_REMOVED, joinerId);
         }
-
-        ExitNow(error = OT_ERROR_NONE);
+    }
+    else
+    {
+        RemoveJoinerEntry(*joiner);
     }
 
 exit:
@@ -426,17 +431,19 @@ void Commissioner::HandleJoinerExpirationTimer(void)
     uint32_t now = TimerMilli::GetNow();
 
     // Remove Joiners.
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    for (uint16_t i = 0; i < JoinerTable::kMaxJoiners; i++)
     {
-        if (!mJoiners[i].mValid)
+        JoinerTable::Joiner &joiner = mJoinerTable.GetJoiner(i);
+
+        if (!joiner.mValid)
         {
             continue;
         }
 
-        if (static_cast<int32_t>(now - mJoiners[i].mExpirationTime) >= 0)
+        if (static_cast<int32_t>(now - joiner.mExpirationTime) >= 0)
         {
             otLogDebgMeshCoP("removing joiner due to timeout or successfully joined");
-            RemoveJoiner(&mJoiners[i].mEui64, 0); // remove immediately
+            RemoveJoinerEntry(joiner); // remove immediately
         }
     }
 
@@ -449,16 +456,17 @@ void Commissioner::UpdateJoinerExpirationTimer(void)
     uint32_t nextTimeout = TimerMilli::kForeverDt;
 
     // Check if timer should be set for next Joiner.
-    for (size_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+    for (uint16_t i = 0; i < JoinerTable::kMaxJoiners; i++)
     {
-        int32_t diff;
+        const JoinerTable::Joiner &joiner = mJoinerTable.GetJoiner(i);
+        int32_t                    diff;
 
-        if (!mJoiners[i].mValid)
+        if (!joiner.mValid)
         {
             continue;
         }
 
-        diff = TimerMilli::Diff(now, mJoiners[i].mExpirationTime);
+        diff = TimerMilli::Diff(now, joiner.mExpirationTime);
         if (diff <= 0)
         {
             nextTimeout = 0;
@@ -832,7 +840,7 @@ void Commissioner::HandleRelayReceive(Coap::Message &aMessage, const Ip6::Messag
     Ip6::MessageInfo       joinerMessageInfo;
     uint16_t               offset;
     uint16_t               length;
-    bool                   enableJoiner = false;
+    JoinerSession *        session = NULL;
     Mac::ExtAddress        joinerId;
 
     VerifyOrExit(mState == OT_COMMISSIONER_STATE_ACTIVE, error = OT_ERROR_INVALID_STATE);
@@ -851,58 +859,48 @@ void Commissioner::HandleRelayReceive(Coap::Message &aMessage, const Ip6::Messag
     SuccessOrExit(error = Tlv::GetValueOffset(aMessage, Tlv::kJoinerDtlsEncapsulation, offset, length));
     VerifyOrExit(length <= aMessage.GetLength() - offset, error = OT_ERROR_PARSE);
 
-    if (!Get<Coap::CoapSecure>().IsConnectionActive())
+    joinerMessageInfo.SetPeerAddr(Get<Mle::MleRouter>().GetMeshLocal64());
+    joinerMessageInfo.GetPeerAddr().SetIid(joinerIid.GetIid());
+    joinerMessageInfo.SetPeerPort(joinerPort.GetUdpPort());
+
+    if (!Get<Coap::CoapSecure>().IsConnectionActive(joinerMessageInfo.GetPeerAddr(), joinerMessageInfo.GetPeerPort()))
     {
-        memcpy(mJoinerIid, joinerIid.GetIid(), sizeof(mJoinerIid));
-        mJoinerIid[0] ^= 0x2;
+        JoinerTable::Joiner *joiner;
+
+        memcpy(&joinerId, joinerIid.GetIid(), sizeof(joinerId));
+        joinerId.m8[0] ^= 0x2;
 
-        for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mJoiners); i++)
+        if ((joiner = mJoinerTable.FindById(joinerId)) != NULL)
         {
-            if (!mJoiners[i].mValid)
-            {
-                continue;
-            }
-
-            ComputeJoinerId(mJoiners[i].mEui64, joinerId);
-
-            if (mJoiners[i].mAny || !memcmp(&joinerId, mJoinerIid, sizeof(joinerId)))
-            {
-                error = Get<Coap::CoapSecure>().SetPsk(reinterpret_cast<const uint8_t *>(mJoiners[i].mPsk),
-                                                       static_cast<uint8_t>(strlen(mJoiners[i].mPsk)));
-                SuccessOrExit(error);
-                mJoinerIndex = i;
-                enableJoiner = true;
-
-                otLogInfoMeshCoP("found joiner, starting new session");
-                SignalJoinerEvent(OT_COMMISSIONER_JOINER_START, joinerId);
-
-                break;
-            }
-        }
+            VerifyOrExit((session = NewJoinerSession(joinerIid.GetIid())) != NULL, error = OT_ERROR_NO_BUFS);
+
+            error = Get<Coap::CoapSecure>().SetPsk(reinterpret_cast<const uint8_t *>(joiner->mPsk),
+                                                   static_cast<uint8_t>(strlen(joiner->mPsk)));
+            SuccessOrExit(error);
+            memcpy(session->mIid, joinerIid.GetIid(), sizeof(session->mIid));
+            session->mJoinerIndex = mJoinerTable.GetIndex(*joiner);
 
-        mJoinerIid[0] ^= 0x2;
+            otLogInfoMeshCoP("found joiner, starting new session");
+            SignalJoinerEvent(OT_COMMISSIONER_JOINER_START, joinerId);
+        }
     }
     else
     {
-        enableJoiner = (memcmp(mJoinerIid, joinerIid.GetIid(), sizeof(mJoinerIid)) == 0);
+        session = FindJoinerSession(joinerIid.GetIid());
     }
 
-    VerifyOrExit(enableJoiner);
+    VerifyOrExit(session != NULL);
 
-    mJoinerPort = joinerPort.GetUdpPort();
-    mJoinerRloc = joinerRloc.GetJoinerRouterLocator();
+    session->mPort = joinerPort.GetUdpPort();
+    session->mRloc = joinerRloc.GetJoinerRouterLocator();
 
-    otLogInfoMeshCoP("Remove Relay Receive (%02x%02x%02x%02x%02x%02x%02x%02x, 0x%04x)", mJoinerIid[0], mJoinerIid[1],
-                     mJoinerIid[2], mJoinerIid[3], mJoinerIid[4], mJoinerIid[5], mJoinerIid[6], mJoinerIid[7],
-                     mJoinerRloc);
+    otLogInfoMeshCoP("Remove Relay Receive (%02x%02x%02x%02x%02x%02x%02x%02x, 0x%04x)", session->mIid[0],
+                     session->mIid[1], session->mIid[2], session->mIid[3], session->mIid[4], session->mIid[5],
+                     session->mIid[6], session->mIid[7], session->mRloc);
 
     aMessage.SetOffset(offset);
     SuccessOrExit(error = aMessage.SetLength(offset + length));
 
-    joinerMessageInfo.SetPeerAddr(Get<Mle::MleRouter>().GetMeshLocal64());
-    joinerMessageInfo.GetPeerAddr().SetIid(mJoinerIid);
-    joinerMessageInfo.SetPeerPort(mJoinerPort);
-
     Get<Coap::CoapSecure>().HandleUdpReceive(aMessage, joinerMessageInfo);
 
 exit:
@@ -937,8 +935,6 @@ void Commissioner::HandleJoinerFinalize(void *aContext, otMessage *aMessage, con
 
 void Commissioner::HandleJoinerFinalize(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    OT_UNUSED_VARIABLE(aMessageInfo);
-
     StateTlv::State    state = StateTlv::kAccept;
     ProvisioningUrlTlv provisioningUrl;
 
@@ -965,16 +961,18 @@ void Commissioner::HandleJoinerFinalize(Coap::Message &aMessage, const Ip6::Mess
     }
 #endif
 
-    SendJoinFinalizeResponse(aMessage, state);
+    SendJoinFinalizeResponse(aMessage, aMessageInfo, state);
 }
 
-void Commissioner::SendJoinFinalizeResponse(const Coap::Message &aRequest, StateTlv::State aState)
+void Commissioner::SendJoinFinalizeResponse(const Coap::Message &   aRequest,
+                                            const Ip6::MessageInfo &aMessageInfo,
+                                            StateTlv::State         aState)
 {
     otError           error = OT_ERROR_NONE;
-    Ip6::MessageInfo  joinerMessageInfo;
     MeshCoP::StateTlv stateTlv;
     Coap::Message *   message;
     Mac::ExtAddress   joinerId;
+    JoinerSession *   session;
 
     VerifyOrExit((message = NewMeshCoPMessage(Get<Coap::CoapSecure>())) != NULL, error = OT_ERROR_NO_BUFS);
 
@@ -987,10 +985,6 @@ void Commissioner::SendJoinFinalizeResponse(const Coap::Message &aRequest, State
     stateTlv.SetState(aState);
     SuccessOrExit(error = message->AppendTlv(stateTlv));
 
-    joinerMessageInfo.SetPeerAddr(Get<Mle::MleRouter>().GetMeshLocal64());
-    joinerMessageInfo.GetPeerAddr().SetIid(mJoinerIid);
-    joinerMessageInfo.SetPeerPort(mJoinerPort);
-
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t buf[OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE];
 
@@ -999,16 +993,18 @@ void Commissioner::SendJoinFinalizeResponse(const Coap::Message &aRequest, State
     otDumpCertMeshCoP("[THCI] direction=send | type=JOIN_FIN.rsp |", buf, message->GetLength() - message->GetOffset());
 #endif
 
-    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(*message, joinerMessageInfo));
+    SuccessOrExit(error = Get<Coap::CoapSecure>().SendMessage(*message, aMessageInfo));
 
-    memcpy(&joinerId, mJoinerIid, sizeof(joinerId));
+    memcpy(&joinerId, aMessageInfo.GetPeerAddr().GetIid(), sizeof(joinerId));
     joinerId.m8[0] ^= 0x2;
     SignalJoinerEvent(OT_COMMISSIONER_JOINER_FINALIZE, joinerId);
 
-    if (!mJoiners[mJoinerIndex].mAny)
+    session = FindJoinerSession(aMessageInfo.GetPeerAddr().GetIid());
+
+    if (session != NULL && !mJoinerTable.GetJoiner(session->mJoinerIndex).mAny)
     {
         // remove after kRemoveJoinerDelay (seconds)
-        RemoveJoiner(&mJoiners[mJoinerIndex].mEui64, kRemoveJoinerDelay);
+        RemoveJoiner(&mJoinerTable.GetJoiner(session->mJoinerIndex).mEui64, kRemoveJoinerDelay);
     }
 
     otLogInfoMeshCoP("sent joiner finalize response");
@@ -1028,17 +1024,17 @@ otError Commissioner::SendRelayTransmit(void *aContext, Message &aMessage, const
 
 otError Commissioner::SendRelayTransmit(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    OT_UNUSED_VARIABLE(aMessageInfo);
-
-    otError                error = OT_ERROR_NONE;
+    otError                error   = OT_ERROR_NONE;
+    JoinerSession *        session = FindJoinerSession(aMessageInfo.GetPeerAddr().GetIid());
     JoinerUdpPortTlv       udpPort;
     JoinerIidTlv           iid;
     JoinerRouterLocatorTlv rloc;
     ExtendedTlv            tlv;
-    Coap::Message *        message;
+    Coap::Message *        message = NULL;
     uint16_t               offset;
     Ip6::MessageInfo       messageInfo;
 
+    VerifyOrExit(session != NULL, error = OT_ERROR_NOT_FOUND);
     VerifyOrExit((message = NewMeshCoPMessage(Get<Coap::Coap>())) != NULL, error = OT_ERROR_NO_BUFS);
 
     message->Init(OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_POST);
@@ -1046,15 +1042,15 @@ otError Commissioner::SendRelayTransmit(Message &aMessage, const Ip6::MessageInf
     SuccessOrExit(error = message->SetPayloadMarker());
 
     udpPort.Init();
-    udpPort.SetUdpPort(mJoinerPort);
+    udpPort.SetUdpPort(aMessageInfo.GetPeerPort());
     SuccessOrExit(error = message->AppendTlv(udpPort));
 
     iid.Init();
-    iid.SetIid(mJoinerIid);
+    iid.SetIid(session->mIid);
     SuccessOrExit(error = message->AppendTlv(iid));
 
     rloc.Init();
-    rloc.SetJoinerRouterLocator(mJoinerRloc);
+    rloc.SetJoinerRouterLocator(session->mRloc);
     SuccessOrExit(error = message->AppendTlv(rloc));
 
     if (aMessage.GetSubType() == Message::kSubTypeJoinerFinalizeResponse)
@@ -1073,7 +1069,7 @@ otError Commissioner::SendRelayTransmit(Message &aMessage, const Ip6::MessageInf
     aMessage.CopyTo(0, offset, aMessage.GetLength(), *message);
 
     messageInfo.SetPeerAddr(Get<Mle::MleRouter>().GetMeshLocal16());
-    messageInfo.GetPeerAddr().mFields.m16[7] = HostSwap16(mJoinerRloc);
+    messageInfo.GetPeerAddr().mFields.m16[7] = HostSwap16(session->mRloc);
     messageInfo.SetPeerPort(kCoapUdpPort);
 
     SuccessOrExit(error = Get<Coap::Coap>().SendMessage(*message, messageInfo));
@@ -1090,6 +1086,45 @@ exit:
     return error;
 }
 
+Commissioner::JoinerSession *Commissioner::FindJoinerSession(const uint8_t *aIid)
+{
+    JoinerSession *session = NULL;
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mJoinerSessions); i++)
+    {
+        if (memcmp(mJoinerSessions[i].mIid, aIid, sizeof(mJoinerSessions[i].mIid)) == 0)
+        {
+            ExitNow(session = &mJoinerSessions[i]);
+        }
+    }
+
+exit:
+    return session;
+}
+
+Commissioner::JoinerSession *Commissioner::NewJoinerSession(const uint8_t *aIid)
+{
+    JoinerSession *session = FindJoinerSession(aIid);
+
+    VerifyOrExit(session == NULL);
+
+    // Reuse an entry whose DTLS session has ended.
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(mJoinerSessions); i++)
+    {
+        Ip6::Address peerAddr = Get<Mle::MleRouter>().GetMeshLocal64();
+
+        peerAddr.SetIid(mJoinerSessions[i].mIid);
+
+        if (!Get<Coap::CoapSecure>().IsConnectionActive(peerAddr, mJoinerSessions[i].mPort))
+        {
+            ExitNow(session = &mJoinerSessions[i]);
+        }
+    }
+
+exit:
+    return session;
+}
+
 otError Commissioner::GeneratePSKc(const char *              aPassPhrase,
                                    const char *              aNetworkName,
                                    const Mac::ExtendedPanId &aExtPanId,
@@ -1121,6 +1156,39 @@ exit:
     return error;
 }
 
+otError Commissioner::GetPSKc(const char *              aPassPhrase,
+                              const char *              aNetworkName,
+                              const Mac::ExtendedPanId &aExtPanId,
+                              uint8_t *                 aPSKc)
+{
+    otError        error     = OT_ERROR_NONE;
+    const uint8_t  separator = 0;
+    Crypto::Sha256 sha256;
+    uint8_t        cacheKey[Crypto::Sha256::kHashSize];
+
+    VerifyOrExit(strlen(aPassPhrase) <= OT_COMMISSIONING_PASSPHRASE_MAX_SIZE, error = OT_ERROR_INVALID_ARGS);
+
+    sha256.Start();
+    sha256.Update(reinterpret_cast<const uint8_t *>(aPassPhrase), static_cast<uint16_t>(strlen(aPassPhrase)));
+    sha256.Update(&separator, sizeof(separator));
+    sha256.Update(reinterpret_cast<const uint8_t *>(aNetworkName), static_cast<uint16_t>(strlen(aNetworkName)));
+    sha256.Update(&separator, sizeof(separator));
+    sha256.Update(aExtPanId.m8, sizeof(aExtPanId.m8));
+    sha256.Finish(cacheKey);
+
+    if (!mPSKcCacheValid || memcmp(cacheKey, mPSKcCacheKey, sizeof(cacheKey)) != 0)
+    {
+        SuccessOrExit(error = GeneratePSKc(aPassPhrase, aNetworkName, aExtPanId, mPSKcCache));
+        memcpy(mPSKcCacheKey, cacheKey, sizeof(mPSKcCacheKey));
+        mPSKcCacheValid = true;
+    }
+
+    memcpy(aPSKc, mPSKcCache, sizeof(mPSKcCache));
+
+exit:
+    return error;
+}
+
 } // namespace MeshCoP
 } // namespace ot
 
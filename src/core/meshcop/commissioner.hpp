@@ -42,10 +42,12 @@
 #include "coap/coap_secure.hpp"
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/sha256.hpp"
 #include "mac/mac_frame.hpp"
 #include "meshcop/announce_begin_client.hpp"
 #include "meshcop/dtls.hpp"
 #include "meshcop/energy_scan_client.hpp"
+#include "meshcop/joiner_table.hpp"
 #include "meshcop/panid_query_client.hpp"
 #include "net/udp6.hpp"
 #include "thread/mle.hpp"
@@ -109,6 +111,23 @@ public:
      */
     otError AddJoiner(const Mac::ExtAddress *aEui64, const char *aPSKd, uint32_t aTimeout);
 
+    /**
+     * This method adds a list of Joiner entries.
+     *
+     * Either all entries are added or, on error, none is.
+     *
+     * @param[in]  aJoiners      A pointer to an array of Joiner entries.
+     * @param[in]  aNumJoiners   The number of entries in @p aJoiners.
+     * @param[in]  aTimeout      A time after which the Joiners are automatically removed, in seconds.
+     *
+     * @retval OT_ERROR_NONE           Successfully added the Joiners.
+     * @retval OT_ERROR_NO_BUFS        No buffers available to add all the Joiners.
+     * @retval OT_ERROR_INVALID_ARGS   A PSKd in @p aJoiners is invalid.
+     * @retval OT_ERROR_INVALID_STATE  Commissioner service is not started.
+     *
+     */
+    otError AddJoiners(const otCommissionerJoiner *aJoiners, uint16_t aNumJoiners, uint32_t aTimeout);
+
     /**
      * This method removes a Joiner entry.
      *
@@ -221,6 +240,26 @@ public:
                                 const Mac::ExtendedPanId &aExtPanId,
                                 uint8_t *                 aPSKc);
 
+    /**
+     * This method generates PSKc, or returns the last generated one if the inputs are unchanged.
+     *
+     * The PBKDF2 derivation of PSKc is slow, the result is cached keyed by a hash of the passphrase, the network
+     * name and the extended pan id.
+     *
+     * @param[in]  aPassPhrase   The commissioning passphrase.
+     * @param[in]  aNetworkName  The network name for PSKc computation.
+     * @param[in]  aExtPanId     The extended pan id for PSKc computation.
+     * @param[out] aPSKc         A pointer to where the generated PSKc will be placed.
+     *
+     * @retval OT_ERROR_NONE          Successfully generate PSKc.
+     * @retval OT_ERROR_INVALID_ARGS  If the length of passphrase is out of range.
+     *
+     */
+    otError GetPSKc(const char *              aPassPhrase,
+                    const char *              aNetworkName,
+                    const Mac::ExtendedPanId &aExtPanId,
+                    uint8_t *                 aPSKc);
+
     /**
      * This method returns a reference to the AnnounceBeginClient instance.
      *
@@ -303,7 +342,9 @@ private:
     static void HandleJoinerFinalize(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleJoinerFinalize(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    void SendJoinFinalizeResponse(const Coap::Message &aRequest, StateTlv::State aState);
+    void SendJoinFinalizeResponse(const Coap::Message &   aRequest,
+                                  const Ip6::MessageInfo &aMessageInfo,
+                                  StateTlv::State         aState);
 
     static otError SendRelayTransmit(void *aContext, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError        SendRelayTransmit(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
@@ -315,21 +356,36 @@ private:
     void SetState(otCommissionerState aState);
     void SignalJoinerEvent(otCommissionerJoinerEvent aEvent, const Mac::ExtAddress &aJoinerId);
 
-    struct Joiner
+    enum
+    {
+        kCommissionerSetDelay = OPENTHREAD_CONFIG_COMMISSIONER_SET_DELAY,
+    };
+
+    void RemoveJoinerEntry(JoinerTable::Joiner &aJoiner);
+    void ScheduleCommissionerSet(void);
+
+    static void HandleCommissionerSetTimer(Timer &aTimer);
+
+    JoinerTable mJoinerTable;
+    TimerMilli  mCommissionerSetTimer;
+
+    /**
+     * This structure represents a Joiner with a DTLS session, one per concurrent DTLS session.
+     *
+     */
+    struct JoinerSession
     {
-        Mac::ExtAddress mEui64;
-        uint32_t        mExpirationTime;
-        char            mPsk[Dtls::kPskMaxLength + 1];
-        bool            mValid : 1;
-        bool            mAny : 1;
+        uint8_t  mIid[8];      ///< The Joiner IID (as relayed by the Joiner Router).
+        uint16_t mPort;        ///< The Joiner UDP port.
+        uint16_t mRloc;        ///< The Joiner Router RLOC16.
+        uint16_t mJoinerIndex; ///< The index of the matching entry in `mJoinerTable`.
     };
-    Joiner mJoiners[OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES];
 
-    uint8_t    mJoinerIid[8];
-    uint16_t   mJoinerPort;
-    uint16_t   mJoinerRloc;
-    uint8_t    mJoinerIndex;
-    TimerMilli mJoinerExpirationTimer;
+    JoinerSession *FindJoinerSession(const uint8_t *aIid);
+    JoinerSession *NewJoinerSession(const uint8_t *aIid);
+
+    JoinerSession mJoinerSessions[OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS];
+    TimerMilli    mJoinerExpirationTimer;
 
     TimerMilli mTimer;
     uint16_t   mSessionId;
@@ -347,6 +403,10 @@ private:
 
     ProvisioningUrlTlv mProvisioningUrl;
 
+    uint8_t mPSKcCacheKey[Crypto::Sha256::kHashSize];
+    uint8_t mPSKcCache[OT_PSKC_MAX_SIZE];
+    bool    mPSKcCacheValid;
+
     otCommissionerStateCallback  mStateCallback;
     otCommissionerJoinerCallback mJoinerCallback;
     void *                       mCallbackContext;
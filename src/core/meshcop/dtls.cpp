@@ -56,16 +56,30 @@
 namespace ot {
 namespace MeshCoP {
 
+Dtls::Session::Session(void)
+    : mDtls(NULL)
+    , mState(kStateClosed)
+    , mReceiveMessage(NULL)
+    , mTimerIntermediate(0)
+    , mTimerFinish(0)
+    , mTimerSet(false)
+    , mMessageSubType(Message::kSubTypeNone)
+    , mPskLength(0)
+{
+    memset(&mSsl, 0, sizeof(mSsl));
+    memset(mPsk, 0, sizeof(mPsk));
+    memset(mKek, 0, sizeof(mKek));
+}
+
 Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
     : InstanceLocator(aInstance)
     , mState(kStateClosed)
     , mPskLength(0)
     , mVerifyPeerCertificate(true)
     , mTimer(aInstance, &Dtls::HandleTimer, this)
-    , mTimerIntermediate(0)
-    , mTimerSet(false)
+    , mConfigured(false)
+    , mClient(false)
     , mLayerTwoSecurity(aLayerTwoSecurity)
-    , mReceiveMessage(NULL)
     , mConnectedHandler(NULL)
     , mReceiveHandler(NULL)
     , mSendHandler(NULL)
@@ -73,8 +87,8 @@ Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
     , mSocket(Get<Ip6::Udp>())
     , mTransportCallback(NULL)
     , mTransportContext(NULL)
-    , mMessageSubType(Message::kSubTypeNone)
     , mMessageDefaultSubType(Message::kSubTypeNone)
+    , mCurrentSession(NULL)
 {
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 #ifdef MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
@@ -99,16 +113,22 @@ Dtls::Dtls(Instance &aInstance, bool aLayerTwoSecurity)
 
     memset(mCipherSuites, 0, sizeof(mCipherSuites));
     memset(mPsk, 0, sizeof(mPsk));
-    memset(&mSsl, 0, sizeof(mSsl));
     memset(&mConf, 0, sizeof(mConf));
 
 #ifdef MBEDTLS_SSL_COOKIE_C
     memset(&mCookieCtx, 0, sizeof(mCookieCtx));
 #endif
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        mSessions[i].mDtls = this;
+    }
 }
 
-void Dtls::FreeMbedtls(void)
+void Dtls::FreeConfig(void)
 {
+    VerifyOrExit(mConfigured);
+
 #ifdef MBEDTLS_SSL_COOKIE_C
     mbedtls_ssl_cookie_free(&mCookieCtx);
 #endif
@@ -120,7 +140,11 @@ void Dtls::FreeMbedtls(void)
 #endif // MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     mbedtls_ssl_config_free(&mConf);
-    mbedtls_ssl_free(&mSsl);
+
+    mConfigured = false;
+
+exit:
+    return;
 }
 
 otError Dtls::Open(ReceiveHandler aReceiveHandler, ConnectedHandler aConnectedHandler, void *aContext)
@@ -142,19 +166,119 @@ exit:
 
 otError Dtls::Connect(const Ip6::SockAddr &aSockAddr)
 {
-    otError error;
+    otError  error;
+    Session *session;
 
-    VerifyOrExit(mState == kStateOpen, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(mState == kStateOpen && !IsConnectionActive(), error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit((session = NewSession()) != NULL, error = OT_ERROR_INVALID_STATE);
 
-    memcpy(&mPeerAddress.mPeerAddr, &aSockAddr.mAddress, sizeof(mPeerAddress.mPeerAddr));
-    mPeerAddress.mPeerPort = aSockAddr.mPort;
+    new (&session->mPeerAddress) Ip6::MessageInfo();
+    memcpy(&session->mPeerAddress.mPeerAddr, &aSockAddr.mAddress, sizeof(session->mPeerAddress.mPeerAddr));
+    session->mPeerAddress.mPeerPort = aSockAddr.mPort;
 
-    error = Setup(true);
+    error = Setup(*session, true);
 
 exit:
     return error;
 }
 
+bool Dtls::IsConnectionActive(void) const
+{
+    bool rval = false;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        if (mSessions[i].IsActive())
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+Dtls::Session *Dtls::NewSession(void)
+{
+    Session *session = NULL;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        if (mSessions[i].mState == kStateClosed)
+        {
+            ExitNow(session = &mSessions[i]);
+        }
+    }
+
+exit:
+    return session;
+}
+
+const Dtls::Session *Dtls::FindSession(State aState) const
+{
+    const Session *session = NULL;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        if (mSessions[i].mState == aState)
+        {
+            ExitNow(session = &mSessions[i]);
+        }
+    }
+
+exit:
+    return session;
+}
+
+const Dtls::Session *Dtls::FindSession(const Ip6::Address &aPeerAddr, uint16_t aPeerPort) const
+{
+    const Session *session = NULL;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        if (mSessions[i].Matches(aPeerAddr, aPeerPort))
+        {
+            ExitNow(session = &mSessions[i]);
+        }
+    }
+
+exit:
+    return session;
+}
+
+bool Dtls::HasSslSession(void) const
+{
+    bool rval = false;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        if (mSessions[i].mState >= kStateInitializing && mSessions[i].mState <= kStateConnected)
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+const Ip6::MessageInfo &Dtls::GetPeerAddress(void) const
+{
+    const Session *session = mCurrentSession;
+
+    if (session == NULL)
+    {
+        session = FindSession(kStateConnected);
+    }
+
+    if (session == NULL)
+    {
+        session = &mSessions[0];
+    }
+
+    return session->mPeerAddress;
+}
+
 void Dtls::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
     static_cast<Dtls *>(aContext)->HandleUdpReceive(*static_cast<Message *>(aMessage),
@@ -163,49 +287,52 @@ void Dtls::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessage
 
 void Dtls::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    switch (mState)
-    {
-    case MeshCoP::Dtls::kStateClosed:
-        ExitNow();
+    Session *session;
+
+    VerifyOrExit(mState == kStateOpen);
 
-    case MeshCoP::Dtls::kStateOpen:
+    session = FindSession(aMessageInfo.GetPeerAddr(), aMessageInfo.GetPeerPort());
+
+    if (session == NULL)
     {
-        Ip6::SockAddr sockAddr;
+        // A client communicates only with the server it connected to.
+        VerifyOrExit(!(mConfigured && mClient));
 
-        sockAddr.mAddress = aMessageInfo.GetPeerAddr();
-        sockAddr.mPort    = aMessageInfo.GetPeerPort();
-        mSocket.Connect(sockAddr);
+        if ((session = NewSession()) == NULL)
+        {
+            otLogNoteMeshCoP("Dtls: no free session for a new peer");
+            ExitNow();
+        }
 
-        mPeerAddress.SetPeerAddr(aMessageInfo.GetPeerAddr());
-        mPeerAddress.SetPeerPort(aMessageInfo.GetPeerPort());
-        mPeerAddress.SetIsHostInterface(aMessageInfo.IsHostInterface());
+        new (&session->mPeerAddress) Ip6::MessageInfo();
+        session->mPeerAddress.SetPeerAddr(aMessageInfo.GetPeerAddr());
+        session->mPeerAddress.SetPeerPort(aMessageInfo.GetPeerPort());
+        session->mPeerAddress.SetIsHostInterface(aMessageInfo.IsHostInterface());
 
         if (Get<ThreadNetif>().IsUnicastAddress(aMessageInfo.GetSockAddr()))
         {
-            mPeerAddress.SetSockAddr(aMessageInfo.GetSockAddr());
+            session->mPeerAddress.SetSockAddr(aMessageInfo.GetSockAddr());
         }
 
-        mPeerAddress.SetSockPort(aMessageInfo.GetSockPort());
+        session->mPeerAddress.SetSockPort(aMessageInfo.GetSockPort());
 
-        SuccessOrExit(Setup(false));
-        break;
+        SuccessOrExit(Setup(*session, false));
     }
-
-    default:
-        // Once DTLS session is started, communicate only with a peer.
-        VerifyOrExit((mPeerAddress.GetPeerAddr() == aMessageInfo.GetPeerAddr()) &&
-                     (mPeerAddress.GetPeerPort() == aMessageInfo.GetPeerPort()));
-        break;
+    else
+    {
+        // Do not handle a new connection from the peer before the guard time expired.
+        VerifyOrExit(session->mState != kStateCloseNotify);
     }
 
 #ifdef MBEDTLS_SSL_SRV_C
-    if (mState == MeshCoP::Dtls::kStateConnecting)
+    if (session->mState == kStateConnecting)
     {
-        SetClientId(mPeerAddress.GetPeerAddr().mFields.m8, sizeof(mPeerAddress.GetPeerAddr().mFields));
+        SetClientId(*session, session->mPeerAddress.GetPeerAddr().mFields.m8,
+                    sizeof(session->mPeerAddress.GetPeerAddr().mFields));
     }
 #endif
 
-    Receive(aMessage);
+    Receive(*session, aMessage);
 
 exit:
     return;
@@ -241,16 +368,10 @@ exit:
     return error;
 }
 
-otError Dtls::Setup(bool aClient)
+int Dtls::SetupConfig(bool aClient)
 {
     int rval;
 
-    // do not handle new connection before guard time expired
-    VerifyOrExit(mState == kStateOpen, rval = MBEDTLS_ERR_SSL_TIMEOUT);
-
-    mState = kStateInitializing;
-
-    mbedtls_ssl_init(&mSsl);
     mbedtls_ssl_config_init(&mConf);
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 #ifdef MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
@@ -259,6 +380,12 @@ otError Dtls::Setup(bool aClient)
     mbedtls_pk_init(&mPrivateKey);
 #endif // MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+#ifdef MBEDTLS_SSL_COOKIE_C
+    mbedtls_ssl_cookie_init(&mCookieCtx);
+#endif
+
+    mConfigured = true;
+    mClient     = aClient;
 
     rval = mbedtls_ssl_config_defaults(&mConf, aClient ? MBEDTLS_SSL_IS_CLIENT : MBEDTLS_SSL_IS_SERVER,
                                        MBEDTLS_SSL_TRANSPORT_DATAGRAM, MBEDTLS_SSL_PRESET_DEFAULT);
@@ -290,8 +417,6 @@ otError Dtls::Setup(bool aClient)
 #ifdef MBEDTLS_SSL_SRV_C
     if (!aClient)
     {
-        mbedtls_ssl_cookie_init(&mCookieCtx);
-
         rval = mbedtls_ssl_cookie_setup(&mCookieCtx, mbedtls_ctr_drbg_random, Random::Crypto::MbedTlsContextGet());
         VerifyOrExit(rval == 0);
 
@@ -299,27 +424,53 @@ otError Dtls::Setup(bool aClient)
     }
 #endif
 
-    rval = mbedtls_ssl_setup(&mSsl, &mConf);
-    VerifyOrExit(rval == 0);
-
-    mbedtls_ssl_set_bio(&mSsl, this, &Dtls::HandleMbedtlsTransmit, HandleMbedtlsReceive, NULL);
-    mbedtls_ssl_set_timer_cb(&mSsl, this, &Dtls::HandleMbedtlsSetTimer, HandleMbedtlsGetTimer);
-
-    if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
-    {
-        rval = mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
-    }
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
-    else
+    if (mCipherSuites[0] != MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
         rval = SetApplicationCoapSecureKeys();
     }
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+
+exit:
+    return rval;
+}
+
+otError Dtls::Setup(Session &aSession, bool aClient)
+{
+    int rval = 0;
+
+    aSession.mState = kStateInitializing;
+
+    mbedtls_ssl_init(&aSession.mSsl);
+
+    // All sessions share the configuration, it is set up for the first one.
+    if (!mConfigured)
+    {
+        rval = SetupConfig(aClient);
+        VerifyOrExit(rval == 0);
+    }
+
+    assert(mClient == aClient);
+
+    rval = mbedtls_ssl_setup(&aSession.mSsl, &mConf);
     VerifyOrExit(rval == 0);
 
-    mReceiveMessage = NULL;
-    mMessageSubType = Message::kSubTypeNone;
-    mState          = kStateConnecting;
+    mbedtls_ssl_set_bio(&aSession.mSsl, &aSession, &Dtls::HandleMbedtlsTransmit, HandleMbedtlsReceive, NULL);
+    mbedtls_ssl_set_timer_cb(&aSession.mSsl, &aSession, &Dtls::HandleMbedtlsSetTimer, HandleMbedtlsGetTimer);
+
+    // The PSK may change for the next session (e.g. the commissioner has a PSKd per joiner).
+    memcpy(aSession.mPsk, mPsk, mPskLength);
+    aSession.mPskLength = mPskLength;
+
+    if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
+    {
+        rval = mbedtls_ssl_set_hs_ecjpake_password(&aSession.mSsl, aSession.mPsk, aSession.mPskLength);
+        VerifyOrExit(rval == 0);
+    }
+
+    aSession.mReceiveMessage = NULL;
+    aSession.mMessageSubType = Message::kSubTypeNone;
+    aSession.mTimerSet       = false;
 
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
@@ -332,15 +483,20 @@ otError Dtls::Setup(bool aClient)
     }
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
-    mState = kStateConnecting;
+    aSession.mState = kStateConnecting;
 
-    Process();
+    Process(aSession);
 
 exit:
-    if ((mState == kStateInitializing) && (rval != 0))
+    if ((aSession.mState == kStateInitializing) && (rval != 0))
     {
-        mState = kStateOpen;
-        FreeMbedtls();
+        mbedtls_ssl_free(&aSession.mSsl);
+        aSession.mState = kStateClosed;
+
+        if (!HasSslSession())
+        {
+            FreeConfig();
+        }
     }
 
     return Crypto::MbedTls::MapError(rval);
@@ -407,10 +563,15 @@ void Dtls::Close(void)
 {
     Disconnect();
 
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        mSessions[i].mState    = kStateClosed;
+        mSessions[i].mTimerSet = false;
+    }
+
     mState             = kStateClosed;
     mTransportCallback = NULL;
     mTransportContext  = NULL;
-    mTimerSet          = false;
 
     mSocket.Close();
     mTimer.Stop();
@@ -418,16 +579,29 @@ void Dtls::Close(void)
 
 void Dtls::Disconnect(void)
 {
-    VerifyOrExit(mState == kStateConnecting || mState == kStateConnected);
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        Disconnect(mSessions[i]);
+    }
+}
+
+void Dtls::Disconnect(Session &aSession)
+{
+    VerifyOrExit(aSession.mState == kStateConnecting || aSession.mState == kStateConnected);
 
-    mbedtls_ssl_close_notify(&mSsl);
-    mState = kStateCloseNotify;
-    mTimer.Start(kGuardTimeNewConnectionMilli);
+    mbedtls_ssl_close_notify(&aSession.mSsl);
+    mbedtls_ssl_free(&aSession.mSsl);
 
-    new (&mPeerAddress) Ip6::MessageInfo();
-    mSocket.Connect(Ip6::SockAddr());
+    // The session is kept for the guard time, to ignore the retransmissions of the peer.
+    aSession.mState       = kStateCloseNotify;
+    aSession.mTimerSet    = true;
+    aSession.mTimerFinish = TimerMilli::GetNow() + kGuardTimeNewConnectionMilli;
+    StartTimer();
 
-    FreeMbedtls();
+    if (!HasSslSession())
+    {
+        FreeConfig();
+    }
 
 exit:
     return;
@@ -507,10 +681,13 @@ otError Dtls::GetPeerCertificateBase64(unsigned char *aPeerCert, size_t *aCertLe
 {
     otError error = OT_ERROR_NONE;
 
-    VerifyOrExit(mState == kStateConnected, error = OT_ERROR_INVALID_STATE);
+    const Session *session = (mCurrentSession != NULL) ? mCurrentSession : FindSession(kStateConnected);
 
-    VerifyOrExit(mbedtls_base64_encode(aPeerCert, aCertBufferSize, aCertLength, mSsl.session->peer_cert->raw.p,
-                                       mSsl.session->peer_cert->raw.len) == 0,
+    VerifyOrExit(session != NULL && session->mState == kStateConnected, error = OT_ERROR_INVALID_STATE);
+
+    VerifyOrExit(mbedtls_base64_encode(aPeerCert, aCertBufferSize, aCertLength,
+                                       session->mSsl.session->peer_cert->raw.p,
+                                       session->mSsl.session->peer_cert->raw.len) == 0,
                  error = OT_ERROR_NO_BUFS);
 
 exit:
@@ -521,29 +698,37 @@ exit:
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
 #ifdef MBEDTLS_SSL_SRV_C
-otError Dtls::SetClientId(const uint8_t *aClientId, uint8_t aLength)
+otError Dtls::SetClientId(Session &aSession, const uint8_t *aClientId, uint8_t aLength)
 {
-    int rval = mbedtls_ssl_set_client_transport_id(&mSsl, aClientId, aLength);
+    int rval = mbedtls_ssl_set_client_transport_id(&aSession.mSsl, aClientId, aLength);
     return Crypto::MbedTls::MapError(rval);
 }
 #endif
 
-otError Dtls::Send(Message &aMessage, uint16_t aLength)
+otError Dtls::Send(Message &aMessage, uint16_t aLength, const Ip6::SockAddr &aPeer)
 {
-    otError error = OT_ERROR_NONE;
-    uint8_t buffer[kApplicationDataMaxLength];
+    otError  error   = OT_ERROR_NONE;
+    Session *session = FindSession(aPeer.GetAddress(), aPeer.mPort);
+    Session *previous;
+    uint8_t  buffer[kApplicationDataMaxLength];
 
+    VerifyOrExit(session != NULL && session->mState == kStateConnected, error = OT_ERROR_INVALID_STATE);
     VerifyOrExit(aLength <= kApplicationDataMaxLength, error = OT_ERROR_NO_BUFS);
 
     // Store message specific sub type.
     if (aMessage.GetSubType() != Message::kSubTypeNone)
     {
-        mMessageSubType = aMessage.GetSubType();
+        session->mMessageSubType = aMessage.GetSubType();
     }
 
     aMessage.Read(0, aLength, buffer);
 
-    SuccessOrExit(error = Crypto::MbedTls::MapError(mbedtls_ssl_write(&mSsl, buffer, aLength)));
+    previous        = mCurrentSession;
+    mCurrentSession = session;
+    error           = Crypto::MbedTls::MapError(mbedtls_ssl_write(&session->mSsl, buffer, aLength));
+    mCurrentSession = previous;
+
+    SuccessOrExit(error);
 
     aMessage.Free();
 
@@ -551,21 +736,23 @@ exit:
     return error;
 }
 
-void Dtls::Receive(Message &aMessage)
+void Dtls::Receive(Session &aSession, Message &aMessage)
 {
-    mReceiveMessage = &aMessage;
+    aSession.mReceiveMessage = &aMessage;
 
-    Process();
+    Process(aSession);
 
-    mReceiveMessage = NULL;
+    aSession.mReceiveMessage = NULL;
 }
 
 int Dtls::HandleMbedtlsTransmit(void *aContext, const unsigned char *aBuf, size_t aLength)
 {
-    return static_cast<Dtls *>(aContext)->HandleMbedtlsTransmit(aBuf, aLength);
+    Session &session = *static_cast<Session *>(aContext);
+
+    return session.mDtls->HandleMbedtlsTransmit(session, aBuf, aLength);
 }
 
-int Dtls::HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength)
+int Dtls::HandleMbedtlsTransmit(Session &aSession, const unsigned char *aBuf, size_t aLength)
 {
     otError error;
     int     rval = 0;
@@ -581,10 +768,10 @@ int Dtls::HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength)
     }
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
-    error = HandleDtlsSend(aBuf, static_cast<uint16_t>(aLength), mMessageSubType);
+    error = HandleDtlsSend(aSession, aBuf, static_cast<uint16_t>(aLength), aSession.mMessageSubType);
 
     // Restore default sub type.
-    mMessageSubType = mMessageDefaultSubType;
+    aSession.mMessageSubType = mMessageDefaultSubType;
 
     switch (error)
     {
@@ -607,12 +794,15 @@ int Dtls::HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength)
 
 int Dtls::HandleMbedtlsReceive(void *aContext, unsigned char *aBuf, size_t aLength)
 {
-    return static_cast<Dtls *>(aContext)->HandleMbedtlsReceive(aBuf, aLength);
+    Session &session = *static_cast<Session *>(aContext);
+
+    return session.mDtls->HandleMbedtlsReceive(session, aBuf, aLength);
 }
 
-int Dtls::HandleMbedtlsReceive(unsigned char *aBuf, size_t aLength)
+int Dtls::HandleMbedtlsReceive(Session &aSession, unsigned char *aBuf, size_t aLength)
 {
-    int rval;
+    Message *message = aSession.mReceiveMessage;
+    int      rval;
 
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
@@ -625,7 +815,7 @@ int Dtls::HandleMbedtlsReceive(unsigned char *aBuf, size_t aLength)
     }
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
-    VerifyOrExit(mReceiveMessage != NULL && (rval = mReceiveMessage->GetLength() - mReceiveMessage->GetOffset()) > 0,
+    VerifyOrExit(message != NULL && (rval = message->GetLength() - message->GetOffset()) > 0,
                  rval = MBEDTLS_ERR_SSL_WANT_READ);
 
     if (aLength > static_cast<size_t>(rval))
@@ -633,8 +823,8 @@ int Dtls::HandleMbedtlsReceive(unsigned char *aBuf, size_t aLength)
         aLength = static_cast<size_t>(rval);
     }
 
-    rval = mReceiveMessage->Read(mReceiveMessage->GetOffset(), static_cast<uint16_t>(aLength), aBuf);
-    mReceiveMessage->MoveOffset(rval);
+    rval = message->Read(message->GetOffset(), static_cast<uint16_t>(aLength), aBuf);
+    message->MoveOffset(rval);
 
 exit:
     return rval;
@@ -642,12 +832,15 @@ exit:
 
 int Dtls::HandleMbedtlsGetTimer(void *aContext)
 {
-    return static_cast<Dtls *>(aContext)->HandleMbedtlsGetTimer();
+    const Session &session = *static_cast<const Session *>(aContext);
+
+    return session.mDtls->HandleMbedtlsGetTimer(session);
 }
 
-int Dtls::HandleMbedtlsGetTimer(void)
+int Dtls::HandleMbedtlsGetTimer(const Session &aSession)
 {
-    int rval;
+    uint32_t now = TimerMilli::GetNow();
+    int      rval;
 
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
@@ -660,15 +853,15 @@ int Dtls::HandleMbedtlsGetTimer(void)
     }
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
-    if (!mTimerSet)
+    if (!aSession.mTimerSet)
     {
         rval = -1;
     }
-    else if (!mTimer.IsRunning())
+    else if (static_cast<int32_t>(aSession.mTimerFinish - now) <= 0)
     {
         rval = 2;
     }
-    else if (static_cast<int32_t>(mTimerIntermediate - TimerMilli::GetNow()) <= 0)
+    else if (static_cast<int32_t>(aSession.mTimerIntermediate - now) <= 0)
     {
         rval = 1;
     }
@@ -682,10 +875,12 @@ int Dtls::HandleMbedtlsGetTimer(void)
 
 void Dtls::HandleMbedtlsSetTimer(void *aContext, uint32_t aIntermediate, uint32_t aFinish)
 {
-    static_cast<Dtls *>(aContext)->HandleMbedtlsSetTimer(aIntermediate, aFinish);
+    Session &session = *static_cast<Session *>(aContext);
+
+    session.mDtls->HandleMbedtlsSetTimer(session, aIntermediate, aFinish);
 }
 
-void Dtls::HandleMbedtlsSetTimer(uint32_t aIntermediate, uint32_t aFinish)
+void Dtls::HandleMbedtlsSetTimer(Session &aSession, uint32_t aIntermediate, uint32_t aFinish)
 {
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
     {
@@ -700,14 +895,53 @@ void Dtls::HandleMbedtlsSetTimer(uint32_t aIntermediate, uint32_t aFinish)
 
     if (aFinish == 0)
     {
-        mTimerSet = false;
+        aSession.mTimerSet = false;
+    }
+    else
+    {
+        uint32_t now = TimerMilli::GetNow();
+
+        aSession.mTimerSet          = true;
+        aSession.mTimerFinish       = now + aFinish;
+        aSession.mTimerIntermediate = now + aIntermediate;
+    }
+
+    StartTimer();
+}
+
+void Dtls::StartTimer(void)
+{
+    uint32_t now      = TimerMilli::GetNow();
+    bool     running  = false;
+    uint32_t fireTime = 0;
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
+    {
+        const Session &session = mSessions[i];
+
+        if (!session.IsActive() || !session.mTimerSet)
+        {
+            continue;
+        }
+
+        if (!running || static_cast<int32_t>(session.mTimerFinish - fireTime) < 0)
+        {
+            fireTime = session.mTimerFinish;
+            running  = true;
+        }
+    }
+
+    if (!running)
+    {
         mTimer.Stop();
     }
+    else if (static_cast<int32_t>(fireTime - now) <= 0)
+    {
+        mTimer.Start(0);
+    }
     else
     {
-        mTimerSet = true;
-        mTimer.Start(aFinish);
-        mTimerIntermediate = TimerMilli::GetNow() + aIntermediate;
+        mTimer.Start(fireTime - now);
     }
 }
 
@@ -737,6 +971,9 @@ int Dtls::HandleMbedtlsExportKeys(const unsigned char *aMasterSecret,
     sha256.Update(aKeyBlock, 2 * static_cast<uint16_t>(aMacLength + aKeyLength + aIvLength));
     sha256.Finish(kek);
 
+    assert(mCurrentSession != NULL);
+    memcpy(mCurrentSession->mKek, kek, sizeof(mCurrentSession->mKek));
+
     Get<KeyManager>().SetKek(kek);
 
     if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
@@ -759,44 +996,69 @@ void Dtls::HandleTimer(Timer &aTimer)
 
 void Dtls::HandleTimer(void)
 {
-    switch (mState)
+    uint32_t now = TimerMilli::GetNow();
+
+    for (uint8_t i = 0; i < kMaxSessions; i++)
     {
-    case kStateConnecting:
-    case kStateConnected:
-        Process();
-        break;
+        Session &session = mSessions[i];
 
-    case kStateCloseNotify:
-        mState = kStateOpen;
-        mTimer.Stop();
+        if (!session.IsActive() || !session.mTimerSet || static_cast<int32_t>(session.mTimerFinish - now) > 0)
+        {
+            continue;
+        }
 
-        if (mConnectedHandler != NULL)
+        switch (session.mState)
         {
-            mConnectedHandler(mContext, false);
+        case kStateConnecting:
+        case kStateConnected:
+            Process(session);
+            break;
+
+        case kStateCloseNotify:
+        {
+            Session *previous = mCurrentSession;
+
+            session.mState    = kStateClosed;
+            session.mTimerSet = false;
+
+            if (mConnectedHandler != NULL)
+            {
+                mCurrentSession = &session;
+                mConnectedHandler(mContext, false);
+                mCurrentSession = previous;
+            }
+
+            new (&session.mPeerAddress) Ip6::MessageInfo();
+            break;
         }
-        break;
 
-    default:
-        assert(false);
-        break;
+        default:
+            assert(false);
+            break;
+        }
     }
+
+    StartTimer();
 }
 
-void Dtls::Process(void)
+void Dtls::Process(Session &aSession)
 {
-    uint8_t buf[MBEDTLS_SSL_MAX_CONTENT_LEN];
-    bool    shouldDisconnect = false;
-    int     rval;
+    uint8_t  buf[MBEDTLS_SSL_MAX_CONTENT_LEN];
+    Session *previous         = mCurrentSession;
+    bool     shouldDisconnect = false;
+    int      rval;
+
+    mCurrentSession = &aSession;
 
-    while ((mState == kStateConnecting) || (mState == kStateConnected))
+    while ((aSession.mState == kStateConnecting) || (aSession.mState == kStateConnected))
     {
-        if (mState == kStateConnecting)
+        if (aSession.mState == kStateConnecting)
         {
-            rval = mbedtls_ssl_handshake(&mSsl);
+            rval = mbedtls_ssl_handshake(&aSession.mSsl);
 
-            if (mSsl.state == MBEDTLS_SSL_HANDSHAKE_OVER)
+            if (aSession.mSsl.state == MBEDTLS_SSL_HANDSHAKE_OVER)
             {
-                mState = kStateConnected;
+                aSession.mState = kStateConnected;
 
                 if (mConnectedHandler != NULL)
                 {
@@ -806,7 +1068,7 @@ void Dtls::Process(void)
         }
         else
         {
-            rval = mbedtls_ssl_read(&mSsl, buf, sizeof(buf));
+            rval = mbedtls_ssl_read(&aSession.mSsl, buf, sizeof(buf));
         }
 
         if (rval > 0)
@@ -822,7 +1084,7 @@ void Dtls::Process(void)
             switch (rval)
             {
             case MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY:
-                mbedtls_ssl_close_notify(&mSsl);
+                mbedtls_ssl_close_notify(&aSession.mSsl);
                 ExitNow(shouldDisconnect = true);
                 break;
 
@@ -830,14 +1092,14 @@ void Dtls::Process(void)
                 break;
 
             case MBEDTLS_ERR_SSL_FATAL_ALERT_MESSAGE:
-                mbedtls_ssl_close_notify(&mSsl);
+                mbedtls_ssl_close_notify(&aSession.mSsl);
                 ExitNow(shouldDisconnect = true);
                 break;
 
             case MBEDTLS_ERR_SSL_INVALID_MAC:
-                if (mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER)
+                if (aSession.mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER)
                 {
-                    mbedtls_ssl_send_alert_message(&mSsl, MBEDTLS_SSL_ALERT_LEVEL_FATAL,
+                    mbedtls_ssl_send_alert_message(&aSession.mSsl, MBEDTLS_SSL_ALERT_LEVEL_FATAL,
                                                    MBEDTLS_SSL_ALERT_MSG_BAD_RECORD_MAC);
                     ExitNow(shouldDisconnect = true);
                 }
@@ -845,9 +1107,9 @@ void Dtls::Process(void)
                 break;
 
             default:
-                if (mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER)
+                if (aSession.mSsl.state != MBEDTLS_SSL_HANDSHAKE_OVER)
                 {
-                    mbedtls_ssl_send_alert_message(&mSsl, MBEDTLS_SSL_ALERT_LEVEL_FATAL,
+                    mbedtls_ssl_send_alert_message(&aSession.mSsl, MBEDTLS_SSL_ALERT_LEVEL_FATAL,
                                                    MBEDTLS_SSL_ALERT_MSG_HANDSHAKE_FAILURE);
                     ExitNow(shouldDisconnect = true);
                 }
@@ -855,10 +1117,10 @@ void Dtls::Process(void)
                 break;
             }
 
-            mbedtls_ssl_session_reset(&mSsl);
+            mbedtls_ssl_session_reset(&aSession.mSsl);
             if (mCipherSuites[0] == MBEDTLS_TLS_ECJPAKE_WITH_AES_128_CCM_8)
             {
-                mbedtls_ssl_set_hs_ecjpake_password(&mSsl, mPsk, mPskLength);
+                mbedtls_ssl_set_hs_ecjpake_password(&aSession.mSsl, aSession.mPsk, aSession.mPskLength);
             }
             break;
         }
@@ -868,8 +1130,10 @@ exit:
 
     if (shouldDisconnect)
     {
-        Disconnect();
+        Disconnect(aSession);
     }
+
+    mCurrentSession = previous;
 }
 
 void Dtls::HandleMbedtlsDebug(void *ctx, int level, const char *, int, const char *str)
@@ -900,7 +1164,7 @@ void Dtls::HandleMbedtlsDebug(void *ctx, int level, const char *, int, const cha
     }
 }
 
-otError Dtls::HandleDtlsSend(const uint8_t *aBuf, uint16_t aLength, uint8_t aMessageSubType)
+otError Dtls::HandleDtlsSend(Session &aSession, const uint8_t *aBuf, uint16_t aLength, uint8_t aMessageSubType)
 {
     otError      error   = OT_ERROR_NONE;
     ot::Message *message = NULL;
@@ -917,13 +1181,20 @@ otError Dtls::HandleDtlsSend(const uint8_t *aBuf, uint16_t aLength, uint8_t aMes
         message->SetSubType(aMessageSubType);
     }
 
+    // The Joiner Finalize Response carries the KEK of its own session, which may differ from the KEK of the latest
+    // handshake when several sessions are active.
+    if (aMessageSubType == Message::kSubTypeJoinerFinalizeResponse)
+    {
+        Get<KeyManager>().SetKek(aSession.mKek);
+    }
+
     if (mTransportCallback)
     {
-        SuccessOrExit(error = mTransportCallback(mTransportContext, *message, mPeerAddress));
+        SuccessOrExit(error = mTransportCallback(mTransportContext, *message, aSession.mPeerAddress));
     }
     else
     {
-        SuccessOrExit(error = mSocket.SendTo(*message, mPeerAddress));
+        SuccessOrExit(error = mSocket.SendTo(*message, aSession.mPeerAddress));
     }
 
 exit:
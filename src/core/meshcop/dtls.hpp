@@ -76,6 +76,7 @@ public:
 #else
         kApplicationDataMaxLength = OPENTHREAD_CONFIG_DTLS_APPLICATION_DATA_MAX_LENGTH,
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+        kMaxSessions = OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS,
     };
 
     enum State
@@ -100,6 +101,8 @@ public:
     /**
      * This function pointer is called when a connection is established or torn down.
      *
+     * `GetPeerAddress()` returns the peer of the session during the call.
+     *
      * @param[in]  aContext    A pointer to application-specific context.
      * @param[in]  aConnected  TRUE if a connection was established, FALSE otherwise.
      *
@@ -109,6 +112,8 @@ public:
     /**
      * This function pointer is called when data is received from the DTLS session.
      *
+     * `GetPeerAddress()` returns the peer of the session during the call.
+     *
      * @param[in]  aContext  A pointer to application-specific context.
      * @param[in]  aBuf      A pointer to the received data buffer.
      * @param[in]  aLength   Number of bytes in the received data buffer.
@@ -182,38 +187,55 @@ public:
      * Set X509 Pk and Cert for use DTLS mode ECDHE ECDSA with AES 128 CCM 8 or
      * set PreShared Key for use DTLS mode PSK with AES 128 CCM 8.
      *
+     * A client has at most one session.
+     *
      * @param[in]  aSockAddr               A reference to the remote sockaddr.
      *
      * @retval OT_ERROR_NONE           Successfully started DTLS handshake.
-     * @retval OT_ERROR_INVALID_STATE  The DTLS service is not in state kStateOpen.
+     * @retval OT_ERROR_INVALID_STATE  The DTLS service is not in state kStateOpen, or a session is already active.
      *
      */
     otError Connect(const Ip6::SockAddr &aSockAddr);
 
     /**
-     * This method indicates whether or not the DTLS session is active.
+     * This method indicates whether or not any DTLS session is active.
      *
-     * In other words, the state is kStateConnecting, kStateConnected, or kStateCloseNotify.
+     * In other words, the state of a session is kStateConnecting, kStateConnected, or kStateCloseNotify.
      *
-     * @retval TRUE  If DTLS session is active.
-     * @retval FALSE If DTLS session is not active.
+     * @retval TRUE  If a DTLS session is active.
+     * @retval FALSE If no DTLS session is active.
      *
      */
-    bool IsConnectionActive(void) const { return mState >= kStateConnecting; }
+    bool IsConnectionActive(void) const;
 
     /**
-     * This method indicates whether or not the DTLS session is connected.
+     * This method indicates whether or not a DTLS session with a given peer is active.
      *
-     * In other words, the state is kStateConnected.
+     * @param[in]  aPeerAddr  A reference to the peer address.
+     * @param[in]  aPeerPort  The peer port.
      *
-     * @retval TRUE   The DTLS session is connected.
-     * @retval FALSE  The DTLS session is not connected.
+     * @retval TRUE  If a DTLS session with the peer is active.
+     * @retval FALSE If no DTLS session with the peer is active.
      *
      */
-    bool IsConnected(void) const { return mState == kStateConnected; }
+    bool IsConnectionActive(const Ip6::Address &aPeerAddr, uint16_t aPeerPort) const
+    {
+        return FindSession(aPeerAddr, aPeerPort) != NULL;
+    }
 
     /**
-     * This method disconnects the DTLS session.
+     * This method indicates whether or not any DTLS session is connected.
+     *
+     * In other words, the state of a session is kStateConnected.
+     *
+     * @retval TRUE   A DTLS session is connected.
+     * @retval FALSE  No DTLS session is connected.
+     *
+     */
+    bool IsConnected(void) const { return FindSession(kStateConnected) != NULL; }
+
+    /**
+     * This method disconnects all DTLS sessions.
      *
      */
     void Disconnect(void);
@@ -225,13 +247,10 @@ public:
     void Close(void);
 
     /**
-     * This method returns the DTLS connection state.
+     * This method returns the DTLS socket state.
      *
      * @retval kStateClosed       The UDP socket closed.
      * @retval kStateOpen         The UDP socket is open.
-     * @retval kStateConnecting   The DTLS service is establishing a connection.
-     * @retval kStateConnected    The DTLS service has a connection established.
-     * @retval kStateCloseNotify  The DTLS service is closing a connection.
      *
      */
     State GetState(void) const { return mState; }
@@ -239,6 +258,8 @@ public:
     /**
      * This method sets the PSK.
      *
+     * The PSK is used by the sessions started after this call.
+     *
      * @param[in]  aPSK  A pointer to the PSK.
      *
      * @retval OT_ERROR_NONE          Successfully set the PSK.
@@ -301,7 +322,8 @@ public:
     /**
      * This method returns the peer x509 certificate base64 encoded.
      *
-     * DTLS mode "ECDHE ECDSA with AES 128 CCM 8" for Application CoAPS.
+     * DTLS mode "ECDHE ECDSA with AES 128 CCM 8" for Application CoAPS. The certificate is the one of the peer
+     * returned by `GetPeerAddress()`.
      *
      * @param[out]  aPeerCert        A pointer to the base64 encoded certificate buffer.
      * @param[out]  aCertLength      The length of the base64 encoded peer certificate.
@@ -327,38 +349,19 @@ public:
     void SetSslAuthMode(bool aVerifyPeerCertificate);
 #endif // OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
 
-#ifdef MBEDTLS_SSL_SRV_C
-    /**
-     * This method sets the Client ID used for generating the Hello Cookie.
-     *
-     * @param[in]  aClientId  A pointer to the Client ID.
-     * @param[in]  aLength    Number of bytes in the Client ID.
-     *
-     * @retval OT_ERROR_NONE  Successfully set the Client ID.
-     *
-     */
-    otError SetClientId(const uint8_t *aClientId, uint8_t aLength);
-#endif
-
     /**
-     * This method sends data within the DTLS session.
+     * This method sends data within the DTLS session with a peer.
      *
      * @param[in]  aMessage  A message to send via DTLS.
      * @param[in]  aLength   Number of bytes in the data buffer.
+     * @param[in]  aPeer     A reference to the peer socket address.
      *
-     * @retval OT_ERROR_NONE     Successfully sent the data via the DTLS session.
-     * @retval OT_ERROR_NO_BUFS  A message is too long.
+     * @retval OT_ERROR_NONE           Successfully sent the data via the DTLS session.
+     * @retval OT_ERROR_NO_BUFS        A message is too long.
+     * @retval OT_ERROR_INVALID_STATE  No DTLS session with @p aPeer is connected.
      *
      */
-    otError Send(Message &aMessage, uint16_t aLength);
-
-    /**
-     * This method provides a received DTLS message to the DTLS object.
-     *
-     * @param[in]  aMessage  A reference to the message.
-     *
-     */
-    void Receive(Message &aMessage);
+    otError Send(Message &aMessage, uint16_t aLength, const Ip6::SockAddr &aPeer);
 
     /**
      * This method sets the default message sub-type that will be used for all messages without defined
@@ -372,16 +375,76 @@ public:
     /**
      * This method returns the DTLS session's peer address.
      *
+     * Within a callback, this is the peer of the session that invoked it. Otherwise, this is the peer of the first
+     * connected session.
+     *
      * @return DTLS session's message info.
      *
      */
-    const Ip6::MessageInfo &GetPeerAddress(void) const { return mPeerAddress; }
+    const Ip6::MessageInfo &GetPeerAddress(void) const;
 
+    /**
+     * This method provides a received UDP message to the DTLS object.
+     *
+     * The message is handled by the session with the sender, or starts a new session if the DTLS is not a client
+     * and a session is free. It is dropped otherwise.
+     *
+     * @param[in]  aMessage      A reference to the message.
+     * @param[in]  aMessageInfo  A reference to the message info associated with @p aMessage.
+     *
+     */
     void HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
 private:
-    void    FreeMbedtls(void);
-    otError Setup(bool aClient);
+    /**
+     * This class represents a DTLS session with one peer.
+     *
+     */
+    class Session
+    {
+    public:
+        Session(void);
+
+        bool IsActive(void) const { return mState >= kStateConnecting; }
+        bool Matches(const Ip6::Address &aPeerAddr, uint16_t aPeerPort) const
+        {
+            return IsActive() && mPeerAddress.GetPeerAddr() == aPeerAddr && mPeerAddress.GetPeerPort() == aPeerPort;
+        }
+
+        Dtls *              mDtls;
+        State               mState;
+        mbedtls_ssl_context mSsl;
+        Ip6::MessageInfo    mPeerAddress;
+        Message *           mReceiveMessage;
+        uint32_t            mTimerIntermediate;
+        uint32_t            mTimerFinish;
+        bool                mTimerSet;
+        uint8_t             mMessageSubType;
+        uint8_t             mPskLength;
+        uint8_t             mPsk[kPskMaxLength];
+        uint8_t             mKek[Crypto::Sha256::kHashSize];
+    };
+
+    int     SetupConfig(bool aClient);
+    void    FreeConfig(void);
+    otError Setup(Session &aSession, bool aClient);
+    void    Disconnect(Session &aSession);
+    void    Receive(Session &aSession, Message &aMessage);
+
+    Session *      NewSession(void);
+    const Session *FindSession(State aState) const;
+    const Session *FindSession(const Ip6::Address &aPeerAddr, uint16_t aPeerPort) const;
+    Session *      FindSession(const Ip6::Address &aPeerAddr, uint16_t aPeerPort)
+    {
+        return const_cast<Session *>(const_cast<const Dtls *>(this)->FindSession(aPeerAddr, aPeerPort));
+    }
+    bool HasSslSession(void) const;
+
+    void StartTimer(void);
+
+#ifdef MBEDTLS_SSL_SRV_C
+    otError SetClientId(Session &aSession, const uint8_t *aClientId, uint8_t aLength);
+#endif
 
 #if OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
     /**
@@ -396,16 +459,16 @@ private:
     static void HandleMbedtlsDebug(void *ctx, int level, const char *file, int line, const char *str);
 
     static int HandleMbedtlsGetTimer(void *aContext);
-    int        HandleMbedtlsGetTimer(void);
+    int        HandleMbedtlsGetTimer(const Session &aSession);
 
     static void HandleMbedtlsSetTimer(void *aContext, uint32_t aIntermediate, uint32_t aFinish);
-    void        HandleMbedtlsSetTimer(uint32_t aIntermediate, uint32_t aFinish);
+    void        HandleMbedtlsSetTimer(Session &aSession, uint32_t aIntermediate, uint32_t aFinish);
 
     static int HandleMbedtlsReceive(void *aContext, unsigned char *aBuf, size_t aLength);
-    int        HandleMbedtlsReceive(unsigned char *aBuf, size_t aLength);
+    int        HandleMbedtlsReceive(Session &aSession, unsigned char *aBuf, size_t aLength);
 
     static int HandleMbedtlsTransmit(void *aContext, const unsigned char *aBuf, size_t aLength);
-    int        HandleMbedtlsTransmit(const unsigned char *aBuf, size_t aLength);
+    int        HandleMbedtlsTransmit(Session &aSession, const unsigned char *aBuf, size_t aLength);
 
     static int HandleMbedtlsExportKeys(void *               aContext,
                                        const unsigned char *aMasterSecret,
@@ -424,13 +487,9 @@ private:
 
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
-    void    HandleDtlsReceive(const uint8_t *aBuf, uint16_t aLength);
-    otError HandleDtlsSend(const uint8_t *aBuf, uint16_t aLength, uint8_t aMessageSubType);
-
-    static void HandleUdpTransmit(Tasklet &aTasklet);
-    void        HandleUdpTransmit(void);
+    otError HandleDtlsSend(Session &aSession, const uint8_t *aBuf, uint16_t aLength, uint8_t aMessageSubType);
 
-    void Process(void);
+    void Process(Session &aSession);
 
     State mState;
 
@@ -462,8 +521,7 @@ private:
 
     bool mVerifyPeerCertificate;
 
-    mbedtls_ssl_context mSsl;
-    mbedtls_ssl_config  mConf;
+    mbedtls_ssl_config mConf;
 
 #ifdef MBEDTLS_SSL_COOKIE_C
     mbedtls_ssl_cookie_ctx mCookieCtx;
@@ -471,26 +529,24 @@ private:
 
     TimerMilliContext mTimer;
 
-    uint32_t mTimerIntermediate;
-    bool     mTimerSet : 1;
-
+    bool mConfigured : 1;
+    bool mClient : 1;
     bool mLayerTwoSecurity : 1;
 
-    Message *mReceiveMessage;
-
     ConnectedHandler mConnectedHandler;
     ReceiveHandler   mReceiveHandler;
     SendHandler      mSendHandler;
     void *           mContext;
 
-    Ip6::MessageInfo mPeerAddress;
-    Ip6::UdpSocket   mSocket;
+    Ip6::UdpSocket mSocket;
 
     TransportCallback mTransportCallback;
     void *            mTransportContext;
 
-    uint8_t mMessageSubType;
     uint8_t mMessageDefaultSubType;
+
+    Session  mSessions[kMaxSessions];
+    Session *mCurrentSession;
 };
 
 } // namespace MeshCoP
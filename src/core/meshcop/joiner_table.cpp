@@ -0,0 +1,257 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the Commissioner's Joiner table.
+ */
+
+#include "joiner_table.hpp"
+
+#include "utils/wrap_string.h"
+
+#include "common/code_utils.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "meshcop/meshcop.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+
+namespace ot {
+namespace MeshCoP {
+
+JoinerTable::JoinerTable(void)
+{
+    Clear();
+}
+
+void JoinerTable::Clear(void)
+{
+    memset(mJoiners, 0, sizeof(mJoiners));
+
+    for (uint16_t i = 0; i < kMaxJoiners; i++)
+    {
+        mJoiners[i].mNextByEui64 = (i + 1 < kMaxJoiners) ? i + 1 : static_cast<uint16_t>(kInvalidIndex);
+    }
+
+    for (uint16_t i = 0; i < kHashSize; i++)
+    {
+        mEui64Buckets[i] = kInvalidIndex;
+        mIdBuckets[i]    = kInvalidIndex;
+    }
+
+    mFreeList  = 0;
+    mNumFree   = kMaxJoiners;
+    mAnyJoiner = kInvalidIndex;
+
+    mSteeringData.Init();
+}
+
+uint16_t JoinerTable::GetEui64Bucket(const Mac::ExtAddress &aEui64)
+{
+    // EUI-64s of a vendor share their first bytes, so all bytes are folded into the hash.
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aEui64.m8); i += 2)
+    {
+        hash ^= static_cast<uint16_t>((aEui64.m8[i] << 8) | aEui64.m8[i + 1]);
+    }
+
+    return hash % kHashSize;
+}
+
+uint16_t JoinerTable::GetIdBucket(const Mac::ExtAddress &aJoinerId)
+{
+    // The Joiner ID is a SHA-256 digest, its last bytes are uniformly distributed.
+    return static_cast<uint16_t>((aJoinerId.m8[6] << 8) | aJoinerId.m8[7]) % kHashSize;
+}
+
+JoinerTable::Joiner *JoinerTable::Find(const Mac::ExtAddress *aEui64)
+{
+    Joiner *joiner = NULL;
+
+    if (aEui64 == NULL)
+    {
+        ExitNow(joiner = (mAnyJoiner != kInvalidIndex) ? &mJoiners[mAnyJoiner] : NULL);
+    }
+
+    for (uint16_t i = mEui64Buckets[GetEui64Bucket(*aEui64)]; i != kInvalidIndex; i = mJoiners[i].mNextByEui64)
+    {
+        if (mJoiners[i].mEui64 == *aEui64)
+        {
+            ExitNow(joiner = &mJoiners[i]);
+        }
+    }
+
+exit:
+    return joiner;
+}
+
+JoinerTable::Joiner *JoinerTable::FindById(const Mac::ExtAddress &aJoinerId)
+{
+    Joiner *joiner = NULL;
+
+    for (uint16_t i = mIdBuckets[GetIdBucket(aJoinerId)]; i != kInvalidIndex; i = mJoiners[i].mNextById)
+    {
+        if (mJoiners[i].mJoinerId == aJoinerId)
+        {
+            ExitNow(joiner = &mJoiners[i]);
+        }
+    }
+
+    if (mAnyJoiner != kInvalidIndex)
+    {
+        joiner = &mJoiners[mAnyJoiner];
+    }
+
+exit:
+    return joiner;
+}
+
+JoinerTable::Joiner *JoinerTable::Add(const Mac::ExtAddress *aEui64, const char *aPskd, uint32_t aExpirationTime)
+{
+    Joiner * joiner = NULL;
+    uint16_t index  = mFreeList;
+
+    assert(Find(aEui64) == NULL);
+    VerifyOrExit(index != kInvalidIndex);
+
+    joiner    = &mJoiners[index];
+    mFreeList = joiner->mNextByEui64;
+    mNumFree--;
+
+    if (aEui64 != NULL)
+    {
+        uint16_t eui64Bucket = GetEui64Bucket(*aEui64);
+        uint16_t idBucket;
+
+        joiner->mEui64 = *aEui64;
+        ComputeJoinerId(joiner->mEui64, joiner->mJoinerId);
+        joiner->mAny = false;
+
+        idBucket = GetIdBucket(joiner->mJoinerId);
+
+        joiner->mNextByEui64       = mEui64Buckets[eui64Bucket];
+        mEui64Buckets[eui64Bucket] = index;
+        joiner->mNextById          = mIdBuckets[idBucket];
+        mIdBuckets[idBucket]       = index;
+    }
+    else
+    {
+        memset(&joiner->mEui64, 0, sizeof(joiner->mEui64));
+        memset(&joiner->mJoinerId, 0, sizeof(joiner->mJoinerId));
+        joiner->mAny         = true;
+        joiner->mNextByEui64 = kInvalidIndex;
+        joiner->mNextById    = kInvalidIndex;
+        mAnyJoiner           = index;
+    }
+
+    (void)strlcpy(joiner->mPsk, aPskd, sizeof(joiner->mPsk));
+    joiner->mValid          = true;
+    joiner->mExpirationTime = aExpirationTime;
+
+    // A Joiner is added to the Bloom filter incrementally, only a removal requires recomputing it.
+    if (joiner->mAny)
+    {
+        mSteeringData.SetLength(1);
+        mSteeringData.Set();
+    }
+    else if (mAnyJoiner == kInvalidIndex)
+    {
+        mSteeringData.ComputeBloomFilter(joiner->mJoinerId);
+    }
+
+exit:
+    return joiner;
+}
+
+void JoinerTable::Remove(Joiner &aJoiner)
+{
+    uint16_t index = GetIndex(aJoiner);
+
+    assert(aJoiner.mValid);
+
+    if (aJoiner.mAny)
+    {
+        mAnyJoiner = kInvalidIndex;
+    }
+    else
+    {
+        uint16_t *next = &mEui64Buckets[GetEui64Bucket(aJoiner.mEui64)];
+
+        while (*next != index)
+        {
+            next = &mJoiners[*next].mNextByEui64;
+        }
+
+        *next = aJoiner.mNextByEui64;
+        next  = &mIdBuckets[GetIdBucket(aJoiner.mJoinerId)];
+
+        while (*next != index)
+        {
+            next = &mJoiners[*next].mNextById;
+        }
+
+        *next = aJoiner.mNextById;
+    }
+
+    aJoiner.mValid       = false;
+    aJoiner.mNextByEui64 = mFreeList;
+    mFreeList            = index;
+    mNumFree++;
+
+    UpdateSteeringData();
+}
+
+void JoinerTable::UpdateSteeringData(void)
+{
+    mSteeringData.Init();
+
+    if (mAnyJoiner != kInvalidIndex)
+    {
+        mSteeringData.SetLength(1);
+        mSteeringData.Set();
+        ExitNow();
+    }
+
+    for (uint16_t i = 0; i < kMaxJoiners; i++)
+    {
+        if (mJoiners[i].mValid)
+        {
+            mSteeringData.ComputeBloomFilter(mJoiners[i].mJoinerId);
+        }
+    }
+
+exit:
+    return;
+}
+
+} // namespace MeshCoP
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
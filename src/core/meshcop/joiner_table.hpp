@@ -0,0 +1,194 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the Commissioner's Joiner table.
+ */
+
+#ifndef JOINER_TABLE_HPP_
+#define JOINER_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include "mac/mac_frame.hpp"
+#include "meshcop/dtls.hpp"
+#include "meshcop/meshcop_tlvs.hpp"
+
+namespace ot {
+
+namespace MeshCoP {
+
+/**
+ * This class implements the table of Joiners accepted by the Commissioner.
+ *
+ * The table is a fixed pool of entries. Entries are chained in hash buckets both by EUI-64 and by Joiner ID, so the
+ * Joiner ID (a SHA-256 digest) is computed once when an entry is added and never on lookups. The table also
+ * maintains the Steering Data Bloom filter of its entries.
+ *
+ */
+class JoinerTable
+{
+public:
+    enum
+    {
+        kMaxJoiners = OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES, ///< Number of entries in the table.
+    };
+
+    /**
+     * This structure represents a Joiner entry.
+     *
+     */
+    struct Joiner
+    {
+        Mac::ExtAddress mEui64;                        ///< The Joiner EUI-64 (all zeros for any Joiner).
+        Mac::ExtAddress mJoinerId;                     ///< The Joiner ID computed from `mEui64`.
+        uint32_t        mExpirationTime;               ///< The time the entry expires (in milliseconds).
+        char            mPsk[Dtls::kPskMaxLength + 1]; ///< The Joiner PSKd.
+        uint16_t        mNextByEui64; ///< The index of the next entry in the EUI-64 hash bucket or the free list.
+        uint16_t        mNextById;    ///< The index of the next entry in the Joiner ID hash bucket.
+        bool            mValid : 1;   ///< TRUE if the entry is in use.
+        bool            mAny : 1;     ///< TRUE if the entry accepts any Joiner.
+    };
+
+    /**
+     * This constructor initializes the Joiner table.
+     *
+     */
+    JoinerTable(void);
+
+    /**
+     * This method removes all entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of unused entries.
+     *
+     * @returns The number of unused entries.
+     *
+     */
+    uint16_t GetNumFree(void) const { return mNumFree; }
+
+    /**
+     * This method finds the entry of a Joiner.
+     *
+     * @param[in]  aEui64  A pointer to the Joiner's IEEE EUI-64 or NULL for any Joiner.
+     *
+     * @returns A pointer to the entry, or NULL if there is no entry for @p aEui64.
+     *
+     */
+    Joiner *Find(const Mac::ExtAddress *aEui64);
+
+    /**
+     * This method finds the entry accepting a Joiner, given its Joiner ID.
+     *
+     * @param[in]  aJoinerId  The Joiner ID.
+     *
+     * @returns A pointer to the entry with @p aJoinerId, or else to the entry for any Joiner, or NULL if neither
+     *          exists.
+     *
+     */
+    Joiner *FindById(const Mac::ExtAddress &aJoinerId);
+
+    /**
+     * This method adds an entry.
+     *
+     * There must be no entry for @p aEui64 in the table.
+     *
+     * @param[in]  aEui64           A pointer to the Joiner's IEEE EUI-64 or NULL for any Joiner.
+     * @param[in]  aPskd            A pointer to the PSKd, at most `Dtls::kPskMaxLength` characters.
+     * @param[in]  aExpirationTime  The time the entry expires (in milliseconds).
+     *
+     * @returns A pointer to the new entry, or NULL if there is no unused entry.
+     *
+     */
+    Joiner *Add(const Mac::ExtAddress *aEui64, const char *aPskd, uint32_t aExpirationTime);
+
+    /**
+     * This method removes an entry.
+     *
+     * @param[in]  aJoiner  A reference to the entry to remove.
+     *
+     */
+    void Remove(Joiner &aJoiner);
+
+    /**
+     * This method returns the entry at a given index.
+     *
+     * @param[in]  aIndex  The index of the entry, less than `kMaxJoiners`.
+     *
+     * @returns A reference to the entry (which may be unused).
+     *
+     */
+    Joiner &GetJoiner(uint16_t aIndex) { return mJoiners[aIndex]; }
+
+    /**
+     * This method returns the index of an entry.
+     *
+     * @param[in]  aJoiner  A reference to the entry.
+     *
+     * @returns The index of @p aJoiner.
+     *
+     */
+    uint16_t GetIndex(const Joiner &aJoiner) const { return static_cast<uint16_t>(&aJoiner - mJoiners); }
+
+    /**
+     * This method returns the Steering Data matching the entries.
+     *
+     * @returns A reference to the Steering Data TLV.
+     *
+     */
+    const SteeringDataTlv &GetSteeringData(void) const { return mSteeringData; }
+
+private:
+    enum
+    {
+        kHashSize     = OPENTHREAD_CONFIG_COMMISSIONER_MAX_JOINER_ENTRIES, ///< Number of hash buckets.
+        kInvalidIndex = 0xffff,
+    };
+
+    static uint16_t GetEui64Bucket(const Mac::ExtAddress &aEui64);
+    static uint16_t GetIdBucket(const Mac::ExtAddress &aJoinerId);
+    void            UpdateSteeringData(void);
+
+    Joiner          mJoiners[kMaxJoiners];
+    uint16_t        mEui64Buckets[kHashSize];
+    uint16_t        mIdBuckets[kHashSize];
+    uint16_t        mFreeList;
+    uint16_t        mNumFree;
+    uint16_t        mAnyJoiner;
+    SteeringDataTlv mSteeringData;
+};
+
+} // namespace MeshCoP
+
+} // namespace ot
+
+#endif // JOINER_TABLE_HPP_
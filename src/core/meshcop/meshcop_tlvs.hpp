@@ -694,7 +694,7 @@ public:
      * @retval FALSE  If the SteeringData doesn't allow any Joiner.
      *
      */
-    bool DoesAllowAny(void)
+    bool DoesAllowAny(void) const
     {
         bool rval = true;
 
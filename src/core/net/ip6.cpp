@@ -444,6 +444,9 @@ exit:
 
 void Ip6::EnqueueDatagram(Message &aMessage)
 {
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Get<Utils::LatencyTracer>().Start(aMessage);
+#endif
     mSendQueue.Enqueue(aMessage);
     mSendQueueTask.Post();
 }
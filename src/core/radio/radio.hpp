@@ -352,6 +352,21 @@ public:
      */
     otError Receive(uint8_t aChannel) { return otPlatRadioReceive(GetInstance(), aChannel); }
 
+    /**
+     * This method transitions the radio from Sleep to Receive on multiple channels concurrently.
+     *
+     * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+     *
+     * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+     * @retval OT_ERROR_INVALID_STATE    The radio was disabled or transmitting.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The radio does not support receiving on multiple channels.
+     *
+     */
+    otError ReceiveMultiChannel(uint32_t aChannelMask)
+    {
+        return otPlatRadioReceiveMultiChannel(GetInstance(), aChannelMask);
+    }
+
     /**
      * This method gets the radio transmit frame buffer.
      *
@@ -129,3 +129,11 @@ OT_TOOL_WEAK const char *otPlatRadioGetVersionString(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
     return otGetVersionString();
 }
+
+OT_TOOL_WEAK otError otPlatRadioReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aChannelMask);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
@@ -331,6 +331,7 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
         else if (entry->mTimeout == 0 && entry->mRetryTimeout == 0)
         {
             SuccessOrExit(error = SendAddressQuery(aEid));
+            OT_COUNTER_INCREMENT(GetInstance(), kAddressQueryRetries);
             entry->mTimeout = kAddressQueryTimeout;
             error           = OT_ERROR_ADDRESS_QUERY;
         }
@@ -376,6 +377,7 @@ otError AddressResolver::SendAddressQuery(const Ip6::Address &aEid)
     SuccessOrExit(error = Get<Coap::Coap>().SendMessage(*message, messageInfo));
 
     otLogInfoArp("Sending address query for %s", aEid.ToString().AsCString());
+    OT_COUNTER_INCREMENT(GetInstance(), kAddressQueries);
 
 exit:
 
@@ -101,9 +101,18 @@ exit:
 ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
+{
+    Clear();
+}
+
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+void ChildTable::Clear(void)
 {
     memset(mChildren, 0, sizeof(mChildren));
+    memset(mIndex, 0, sizeof(mIndex));
+    memset(mIndexBuckets, 0, sizeof(mIndexBuckets));
 }
+#endif
 
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
 {
@@ -125,6 +134,65 @@ Child *ChildTable::GetNewChild(void)
         if (child->GetState() == Child::kStateInvalid)
         {
             memset(child, 0, sizeof(Child));
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+            UpdateIndex(kIndexRloc16, *child, child->GetRloc16());
+            UpdateIndex(kIndexExtAddress, *child, HashExtAddress(child->GetExtAddress()));
+#endif
+            ExitNow();
+        }
+    }
+
+    child = NULL;
+
+exit:
+    return child;
+}
+
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
+Child *ChildTable::FindChild(uint16_t aRloc16, StateFilter aFilter)
+{
+    uint16_t next  = mIndexBuckets[kIndexRloc16][aRloc16 & kIndexBucketMask];
+    Child *  child = NULL;
+
+    for (; next != 0; next = mIndex[next - 1].mNext[kIndexRloc16])
+    {
+        if (mIndex[next - 1].mKey[kIndexRloc16] != aRloc16)
+        {
+            continue;
+        }
+
+        child = &mChildren[next - 1];
+
+        if (MatchesFilter(*child, aFilter) && (child->GetRloc16() == aRloc16))
+        {
+            ExitNow();
+        }
+    }
+
+    child = NULL;
+
+exit:
+    return child;
+}
+
+Child *ChildTable::FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilter)
+{
+    uint16_t hash  = HashExtAddress(aAddress);
+    uint16_t next  = mIndexBuckets[kIndexExtAddress][hash & kIndexBucketMask];
+    Child *  child = NULL;
+
+    for (; next != 0; next = mIndex[next - 1].mNext[kIndexExtAddress])
+    {
+        if (mIndex[next - 1].mKey[kIndexExtAddress] != hash)
+        {
+            continue;
+        }
+
+        child = &mChildren[next - 1];
+
+        if (MatchesFilter(*child, aFilter) && (child->GetExtAddress() == aAddress))
+        {
             ExitNow();
         }
     }
@@ -135,6 +203,75 @@ exit:
     return child;
 }
 
+void ChildTable::SetChildRloc16(Child &aChild, uint16_t aRloc16)
+{
+    aChild.SetRloc16(aRloc16);
+    UpdateIndex(kIndexRloc16, aChild, aRloc16);
+}
+
+void ChildTable::SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress)
+{
+    aChild.SetExtAddress(aAddress);
+    UpdateIndex(kIndexExtAddress, aChild, HashExtAddress(aAddress));
+}
+
+void ChildTable::UpdateIndex(IndexKey aKey, const Child &aChild, uint16_t aKeyValue)
+{
+    uint16_t childIndex;
+
+    // Only entries of the table are indexed. An entry stays indexed with its keys whatever its state, `FindChild()`
+    // applies the state filter.
+    VerifyOrExit(&aChild >= mChildren && &aChild < OT_ARRAY_END(mChildren));
+    childIndex = GetChildIndex(aChild);
+
+    UnlinkIndex(aKey, childIndex);
+    LinkIndex(aKey, childIndex, aKeyValue);
+
+exit:
+    return;
+}
+
+void ChildTable::LinkIndex(IndexKey aKey, uint16_t aChildIndex, uint16_t aKeyValue)
+{
+    IndexEntry &entry  = mIndex[aChildIndex];
+    uint16_t &  bucket = mIndexBuckets[aKey][aKeyValue & kIndexBucketMask];
+
+    entry.mKey[aKey]  = aKeyValue;
+    entry.mNext[aKey] = bucket;
+    bucket            = aChildIndex + 1;
+}
+
+void ChildTable::UnlinkIndex(IndexKey aKey, uint16_t aChildIndex)
+{
+    uint16_t *link = &mIndexBuckets[aKey][mIndex[aChildIndex].mKey[aKey] & kIndexBucketMask];
+
+    // A child that was never linked is not found in the bucket of its (zero) key.
+    while (*link != 0)
+    {
+        if (*link == aChildIndex + 1)
+        {
+            *link = mIndex[aChildIndex].mNext[aKey];
+            break;
+        }
+
+        link = &mIndex[*link - 1].mNext[aKey];
+    }
+}
+
+uint16_t ChildTable::HashExtAddress(const Mac::ExtAddress &aAddress)
+{
+    uint16_t hash = 0;
+
+    for (uint8_t i = 0; i < sizeof(aAddress); i += 2)
+    {
+        hash ^= static_cast<uint16_t>((aAddress.m8[i] << 8) | aAddress.m8[i + 1]);
+    }
+
+    return hash;
+}
+
+#else // OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
 Child *ChildTable::FindChild(uint16_t aRloc16, StateFilter aFilter)
 {
     Child *child = mChildren;
@@ -171,6 +308,8 @@ exit:
     return child;
 }
 
+#endif // OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+
 Child *ChildTable::FindChild(const Mac::Address &aAddress, StateFilter aFilter)
 {
     Child *child = NULL;
@@ -170,7 +170,11 @@ public:
      * This method clears the child table.
      *
      */
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    void Clear(void);
+#else
     void Clear(void) { memset(mChildren, 0, sizeof(mChildren)); }
+#endif
 
     /**
      * This method returns the child table index for a given `Child` instance.
@@ -237,6 +241,38 @@ public:
      */
     Child *FindChild(const Mac::Address &aAddress, StateFilter aFilter);
 
+    /**
+     * This method sets the RLOC16 of a child.
+     *
+     * The RLOC16 of a child is only set through this method, so that `FindChild()` finds the child by its RLOC16 as
+     * soon as it is set.
+     *
+     * @param[in]  aChild   A reference to the child.
+     * @param[in]  aRloc16  The RLOC16 value.
+     *
+     */
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16);
+#else
+    void SetChildRloc16(Child &aChild, uint16_t aRloc16) { aChild.SetRloc16(aRloc16); }
+#endif
+
+    /**
+     * This method sets the extended address of a child.
+     *
+     * The extended address of a child is only set through this method, so that `FindChild()` finds the child by its
+     * extended address as soon as it is set.
+     *
+     * @param[in]  aChild    A reference to the child.
+     * @param[in]  aAddress  The extended address value.
+     *
+     */
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress);
+#else
+    void SetChildExtAddress(Child &aChild, const Mac::ExtAddress &aAddress) { aChild.SetExtAddress(aAddress); }
+#endif
+
     /**
      * This method indicates whether the child table contains any child matching a given state filter.
      *
@@ -299,8 +335,47 @@ private:
 
     static bool MatchesFilter(const Child &aChild, StateFilter aFilter);
 
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    enum IndexKey
+    {
+        kIndexRloc16,
+        kIndexExtAddress,
+        kNumIndexKeys,
+    };
+
+    enum
+    {
+        // The number of buckets is the smallest power of two not less than `kMaxChildren`.
+        kIndexBucketBits1 = (kMaxChildren - 1) | ((kMaxChildren - 1) >> 1),
+        kIndexBucketBits2 = kIndexBucketBits1 | (kIndexBucketBits1 >> 2),
+        kIndexBucketBits4 = kIndexBucketBits2 | (kIndexBucketBits2 >> 4),
+        kIndexBucketMask  = kIndexBucketBits4 | (kIndexBucketBits4 >> 8),
+        kNumIndexBuckets  = kIndexBucketMask + 1,
+    };
+
+    /**
+     * This structure holds the keys and the bucket links of a child, so that a lookup only reads the `Child` entry
+     * whose key matches.
+     *
+     */
+    struct IndexEntry
+    {
+        uint16_t mKey[kNumIndexKeys];  ///< The RLOC16 and the extended address hash the child is indexed with.
+        uint16_t mNext[kNumIndexKeys]; ///< The child index plus one of the next child in the bucket (zero if none).
+    };
+
+    static uint16_t HashExtAddress(const Mac::ExtAddress &aAddress);
+    void            UpdateIndex(IndexKey aKey, const Child &aChild, uint16_t aKeyValue);
+    void            LinkIndex(IndexKey aKey, uint16_t aChildIndex, uint16_t aKeyValue);
+    void            UnlinkIndex(IndexKey aKey, uint16_t aChildIndex);
+#endif
+
     uint16_t mMaxChildrenAllowed;
     Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_LARGE_CHILD_TABLE_ENABLE
+    IndexEntry mIndex[kMaxChildren];
+    uint16_t   mIndexBuckets[kNumIndexKeys][kNumIndexBuckets];
+#endif
 };
 
 #endif // OPENTHREAD_FTD
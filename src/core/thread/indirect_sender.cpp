@@ -75,6 +75,7 @@ void IndirectSender::Stop(void)
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
     {
         iter.GetChild()->SetIndirectMessage(NULL);
+        iter.GetChild()->SetChildUpdateRequestQueued(false);
         mSourceMatchController.ResetMessageCount(*iter.GetChild());
     }
 
@@ -94,9 +95,18 @@ otError IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChil
     childIndex = Get<ChildTable>().GetChildIndex(aChild);
     VerifyOrExit(!aMessage.GetChildMask(childIndex), error = OT_ERROR_ALREADY);
 
-    aMessage.SetChildMask(childIndex);
+    SuccessOrExit(error = aMessage.SetChildMask(childIndex));
     mSourceMatchController.IncrementMessageCount(aChild);
 
+    if (aMessage.GetSubType() == Message::kSubTypeMleChildUpdateRequest)
+    {
+        aChild.SetChildUpdateRequestQueued(true);
+    }
+
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Get<Utils::LatencyTracer>().Record(aMessage, Utils::LatencyTracer::kStageRouteResolved);
+#endif
+
     RequestMessageUpdate(aChild);
 
 exit:
@@ -113,6 +123,11 @@ otError IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &a
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
 
+    if (aMessage.GetSubType() == Message::kSubTypeMleChildUpdateRequest)
+    {
+        aChild.SetChildUpdateRequestQueued(false);
+    }
+
     RequestMessageUpdate(aChild);
 
 exit:
@@ -145,6 +160,7 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
     }
 
     aChild.SetIndirectMessage(NULL);
+    aChild.SetChildUpdateRequestQueued(false);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -163,6 +179,18 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+void IndirectSender::SetChildFrameBurstLimit(Child &aChild, uint8_t aMaxFrames)
+{
+    if (aMaxFrames > OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES)
+    {
+        aMaxFrames = OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES;
+    }
+
+    aChild.SetFrameBurstLimit(aMaxFrames);
+}
+#endif
+
 void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMode)
 {
     if (!aChild.IsRxOnWhenIdle() && (aChild.GetState() == Neighbor::kStateValid))
@@ -187,6 +215,7 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
         }
 
         aChild.SetIndirectMessage(NULL);
+        aChild.SetChildUpdateRequestQueued(false);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
@@ -299,6 +328,34 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+void IndirectSender::StartFrameBurst(Child &aChild)
+{
+    aChild.ResetFrameBurstCount();
+}
+
+bool IndirectSender::ContinueFrameBurst(const Mac::TxFrame &aFrame, Child &aChild)
+{
+    bool shouldContinue = false;
+
+    VerifyOrExit(aChild.GetFrameBurstCount() < aChild.GetFrameBurstLimit());
+
+    aChild.IncrementFrameBurstCount();
+
+    // The child keeps its receiver on after a frame with the frame
+    // pending bit set, until it has received the agreed number of
+    // frames for the data poll (it then sends a new data poll).
+
+    VerifyOrExit(aFrame.GetFramePending() && (aChild.GetFrameBurstCount() < aChild.GetFrameBurstLimit()));
+
+    OT_COUNTER_INCREMENT(GetInstance(), kFrameBurstFrames);
+    shouldContinue = true;
+
+exit:
+    return shouldContinue;
+}
+#endif
+
 void IndirectSender::UpdateIndirectMessage(Child &aChild)
 {
     Message *message = FindIndirectMessage(aChild);
@@ -332,6 +389,10 @@ otError IndirectSender::PrepareFrameForChild(Mac::TxFrame &aFrame, FrameContext
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Get<Utils::LatencyTracer>().Record(*message, Utils::LatencyTracer::kStageTxStarted);
+#endif
+
     switch (message->GetType())
     {
     case Message::kTypeIp6:
@@ -518,6 +579,10 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         aFrame.GetDstAddr(macDest);
         Get<MeshForwarder>().LogMessage(MeshForwarder::kMessageTransmit, *message, &macDest, txError);
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+        Get<Utils::LatencyTracer>().HandleDelivered(*message, /* aIndirect */ true, aChild.GetIndirectTxSuccess());
+#endif
+
         if (message->GetType() == Message::kTypeIp6)
         {
             if (aChild.GetIndirectTxSuccess())
@@ -536,6 +601,11 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
             mSourceMatchController.DecrementMessageCount(aChild);
         }
 
+        if (message->GetSubType() == Message::kSubTypeMleChildUpdateRequest)
+        {
+            aChild.SetChildUpdateRequestQueued(false);
+        }
+
         if (!message->GetDirectTransmission() && !message->IsChildPending())
         {
             Get<MeshForwarder>().mSendQueue.Dequeue(*message);
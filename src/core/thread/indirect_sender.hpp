@@ -87,6 +87,26 @@ public:
          */
         uint16_t GetIndirectMessageCount(void) const { return mQueuedMessageCount; }
 
+        /**
+         * This method indicates whether an MLE Child Update Request is queued for the child.
+         *
+         * @retval TRUE   If an MLE Child Update Request is queued for the child.
+         * @retval FALSE  If no MLE Child Update Request is queued for the child.
+         *
+         */
+        bool IsChildUpdateRequestQueued(void) const { return mChildUpdateRequestQueued; }
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        /**
+         * This method returns the maximum number of frames sent to the child per data poll.
+         *
+         * @returns The maximum number of frames sent to the child per data poll (zero if the child does not support
+         *          frame burst).
+         *
+         */
+        uint8_t GetFrameBurstLimit(void) const { return mFrameBurstLimit; }
+#endif
+
     private:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
@@ -107,21 +127,41 @@ public:
         void DecrementIndirectMessageCount(void) { mQueuedMessageCount--; }
         void ResetIndirectMessageCount(void) { mQueuedMessageCount = 0; }
 
+        void SetChildUpdateRequestQueued(bool aQueued) { mChildUpdateRequestQueued = aQueued; }
+
         bool IsWaitingForMessageUpdate(void) const { return mWaitingForMessageUpdate; }
         void SetWaitingForMessageUpdate(bool aNeedsUpdate) { mWaitingForMessageUpdate = aNeedsUpdate; }
 
-        const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        void SetFrameBurstLimit(uint8_t aLimit) { mFrameBurstLimit = aLimit; }
 
-        Message *mIndirectMessage;             // Current indirect message.
-        uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
-        bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
-        bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
-        uint16_t mQueuedMessageCount : 14;     // Number of queued indirect messages for the child.
-        bool     mUseShortAddress : 1;         // Indicates whether to use short or extended address.
-        bool     mSourceMatchPending : 1;      // Indicates whether or not pending to add to src match table.
+        uint8_t GetFrameBurstCount(void) const { return mFrameBurstCount; }
+        void    IncrementFrameBurstCount(void) { mFrameBurstCount++; }
+        void    ResetFrameBurstCount(void) { mFrameBurstCount = 0; }
+#endif
 
-        OT_STATIC_ASSERT(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 14),
+        const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
+
+        Message *mIndirectMessage;              // Current indirect message.
+        uint16_t mIndirectFragmentOffset : 14;  // 6LoWPAN fragment offset for the indirect message.
+        bool     mIndirectTxSuccess : 1;        // Indicates tx success/failure of current indirect message.
+        bool     mWaitingForMessageUpdate : 1;  // Indicates waiting for updating the indirect message.
+        uint16_t mQueuedMessageCount : 13;      // Number of queued indirect messages for the child.
+        bool     mUseShortAddress : 1;          // Indicates whether to use short or extended address.
+        bool     mSourceMatchPending : 1;       // Indicates whether or not pending to add to src match table.
+        bool     mChildUpdateRequestQueued : 1; // Indicates whether an MLE Child Update Request is queued.
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        uint8_t mFrameBurstLimit : 4; // Maximum number of frames per data poll (zero if burst is not supported).
+        uint8_t mFrameBurstCount : 4; // Number of frames sent since the last data poll.
+#endif
+
+        OT_STATIC_ASSERT(OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS < (1UL << 13),
                          "mQueuedMessageCount cannot fit max required!");
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        OT_STATIC_ASSERT(OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES > 0 &&
+                             OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES < (1 << 4),
+                         "mFrameBurstLimit cannot fit max required!");
+#endif
     };
 
     /**
@@ -155,6 +195,7 @@ public:
      * @retval OT_ERROR_NONE           Successfully added the message for indirect transmission.
      * @retval OT_ERROR_ALREADY        The message was already added for indirect transmission to same child.
      * @retval OT_ERROR_INVALID_STATE  The child is not sleepy.
+     * @retval OT_ERROR_NO_BUFS        Insufficient message buffers to track the children of the message.
      *
      */
     otError AddMessageForSleepyChild(Message &aMessage, Child &aChild);
@@ -188,6 +229,19 @@ public:
      */
     void SetChildUseShortAddress(Child &aChild, bool aUseShortAddress);
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    /**
+     * This method sets the maximum number of frames sent to a child per data poll.
+     *
+     * The limit is capped to `OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES`.
+     *
+     * @param[in] aChild      A reference to the child.
+     * @param[in] aMaxFrames  The maximum number of frames per data poll requested by the child (zero to disable).
+     *
+     */
+    void SetChildFrameBurstLimit(Child &aChild, uint8_t aMaxFrames);
+#endif
+
     /**
      * This method handles a child mode change and updates any queued messages for the child accordingly.
      *
@@ -214,6 +268,10 @@ private:
                                    otError             aError,
                                    Child &             aChild);
     void    HandleFrameChangeDone(Child &aChild);
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    void StartFrameBurst(Child &aChild);
+    bool ContinueFrameBurst(const Mac::TxFrame &aFrame, Child &aChild);
+#endif
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild);
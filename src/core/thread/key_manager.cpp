@@ -70,6 +70,8 @@ const otMasterKey KeyManager::kDefaultMasterKey = {{
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mTemporaryKeySequence(0)
+    , mTemporaryKeyValid(false)
     , mMacFrameCounter(0)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
@@ -85,7 +87,7 @@ KeyManager::KeyManager(Instance &aInstance)
 {
     mMasterKey = static_cast<const MasterKey &>(kDefaultMasterKey);
     memset(&mPSKc, 0, sizeof(mPSKc));
-    ComputeKey(mKeySequence, mKey);
+    ComputeCurrentKey();
 }
 
 void KeyManager::Start(void)
@@ -118,9 +120,10 @@ otError KeyManager::SetMasterKey(const MasterKey &aKey)
 
     VerifyOrExit(mMasterKey != aKey, Get<Notifier>().SignalIfFirst(OT_CHANGED_MASTER_KEY));
 
-    mMasterKey   = aKey;
-    mKeySequence = 0;
-    ComputeKey(mKeySequence, mKey);
+    mMasterKey         = aKey;
+    mKeySequence       = 0;
+    mTemporaryKeyValid = false;
+    ComputeCurrentKey();
 
     // reset parent frame counters
     parent = Get<Mle::MleRouter>().GetParent();
@@ -155,6 +158,8 @@ void KeyManager::ComputeKey(uint32_t aKeySequence, uint8_t *aKey)
     Crypto::HmacSha256 hmac;
     uint8_t            keySequenceBytes[sizeof(uint32_t)];
 
+    OT_COUNTER_INCREMENT(GetInstance(), kHmacSha256Operations);
+
     hmac.Start(mMasterKey.m8, sizeof(mMasterKey.m8));
 
     Encoding::BigEndian::WriteUint32(aKeySequence, keySequenceBytes);
@@ -164,6 +169,24 @@ void KeyManager::ComputeKey(uint32_t aKeySequence, uint8_t *aKey)
     hmac.Finish(aKey);
 }
 
+void KeyManager::ComputeCurrentKey(void)
+{
+    ComputeKey(mKeySequence, mKey);
+    mMleKeyEcb.SetKey(GetCurrentMleKey(), 8 * kMleKeyLength);
+}
+
+void KeyManager::ComputeTemporaryKey(uint32_t aKeySequence)
+{
+    VerifyOrExit(!mTemporaryKeyValid || aKeySequence != mTemporaryKeySequence);
+
+    ComputeKey(aKeySequence, mTemporaryKey);
+    mTemporaryKeySequence = aKeySequence;
+    mTemporaryKeyValid    = true;
+
+exit:
+    return;
+}
+
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 {
     VerifyOrExit(aKeySequence != mKeySequence, Get<Notifier>().SignalIfFirst(OT_CHANGED_THREAD_KEY_SEQUENCE_COUNTER));
@@ -176,7 +199,7 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
     }
 
     mKeySequence = aKeySequence;
-    ComputeKey(mKeySequence, mKey);
+    ComputeCurrentKey();
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -195,13 +218,13 @@ exit:
 
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
+    ComputeTemporaryKey(aKeySequence);
     return mTemporaryKey + kMacKeyOffset;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
+    ComputeTemporaryKey(aKeySequence);
     return mTemporaryKey;
 }
 
@@ -209,7 +232,7 @@ void KeyManager::IncrementMacFrameCounter(void)
 {
     mMacFrameCounter++;
 
-    if (mMacFrameCounter >= mStoredMacFrameCounter)
+    if (mMacFrameCounter + kStoreFrameCounterMargin >= mStoredMacFrameCounter)
     {
         Get<Mle::MleRouter>().Store();
     }
@@ -219,7 +242,7 @@ void KeyManager::IncrementMleFrameCounter(void)
 {
     mMleFrameCounter++;
 
-    if (mMleFrameCounter >= mStoredMleFrameCounter)
+    if (mMleFrameCounter + kStoreFrameCounterMargin >= mStoredMleFrameCounter)
     {
         Get<Mle::MleRouter>().Store();
     }
@@ -42,6 +42,7 @@
 
 #include "common/locator.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_frame.hpp"
 
@@ -201,9 +202,22 @@ public:
      */
     const uint8_t *GetCurrentMleKey(void) const { return mKey; }
 
+    /**
+     * This method returns the AES ECB object prepared with the current MLE key.
+     *
+     * It is used with `Crypto::AesCcm::SetKey()` to secure MLE messages without expanding the key for each message.
+     *
+     * @returns A reference to the AES ECB object.
+     *
+     */
+    Crypto::AesEcb &GetCurrentMleKeyEcb(void) { return mMleKeyEcb; }
+
     /**
      * This method returns a pointer to a temporary MAC key computed from the given key sequence.
      *
+     * The temporary keys of the last key sequence are kept, so that they are only computed again for another key
+     * sequence.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MAC key.
@@ -214,6 +228,9 @@ public:
     /**
      * This method returns a pointer to a temporary MLE key computed from the given key sequence.
      *
+     * The temporary keys of the last key sequence are kept, so that they are only computed again for another key
+     * sequence.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns A pointer to the temporary MLE key.
@@ -396,11 +413,20 @@ private:
         kMinKeyRotationTime        = 1,
         kDefaultKeyRotationTime    = 672,
         kDefaultKeySwitchGuardTime = 624,
+        kMleKeyLength              = 16,
         kMacKeyOffset              = 16,
         kOneHourIntervalInMsec     = 3600u * 1000u,
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+        // The frame counters are stored ahead of time, so that they are written before the stored values are used.
+        kStoreFrameCounterMargin = OPENTHREAD_CONFIG_STORE_FRAME_COUNTER_AHEAD / 2,
+#else
+        kStoreFrameCounterMargin = 0,
+#endif
     };
 
     void ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    void ComputeCurrentKey(void);
+    void ComputeTemporaryKey(uint32_t aKeySequence);
 
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
@@ -414,7 +440,11 @@ private:
     uint32_t mKeySequence;
     uint8_t  mKey[Crypto::HmacSha256::kHashSize];
 
-    uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    Crypto::AesEcb mMleKeyEcb;
+
+    uint32_t mTemporaryKeySequence;
+    bool     mTemporaryKeyValid;
+    uint8_t  mTemporaryKey[Crypto::HmacSha256::kHashSize];
 
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
@@ -1206,6 +1206,49 @@ exit:
     return (error == OT_ERROR_NONE) ? static_cast<int>(compressedLength) : -1;
 }
 
+otError Lowpan::DecrementHopLimit(uint8_t *aHeader, uint16_t aHeaderLength)
+{
+    otError  error  = OT_ERROR_PARSE;
+    uint16_t offset = 2;
+    uint16_t hcCtl;
+
+    VerifyOrExit(aHeaderLength >= offset);
+    hcCtl = ReadUint16(aHeader);
+    VerifyOrExit((hcCtl & kHcDispatchMask) == kHcDispatch);
+
+    // A compressed hop limit (1, 64 or 255) cannot be decremented without changing the header length.
+    VerifyOrExit((hcCtl & kHcHopLimitMask) == 0, error = OT_ERROR_NOT_CAPABLE);
+
+    if ((hcCtl & kHcContextId) != 0)
+    {
+        offset++;
+    }
+
+    if ((hcCtl & kHcTrafficClass) == 0)
+    {
+        offset++;
+    }
+
+    if ((hcCtl & kHcFlowLabel) == 0)
+    {
+        offset += 3;
+    }
+
+    if ((hcCtl & kHcNextHeader) == 0)
+    {
+        offset++;
+    }
+
+    VerifyOrExit(aHeaderLength > offset);
+    VerifyOrExit(aHeader[offset] > 1, error = OT_ERROR_NOT_CAPABLE);
+
+    aHeader[offset]--;
+    error = OT_ERROR_NONE;
+
+exit:
+    return error;
+}
+
 otError MeshHeader::Init(const uint8_t *aFrame, uint16_t aFrameLength)
 {
     otError error = OT_ERROR_NONE;
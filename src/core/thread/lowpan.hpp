@@ -246,6 +246,33 @@ public:
         return (aHeader[0] & (Lowpan::kHcDispatchMask >> 8)) == (Lowpan::kHcDispatch >> 8);
     }
 
+    /**
+     * This method indicates whether or not a LOWPAN_IPHC header fully elides the source address, i.e. derives it
+     * from the link-layer (or mesh originator) address.
+     *
+     * @param[in]  aHeader  A pointer to the LOWPAN_IPHC header (at least two bytes).
+     *
+     * @retval TRUE   If the source address is derived from the link-layer or mesh originator address.
+     * @retval FALSE  If the source address is carried (fully or partially) inline.
+     */
+    static bool IsSourceAddressElided(const uint8_t *aHeader)
+    {
+        return (aHeader[1] & Lowpan::kHcSrcAddrModeMask) == Lowpan::kHcSrcAddrMode3;
+    }
+
+    /**
+     * This method decrements the hop limit carried inline in a LOWPAN_IPHC header.
+     *
+     * @param[inout]  aHeader        A pointer to the LOWPAN_IPHC header.
+     * @param[in]     aHeaderLength  The number of bytes in @p aHeader.
+     *
+     * @retval OT_ERROR_NONE         Successfully decremented the hop limit.
+     * @retval OT_ERROR_NOT_CAPABLE  The hop limit is compressed, or it is one or less.
+     * @retval OT_ERROR_PARSE        The LOWPAN_IPHC header could not be parsed.
+     *
+     */
+    static otError DecrementHopLimit(uint8_t *aHeader, uint16_t aHeaderLength);
+
     /**
      * This method compresses an IPv6 header.
      *
@@ -72,8 +72,14 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mMacRadioAcquisitionId(0)
     , mRestorePanId(Mac::kPanIdBroadcast)
     , mScanning(false)
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    , mScanMultiChannel(false)
+#endif
 #if OPENTHREAD_FTD
     , mIndirectSender(aInstance)
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    , mVirtualReassembler(aInstance)
+#endif
 #endif
     , mDataPollSender(aInstance)
 {
@@ -131,6 +137,9 @@ void MeshForwarder::Stop(void)
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     memset(mFragmentEntries, 0, sizeof(mFragmentEntries));
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    mVirtualReassembler.Clear();
+#endif
 #endif
 
     mEnabled     = false;
@@ -194,6 +203,10 @@ otError MeshForwarder::PrepareDiscoverRequest(void)
 
     SuccessOrExit(error = Get<Mac::Mac>().AcquireRadioChannel(&mMacRadioAcquisitionId));
 
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    mScanMultiChannel = (Get<Mac::Mac>().SetRadioChannelMask(mMacRadioAcquisitionId, mScanChannels) == OT_ERROR_NONE);
+#endif
+
     mScanning = true;
 
     if (mScanChannels.GetNextChannel(mScanChannel) != OT_ERROR_NONE)
@@ -254,6 +267,9 @@ Message *MeshForwarder::GetDirectTransmission(void)
         switch (error)
         {
         case OT_ERROR_NONE:
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+            Get<Utils::LatencyTracer>().Record(*curMessage, Utils::LatencyTracer::kStageRouteResolved);
+#endif
             ExitNow();
 
 #if OPENTHREAD_FTD
@@ -481,6 +497,10 @@ otError MeshForwarder::HandleFrameRequest(Mac::TxFrame &aFrame)
 
     mSendBusy = true;
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Get<Utils::LatencyTracer>().Record(*mSendMessage, Utils::LatencyTracer::kStageTxStarted);
+#endif
+
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
@@ -953,6 +973,10 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, otError aError)
 
         LogMessage(kMessageTransmit, *mSendMessage, &macDest, txError);
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+        Get<Utils::LatencyTracer>().HandleDelivered(*mSendMessage, /* aIndirect */ false, mSendMessage->GetTxSuccess());
+#endif
+
         if (mSendMessage->GetType() == Message::kTypeIp6)
         {
             if (mSendMessage->GetTxSuccess())
@@ -969,6 +993,22 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, otError aError)
     if (mSendMessage->GetSubType() == Message::kSubTypeMleDiscoverRequest)
     {
         mSendBusy = true;
+
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+        if (mScanMultiChannel)
+        {
+            uint8_t channel = mScanChannel;
+
+            // Discovery Responses are received on all channels, so wait for them once, after the Discovery Request
+            // is sent on the last channel.
+            if (mScanChannels.GetNextChannel(channel) == OT_ERROR_NONE)
+            {
+                mDiscoverTimer.Start(OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_DWELL);
+                ExitNow();
+            }
+        }
+#endif
+
         mDiscoverTimer.Start(static_cast<uint16_t>(Mac::kScanDurationDefault));
         ExitNow();
     }
@@ -1266,6 +1306,7 @@ void MeshForwarder::ClearReassemblyList(void)
         mReassemblyList.Dequeue(*message);
 
         LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_NO_FRAME_RECEIVED);
+        OT_COUNTER_INCREMENT(GetInstance(), kReassemblyDrops);
 
         if (message->GetType() == Message::kTypeIp6)
         {
@@ -1312,6 +1353,7 @@ bool MeshForwarder::UpdateReassemblyList(void)
             mReassemblyList.Dequeue(*message);
 
             LogMessage(kMessageReassemblyDrop, *message, NULL, OT_ERROR_REASSEMBLY_TIMEOUT);
+            OT_COUNTER_INCREMENT(GetInstance(), kReassemblyDrops);
             if (message->GetType() == Message::kTypeIp6)
             {
                 mIpCounters.mRxFailure++;
@@ -47,6 +47,7 @@
 #include "thread/lowpan.hpp"
 #include "thread/network_data_leader.hpp"
 #include "thread/topology.hpp"
+#include "thread/virtual_reassembler.hpp"
 
 namespace ot {
 
@@ -171,6 +172,9 @@ class MeshForwarder : public InstanceLocator
     friend class Instance;
     friend class DataPollSender;
     friend class IndirectSender;
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    friend class VirtualReassembler;
+#endif
 
 public:
     /**
@@ -516,6 +520,9 @@ private:
     uint16_t         mMacRadioAcquisitionId;
     uint16_t         mRestorePanId;
     bool             mScanning;
+#if OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+    bool mScanMultiChannel;
+#endif
 
     otIpCounters mIpCounters;
 
@@ -523,6 +530,9 @@ private:
     FragmentPriorityEntry mFragmentEntries[kNumFragmentPriorityEntries];
     MessageQueue          mResolvingQueue;
     IndirectSender        mIndirectSender;
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    VirtualReassembler mVirtualReassembler;
+#endif
 #endif
 
     DataPollSender mDataPollSender;
@@ -53,6 +53,12 @@ otError MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
     SuccessOrExit(error = mSendQueue.Enqueue(aMessage));
+    OT_COUNTER_UPDATE_HIGH_WATER_MARK(GetInstance(), kSendQueueMessages, mSendQueue.GetNumMessages());
+
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    // Forwarded messages and 6LoWPAN frames do not go through the IPv6 send queue.
+    Get<Utils::LatencyTracer>().Record(aMessage, Utils::LatencyTracer::kStageEnqueued);
+#endif
 
     switch (aMessage.GetType())
     {
@@ -327,10 +333,10 @@ void MeshForwarder::SendMesh(Message &aMessage, Mac::TxFrame &aFrame)
     aFrame.SetDstAddr(mMacDest.GetShort());
     aFrame.SetSrcAddr(mMacSource.GetShort());
 
-    // write payload
-    assert(aMessage.GetLength() <= aFrame.GetMaxPayloadLength());
-    aMessage.Read(0, aMessage.GetLength(), aFrame.GetPayload());
-    aFrame.SetPayloadLength(static_cast<uint8_t>(aMessage.GetLength()));
+    // write payload (the message offset skips a mesh header that is not sent to a minimal child)
+    assert(aMessage.GetLength() - aMessage.GetOffset() <= aFrame.GetMaxPayloadLength());
+    aMessage.Read(aMessage.GetOffset(), aMessage.GetLength() - aMessage.GetOffset(), aFrame.GetPayload());
+    aFrame.SetPayloadLength(static_cast<uint8_t>(aMessage.GetLength() - aMessage.GetOffset()));
 
     mMessageNextOffset = aMessage.GetLength();
 }
@@ -363,6 +369,16 @@ otError MeshForwarder::UpdateMeshRoute(Message &aMessage)
     mMacDest.SetShort(neighbor->GetRloc16());
     mMacSource.SetShort(Get<Mac::Mac>().GetShortAddress());
 
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    // Frames forwarded through virtual reassembly keep their mesh header
+    // until here; minimal children do not process it, so skip it.
+    if (neighbor->GetRloc16() == meshHeader.GetDestination() &&
+        Get<Mle::MleRouter>().IsMinimalChild(meshHeader.GetDestination()))
+    {
+        aMessage.SetOffset(meshHeader.GetHeaderLength());
+    }
+#endif
+
     mAddMeshHeader = true;
     mMeshDest      = meshHeader.GetDestination();
     mMeshSource    = meshHeader.GetSource();
@@ -527,6 +543,15 @@ void MeshForwarder::HandleMesh(uint8_t *               aFrame,
     if (meshDest.GetShort() == Get<Mac::Mac>().GetShortAddress() ||
         Get<Mle::MleRouter>().IsMinimalChild(meshDest.GetShort()))
     {
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+        if (meshDest.GetShort() != Get<Mac::Mac>().GetShortAddress())
+        {
+            error = mVirtualReassembler.ForwardFrame(aFrame, aFrameLength, aMacSource, aLinkInfo);
+            VerifyOrExit(error == OT_ERROR_NOT_CAPABLE);
+            error = OT_ERROR_NONE;
+        }
+#endif
+
         aFrame += meshHeader.GetHeaderLength();
         aFrameLength -= meshHeader.GetHeaderLength();
 
@@ -640,6 +665,13 @@ bool MeshForwarder::UpdateFragmentLifetime(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    if (mVirtualReassembler.UpdateLifetime())
+    {
+        shouldRun = true;
+    }
+#endif
+
     return shouldRun;
 }
 
@@ -35,6 +35,8 @@
 
 #include "mesh_forwarder.hpp"
 
+#include "common/locator-getters.hpp"
+
 namespace ot {
 
 otError MeshForwarder::SendMessage(Message &aMessage)
@@ -46,6 +48,10 @@ otError MeshForwarder::SendMessage(Message &aMessage)
     aMessage.SetDatagramTag(0);
 
     SuccessOrExit(error = mSendQueue.Enqueue(aMessage));
+    OT_COUNTER_UPDATE_HIGH_WATER_MARK(GetInstance(), kSendQueueMessages, mSendQueue.GetNumMessages());
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    Get<Utils::LatencyTracer>().Record(aMessage, Utils::LatencyTracer::kStageEnqueued);
+#endif
     mScheduleTransmissionTask.Post();
 
 exit:
@@ -439,6 +439,9 @@ otError Mle::Restore(void)
         Get<MleRouter>().SetRouterId(GetRouterId(GetRloc16()));
         Get<MleRouter>().SetPreviousPartitionId(networkInfo.mPreviousPartitionId);
         Get<MleRouter>().RestoreChildren();
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+        Get<MleRouter>().RestoreRouterTable();
+#endif
     }
 
 exit:
@@ -1449,6 +1452,18 @@ otError Mle::AppendXtalAccuracy(Message &aMessage)
 }
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+otError Mle::AppendFrameBurst(Message &aMessage, uint8_t aMaxFrames)
+{
+    FrameBurstTlv tlv;
+
+    tlv.Init();
+    tlv.SetMaxFrames(aMaxFrames);
+
+    return aMessage.AppendTlv(tlv);
+}
+#endif
+
 otError Mle::AppendActiveTimestamp(Message &aMessage)
 {
     otError                   error;
@@ -2064,6 +2079,9 @@ otError Mle::SendChildIdRequest(void)
     SuccessOrExit(error = AppendMode(*message, mDeviceMode));
     SuccessOrExit(error = AppendTimeout(*message, mTimeout));
     SuccessOrExit(error = AppendVersion(*message));
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    SuccessOrExit(error = AppendFrameBurst(*message, OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES));
+#endif
 
     if (!IsFullThreadDevice())
     {
@@ -2289,6 +2307,9 @@ otError Mle::SendChildUpdateRequest(void)
     message->SetSubType(Message::kSubTypeMleChildUpdateRequest);
     SuccessOrExit(error = AppendHeader(*message, Header::kCommandChildUpdateRequest));
     SuccessOrExit(error = AppendMode(*message, mDeviceMode));
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    SuccessOrExit(error = AppendFrameBurst(*message, OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES));
+#endif
 
     if (!IsFullThreadDevice())
     {
@@ -2500,7 +2521,6 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
     uint8_t          tag[4];
     uint8_t          tagLength;
     Crypto::AesCcm   aesCcm;
-    uint8_t          buf[64];
     uint16_t         length;
     Ip6::MessageInfo messageInfo;
 
@@ -2518,7 +2538,9 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         KeyManager::GenerateNonce(Get<Mac::Mac>().GetExtAddress(), Get<KeyManager>().GetMleFrameCounter(),
                                   Mac::Frame::kSecEncMic32, nonce);
 
-        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKey(), 16);
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeyEcb());
+        OT_COUNTER_INCREMENT(GetInstance(), kAesCcmOperations);
+        OT_COUNTER_INCREMENT(GetInstance(), kMleSecuredMessages);
         error = aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1),
                             sizeof(tag), nonce, sizeof(nonce));
         assert(error == OT_ERROR_NONE);
@@ -2528,14 +2550,10 @@ otError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination)
         aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
         aMessage.SetOffset(header.GetLength() - 1);
-
-        while (aMessage.GetOffset() < aMessage.GetLength())
-        {
-            length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-            aesCcm.Payload(buf, buf, length, true);
-            aMessage.Write(aMessage.GetOffset(), length, buf);
-            aMessage.MoveOffset(length);
-        }
+        length = aMessage.GetLength() - aMessage.GetOffset();
+        aesCcm.Payload(aMessage, aMessage.GetOffset(), length, true);
+        aMessage.MoveOffset(length);
+        OT_COUNTER_ADD(GetInstance(), kMleSecuredBytes, length);
 
         tagLength = sizeof(tag);
         aesCcm.Finalize(tag, &tagLength);
@@ -2596,19 +2614,17 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 {
     Header          header;
     uint32_t        keySequence;
-    const uint8_t * mleKey;
     uint32_t        frameCounter;
     uint8_t         messageTag[4];
     uint8_t         nonce[KeyManager::kNonceSize];
     Mac::ExtAddress macAddr;
     Crypto::AesCcm  aesCcm;
-    uint16_t        mleOffset;
-    uint8_t         buf[64];
     uint16_t        length;
     uint8_t         tag[4];
     uint8_t         tagLength;
     uint8_t         command;
     Neighbor *      neighbor;
+    TlvIndex        tlvIndex;
 
     VerifyOrExit(aMessageInfo.GetLinkInfo() != NULL);
     VerifyOrExit(aMessageInfo.GetHopLimit() == kMleHopLimit);
@@ -2619,6 +2635,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     if (header.GetSecuritySuite() == Header::kNoSecurity)
     {
         aMessage.MoveOffset(header.GetLength());
+        tlvIndex.Attach(aMessage);
 
         switch (header.GetCommand())
         {
@@ -2643,11 +2660,11 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     if (keySequence == Get<KeyManager>().GetCurrentKeySequence())
     {
-        mleKey = Get<KeyManager>().GetCurrentMleKey();
+        aesCcm.SetKey(Get<KeyManager>().GetCurrentMleKeyEcb());
     }
     else
     {
-        mleKey = Get<KeyManager>().GetTemporaryMleKey(keySequence);
+        aesCcm.SetKey(Get<KeyManager>().GetTemporaryMleKey(keySequence), 16);
     }
 
     VerifyOrExit(aMessage.GetOffset() + header.GetLength() + sizeof(messageTag) <= aMessage.GetLength());
@@ -2660,7 +2677,8 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     frameCounter = header.GetFrameCounter();
     KeyManager::GenerateNonce(macAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(mleKey, 16);
+    OT_COUNTER_INCREMENT(GetInstance(), kAesCcmOperations);
+    OT_COUNTER_INCREMENT(GetInstance(), kMleSecuredMessages);
     SuccessOrExit(
         aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                     aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce)));
@@ -2669,22 +2687,18 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     aesCcm.Header(&aMessageInfo.GetSockAddr(), sizeof(aMessageInfo.GetSockAddr()));
     aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
-    mleOffset = aMessage.GetOffset();
+    length = aMessage.GetLength() - aMessage.GetOffset();
+    OT_COUNTER_ADD(GetInstance(), kMleSecuredBytes, length);
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
-    {
-        length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-        aesCcm.Payload(buf, buf, length, false);
 #ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
-        aMessage.Write(aMessage.GetOffset(), length, buf);
-#endif
-        aMessage.MoveOffset(length);
-    }
+    aesCcm.Payload(aMessage, aMessage.GetOffset(), length, false);
 
     tagLength = sizeof(tag);
     aesCcm.Finalize(tag, &tagLength);
-#ifndef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
     VerifyOrExit(memcmp(messageTag, tag, sizeof(tag)) == 0);
+#else
+    OT_UNUSED_VARIABLE(tag);
+    OT_UNUSED_VARIABLE(tagLength);
 #endif
 
     if (keySequence > Get<KeyManager>().GetCurrentKeySequence())
@@ -2692,8 +2706,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
         Get<KeyManager>().SetCurrentKeySequence(keySequence);
     }
 
-    aMessage.SetOffset(mleOffset);
-
     aMessage.Read(aMessage.GetOffset(), sizeof(command), &command);
     aMessage.MoveOffset(sizeof(command));
 
@@ -2759,6 +2771,9 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
         }
     }
 
+    // The handlers look up the TLVs in the index, instead of reading the message for each TLV.
+    tlvIndex.Attach(aMessage);
+
     switch (command)
     {
     case Header::kCommandLinkRequest:
@@ -3460,6 +3475,11 @@ otError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::MessageIn
     }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    // Frame Burst optional
+    SuccessOrExit(error = HandleFrameBurst(aMessage));
+#endif
+
     // Parent Attach Success
 
     SetStateDetached();
@@ -3650,6 +3670,11 @@ otError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::Messa
             mTimeout = timeout.GetTimeout();
         }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        // Frame Burst optional
+        SuccessOrExit(error = HandleFrameBurst(aMessage));
+#endif
+
         if (!IsRxOnWhenIdle())
         {
             Get<DataPollSender>().SetAttachMode(false);
@@ -3677,6 +3702,27 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+otError Mle::HandleFrameBurst(const Message &aMessage)
+{
+    otError       error     = OT_ERROR_NONE;
+    uint8_t       maxFrames = 0;
+    FrameBurstTlv frameBurst;
+
+    // A parent without frame burst support does not include the TLV, and expects a data poll for each frame.
+    if (Tlv::GetTlv(aMessage, Tlv::kFrameBurst, sizeof(frameBurst), frameBurst) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(frameBurst.IsValid(), error = OT_ERROR_PARSE);
+        maxFrames = frameBurst.GetMaxFrames();
+    }
+
+    Get<DataPollSender>().SetFrameBurstLimit(maxFrames);
+
+exit:
+    return error;
+}
+#endif
+
 otError Mle::HandleAnnounce(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     OT_UNUSED_VARIABLE(aMessageInfo);
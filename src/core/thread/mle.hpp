@@ -1384,6 +1384,20 @@ protected:
     otError AppendXtalAccuracy(Message &aMessage);
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    /**
+     * This method appends a Frame Burst TLV to a message.
+     *
+     * @param[in]  aMessage    A reference to the message.
+     * @param[in]  aMaxFrames  The maximum number of frames per data poll.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the Frame Burst TLV.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffers available to append the Frame Burst TLV.
+     *
+     */
+    otError AppendFrameBurst(Message &aMessage, uint8_t aMaxFrames);
+#endif
+
     /**
      * This method appends a Active Timestamp TLV to a message.
      *
@@ -1709,6 +1723,9 @@ private:
     otError HandleAnnounce(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError HandleDiscoveryResponse(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     otError HandleLeaderData(const Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    otError HandleFrameBurst(const Message &aMessage);
+#endif
     void    ProcessAnnounce(void);
     bool    HasUnregisteredAddress(void);
 
@@ -35,6 +35,7 @@
 #include "mle_router.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/crc16.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -64,7 +65,7 @@ MleRouter::MleRouter(Instance &aInstance)
     , mChildTable(aInstance)
     , mRouterTable(aInstance)
     , mNeighborTableChangedCallback(NULL)
-    , mChallengeTimeout(0)
+    , mChallengeTimeout()
     , mNextChildId(kMaxChildId)
     , mNetworkIdTimeout(kNetworkIdTimeout)
     , mRouterUpgradeThreshold(kRouterUpgradeThreshold)
@@ -73,13 +74,21 @@ MleRouter::MleRouter(Instance &aInstance)
     , mFixedLeaderPartitionId(0)
     , mRouterRoleEnabled(true)
     , mAddressSolicitPending(false)
+    , mRouteTlvValid(false)
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    , mRouterTableRestorePending(false)
+    , mRouterTableSnapshotTimeout()
+    , mRouterTableInfoCrc(0)
+    , mAddressCacheInfoCrc(0)
+#endif
     , mPreviousPartitionIdRouter(0)
     , mPreviousPartitionId(0)
     , mPreviousPartitionRouterIdSequence(0)
-    , mPreviousPartitionIdTimeout(0)
+    , mPreviousPartitionIdTimeout()
     , mRouterSelectionJitter(kRouterSelectionJitter)
-    , mRouterSelectionJitterTimeout(0)
+    , mRouterSelectionJitterTimeout()
     , mParentPriority(kParentPriorityUnspecified)
+    , mRouteTlvRloc16(Mac::kShortAddrInvalid)
 {
     mDeviceMode.Set(mDeviceMode.Get() | DeviceMode::kModeFullThreadDevice | DeviceMode::kModeFullNetworkData);
 
@@ -90,7 +99,7 @@ void MleRouter::HandlePartitionChange(void)
 {
     mPreviousPartitionId               = mLeaderData.GetPartitionId();
     mPreviousPartitionRouterIdSequence = mRouterTable.GetRouterIdSequence();
-    mPreviousPartitionIdTimeout        = GetNetworkIdTimeout();
+    StartCountdown(mPreviousPartitionIdTimeout, TimerMilli::SecToMsec(GetNetworkIdTimeout()));
 
     Get<AddressResolver>().Clear();
     Get<Coap::Coap>().AbortTransaction(&MleRouter::HandleAddressSolicitResponse, this);
@@ -126,9 +135,9 @@ void MleRouter::SetRouterRoleEnabled(bool aEnabled)
         break;
     }
 
-    if (IsRouterRoleEnabled() && IsAttached() && !mStateUpdateTimer.IsRunning())
+    if (IsRouterRoleEnabled() && IsAttached())
     {
-        mStateUpdateTimer.Start(kStateUpdatePeriod);
+        StartStateUpdateTimer();
     }
 }
 
@@ -143,13 +152,13 @@ otError MleRouter::BecomeRouter(ThreadStatusTlv::Status aStatus)
     otLogInfoMle("Attempt to become router");
 
     Get<MeshForwarder>().SetRxOnWhenIdle(true);
-    mRouterSelectionJitterTimeout = 0;
+    mRouterSelectionJitterTimeout.Stop();
 
     switch (mRole)
     {
     case OT_DEVICE_ROLE_DETACHED:
         SuccessOrExit(error = SendLinkRequest(NULL));
-        mStateUpdateTimer.Start(kStateUpdatePeriod);
+        StartStateUpdateTimer();
         break;
 
     case OT_DEVICE_ROLE_CHILD:
@@ -223,10 +232,11 @@ otError MleRouter::HandleChildStart(AttachMode aMode)
 {
     otError error = OT_ERROR_NONE;
 
-    mRouterSelectionJitterTimeout = 1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter);
+    StartCountdown(mRouterSelectionJitterTimeout,
+                   TimerMilli::SecToMsec(1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter)));
 
     StopLeader();
-    mStateUpdateTimer.Start(kStateUpdatePeriod);
+    StartStateUpdateTimer();
 
     if (mRouterRoleEnabled)
     {
@@ -341,7 +351,7 @@ void MleRouter::SetStateLeader(uint16_t aRloc16)
 
     Get<ThreadNetif>().SubscribeAllRoutersMulticast();
     mPreviousPartitionIdRouter = mLeaderData.GetPartitionId();
-    mStateUpdateTimer.Start(kStateUpdatePeriod);
+    StartStateUpdateTimer();
 
     Get<NetworkData::Leader>().Start();
     Get<MeshCoP::ActiveDataset>().StartLeader();
@@ -402,6 +412,12 @@ void MleRouter::ResetAdvertiseInterval(void)
 
     mAdvertiseTimer.IndicateInconsistent();
 
+    if (mRole == OT_DEVICE_ROLE_LEADER)
+    {
+        // A router may have lost its route, the Router ID timeouts are checked again.
+        StartStateUpdateTimer();
+    }
+
 exit:
     return;
 }
@@ -517,7 +533,7 @@ otError MleRouter::SendLinkRequest(Neighbor *aNeighbor)
     {
         Random::NonCrypto::FillBuffer(mChallenge, sizeof(mChallenge));
 
-        mChallengeTimeout = (((2 * kMaxResponseDelay) + kStateUpdatePeriod - 1) / kStateUpdatePeriod);
+        StartCountdown(mChallengeTimeout, 2 * kMaxResponseDelay);
 
         SuccessOrExit(error = AppendChallenge(*message, mChallenge, sizeof(mChallenge)));
         destination.mFields.m8[0]  = 0xff;
@@ -807,6 +823,9 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
     uint8_t                 routerId;
     Address16Tlv            address16;
     RouteTlv                route;
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    bool routeReceived = false;
+#endif
     LeaderDataTlv           leaderData;
     LinkMarginTlv           linkMargin;
     ChallengeTlv            challenge;
@@ -866,7 +885,12 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         VerifyOrExit(mRole == OT_DEVICE_ROLE_DETACHED, error = OT_ERROR_NOT_FOUND);
 
         // Wait for an MLE Advertisement to establish a routing cost to the neighbor
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+        // Keep the link quality restored from the router table snapshot
+        linkMargin.SetLength(0);
+#else
         linkMargin.SetLinkMargin(0);
+#endif
     }
 
     VerifyOrExit(IsActiveRouter(sourceAddress.GetRloc16()), error = OT_ERROR_PARSE);
@@ -884,7 +908,7 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         break;
 
     case Neighbor::kStateInvalid:
-        VerifyOrExit((mChallengeTimeout > 0) && (memcmp(mChallenge, response.GetResponse(), sizeof(mChallenge)) == 0),
+        VerifyOrExit(mChallengeTimeout.IsRunning() && (memcmp(mChallenge, response.GetResponse(), sizeof(mChallenge)) == 0),
                      error = OT_ERROR_SECURITY);
         break;
 
@@ -917,6 +941,9 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
         mRouterTable.Clear();
         SuccessOrExit(error = ProcessRouteTlv(route));
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+        routeReceived = true;
+#endif
         router = mRouterTable.GetRouter(routerId);
         VerifyOrExit(router != NULL);
 
@@ -929,6 +956,10 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
             SetStateRouter(GetRloc16());
         }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+        ApplyRouterTableSnapshot();
+#endif
+
         mRetrieveNewNetworkData = true;
         SendDataRequest(aMessageInfo.GetPeerAddr(), dataRequestTlvs, sizeof(dataRequestTlvs), 0);
 
@@ -961,7 +992,11 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
         {
             VerifyOrExit(route.IsValid(), error = OT_ERROR_PARSE);
             SuccessOrExit(error = ProcessRouteTlv(route));
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+            routeReceived = true;
+#else
             UpdateRoutes(route, routerId);
+#endif
         }
 
         // update routing table
@@ -983,13 +1018,28 @@ otError MleRouter::HandleLinkAccept(const Message &         aMessage,
                                      DeviceMode::kModeFullNetworkData));
     router->GetLinkInfo().Clear();
     router->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
-    router->SetLinkQualityOut(LinkQualityInfo::ConvertLinkMarginToLinkQuality(linkMargin.GetLinkMargin()));
+
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    if (linkMargin.IsValid())
+#endif
+    {
+        router->SetLinkQualityOut(LinkQualityInfo::ConvertLinkMarginToLinkQuality(linkMargin.GetLinkMargin()));
+    }
+
     router->ResetLinkFailures();
     router->SetState(Neighbor::kStateValid);
     router->SetKeySequence(aKeySequence);
 
     Signal(OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED, *router);
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    if (routeReceived)
+    {
+        // Routes through the neighbor are only usable once its link is valid
+        UpdateRoutes(route, routerId);
+    }
+#endif
+
     if (aRequest)
     {
         // Challenge
@@ -1067,6 +1117,24 @@ exit:
     return error;
 }
 
+uint8_t MleRouter::GetRouterSelectionJitterTimeout(void) const
+{
+    // Rounded up, so that a running countdown is not reported as zero.
+    return static_cast<uint8_t>(
+        TimerMilli::MsecToSec(mRouterSelectionJitterTimeout.GetRemaining() + TimerMilli::SecToMsec(1) - 1));
+}
+
+void MleRouter::SetNetworkIdTimeout(uint8_t aTimeout)
+{
+    mNetworkIdTimeout = aTimeout;
+
+    // The leader age is checked against the new timeout.
+    if (IsRouterRoleEnabled() && IsAttached())
+    {
+        StartStateUpdateTimer();
+    }
+}
+
 otError MleRouter::ProcessRouteTlv(const RouteTlv &aRoute)
 {
     otError error = OT_ERROR_NONE;
@@ -1200,7 +1268,7 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
 
         VerifyOrExit(linkMargin >= OPENTHREAD_CONFIG_MLE_PARTITION_MERGE_MARGIN_MIN, error = OT_ERROR_LINK_MARGIN_LOW);
 
-        if (route.IsValid() && IsFullThreadDevice() && (mPreviousPartitionIdTimeout > 0) &&
+        if (route.IsValid() && IsFullThreadDevice() && mPreviousPartitionIdTimeout.IsRunning() &&
             (partitionId == mPreviousPartitionId))
         {
             VerifyOrExit((static_cast<int8_t>(route.GetRouterIdSequence() - mPreviousPartitionRouterIdSequence) > 0),
@@ -1295,9 +1363,11 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
         VerifyOrExit(router != NULL);
 
         if ((router->GetState() == Neighbor::kStateValid) && IsFullThreadDevice() &&
-            (mRouterSelectionJitterTimeout == 0) && (mRouterTable.GetActiveRouterCount() < mRouterUpgradeThreshold))
+            !mRouterSelectionJitterTimeout.IsRunning() &&
+            (mRouterTable.GetActiveRouterCount() < mRouterUpgradeThreshold))
         {
-            mRouterSelectionJitterTimeout = 1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter);
+            StartCountdown(mRouterSelectionJitterTimeout,
+                           TimerMilli::SecToMsec(1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter)));
             ExitNow();
         }
 
@@ -1377,11 +1447,12 @@ otError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::Messa
             }
         }
 
-        if (routerCount > mRouterDowngradeThreshold && mRouterSelectionJitterTimeout == 0 &&
+        if (routerCount > mRouterDowngradeThreshold && !mRouterSelectionJitterTimeout.IsRunning() &&
             HasMinDowngradeNeighborRouters() && HasSmallNumberOfChildren() &&
             HasOneNeighborWithComparableConnectivity(route, routerId))
         {
-            mRouterSelectionJitterTimeout = 1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter);
+            StartCountdown(mRouterSelectionJitterTimeout,
+                           TimerMilli::SecToMsec(1 + Random::NonCrypto::GetUint8InRange(0, mRouterSelectionJitter)));
         }
 
         // fall through
@@ -1653,7 +1724,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
         memset(child, 0, sizeof(*child));
 
         // MAC Address
-        child->SetExtAddress(macAddr);
+        mChildTable.SetChildExtAddress(*child, macAddr);
         child->GetLinkInfo().Clear();
         child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
         child->ResetLinkFailures();
@@ -1678,6 +1749,7 @@ otError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::Messa
     {
         child->SetLastHeard(TimerMilli::GetNow());
         child->SetTimeout(TimerMilli::MsecToSec(kMaxChildIdRequestTimeout));
+        ScheduleChildTimeout(*child);
     }
 
     SendParentResponse(child, challenge, !scanMask.IsEndDeviceFlagSet());
@@ -1686,38 +1758,98 @@ exit:
     return error;
 }
 
-void MleRouter::HandleStateUpdateTimer(Timer &aTimer)
+void MleRouter::StartStateUpdateTimer(void)
 {
-    aTimer.GetOwner<MleRouter>().HandleStateUpdateTimer();
+    // The handler updates the state and restarts the timer for the earliest deadline.
+    mStateUpdateTimer.Start(0);
 }
 
-void MleRouter::HandleStateUpdateTimer(void)
+void MleRouter::ScheduleStateUpdate(uint32_t aStartTime, uint32_t aDelay)
 {
-    bool routerStateUpdate = false;
+    if (aDelay > Timer::kMaxDt)
+    {
+        aDelay = Timer::kMaxDt;
+    }
 
-    VerifyOrExit(IsRouterRoleEnabled());
+    if (!mStateUpdateTimer.IsRunning() ||
+        TimerScheduler::IsStrictlyBefore(aStartTime + aDelay, mStateUpdateTimer.GetFireTime()))
+    {
+        mStateUpdateTimer.StartAt(aStartTime, aDelay);
+    }
+}
+
+void MleRouter::ScheduleChildTimeout(const Child &aChild)
+{
+    // Children are only timed out while the device acts as a parent, the timer is started again when it attaches.
+    VerifyOrExit(IsRouterRoleEnabled() && IsAttached());
+
+    ScheduleStateUpdate(aChild.GetLastHeard(), TimerMilli::SecToMsec(aChild.GetTimeout()));
 
-    mStateUpdateTimer.Start(kStateUpdatePeriod);
+exit:
+    return;
+}
+
+void MleRouter::StartCountdown(Countdown &aCountdown, uint32_t aDelay)
+{
+    aCountdown.Start(aDelay);
+
+    // Countdowns started while detached are checked once the timer is started again on attach.
+    VerifyOrExit(IsRouterRoleEnabled() && IsAttached());
+
+    ScheduleStateUpdate(TimerMilli::GetNow(), aDelay);
+
+exit:
+    return;
+}
 
-    if (mChallengeTimeout > 0)
+uint32_t MleRouter::Countdown::GetRemaining(void) const
+{
+    uint32_t now = TimerMilli::GetNow();
+
+    return (mStarted && TimerScheduler::IsStrictlyBefore(now, mFireTime)) ? mFireTime - now : 0;
+}
+
+bool MleRouter::Countdown::Update(uint32_t &aNextDelay)
+{
+    bool     expired   = false;
+    uint32_t remaining = GetRemaining();
+
+    VerifyOrExit(mStarted);
+
+    if (remaining == 0)
     {
-        mChallengeTimeout--;
+        mStarted = false;
+        ExitNow(expired = true);
     }
 
-    if (mPreviousPartitionIdTimeout > 0)
+    if (remaining < aNextDelay)
     {
-        mPreviousPartitionIdTimeout--;
+        aNextDelay = remaining;
     }
 
-    if (mRouterSelectionJitterTimeout > 0)
-    {
-        mRouterSelectionJitterTimeout--;
+exit:
+    return expired;
+}
 
-        if (mRouterSelectionJitterTimeout == 0)
-        {
-            routerStateUpdate = true;
-        }
-    }
+void MleRouter::HandleStateUpdateTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MleRouter>().HandleStateUpdateTimer();
+}
+
+void MleRouter::HandleStateUpdateTimer(void)
+{
+    uint32_t nextDelay         = Timer::kForeverDt;
+    bool     routerStateUpdate = false;
+    uint32_t leaderAge;
+    uint32_t networkIdTimeout;
+
+    VerifyOrExit(IsRouterRoleEnabled());
+
+    // The timer fires at the earliest deadline and is restarted for the next one found below. It is not restarted
+    // when no timeout or countdown is pending.
+    mChallengeTimeout.Update(nextDelay);
+    mPreviousPartitionIdTimeout.Update(nextDelay);
+    routerStateUpdate = mRouterSelectionJitterTimeout.Update(nextDelay);
 
     switch (mRole)
     {
@@ -1726,7 +1858,7 @@ void MleRouter::HandleStateUpdateTimer(void)
         break;
 
     case OT_DEVICE_ROLE_DETACHED:
-        if (mChallengeTimeout == 0)
+        if (!mChallengeTimeout.IsRunning())
         {
             BecomeDetached();
             ExitNow();
@@ -1757,7 +1889,8 @@ void MleRouter::HandleStateUpdateTimer(void)
                                       TrickleTimer::kModePlainTimer);
             }
 
-            ExitNow();
+            // The downgrade below only applies to routers, the path to the leader is still verified.
+            routerStateUpdate = false;
         }
 
         // fall through
@@ -1766,10 +1899,24 @@ void MleRouter::HandleStateUpdateTimer(void)
         // verify path to leader
         otLogDebgMle("network id timeout = %d", mRouterTable.GetLeaderAge());
 
-        if ((mRouterTable.GetActiveRouterCount() > 0) && (mRouterTable.GetLeaderAge() >= mNetworkIdTimeout))
+        if (mRouterTable.GetActiveRouterCount() > 0)
         {
-            otLogInfoMle("Router ID Sequence timeout");
-            BecomeChild(kAttachSame1);
+            leaderAge        = TimerMilli::Elapsed(mRouterTable.GetRouterIdSequenceLastUpdated());
+            networkIdTimeout = TimerMilli::SecToMsec(mNetworkIdTimeout);
+
+            if (leaderAge >= networkIdTimeout)
+            {
+                otLogInfoMle("Router ID Sequence timeout");
+                BecomeChild(kAttachSame1);
+
+                // Checked every period until the device attaches again.
+                networkIdTimeout = leaderAge + kStateUpdatePeriod;
+            }
+
+            if (networkIdTimeout - leaderAge < nextDelay)
+            {
+                nextDelay = networkIdTimeout - leaderAge;
+            }
         }
 
         if (routerStateUpdate && mRouterTable.GetActiveRouterCount() > mRouterDowngradeThreshold)
@@ -1785,11 +1932,63 @@ void MleRouter::HandleStateUpdateTimer(void)
         break;
     }
 
-    // update children state
+    UpdateChildTimeouts(nextDelay);
+    UpdateRouterTimeouts(nextDelay);
+    mRouterTable.HandleStateUpdate(nextDelay);
+
+    if (SynchronizeChildNetworkData() && kStateUpdatePeriod < nextDelay)
+    {
+        // Deferred Child Update Requests are sent again every period.
+        nextDelay = kStateUpdatePeriod;
+    }
+
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    if (mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER)
+    {
+        if (mRouterTableSnapshotTimeout.Update(nextDelay))
+        {
+            StoreRouterTable();
+        }
+
+        if (!mRouterTableSnapshotTimeout.IsRunning())
+        {
+            mRouterTableSnapshotTimeout.Start(TimerMilli::SecToMsec(kRouterTableSnapshotInterval));
+            mRouterTableSnapshotTimeout.Update(nextDelay);
+        }
+    }
+#endif
+
+#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+    if (mRole == OT_DEVICE_ROLE_LEADER || mRole == OT_DEVICE_ROLE_ROUTER)
+    {
+        // A Time Synchronization message to forward is flagged from the receive path, it is checked every period.
+        Get<TimeSync>().ProcessTimeSync();
+
+        if (kStateUpdatePeriod < nextDelay)
+        {
+            nextDelay = kStateUpdatePeriod;
+        }
+    }
+#endif
+
+    if (nextDelay != Timer::kForeverDt)
+    {
+        ScheduleStateUpdate(TimerMilli::GetNow(), nextDelay);
+    }
+
+exit:
+    return;
+}
+
+void MleRouter::UpdateChildTimeouts(uint32_t &aNextDelay)
+{
+    // A child heard since the last update has a later timeout, so the timer is restarted for the earliest timeout
+    // found, instead of updating it each time a child is heard.
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
     {
         Child &  child   = *iter.GetChild();
         uint32_t timeout = 0;
+        uint32_t elapsed;
 
         switch (child.GetState())
         {
@@ -1810,22 +2009,42 @@ void MleRouter::HandleStateUpdateTimer(void)
             break;
         }
 
-        if (TimerMilli::Elapsed(child.GetLastHeard()) >= timeout)
+        elapsed = TimerMilli::Elapsed(child.GetLastHeard());
+
+        if (elapsed >= timeout)
         {
             otLogInfoMle("Child timeout expired");
             RemoveNeighbor(child);
+            continue;
         }
-        else if ((mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER) &&
-                 (child.GetState() == Neighbor::kStateRestored))
+
+        if (timeout - elapsed < aNextDelay)
+        {
+            aNextDelay = timeout - elapsed;
+        }
+
+        if (child.GetState() == Neighbor::kStateRestored)
         {
-            SendChildUpdateRequest(child);
+            // A Child Update Request is sent to a restored child every state update period until it responds.
+            if (mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER)
+            {
+                SendChildUpdateRequest(child);
+            }
+
+            if (kStateUpdatePeriod < aNextDelay)
+            {
+                aNextDelay = kStateUpdatePeriod;
+            }
         }
     }
+}
 
-    // update router state
+void MleRouter::UpdateRouterTimeouts(uint32_t &aNextDelay)
+{
     for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++)
     {
-        Router & router = *iter.GetRouter();
+        Router & router  = *iter.GetRouter();
+        uint32_t timeout = 0;
         uint32_t age;
 
         if (router.GetRloc16() == GetRloc16())
@@ -1838,9 +2057,11 @@ void MleRouter::HandleStateUpdateTimer(void)
 
         if (router.GetState() == Neighbor::kStateValid)
         {
+            timeout = TimerMilli::SecToMsec(kMaxNeighborAge);
+
 #if OPENTHREAD_CONFIG_MLE_SEND_LINK_REQUEST_ON_ADV_TIMEOUT == 0
 
-            if (age >= TimerMilli::SecToMsec(kMaxNeighborAge))
+            if (age >= timeout)
             {
                 otLogInfoMle("Router timeout expired");
                 RemoveNeighbor(router);
@@ -1849,12 +2070,20 @@ void MleRouter::HandleStateUpdateTimer(void)
 
 #else
 
-            if (age >= TimerMilli::SecToMsec(kMaxNeighborAge))
+            if (age >= timeout)
             {
-                if (age < TimerMilli::SecToMsec(kMaxNeighborAge) + kMaxTransmissionCount * kUnicastRetransmissionDelay)
+                timeout += kMaxTransmissionCount * kUnicastRetransmissionDelay;
+
+                if (age < timeout)
                 {
                     otLogInfoMle("Router timeout expired");
                     SendLinkRequest(&router);
+
+                    // A Link Request is sent every retransmission delay until the router is removed.
+                    if (kUnicastRetransmissionDelay < timeout - age)
+                    {
+                        timeout = age + kUnicastRetransmissionDelay;
+                    }
                 }
                 else
                 {
@@ -1867,7 +2096,9 @@ void MleRouter::HandleStateUpdateTimer(void)
         }
         else if (router.GetState() == Neighbor::kStateLinkRequest)
         {
-            if (age >= kMaxLinkRequestTimeout)
+            timeout = kMaxLinkRequestTimeout;
+
+            if (age >= timeout)
             {
                 otLogInfoMle("Link Request timeout expired");
                 RemoveNeighbor(router);
@@ -1875,31 +2106,32 @@ void MleRouter::HandleStateUpdateTimer(void)
             }
         }
 
+        if (timeout > 0 && timeout - age < aNextDelay)
+        {
+            aNextDelay = timeout - age;
+        }
+
         if (GetRole() == OT_DEVICE_ROLE_LEADER)
         {
-            if (mRouterTable.GetRouter(router.GetNextHop()) == NULL &&
-                mRouterTable.GetLinkCost(router) >= kMaxRouteCost &&
-                age >= TimerMilli::SecToMsec(kMaxLeaderToRouterTimeout))
+            // A router losing its route calls `ResetAdvertiseInterval()`, which restarts the state update on the
+            // leader, so only routers not heard for less than the timeout need a deadline.
+            timeout = TimerMilli::SecToMsec(kMaxLeaderToRouterTimeout);
+
+            if (age < timeout)
+            {
+                if (timeout - age < aNextDelay)
+                {
+                    aNextDelay = timeout - age;
+                }
+            }
+            else if (mRouterTable.GetRouter(router.GetNextHop()) == NULL &&
+                     mRouterTable.GetLinkCost(router) >= kMaxRouteCost)
             {
                 otLogInfoMle("Router ID timeout expired (no route)");
                 mRouterTable.Release(router.GetRouterId());
             }
         }
     }
-
-    mRouterTable.ProcessTimerTick();
-
-    SynchronizeChildNetworkData();
-
-#if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
-    if (mRole == OT_DEVICE_ROLE_LEADER || mRole == OT_DEVICE_ROLE_ROUTER)
-    {
-        Get<TimeSync>().ProcessTimeSync();
-    }
-#endif
-
-exit:
-    return;
 }
 
 void MleRouter::SendParentResponse(Child *aChild, const ChallengeTlv &aChallenge, bool aRoutersOnlyRequest)
@@ -2087,6 +2319,10 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     Router *                router;
     uint8_t                 numTlvs;
     uint16_t                addressRegistrationOffset = 0;
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    FrameBurstTlv frameBurst;
+    uint8_t       frameBurstLimit = 0;
+#endif
 
     LogMleMessage("Receive Child ID Request", aMessageInfo.GetPeerAddr());
 
@@ -2155,6 +2391,15 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
         VerifyOrExit(pendingTimestamp.IsValid(), error = OT_ERROR_PARSE);
     }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    // Frame Burst
+    if (Tlv::GetTlv(aMessage, Tlv::kFrameBurst, sizeof(frameBurst), frameBurst) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(frameBurst.IsValid(), error = OT_ERROR_PARSE);
+        frameBurstLimit = frameBurst.GetMaxFrames();
+    }
+#endif
+
     if (!mode.GetMode().IsFullThreadDevice())
     {
         SuccessOrExit(error = Tlv::GetOffset(aMessage, Tlv::kAddressRegistration, addressRegistrationOffset));
@@ -2184,6 +2429,9 @@ otError MleRouter::HandleChildIdRequest(const Message &         aMessage,
     child->SetDeviceMode(mode.GetMode());
     child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
     child->SetTimeout(timeout.GetTimeout());
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    Get<IndirectSender>().SetChildFrameBurstLimit(*child, frameBurstLimit);
+#endif
 
     if (mode.GetMode().IsFullNetworkData())
     {
@@ -2252,6 +2500,9 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
     uint8_t         tlvslength                = 0;
     uint16_t        addressRegistrationOffset = 0;
     bool            childDidChange            = false;
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    FrameBurstTlv frameBurst;
+#endif
 
     LogMleMessage("Receive Child Update Request from child", aMessageInfo.GetPeerAddr());
 
@@ -2317,12 +2568,27 @@ otError MleRouter::HandleChildUpdateRequest(const Message &         aMessage,
         if (child->GetTimeout() != timeout.GetTimeout())
         {
             child->SetTimeout(timeout.GetTimeout());
+            ScheduleChildTimeout(*child);
             childDidChange = true;
         }
 
         tlvs[tlvslength++] = Tlv::kTimeout;
     }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    // Frame Burst
+    if (Tlv::GetTlv(aMessage, Tlv::kFrameBurst, sizeof(frameBurst), frameBurst) == OT_ERROR_NONE)
+    {
+        VerifyOrExit(frameBurst.IsValid(), error = OT_ERROR_PARSE);
+        Get<IndirectSender>().SetChildFrameBurstLimit(*child, frameBurst.GetMaxFrames());
+        tlvs[tlvslength++] = Tlv::kFrameBurst;
+    }
+    else
+    {
+        Get<IndirectSender>().SetChildFrameBurstLimit(*child, 0);
+    }
+#endif
+
     // TLV Request
     if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == OT_ERROR_NONE)
     {
@@ -2460,6 +2726,7 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     {
         VerifyOrExit(timeout.IsValid(), error = OT_ERROR_PARSE);
         child->SetTimeout(timeout.GetTimeout());
+        ScheduleChildTimeout(*child);
     }
 
     // Ip6 Address
@@ -2488,6 +2755,9 @@ otError MleRouter::HandleChildUpdateResponse(const Message &         aMessage,
     child->SetKeySequence(aKeySequence);
     child->GetLinkInfo().AddRss(Get<Mac::Mac>().GetNoiseFloor(), linkInfo->mRss);
 
+    // The Child Update Request to this child is no longer queued, update the next sleepy children.
+    SynchronizeChildNetworkData();
+
 exit:
     return error;
 }
@@ -2559,16 +2829,31 @@ void MleRouter::HandleNetworkDataUpdateRouter(void)
         (mRole == OT_DEVICE_ROLE_LEADER) ? 0 : Random::NonCrypto::GetUint16InRange(0, kUnsolicitedDataResponseJitter);
     SendDataResponse(destination, tlvs, sizeof(tlvs), delay);
 
+    RemoveOutdatedChildUpdates();
     SynchronizeChildNetworkData();
 
 exit:
     return;
 }
 
-void MleRouter::SynchronizeChildNetworkData(void)
+bool MleRouter::SynchronizeChildNetworkData(void)
 {
+    uint16_t outstanding = 0;
+    bool     deferred    = false;
+
     VerifyOrExit(mRole == OT_DEVICE_ROLE_ROUTER || mRole == OT_DEVICE_ROLE_LEADER);
 
+    // Rx-on-when-idle children are updated by the multicast Data Response. Sleepy children are sent a Child Update
+    // Request each, limiting the number of queued ones so that the updates are paced by the children polling. Returns
+    // whether an update was deferred, a queued one calls this method again when the child responds.
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateAnyExceptInvalid); !iter.IsDone(); iter++)
+    {
+        if (iter.GetChild()->IsChildUpdateRequestQueued())
+        {
+            outstanding++;
+        }
+    }
+
     for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
     {
         Child & child = *iter.GetChild();
@@ -2593,11 +2878,46 @@ void MleRouter::SynchronizeChildNetworkData(void)
             continue;
         }
 
-        SuccessOrExit(SendChildUpdateRequest(child));
+        // A queued Child Update Request carries the current Network Data (see `RemoveOutdatedChildUpdates()`).
+        if (child.IsChildUpdateRequestQueued())
+        {
+            continue;
+        }
+
+        if (outstanding >= kMaxOutstandingChildUpdates)
+        {
+            OT_COUNTER_INCREMENT(GetInstance(), kChildUpdatesDeferred);
+            deferred = true;
+            continue;
+        }
+
+        if (SendChildUpdateRequest(child) != OT_ERROR_NONE)
+        {
+            deferred = true;
+            ExitNow();
+        }
+
+        outstanding++;
+        OT_COUNTER_INCREMENT(GetInstance(), kChildUpdatesSent);
     }
 
+    OT_COUNTER_UPDATE_HIGH_WATER_MARK(GetInstance(), kChildUpdatesQueued, outstanding);
+
 exit:
-    return;
+    return deferred;
+}
+
+void MleRouter::RemoveOutdatedChildUpdates(void)
+{
+    for (ChildTable::Iterator iter(GetInstance(), ChildTable::kInStateValid); !iter.IsDone(); iter++)
+    {
+        Child &child = *iter.GetChild();
+
+        if (child.IsChildUpdateRequestQueued())
+        {
+            Get<MeshForwarder>().RemoveMessages(child, Message::kSubTypeMleChildUpdateRequest);
+        }
+    }
 }
 
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
@@ -2840,7 +3160,7 @@ otError MleRouter::SendChildIdResponse(Child &aChild)
         } while (mChildTable.FindChild(rloc16, ChildTable::kInStateAnyExceptInvalid) != NULL);
 
         // allocate Child ID
-        aChild.SetRloc16(rloc16);
+        mChildTable.SetChildRloc16(aChild, rloc16);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild.GetRloc16()));
@@ -2875,6 +3195,13 @@ otError MleRouter::SendChildIdResponse(Child &aChild)
         SuccessOrExit(error = AppendChildAddresses(*message, aChild));
     }
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    if (aChild.GetFrameBurstLimit() > 0)
+    {
+        SuccessOrExit(error = AppendFrameBurst(*message, aChild.GetFrameBurstLimit()));
+    }
+#endif
+
     SetChildStateToValid(aChild);
 
     if (!aChild.IsRxOnWhenIdle())
@@ -3031,6 +3358,12 @@ void MleRouter::SendChildUpdateResponse(Child *                 aChild,
         case Tlv::kLinkFrameCounter:
             SuccessOrExit(error = AppendLinkFrameCounter(*message));
             break;
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+        case Tlv::kFrameBurst:
+            SuccessOrExit(error = AppendFrameBurst(*message, aChild->GetFrameBurstLimit()));
+            break;
+#endif
         }
     }
 
@@ -3534,9 +3867,9 @@ void MleRouter::RestoreChildren(void)
 
         memset(child, 0, sizeof(*child));
 
-        child->SetExtAddress(*static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
+        mChildTable.SetChildExtAddress(*child, *static_cast<const Mac::ExtAddress *>(&childInfo.mExtAddress));
         child->GetLinkInfo().Clear();
-        child->SetRloc16(childInfo.mRloc16);
+        mChildTable.SetChildRloc16(*child, childInfo.mRloc16);
         child->SetTimeout(childInfo.mTimeout);
         child->SetDeviceMode(DeviceMode(childInfo.mMode));
         child->SetState(Neighbor::kStateRestored);
@@ -3559,6 +3892,201 @@ exit:
     }
 }
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
+void MleRouter::RestoreRouterTable(void)
+{
+    Settings::RouterTableInfo routerTableInfo;
+
+    mRouterTableRestorePending = false;
+
+    SuccessOrExit(Get<Settings>().ReadRouterTableInfo(routerTableInfo));
+
+    // An unchanged snapshot is not written again after the reset.
+    mRouterTableInfoCrc = ComputeSnapshotCrc(&routerTableInfo, sizeof(routerTableInfo));
+
+    VerifyOrExit(routerTableInfo.mPartitionId == mPreviousPartitionId);
+    VerifyOrExit(routerTableInfo.mKeySequence == Get<KeyManager>().GetCurrentKeySequence());
+
+    mRouterTableRestorePending = true;
+
+exit:
+    return;
+}
+
+uint16_t MleRouter::ComputeSnapshotCrc(const void *aValue, uint16_t aLength)
+{
+    Crc16          crc(Crc16::kCcitt);
+    const uint8_t *bytes = static_cast<const uint8_t *>(aValue);
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        crc.Update(bytes[i]);
+    }
+
+    return crc.Get();
+}
+
+void MleRouter::StoreRouterTable(void)
+{
+    // The routes and the EID-to-RLOC cache are saved with different keys, each one only when its content changed.
+    StoreRoutes();
+    StoreAddressCache();
+}
+
+void MleRouter::StoreRoutes(void)
+{
+    Settings::RouterTableInfo routerTableInfo;
+    uint16_t                  crc;
+
+    memset(&routerTableInfo, 0, sizeof(routerTableInfo));
+    routerTableInfo.mPartitionId = mLeaderData.GetPartitionId();
+    routerTableInfo.mKeySequence = Get<KeyManager>().GetCurrentKeySequence();
+
+    for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++)
+    {
+        Router &                          router = *iter.GetRouter();
+        Settings::RouterTableInfo::Route &route  = routerTableInfo.mRoutes[routerTableInfo.mNumRoutes++];
+
+        route.mRouterId = router.GetRouterId();
+        route.mNextHop  = router.GetNextHop();
+        route.mCost     = router.GetCost();
+
+        if (router.GetRloc16() != GetRloc16() && router.GetState() == Neighbor::kStateValid)
+        {
+            route.mLinkQuality =
+                static_cast<uint8_t>((router.GetLinkQualityOut() << 2) | router.GetLinkInfo().GetLinkQuality());
+        }
+    }
+
+    crc = ComputeSnapshotCrc(&routerTableInfo, sizeof(routerTableInfo));
+    VerifyOrExit(crc != mRouterTableInfoCrc);
+
+    SuccessOrExit(Get<Settings>().SaveRouterTableInfo(routerTableInfo));
+    mRouterTableInfoCrc = crc;
+
+exit:
+    return;
+}
+
+void MleRouter::StoreAddressCache(void)
+{
+    Settings::AddressCacheInfo addressCacheInfo;
+    otEidCacheEntry            entry;
+    uint16_t                   crc;
+
+    memset(&addressCacheInfo, 0, sizeof(addressCacheInfo));
+    addressCacheInfo.mPartitionId = mLeaderData.GetPartitionId();
+
+    // Cache entries are ordered by age so that restoring them keeps the least recently used entry first to evict.
+    for (uint8_t age = 0; age < OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES &&
+                          addressCacheInfo.mNumEntries < Settings::AddressCacheInfo::kMaxEntries;
+         age++)
+    {
+        for (uint8_t index = 0; Get<AddressResolver>().GetEntry(index, entry) == OT_ERROR_NONE; index++)
+        {
+            if (entry.mValid && entry.mAge == age)
+            {
+                Settings::AddressCacheInfo::Entry &cacheEntry =
+                    addressCacheInfo.mEntries[addressCacheInfo.mNumEntries++];
+
+                cacheEntry.mTarget = *static_cast<Ip6::Address *>(&entry.mTarget);
+                cacheEntry.mRloc16 = entry.mRloc16;
+                break;
+            }
+        }
+    }
+
+    crc = ComputeSnapshotCrc(&addressCacheInfo, sizeof(addressCacheInfo));
+    VerifyOrExit(crc != mAddressCacheInfoCrc);
+
+    SuccessOrExit(Get<Settings>().SaveAddressCacheInfo(addressCacheInfo));
+    mAddressCacheInfoCrc = crc;
+
+exit:
+    return;
+}
+
+void MleRouter::ApplyRouterTableSnapshot(void)
+{
+    VerifyOrExit(mRouterTableRestorePending);
+    mRouterTableRestorePending = false;
+
+    // The two values are read one after the other, so that only one of them is on the stack.
+    SuccessOrExit(ApplyRoutesSnapshot());
+    ApplyAddressCacheSnapshot();
+
+exit:
+    return;
+}
+
+otError MleRouter::ApplyRoutesSnapshot(void)
+{
+    Settings::RouterTableInfo routerTableInfo;
+    uint8_t                   numRoutes = 0;
+    otError                   error;
+
+    // The router IDs of the snapshot are only meaningful in the same partition, and only routes to and through router
+    // IDs that are still allocated are restored.
+    SuccessOrExit(error = Get<Settings>().ReadRouterTableInfo(routerTableInfo));
+    VerifyOrExit(routerTableInfo.mPartitionId == mLeaderData.GetPartitionId(), error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(routerTableInfo.mKeySequence == Get<KeyManager>().GetCurrentKeySequence(), error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(routerTableInfo.mNumRoutes <= kMaxRouters, error = OT_ERROR_PARSE);
+
+    for (uint8_t i = 0; i < routerTableInfo.mNumRoutes; i++)
+    {
+        const Settings::RouterTableInfo::Route &route  = routerTableInfo.mRoutes[i];
+        Router *                                router = mRouterTable.GetRouter(route.mRouterId);
+
+        if (router == NULL || route.mRouterId == mRouterId)
+        {
+            continue;
+        }
+
+        if (mRouterTable.GetRouter(route.mNextHop) != NULL)
+        {
+            router->SetNextHop(route.mNextHop);
+            router->SetCost(route.mCost);
+            numRoutes++;
+        }
+
+        // Used as the link quality out when the Link Accept does not include a Link Margin TLV.
+        router->SetLinkQualityOut(route.mLinkQuality >> 2);
+    }
+
+    otLogNoteMle("Restored router table snapshot, routes:%d", numRoutes);
+
+exit:
+    return error;
+}
+
+void MleRouter::ApplyAddressCacheSnapshot(void)
+{
+    Settings::AddressCacheInfo addressCacheInfo;
+
+    SuccessOrExit(Get<Settings>().ReadAddressCacheInfo(addressCacheInfo));
+    VerifyOrExit(addressCacheInfo.mPartitionId == mLeaderData.GetPartitionId());
+    VerifyOrExit(addressCacheInfo.mNumEntries <= Settings::AddressCacheInfo::kMaxEntries);
+
+    // Restored in reverse order so that the most recently used entry is restored last.
+    for (uint8_t numEntries = addressCacheInfo.mNumEntries; numEntries > 0; numEntries--)
+    {
+        const Settings::AddressCacheInfo::Entry &cacheEntry = addressCacheInfo.mEntries[numEntries - 1];
+
+        if (mRouterTable.IsAllocated(GetRouterId(cacheEntry.mRloc16)))
+        {
+            Get<AddressResolver>().AddCacheEntry(cacheEntry.mTarget, cacheEntry.mRloc16);
+        }
+    }
+
+    otLogNoteMle("Restored EID-to-RLOC cache snapshot, entries:%d", addressCacheInfo.mNumEntries);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+
 otError MleRouter::RemoveStoredChild(uint16_t aChildRloc16)
 {
     otError error = OT_ERROR_NOT_FOUND;
@@ -4426,14 +4954,61 @@ void MleRouter::FillRouteTlv(RouteTlv &aTlv)
     aTlv.SetRouteDataLength(routerCount);
 }
 
-otError MleRouter::AppendRoute(Message &aMessage)
+bool MleRouter::UpdateRouteTlvInputs(void)
 {
-    RouteTlv tlv;
+    bool    changed     = !mRouteTlvValid || mRouteTlvRloc16 != GetRloc16();
+    uint8_t routerCount = 0;
 
-    tlv.Init();
-    FillRouteTlv(tlv);
+    if (mRouteTlv.GetRouterIdSequence() != mRouterTable.GetRouterIdSequence())
+    {
+        changed = true;
+    }
 
-    return aMessage.AppendTlv(tlv);
+    for (RouterTable::Iterator iter(GetInstance()); !iter.IsDone(); iter++, routerCount++)
+    {
+        Router &      router = *iter.GetRouter();
+        RouteTlvInput input;
+
+        input.mRouterId    = router.GetRouterId();
+        input.mNextHop     = router.GetNextHop();
+        input.mCost        = router.GetCost();
+        input.mLinkQuality = static_cast<uint8_t>((router.GetState() == Neighbor::kStateValid) << 4 |
+                                                  router.GetLinkQualityOut() << 2 |
+                                                  router.GetLinkInfo().GetLinkQuality());
+
+        if (changed || memcmp(&input, &mRouteTlvInputs[routerCount], sizeof(input)) != 0)
+        {
+            mRouteTlvInputs[routerCount] = input;
+            changed                      = true;
+        }
+    }
+
+    return changed || routerCount != mRouteTlv.GetRouteDataLength();
+}
+
+const RouteTlv &MleRouter::GetRouteTlv(void)
+{
+    // The route data of a router is filled from its own entry and from the entry of its next hop, so comparing the
+    // entries of all routers with the ones the Route TLV was filled from tells whether it must be filled again.
+    if (UpdateRouteTlvInputs())
+    {
+        mRouteTlv.Init();
+        FillRouteTlv(mRouteTlv);
+        mRouteTlvRloc16 = GetRloc16();
+        mRouteTlvValid  = true;
+        OT_COUNTER_INCREMENT(GetInstance(), kRouteTlvRebuilds);
+    }
+    else
+    {
+        OT_COUNTER_INCREMENT(GetInstance(), kRouteTlvReuses);
+    }
+
+    return mRouteTlv;
+}
+
+otError MleRouter::AppendRoute(Message &aMessage)
+{
+    return aMessage.AppendTlv(GetRouteTlv());
 }
 
 otError MleRouter::AppendActiveDataset(Message &aMessage)
@@ -4552,6 +5127,7 @@ void MleRouter::SetChildStateToValid(Child &aChild)
     VerifyOrExit(aChild.GetState() != Neighbor::kStateValid);
 
     aChild.SetState(Neighbor::kStateValid);
+    ScheduleChildTimeout(aChild);
     StoreChild(aChild);
     Signal(OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED, aChild);
 
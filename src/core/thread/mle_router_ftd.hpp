@@ -228,7 +228,7 @@ public:
      * @param[in]  aTimeout  The NETWORK_ID_TIMEOUT value.
      *
      */
-    void SetNetworkIdTimeout(uint8_t aTimeout) { mNetworkIdTimeout = aTimeout; }
+    void SetNetworkIdTimeout(uint8_t aTimeout);
 
     /**
      * This method returns the route cost to a RLOC16.
@@ -282,7 +282,7 @@ public:
      * @returns The current router selection jitter timeout value.
      *
      */
-    uint8_t GetRouterSelectionJitterTimeout(void) const { return mRouterSelectionJitterTimeout; }
+    uint8_t GetRouterSelectionJitterTimeout(void) const;
 
     /**
      * This method returns the ROUTER_UPGRADE_THRESHOLD value.
@@ -330,6 +330,17 @@ public:
      */
     void RestoreChildren(void);
 
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    /**
+     * This method restores the router table snapshot from non-volatile memory.
+     *
+     * The snapshot is only kept if it was taken in the previous partition with the current key sequence. It is applied
+     * when the device re-attaches to that partition as a router.
+     *
+     */
+    void RestoreRouterTable(void);
+#endif
+
     /**
      * This method remove a stored child information from non-volatile memory.
      *
@@ -528,6 +539,17 @@ public:
      */
     void FillRouteTlv(RouteTlv &aTlv);
 
+    /**
+     * This method returns the Route TLV of this router.
+     *
+     * The Route TLV is cached and filled again only if the router table, a route or the link quality of a neighbor
+     * router changed since it was last filled.
+     *
+     * @returns A reference to the Route TLV.
+     *
+     */
+    const RouteTlv &GetRouteTlv(void);
+
     /**
      * This method generates an MLE Child Update Request message to be sent to the parent.
      *
@@ -662,6 +684,48 @@ private:
         kDiscoveryMaxJitter = 250u,  ///< Maximum jitter time used to delay Discovery Responses in milliseconds.
         kStateUpdatePeriod  = 1000u, ///< State update period in milliseconds.
         kUnsolicitedDataResponseJitter = 500u, ///< Maximum delay before unsolicited Data Response in milliseconds.
+        kMaxOutstandingChildUpdates    = OPENTHREAD_CONFIG_MLE_MAX_OUTSTANDING_CHILD_UPDATES,
+        kRouterTableSnapshotInterval   = OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL, ///< In seconds.
+    };
+
+    /**
+     * This class implements a countdown that expires at a deadline. It is checked when the state update timer fires,
+     * which is scheduled for the earliest pending deadline.
+     *
+     */
+    class Countdown
+    {
+    public:
+        Countdown(void)
+            : mFireTime(0)
+            , mStarted(false)
+        {
+        }
+
+        void Start(uint32_t aDelay)
+        {
+            mFireTime = TimerMilli::GetNow() + aDelay;
+            mStarted  = true;
+        }
+
+        void     Stop(void) { mStarted = false; }
+        bool     IsRunning(void) const { return GetRemaining() > 0; }
+        uint32_t GetRemaining(void) const;
+
+        /**
+         * This method stops the countdown if it has expired, otherwise lowers @p aNextDelay to its remaining time.
+         *
+         * @param[inout]  aNextDelay  The delay in milliseconds until the next state update.
+         *
+         * @retval TRUE   The countdown has expired.
+         * @retval FALSE  The countdown has not expired or was not started.
+         *
+         */
+        bool Update(uint32_t &aNextDelay);
+
+    private:
+        uint32_t mFireTime;
+        bool     mStarted;
     };
 
     otError AppendConnectivity(Message &aMessage);
@@ -728,9 +792,20 @@ private:
     void    SetStateRouter(uint16_t aRloc16);
     void    SetStateLeader(uint16_t aRloc16);
     void    StopLeader(void);
-    void    SynchronizeChildNetworkData(void);
+    bool    SynchronizeChildNetworkData(void);
+    void    RemoveOutdatedChildUpdates(void);
     otError UpdateChildAddresses(const Message &aMessage, uint16_t aOffset, Child &aChild);
     void    UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId);
+    bool    UpdateRouteTlvInputs(void);
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    void            StoreRouterTable(void);
+    void            StoreRoutes(void);
+    void            StoreAddressCache(void);
+    void            ApplyRouterTableSnapshot(void);
+    otError         ApplyRoutesSnapshot(void);
+    void            ApplyAddressCacheSnapshot(void);
+    static uint16_t ComputeSnapshotCrc(const void *aValue, uint16_t aLength);
+#endif
 
     static void HandleAddressSolicitResponse(void *               aContext,
                                              otMessage *          aMessage,
@@ -747,6 +822,10 @@ private:
     void HandlePartitionChange(void);
 
     void SetChildStateToValid(Child &aChild);
+    void StartStateUpdateTimer(void);
+    void ScheduleStateUpdate(uint32_t aStartTime, uint32_t aDelay);
+    void ScheduleChildTimeout(const Child &aChild);
+    void StartCountdown(Countdown &aCountdown, uint32_t aDelay);
     bool HasChildren(void);
     void RemoveChildren(void);
     bool HasMinDowngradeNeighborRouters(void);
@@ -757,6 +836,8 @@ private:
     bool        HandleAdvertiseTimer(void);
     static void HandleStateUpdateTimer(Timer &aTimer);
     void        HandleStateUpdateTimer(void);
+    void        UpdateChildTimeouts(uint32_t &aNextDelay);
+    void        UpdateRouterTimeouts(uint32_t &aNextDelay);
 
     TrickleTimer mAdvertiseTimer;
     TimerMilli   mStateUpdateTimer;
@@ -769,30 +850,53 @@ private:
 
     otNeighborTableCallback mNeighborTableChangedCallback;
 
-    uint8_t  mChallengeTimeout;
-    uint8_t  mChallenge[8];
-    uint16_t mNextChildId;
-    uint8_t  mNetworkIdTimeout;
-    uint8_t  mRouterUpgradeThreshold;
-    uint8_t  mRouterDowngradeThreshold;
-    uint8_t  mLeaderWeight;
-    uint32_t mFixedLeaderPartitionId; ///< only for certification testing
-    bool     mRouterRoleEnabled : 1;
-    bool     mAddressSolicitPending : 1;
+    Countdown mChallengeTimeout;
+    uint8_t   mChallenge[8];
+    uint16_t  mNextChildId;
+    uint8_t   mNetworkIdTimeout;
+    uint8_t   mRouterUpgradeThreshold;
+    uint8_t   mRouterDowngradeThreshold;
+    uint8_t   mLeaderWeight;
+    uint32_t  mFixedLeaderPartitionId; ///< only for certification testing
+    bool      mRouterRoleEnabled : 1;
+    bool      mAddressSolicitPending : 1;
+    bool      mRouteTlvValid : 1;
+#if OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+    bool      mRouterTableRestorePending : 1;
+    Countdown mRouterTableSnapshotTimeout; ///< Time until the next router table snapshot.
+    uint16_t  mRouterTableInfoCrc;         ///< CRC of the last saved `RouterTableInfo`.
+    uint16_t  mAddressCacheInfoCrc;        ///< CRC of the last saved `AddressCacheInfo`.
+#endif
 
     uint8_t mRouterId;
     uint8_t mPreviousRouterId;
 
-    uint32_t mPreviousPartitionIdRouter;         ///< The partition ID when last operating as a router
-    uint32_t mPreviousPartitionId;               ///< The partition ID when last attached
-    uint8_t  mPreviousPartitionRouterIdSequence; ///< The router ID sequence when last attached
-    uint8_t  mPreviousPartitionIdTimeout;        ///< The partition ID timeout when last attached
+    uint32_t  mPreviousPartitionIdRouter;         ///< The partition ID when last operating as a router
+    uint32_t  mPreviousPartitionId;               ///< The partition ID when last attached
+    uint8_t   mPreviousPartitionRouterIdSequence; ///< The router ID sequence when last attached
+    Countdown mPreviousPartitionIdTimeout;        ///< The partition ID timeout when last attached
 
-    uint8_t mRouterSelectionJitter;        ///< The variable to save the assigned jitter value.
-    uint8_t mRouterSelectionJitterTimeout; ///< The Timeout prior to request/release Router ID.
+    uint8_t   mRouterSelectionJitter;        ///< The variable to save the assigned jitter value.
+    Countdown mRouterSelectionJitterTimeout; ///< The Timeout prior to request/release Router ID.
 
     int8_t mParentPriority; ///< The assigned parent priority value, -2 means not assigned.
 
+    /**
+     * The values of a router table entry that its route data in the Route TLV is filled from.
+     *
+     */
+    struct RouteTlvInput
+    {
+        uint8_t mRouterId;
+        uint8_t mNextHop;
+        uint8_t mCost;
+        uint8_t mLinkQuality; ///< Link quality in and out, and whether the link is valid.
+    };
+
+    RouteTlv      mRouteTlv;                    ///< The cached Route TLV.
+    RouteTlvInput mRouteTlvInputs[kMaxRouters]; ///< The router table entries the cached Route TLV was filled from.
+    uint16_t      mRouteTlvRloc16;              ///< The RLOC16 the cached Route TLV was filled with.
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     MeshCoP::SteeringDataTlv mSteeringData;
 #endif // OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
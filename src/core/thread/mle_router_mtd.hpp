@@ -86,6 +86,7 @@ public:
     bool IsMinimalChild(uint16_t) const { return false; }
 
     void    RestoreChildren(void) {}
+    void    RestoreRouterTable(void) {}
     otError RemoveStoredChild(uint16_t) { return OT_ERROR_NOT_IMPLEMENTED; }
     otError StoreChild(const Child &) { return OT_ERROR_NOT_IMPLEMENTED; }
 
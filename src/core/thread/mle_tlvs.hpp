@@ -109,6 +109,12 @@ public:
         kPendingDataset      = 25, ///< Pending Operational Dataset TLV
         kDiscovery           = 26, ///< Thread Discovery TLV
 
+        /**
+         * Applicable/Required only when frame burst (`OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE`) is enabled.
+         *
+         */
+        kFrameBurst = 251, ///< Frame Burst TLV
+
         /**
          * Applicable/Required only when time synchronization service
          * (`OPENTHREAD_CONFIG_TIME_SYNC_ENABLE`) is enabled.
@@ -2000,6 +2006,55 @@ private:
 } OT_TOOL_PACKED_END;
 #endif // OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
 
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+/**
+ * This class implements Frame Burst TLV generation and parsing.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class FrameBurstTlv : public Tlv
+{
+public:
+    /**
+     * This method initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kFrameBurst);
+        SetLength(sizeof(*this) - sizeof(Tlv));
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(Tlv); }
+
+    /**
+     * This method returns the maximum number of frames per data poll.
+     *
+     * @returns The maximum number of frames per data poll.
+     *
+     */
+    uint8_t GetMaxFrames(void) const { return mMaxFrames; }
+
+    /**
+     * This method sets the maximum number of frames per data poll.
+     *
+     * @param[in]  aMaxFrames  The maximum number of frames per data poll.
+     *
+     */
+    void SetMaxFrames(uint8_t aMaxFrames) { mMaxFrames = aMaxFrames; }
+
+private:
+    uint8_t mMaxFrames;
+} OT_TOOL_PACKED_END;
+#endif // OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+
 /**
  * This class implements Active Timestamp TLV generation and parsing.
  *
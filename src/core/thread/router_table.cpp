@@ -61,6 +61,7 @@ void RouterTable::Iterator::Advance(void)
 
 RouterTable::RouterTable(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mRouterIdReuseDelayUpdated(0)
     , mRouterIdSequenceLastUpdated(0)
     , mRouterIdSequence(Random::NonCrypto::GetUint8())
     , mActiveRouterCount(0)
@@ -92,6 +93,7 @@ void RouterTable::Clear(void)
 {
     mAllocatedRouterIds.Clear();
     memset(mRouterIdReuseDelay, 0, sizeof(mRouterIdReuseDelay));
+    mRouterIdReuseDelayUpdated = TimerMilli::GetNow();
     UpdateAllocation();
 }
 
@@ -205,6 +207,8 @@ Router *RouterTable::Allocate(void)
     uint8_t numAvailable = 0;
     uint8_t freeBit;
 
+    UpdateRouterIdReuseDelays();
+
     // count available router ids
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
     {
@@ -245,6 +249,8 @@ Router *RouterTable::Allocate(uint8_t aRouterId)
 {
     Router *rval = NULL;
 
+    UpdateRouterIdReuseDelays();
+
     VerifyOrExit(aRouterId <= Mle::kMaxRouterId && mActiveRouterCount < Mle::kMaxRouters && !IsAllocated(aRouterId) &&
                  mRouterIdReuseDelay[aRouterId] == 0);
 
@@ -277,6 +283,8 @@ otError RouterTable::Release(uint8_t aRouterId)
     mAllocatedRouterIds.Remove(aRouterId);
     UpdateAllocation();
 
+    // The delay is aged by `HandleStateUpdate()`, the leader's state update is restarted by `ResetAdvertiseInterval()`.
+    UpdateRouterIdReuseDelays();
     mRouterIdReuseDelay[aRouterId] = Mle::kRouterIdReuseDelay;
 
     for (Router *router = GetFirstEntry(); router != NULL; router = GetNextEntry(router))
@@ -565,27 +573,72 @@ void RouterTable::ProcessTlv(const ThreadRouterMaskTlv &aTlv)
     }
 }
 
-void RouterTable::ProcessTimerTick(void)
+void RouterTable::UpdateRouterIdReuseDelays(void)
+{
+    uint32_t elapsed = TimerMilli::MsecToSec(TimerMilli::Elapsed(mRouterIdReuseDelayUpdated));
+
+    // The delays count whole seconds, the remainder is carried over to the next update.
+    mRouterIdReuseDelayUpdated += TimerMilli::SecToMsec(elapsed);
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        if (mRouterIdReuseDelay[routerId] > elapsed)
+        {
+            mRouterIdReuseDelay[routerId] -= static_cast<uint8_t>(elapsed);
+        }
+        else
+        {
+            mRouterIdReuseDelay[routerId] = 0;
+        }
+    }
+}
+
+void RouterTable::HandleStateUpdate(uint32_t &aNextDelay)
 {
-    Mle::MleRouter &mle = Get<Mle::MleRouter>();
+    uint32_t period     = TimerMilli::SecToMsec(Mle::kRouterIdSequencePeriod);
+    uint8_t  reuseDelay = 0;
+    uint32_t elapsed;
+    uint32_t delay;
+
+    VerifyOrExit(Get<Mle::MleRouter>().GetRole() == OT_DEVICE_ROLE_LEADER);
 
-    if (mle.GetRole() == OT_DEVICE_ROLE_LEADER)
+    // update router id sequence
+    elapsed = TimerMilli::Elapsed(mRouterIdSequenceLastUpdated);
+
+    if (elapsed >= period)
+    {
+        mRouterIdSequence++;
+        mRouterIdSequenceLastUpdated = TimerMilli::GetNow();
+        elapsed                      = 0;
+    }
+
+    if (period - elapsed < aNextDelay)
+    {
+        aNextDelay = period - elapsed;
+    }
+
+    UpdateRouterIdReuseDelays();
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
     {
-        // update router id sequence
-        if (GetLeaderAge() >= Mle::kRouterIdSequencePeriod)
+        if (mRouterIdReuseDelay[routerId] > 0 && (reuseDelay == 0 || mRouterIdReuseDelay[routerId] < reuseDelay))
         {
-            mRouterIdSequence++;
-            mRouterIdSequenceLastUpdated = TimerMilli::GetNow();
+            reuseDelay = mRouterIdReuseDelay[routerId];
         }
+    }
+
+    if (reuseDelay > 0)
+    {
+        delay = TimerMilli::SecToMsec(reuseDelay) - TimerMilli::Elapsed(mRouterIdReuseDelayUpdated);
 
-        for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+        if (delay < aNextDelay)
         {
-            if (mRouterIdReuseDelay[routerId] > 0)
-            {
-                mRouterIdReuseDelay[routerId]--;
-            }
+            aNextDelay = delay;
         }
     }
+
+exit:
+    return;
 }
 
 } // namespace ot
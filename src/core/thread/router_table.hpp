@@ -326,10 +326,13 @@ public:
     void ProcessTlv(const ThreadRouterMaskTlv &aTlv);
 
     /**
-     * This method updates the router table and must be called with a one second period.
+     * This method updates the Router ID Sequence and the Router ID reuse delays when the MLE state update timer fires.
+     *
+     * @param[inout]  aNextDelay  The delay in milliseconds until the next state update, lowered to the time until the
+     *                            router table needs to be updated again.
      *
      */
-    void ProcessTimerTick(void);
+    void HandleStateUpdate(uint32_t &aNextDelay);
 
 private:
     class RouterIdSet
@@ -345,6 +348,7 @@ private:
     };
 
     void          UpdateAllocation(void);
+    void          UpdateRouterIdReuseDelays(void);
     const Router *GetFirstEntry(void) const;
     const Router *GetNextEntry(const Router *aRouter) const;
     Router *GetFirstEntry(void) { return const_cast<Router *>(const_cast<const RouterTable *>(this)->GetFirstEntry()); }
@@ -355,7 +359,8 @@ private:
 
     Router      mRouters[Mle::kMaxRouters];
     RouterIdSet mAllocatedRouterIds;
-    uint8_t     mRouterIdReuseDelay[Mle::kMaxRouterId + 1];
+    uint8_t     mRouterIdReuseDelay[Mle::kMaxRouterId + 1]; ///< In seconds, from `mRouterIdReuseDelayUpdated`.
+    uint32_t    mRouterIdReuseDelayUpdated;
     uint32_t    mRouterIdSequenceLastUpdated;
     uint8_t     mRouterIdSequence;
     uint8_t     mActiveRouterCount;
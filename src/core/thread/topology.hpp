@@ -377,6 +377,8 @@ private:
  */
 class Child : public Neighbor, public IndirectSender::ChildInfo, public DataPollHandler::ChildInfo
 {
+    friend class ChildTable;
+
 public:
     enum
     {
@@ -627,6 +629,10 @@ private:
         kNumIp6Addresses = OPENTHREAD_CONFIG_MLE_IP_ADDRS_PER_CHILD - 1,
     };
 
+    // The RLOC16 and the extended address of a child are set through `ChildTable`, which keeps its lookup index.
+    using Neighbor::SetExtAddress;
+    using Neighbor::SetRloc16;
+
     uint8_t      mNetworkDataVersion;                                   ///< Current Network Data version
     uint8_t      mMeshLocalIid[Ip6::Address::kInterfaceIdentifierSize]; ///< IPv6 address IID for mesh-local address
     Ip6::Address mIp6Address[kNumIp6Addresses];                         ///< Registered IPv6 addresses
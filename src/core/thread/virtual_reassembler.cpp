@@ -0,0 +1,247 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements forwarding 6LoWPAN fragments to minimal children without reassembly.
+ */
+
+#include "virtual_reassembler.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/locator-getters.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/mle_router.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+
+namespace ot {
+
+VirtualReassembler::VirtualReassembler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+{
+    Clear();
+}
+
+void VirtualReassembler::Clear(void)
+{
+    memset(mEntries, 0, sizeof(mEntries));
+}
+
+otError VirtualReassembler::ForwardFrame(uint8_t *               aFrame,
+                                         uint16_t                aFrameLength,
+                                         const Mac::Address &    aMacSource,
+                                         const otThreadLinkInfo &aLinkInfo)
+{
+    MeshForwarder &        meshForwarder = Get<MeshForwarder>();
+    otError                error         = OT_ERROR_NONE;
+    Message *              message       = NULL;
+    Entry *                entry         = NULL;
+    bool                   isFragment    = false;
+    uint8_t                priority      = MeshForwarder::kDefaultMsgPriority;
+    Lowpan::MeshHeader     meshHeader;
+    Lowpan::FragmentHeader fragmentHeader;
+    Mac::Address           meshSource;
+    Mac::Address           meshDest;
+    Neighbor *             child;
+    uint8_t *              payload;
+    uint16_t               payloadLength;
+
+    SuccessOrExit(error = meshHeader.Init(aFrame, aFrameLength));
+    meshSource.SetShort(meshHeader.GetSource());
+    meshDest.SetShort(meshHeader.GetDestination());
+
+    payload       = aFrame + meshHeader.GetHeaderLength();
+    payloadLength = aFrameLength - meshHeader.GetHeaderLength();
+
+    VerifyOrExit(payloadLength >= sizeof(uint16_t), error = OT_ERROR_PARSE);
+
+    if (reinterpret_cast<Lowpan::FragmentHeader *>(payload)->IsFragmentHeader())
+    {
+        SuccessOrExit(error = fragmentHeader.Init(payload, payloadLength));
+        isFragment = true;
+        payload += fragmentHeader.GetHeaderLength();
+        payloadLength -= fragmentHeader.GetHeaderLength();
+    }
+
+    if (isFragment && fragmentHeader.GetDatagramOffset() > 0)
+    {
+        // Subsequent fragments follow the decision taken for the first one.
+        entry = FindEntry(fragmentHeader.GetDatagramTag(), meshSource.GetShort());
+        VerifyOrExit(entry != NULL, error = OT_ERROR_NOT_CAPABLE);
+
+        priority = entry->mPriority;
+
+        if (fragmentHeader.GetDatagramOffset() + payloadLength >= fragmentHeader.GetDatagramSize())
+        {
+            entry->mLifetime = 0;
+        }
+        else
+        {
+            entry->mLifetime = kReassemblyTimeout;
+        }
+    }
+    else
+    {
+        VerifyOrExit(payloadLength >= sizeof(uint16_t) && Lowpan::Lowpan::IsLowpanHc(payload),
+                     error = OT_ERROR_NOT_CAPABLE);
+
+        // Sleepy children only reassemble one datagram at a time, which
+        // the indirect sender guarantees for reassembled datagrams only.
+        child = Get<Mle::MleRouter>().GetNeighbor(meshDest.GetShort());
+        VerifyOrExit(child != NULL && child->IsRxOnWhenIdle(), error = OT_ERROR_NOT_CAPABLE);
+
+        // Without the mesh header, the child would derive an elided source
+        // address from our MAC address instead of the mesh originator's.
+        VerifyOrExit(!Lowpan::Lowpan::IsSourceAddressElided(payload), error = OT_ERROR_NOT_CAPABLE);
+
+        SuccessOrExit(error = meshForwarder.GetFramePriority(payload, payloadLength, meshSource, meshDest, priority));
+
+        if (isFragment)
+        {
+            VerifyOrExit((entry = GetUnusedEntry()) != NULL, error = OT_ERROR_NOT_CAPABLE);
+
+            // Avoid using datagram tag value 0, which indicates the tag has not been set
+            if (meshForwarder.mFragTag == 0)
+            {
+                meshForwarder.mFragTag++;
+            }
+
+            entry->mSrcRloc16   = meshSource.GetShort();
+            entry->mDatagramTag = fragmentHeader.GetDatagramTag();
+            entry->mForwardTag  = meshForwarder.mFragTag++;
+            entry->mPriority    = priority;
+            entry->mLifetime    = kReassemblyTimeout;
+
+            if (!meshForwarder.mUpdateTimer.IsRunning())
+            {
+                meshForwarder.mUpdateTimer.Start(MeshForwarder::kStateUpdatePeriod);
+            }
+        }
+
+        // The hop limit is rewritten in place, so it is left to full
+        // reassembly when it is compressed or when it expires here.
+        SuccessOrExit(error = Lowpan::Lowpan::DecrementHopLimit(payload, payloadLength));
+    }
+
+    if (entry != NULL)
+    {
+        reinterpret_cast<Lowpan::FragmentHeader *>(aFrame + meshHeader.GetHeaderLength())
+            ->SetDatagramTag(entry->mForwardTag);
+    }
+
+    VerifyOrExit((message = Get<MessagePool>().New(Message::kType6lowpan, priority)) != NULL,
+                 error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = message->SetLength(aFrameLength));
+    message->Write(0, aFrameLength, aFrame);
+    message->SetLinkSecurityEnabled(aLinkInfo.mLinkSecurity);
+    message->SetPanId(aLinkInfo.mPanId);
+    message->AddRss(aLinkInfo.mRss);
+
+    meshForwarder.LogMessage(MeshForwarder::kMessageReceive, *message, &aMacSource, OT_ERROR_NONE);
+
+    meshForwarder.SendMessage(*message);
+
+exit:
+
+    if (error != OT_ERROR_NONE)
+    {
+        // Once a fragment is lost, the remaining ones are dropped as well.
+        if (entry != NULL)
+        {
+            entry->mLifetime = 0;
+        }
+
+        if (message != NULL)
+        {
+            message->Free();
+        }
+    }
+
+    return error;
+}
+
+bool VirtualReassembler::UpdateLifetime(void)
+{
+    bool shouldRun = false;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mEntries); i++)
+    {
+        if (mEntries[i].mLifetime != 0)
+        {
+            mEntries[i].mLifetime--;
+
+            if (mEntries[i].mLifetime != 0)
+            {
+                shouldRun = true;
+            }
+        }
+    }
+
+    return shouldRun;
+}
+
+VirtualReassembler::Entry *VirtualReassembler::FindEntry(uint16_t aTag, uint16_t aSrcRloc16)
+{
+    Entry *rval = NULL;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mEntries); i++)
+    {
+        Entry &entry = mEntries[i];
+
+        if ((entry.mLifetime != 0) && (entry.mDatagramTag == aTag) && (entry.mSrcRloc16 == aSrcRloc16))
+        {
+            ExitNow(rval = &entry);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+VirtualReassembler::Entry *VirtualReassembler::GetUnusedEntry(void)
+{
+    Entry *rval = NULL;
+
+    for (size_t i = 0; i < OT_ARRAY_LENGTH(mEntries); i++)
+    {
+        if (mEntries[i].mLifetime == 0)
+        {
+            ExitNow(rval = &mEntries[i]);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
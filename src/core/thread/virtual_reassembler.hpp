@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for forwarding 6LoWPAN fragments to minimal children without reassembly.
+ */
+
+#ifndef VIRTUAL_REASSEMBLER_HPP_
+#define VIRTUAL_REASSEMBLER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/thread.h>
+
+#include "common/locator.hpp"
+#include "mac/mac_frame.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-mesh-forwarding
+ *
+ * @{
+ */
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+
+/**
+ * This class implements virtual reassembly, i.e. forwarding the mesh frames of a datagram destined to a minimal child
+ * as they are received, without reassembling the datagram first.
+ *
+ */
+class VirtualReassembler : public InstanceLocator
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit VirtualReassembler(Instance &aInstance);
+
+    /**
+     * This method removes all the entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method forwards a mesh frame destined to a minimal child without reassembling the datagram.
+     *
+     * The frame is queued as is (the mesh header is skipped when the frame is sent) with the hop limit decremented as
+     * `Ip6::HandleDatagram()` does, and the datagram tag rewritten so that it cannot collide with the tags of the
+     * datagrams fragmented by this device. The subsequent fragments of a datagram follow the decision taken for its
+     * first fragment.
+     *
+     * @param[inout]  aFrame        A pointer to the mesh frame.
+     * @param[in]     aFrameLength  The number of bytes in @p aFrame.
+     * @param[in]     aMacSource    The MAC source address of the frame.
+     * @param[in]     aLinkInfo     The link info of the frame.
+     *
+     * @retval OT_ERROR_NONE         Successfully queued the frame.
+     * @retval OT_ERROR_NOT_CAPABLE  The frame has to go through full reassembly instead.
+     * @retval OT_ERROR_NO_BUFS      Insufficient buffers to queue the frame.
+     * @retval OT_ERROR_PARSE        The frame could not be parsed.
+     *
+     */
+    otError ForwardFrame(uint8_t *               aFrame,
+                         uint16_t                aFrameLength,
+                         const Mac::Address &    aMacSource,
+                         const otThreadLinkInfo &aLinkInfo);
+
+    /**
+     * This method decrements the lifetime of all the entries.
+     *
+     * It is called every `MeshForwarder::kStateUpdatePeriod`.
+     *
+     * @retval TRUE   If an entry is still in use.
+     * @retval FALSE  If no entry is in use.
+     *
+     */
+    bool UpdateLifetime(void);
+
+private:
+    enum
+    {
+        kNumEntries = OPENTHREAD_CONFIG_NUM_VIRTUAL_REASSEMBLY_ENTRIES,
+    };
+
+    struct Entry
+    {
+        uint16_t mSrcRloc16;   ///< The mesh source of the datagram.
+        uint16_t mDatagramTag; ///< The datagram tag assigned by the mesh source.
+        uint16_t mForwardTag;  ///< The datagram tag used towards the child.
+        uint8_t  mPriority;    ///< The priority level of the first fragment.
+        uint8_t  mLifetime;    ///< The lifetime of the entry (in seconds). 0 means the entry is invalid.
+    };
+
+    Entry *FindEntry(uint16_t aTag, uint16_t aSrcRloc16);
+    Entry *GetUnusedEntry(void);
+
+    Entry mEntries[kNumEntries];
+};
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // VIRTUAL_REASSEMBLER_HPP_
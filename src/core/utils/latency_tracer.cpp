@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements per-message latency tracing.
+ */
+
+#include "latency_tracer.hpp"
+
+#include "utils/wrap_string.h"
+
+#include "common/code_utils.hpp"
+#include "common/timer.hpp"
+
+namespace ot {
+namespace Utils {
+
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
+LatencyTracer::LatencyTracer(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mCallback(NULL)
+    , mCallbackContext(NULL)
+{
+    ResetHistogram();
+}
+
+uint32_t LatencyTracer::GetNow(void)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    return TimerMicro::GetNow();
+#else
+    return TimerMilli::GetNow() * 1000U;
+#endif
+}
+
+void LatencyTracer::Start(Message &aMessage)
+{
+    aMessage.ClearLatencyStages(aMessage.GetLatencyStageMask());
+    aMessage.SetLatencyTimestamp(kStageEnqueued, GetNow());
+}
+
+void LatencyTracer::Record(Message &aMessage, uint8_t aStage)
+{
+    if (!aMessage.IsLatencyStageRecorded(aStage))
+    {
+        aMessage.SetLatencyTimestamp(aStage, GetNow());
+    }
+}
+
+void LatencyTracer::HandleDelivered(Message &aMessage, bool aIndirect, bool aTxSuccess)
+{
+    otMessageLatencyTrace trace;
+
+    VerifyOrExit(aMessage.IsLatencyStageRecorded(kStageEnqueued));
+
+    aMessage.SetLatencyTimestamp(kStageTxDone, GetNow());
+
+    mHistogram.mCount++;
+
+    for (uint8_t stage = 0; stage < kNumStages; stage++)
+    {
+        trace.mTimestamps[stage] = aMessage.GetLatencyTimestamp(stage);
+
+        if (stage != kStageEnqueued && aMessage.IsLatencyStageRecorded(stage))
+        {
+            uint32_t latency = trace.mTimestamps[stage] - trace.mTimestamps[kStageEnqueued];
+
+            mHistogram.mBins[stage - 1][GetBin(latency)]++;
+        }
+    }
+
+    trace.mStageMask = aMessage.GetLatencyStageMask();
+    trace.mPriority  = aMessage.GetPriority();
+    trace.mLength    = aMessage.GetLength();
+    trace.mIndirect  = aIndirect;
+    trace.mTxSuccess = aTxSuccess;
+
+    aMessage.ClearLatencyStages(static_cast<uint8_t>(1U << kStageTxDone));
+
+    if (mCallback != NULL)
+    {
+        mCallback(&trace, mCallbackContext);
+    }
+
+exit:
+    return;
+}
+
+uint8_t LatencyTracer::GetBin(uint32_t aLatency)
+{
+    uint32_t ms  = aLatency / 1000U;
+    uint8_t  bin = 0;
+
+    while (ms != 0 && bin < kNumBins - 1)
+    {
+        ms >>= 1;
+        bin++;
+    }
+
+    return bin;
+}
+
+void LatencyTracer::SetCallback(otMessageLatencyCallback aCallback, void *aContext)
+{
+    mCallback        = aCallback;
+    mCallbackContext = aContext;
+}
+
+void LatencyTracer::ResetHistogram(void)
+{
+    memset(&mHistogram, 0, sizeof(mHistogram));
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
+} // namespace Utils
+} // namespace ot
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for per-message latency tracing.
+ */
+
+#ifndef LATENCY_TRACER_HPP_
+#define LATENCY_TRACER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <openthread/message.h>
+
+#include "common/locator.hpp"
+#include "common/message.hpp"
+
+namespace ot {
+namespace Utils {
+
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
+/**
+ * This class implements per-message latency tracing.
+ *
+ * The stages of a message are time-stamped in the message metadata as it moves through `Ip6` and `MeshForwarder`.
+ * Each completed delivery of the message (direct, or indirect to one sleepy child) updates the latency histograms
+ * and is reported to the registered callback.
+ *
+ */
+class LatencyTracer : public InstanceLocator
+{
+public:
+    enum
+    {
+        kStageEnqueued      = OT_MESSAGE_LATENCY_STAGE_ENQUEUED,       ///< Enqueued for transmission.
+        kStageRouteResolved = OT_MESSAGE_LATENCY_STAGE_ROUTE_RESOLVED, ///< Next hop or sleepy child determined.
+        kStageTxStarted     = OT_MESSAGE_LATENCY_STAGE_TX_STARTED,     ///< First frame handed to the MAC.
+        kStageTxDone        = OT_MESSAGE_LATENCY_STAGE_TX_DONE,        ///< Last frame transmitted.
+        kNumStages          = OT_MESSAGE_LATENCY_NUM_STAGES,           ///< Number of stages.
+        kNumBins            = OT_MESSAGE_LATENCY_HISTOGRAM_BINS,       ///< Number of histogram bins.
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit LatencyTracer(Instance &aInstance);
+
+    /**
+     * This method starts a new trace of a message and records its `kStageEnqueued` stage.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     */
+    void Start(Message &aMessage);
+
+    /**
+     * This method records a stage of a message, unless the stage was already recorded.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     * @param[in]  aStage    The stage to record.
+     *
+     */
+    void Record(Message &aMessage, uint8_t aStage);
+
+    /**
+     * This method completes a delivery of a message.
+     *
+     * This method records the `kStageTxDone` stage, updates the histograms, and invokes the callback. The tx done
+     * stage is then cleared, so that a later delivery of the same message (to another sleepy child) is traced
+     * separately.
+     *
+     * The MAC reports the transmission of a frame once its ack is received, so there is no separate ack stage.
+     *
+     * @param[in]  aMessage    A reference to the message.
+     * @param[in]  aIndirect   TRUE if the message was delivered indirectly to a sleepy child.
+     * @param[in]  aTxSuccess  TRUE if all frames of the message were sent (and acked when an ack was requested).
+     *
+     */
+    void HandleDelivered(Message &aMessage, bool aIndirect, bool aTxSuccess);
+
+    /**
+     * This method registers a callback to receive the trace of each delivered message.
+     *
+     * @param[in]  aCallback  A pointer to the callback function, or NULL to disable the callback.
+     * @param[in]  aContext   A pointer to application-specific context.
+     *
+     */
+    void SetCallback(otMessageLatencyCallback aCallback, void *aContext);
+
+    /**
+     * This method returns the latency histograms.
+     *
+     * @returns A reference to the latency histograms.
+     *
+     */
+    const otMessageLatencyHistogram &GetHistogram(void) const { return mHistogram; }
+
+    /**
+     * This method resets the latency histograms.
+     *
+     */
+    void ResetHistogram(void);
+
+private:
+    static uint32_t GetNow(void);
+    static uint8_t  GetBin(uint32_t aLatency);
+
+    otMessageLatencyCallback  mCallback;
+    void *                    mCallbackContext;
+    otMessageLatencyHistogram mHistogram;
+};
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
+} // namespace Utils
+} // namespace ot
+
+#endif // LATENCY_TRACER_HPP_
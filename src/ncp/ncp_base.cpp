@@ -227,6 +227,9 @@ NcpBase::NcpBase(Instance *aInstance)
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     , mAllowLocalServerDataChange(false)
 #endif
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    , mBinaryLogLength(0)
+#endif
 #if OPENTHREAD_FTD
     , mPreferredRouteId(0)
 #endif
@@ -257,6 +260,10 @@ NcpBase::NcpBase(Instance *aInstance)
 
     memset(&mResponseQueue, 0, sizeof(mResponseQueue));
 
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    otLoggingBinarySetHandler(&NcpBase::HandleBinaryLog, this);
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
     otMessageQueueInit(&mMessageQueue);
     otSetStateChangedCallback(mInstance, &NcpBase::HandleStateChanged, this);
@@ -823,8 +830,50 @@ void NcpBase::UpdateChangedProps(void)
 
 exit:
     mDidInitialUpdates = true;
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    SendBinaryLog();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+void NcpBase::HandleBinaryLog(void *aContext)
+{
+    static_cast<NcpBase *>(aContext)->mUpdateChangedPropsTask.Post();
+}
+
+void NcpBase::SendBinaryLog(void)
+{
+    uint8_t header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID_0;
+
+    VerifyOrExit(!mDisableStreamWrite);
+    VerifyOrExit(!mChangedPropsSet.IsPropertyFiltered(SPINEL_PROP_STREAM_LOG_BINARY));
+
+    // Log records are sent only when there is no pending queued response, same as `SPINEL_PROP_STREAM_LOG`.
+    // Records which do not fit in the NCP buffer are kept in `mBinaryLog` and sent once space becomes available.
+
+    while (IsResponseQueueEmpty())
+    {
+        if (mBinaryLogLength == 0)
+        {
+            mBinaryLogLength = otLoggingBinaryRead(mBinaryLog, sizeof(mBinaryLog));
+            VerifyOrExit(mBinaryLogLength != 0);
+        }
+
+        SuccessOrExit(mEncoder.BeginFrame(header, SPINEL_CMD_PROP_VALUE_IS, SPINEL_PROP_STREAM_LOG_BINARY));
+        SuccessOrExit(mEncoder.WriteData(mBinaryLog, mBinaryLogLength));
+        SuccessOrExit(mEncoder.EndFrame());
+
+        mBinaryLogLength = 0;
+    }
+
+exit:
+    return;
 }
 
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
 // ----------------------------------------------------------------------------
 // MARK: Inbound Command Handler
 // ----------------------------------------------------------------------------
@@ -1760,6 +1809,10 @@ template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CAPS>(void)
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_OPENTHREAD_LOG_METADATA));
 #endif
 
+#if (OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY)
+    SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_OPENTHREAD_LOG_BINARY));
+#endif
+
 #if OPENTHREAD_MTD || OPENTHREAD_FTD
 
     SuccessOrExit(error = mEncoder.WriteUintPacked(SPINEL_CAP_NET_THREAD_1_1));
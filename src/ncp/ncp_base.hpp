@@ -45,6 +45,7 @@
 #if OPENTHREAD_FTD
 #include <openthread/thread_ftd.h>
 #endif
+#include <openthread/logging.h>
 #include <openthread/message.h>
 #include <openthread/ncp.h>
 
@@ -245,6 +246,11 @@ protected:
     static void UpdateChangedProps(Tasklet &aTasklet);
     void        UpdateChangedProps(void);
 
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    static void HandleBinaryLog(void *aContext);
+    void        SendBinaryLog(void);
+#endif
+
     static void HandleFrameRemovedFromNcpBuffer(void *                   aContext,
                                                 NcpFrameBuffer::FrameTag aFrameTag,
                                                 NcpFrameBuffer::Priority aPriority,
@@ -556,6 +562,11 @@ protected:
     bool mAllowLocalServerDataChange;
 #endif
 
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    uint8_t  mBinaryLog[OT_LOGGING_BINARY_MAX_RECORD_LENGTH]; // Records read but not yet sent to host.
+    uint16_t mBinaryLogLength;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     otExtAddress mSteeringDataAddress;
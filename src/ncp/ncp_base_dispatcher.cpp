@@ -156,6 +156,11 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_MAC_DATA_POLL_PERIOD:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_DATA_POLL_PERIOD>;
         break;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    case SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET>;
+        break;
+#endif
     case SPINEL_PROP_MAC_EXTENDED_ADDR:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_EXTENDED_ADDR>;
         break;
@@ -463,6 +468,21 @@ NcpBase::PropertyHandler NcpBase::FindGetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_CNTR_MLE_COUNTERS:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MLE_COUNTERS>;
         break;
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    case SPINEL_PROP_CNTR_MSG_LATENCY:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MSG_LATENCY>;
+        break;
+#endif
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+    case SPINEL_PROP_CNTR_PERF_COUNTERS:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_PERF_COUNTERS>;
+        break;
+#endif
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    case SPINEL_PROP_CNTR_DATA_POLL:
+        handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_DATA_POLL>;
+        break;
+#endif
         // NCP counters
     case SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL:
         handler = &NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_TX_IP_SEC_TOTAL>;
@@ -731,6 +751,11 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_MAC_DATA_POLL_PERIOD:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_DATA_POLL_PERIOD>;
         break;
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    case SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET>;
+        break;
+#endif
     case SPINEL_PROP_NET_IF_UP:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_NET_IF_UP>;
         break;
@@ -868,6 +893,21 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_CNTR_RESET:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_RESET>;
         break;
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+    case SPINEL_PROP_CNTR_MSG_LATENCY:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_MSG_LATENCY>;
+        break;
+#endif
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+    case SPINEL_PROP_CNTR_PERF_COUNTERS:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_PERF_COUNTERS>;
+        break;
+#endif
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    case SPINEL_PROP_CNTR_DATA_POLL:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_DATA_POLL>;
+        break;
+#endif
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
     case SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_CHILD_SUPERVISION_CHECK_TIMEOUT>;
@@ -1014,6 +1054,9 @@ NcpBase::PropertyHandler NcpBase::FindSetPropertyHandler(spinel_prop_key_t aKey)
     case SPINEL_PROP_PHY_ENABLED:
         handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_ENABLED>;
         break;
+    case SPINEL_PROP_PHY_CHAN_RX_MASK:
+        handler = &NcpBase::HandlePropertySet<SPINEL_PROP_PHY_CHAN_RX_MASK>;
+        break;
 #endif // #if OPENTHREAD_RADIO || OPENTHREAD_CONFIG_LINK_RAW_ENABLE
 
     default:
@@ -43,6 +43,9 @@
 #if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
 #include <openthread/child_supervision.h>
 #endif
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+#include <openthread/counters.h>
+#endif
 #include <openthread/diag.h>
 #include <openthread/icmp6.h>
 #if OPENTHREAD_CONFIG_JAM_DETECTION_ENABLE
@@ -208,6 +211,26 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET>(void)
+{
+    return mEncoder.WriteUint32(otLinkGetPollLatencyBudget(mInstance));
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET>(void)
+{
+    uint32_t latency;
+    otError  error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint32(latency));
+
+    error = otLinkSetPollLatencyBudget(mInstance, latency);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_EXTENDED_ADDR>(void)
 {
     return mEncoder.WriteEui64(*otLinkGetExtendedAddress(mInstance));
@@ -2506,6 +2529,114 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_MSG_LATENCY>(void)
+{
+    otError                          error     = OT_ERROR_NONE;
+    const otMessageLatencyHistogram *histogram = otMessageGetLatencyHistogram(mInstance);
+
+    SuccessOrExit(error = mEncoder.WriteUint32(histogram->mCount));
+
+    for (uint8_t stage = 0; stage < OT_MESSAGE_LATENCY_NUM_STAGES - 1; stage++)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+
+        for (uint8_t bin = 0; bin < OT_MESSAGE_LATENCY_HISTOGRAM_BINS; bin++)
+        {
+            SuccessOrExit(error = mEncoder.WriteUint32(histogram->mBins[stage][bin]));
+        }
+
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_MSG_LATENCY>(void)
+{
+    uint8_t value = 0;
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint8(value));
+
+    VerifyOrExit(value == 1, error = OT_ERROR_INVALID_ARGS);
+
+    otMessageResetLatencyHistogram(mInstance);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE
+
+#if OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_PERF_COUNTERS>(void)
+{
+    otError   error = OT_ERROR_NONE;
+    otCounter counter;
+
+    for (uint16_t index = 0; otCountersGetCounter(mInstance, index, &counter) == OT_ERROR_NONE; index++)
+    {
+        SuccessOrExit(error = mEncoder.OpenStruct());
+        SuccessOrExit(error = mEncoder.WriteUtf8(counter.mName));
+        SuccessOrExit(error = mEncoder.WriteUint8(static_cast<uint8_t>(counter.mType)));
+        SuccessOrExit(error = mEncoder.WriteUint32(counter.mValue));
+        SuccessOrExit(error = mEncoder.CloseStruct());
+    }
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_PERF_COUNTERS>(void)
+{
+    uint8_t value = 0;
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint8(value));
+
+    VerifyOrExit(value == 1, error = OT_ERROR_INVALID_ARGS);
+
+    otCountersReset(mInstance);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_CNTR_DATA_POLL>(void)
+{
+    otError     error = OT_ERROR_NONE;
+    otPollStats stats;
+
+    otLinkGetPollStats(mInstance, &stats);
+
+    SuccessOrExit(error = mEncoder.WriteUint32(stats.mPollsSent));
+    SuccessOrExit(error = mEncoder.WriteUint32(stats.mEmptyPolls));
+    SuccessOrExit(error = mEncoder.WriteUint32(stats.mAverageLatency));
+    SuccessOrExit(error = mEncoder.WriteUint32(stats.mPollPeriod));
+
+exit:
+    return error;
+}
+
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_CNTR_DATA_POLL>(void)
+{
+    uint8_t value = 0;
+    otError error = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint8(value));
+
+    VerifyOrExit(value == 1, error = OT_ERROR_INVALID_ARGS);
+
+    otLinkResetPollStats(mInstance);
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+
 #if OPENTHREAD_CONFIG_MAC_FILTER_ENABLE
 
 template <> otError NcpBase::HandlePropertyGet<SPINEL_PROP_MAC_WHITELIST>(void)
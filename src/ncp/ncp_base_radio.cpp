@@ -338,6 +338,27 @@ exit:
     return error;
 }
 
+template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_PHY_CHAN_RX_MASK>(void)
+{
+    uint32_t channelMask = 0;
+    otError  error       = OT_ERROR_NONE;
+
+    SuccessOrExit(error = mDecoder.ReadUint32(channelMask));
+    VerifyOrExit(mIsRawStreamEnabled, error = OT_ERROR_INVALID_STATE);
+
+    if (channelMask == 0)
+    {
+        error = otLinkRawReceive(mInstance, &NcpBase::LinkRawReceiveDone);
+    }
+    else
+    {
+        error = otLinkRawReceiveMultiChannel(mInstance, channelMask, &NcpBase::LinkRawReceiveDone);
+    }
+
+exit:
+    return error;
+}
+
 template <> otError NcpBase::HandlePropertySet<SPINEL_PROP_MAC_15_4_SADDR>(void)
 {
     uint16_t shortAddress;
@@ -1411,6 +1411,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "RADIO_COEX_METRICS";
         break;
 
+    case SPINEL_PROP_PHY_CHAN_RX_MASK:
+        ret = "PHY_CHAN_RX_MASK";
+        break;
+
     case SPINEL_PROP_MAC_SCAN_STATE:
         ret = "MAC_SCAN_STATE";
         break;
@@ -1495,6 +1499,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "MAC_CCA_FAILURE_RATE";
         break;
 
+    case SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET:
+        ret = "MAC_DATA_POLL_LATENCY_BUDGET";
+        break;
+
     case SPINEL_PROP_NET_SAVED:
         ret = "NET_SAVED";
         break;
@@ -1827,6 +1835,10 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "STREAM_LOG";
         break;
 
+    case SPINEL_PROP_STREAM_LOG_BINARY:
+        ret = "STREAM_LOG_BINARY";
+        break;
+
     case SPINEL_PROP_MESHCOP_COMMISSIONER_STATE:
         ret = "MESHCOP_COMMISSIONER_STATE";
         break;
@@ -2159,6 +2171,18 @@ const char *spinel_prop_key_to_cstr(spinel_prop_key_t prop_key)
         ret = "CNTR_MLE_COUNTERS";
         break;
 
+    case SPINEL_PROP_CNTR_MSG_LATENCY:
+        ret = "CNTR_MSG_LATENCY";
+        break;
+
+    case SPINEL_PROP_CNTR_PERF_COUNTERS:
+        ret = "CNTR_PERF_COUNTERS";
+        break;
+
+    case SPINEL_PROP_CNTR_DATA_POLL:
+        ret = "CNTR_DATA_POLL";
+        break;
+
     case SPINEL_PROP_NEST_STREAM_MFG:
         ret = "NEST_STREAM_MFG";
         break;
@@ -2576,6 +2600,10 @@ const char *spinel_capability_to_cstr(unsigned int capability)
         ret = "SLAAC";
         break;
 
+    case SPINEL_CAP_OPENTHREAD_LOG_BINARY:
+        ret = "OPENTHREAD_LOG_BINARY";
+        break;
+
     case SPINEL_CAP_ERROR_RATE_TRACKING:
         ret = "ERROR_RATE_TRACKING";
         break;
@@ -1054,6 +1054,7 @@ enum
     SPINEL_CAP_CHILD_SUPERVISION       = (SPINEL_CAP_OPENTHREAD__BEGIN + 8),
     SPINEL_CAP_POSIX_APP               = (SPINEL_CAP_OPENTHREAD__BEGIN + 9),
     SPINEL_CAP_SLAAC                   = (SPINEL_CAP_OPENTHREAD__BEGIN + 10),
+    SPINEL_CAP_OPENTHREAD_LOG_BINARY   = (SPINEL_CAP_OPENTHREAD__BEGIN + 11),
     SPINEL_CAP_OPENTHREAD__END         = 640,
 
     SPINEL_CAP_THREAD__BEGIN        = 1024,
@@ -1664,6 +1665,18 @@ typedef enum
      */
     SPINEL_PROP_RADIO_COEX_METRICS = SPINEL_PROP_PHY_EXT__BEGIN + 12,
 
+    /// Multi-channel receive mask
+    /** Format: `L`
+     *
+     * A bit vector of the channels the radio receives on concurrently. It requires `OT_RADIO_CAPS_MULTI_CHANNEL_RX`
+     * in `SPINEL_PROP_RADIO_CAPS`.
+     *
+     * Setting a non-zero mask makes the radio receive on all channels of the mask. Setting zero, or setting
+     * `SPINEL_PROP_PHY_CHAN`, makes the radio receive on `SPINEL_PROP_PHY_CHAN` only.
+     *
+     */
+    SPINEL_PROP_PHY_CHAN_RX_MASK = SPINEL_PROP_PHY_EXT__BEGIN + 13,
+
     SPINEL_PROP_PHY_EXT__END = 0x1300,
 
     SPINEL_PROP_MAC__BEGIN = 0x30,
@@ -1915,6 +1928,20 @@ typedef enum
      */
     SPINEL_PROP_MAC_CCA_FAILURE_RATE = SPINEL_PROP_MAC_EXT__BEGIN + 9,
 
+    /// Data poll latency budget
+    /** Format: `L` (read-write)
+     *
+     *  Unit: millisecond
+     *
+     * Available only when the NCP is built with `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE`.
+     *
+     * A non-zero value enables adaptive data polling: the data poll period follows the observed interval between
+     * downlink frames and is at most the latency budget. It replaces `SPINEL_PROP_MAC_DATA_POLL_PERIOD`. Value zero
+     * disables adaptive data polling.
+     *
+     */
+    SPINEL_PROP_MAC_DATA_POLL_LATENCY_BUDGET = SPINEL_PROP_MAC_EXT__BEGIN + 10,
+
     SPINEL_PROP_MAC_EXT__END = 0x1400,
 
     SPINEL_PROP_NET__BEGIN = 0x40,
@@ -2960,6 +2987,21 @@ typedef enum
      */
     SPINEL_PROP_STREAM_LOG = SPINEL_PROP_STREAM__BEGIN + 4,
 
+    /// Binary Log Stream
+    /** Format: `D` (stream, read only)
+     *
+     * Required capability: SPINEL_CAP_OPENTHREAD_LOG_BINARY
+     *
+     * This property is a read-only streaming property which provides
+     * OpenThread log records in binary form, formatted by the host.
+     * This property provides asynchronous `CMD_PROP_VALUE_IS` updates
+     * with one or more records, each starting with its length in bytes
+     * (one byte). The record format is described in
+     * `tools/binary-log/README.md`.
+     *
+     */
+    SPINEL_PROP_STREAM_LOG_BINARY = SPINEL_PROP_STREAM__BEGIN + 5,
+
     SPINEL_PROP_STREAM__END = 0x80,
 
     SPINEL_PROP_STREAM_EXT__BEGIN = 0x1700,
@@ -3772,6 +3814,58 @@ typedef enum
      */
     SPINEL_PROP_CNTR_MLE_COUNTERS = SPINEL_PROP_CNTR__BEGIN + 402,
 
+    /// Message latency histograms.
+    /** Format: `Lt(A(L))t(A(L))t(A(L))`  (Read-write)
+     *
+     * Available only when the NCP is built with `OPENTHREAD_CONFIG_MESSAGE_LATENCY_TRACE_ENABLE`.
+     *
+     *   'L': Count                 (The number of traced message deliveries).
+     *
+     * Followed by one histogram per stage, holding the time from enqueue to the stage:
+     *
+     *   t(A(L)): RouteResolved     (Next hop or sleepy child determined).
+     *   t(A(L)): TxStarted         (First frame handed to the MAC).
+     *   t(A(L)): TxDone            (Last frame transmitted).
+     *
+     * Bin 0 counts latencies below 1 ms, bin `b` counts latencies in [2^(b-1), 2^b) ms, and the last bin also counts
+     * all longer latencies.
+     *
+     * Writing `1` (format `C`) to this property resets the histograms.
+     *
+     */
+    SPINEL_PROP_CNTR_MSG_LATENCY = SPINEL_PROP_CNTR__BEGIN + 403,
+
+    /// Performance counters.
+    /** Format: `A(t(UCL))`  (Read-write)
+     *
+     * Available only when the NCP is built with `OPENTHREAD_CONFIG_PERF_COUNTERS_ENABLE`.
+     *
+     * Each struct holds one counter of the performance counters registry:
+     *
+     *   'U': Name                  (The counter name).
+     *   'C': Type                  (0: event count, 1: high-water mark).
+     *   'L': Value                 (The counter value).
+     *
+     * Writing `1` (format `C`) to this property resets the counters.
+     *
+     */
+    SPINEL_PROP_CNTR_PERF_COUNTERS = SPINEL_PROP_CNTR__BEGIN + 404,
+
+    /// Data poll statistics.
+    /** Format: `LLLL`  (Read-write)
+     *
+     * Available only when the NCP is built with `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE`.
+     *
+     *   'L': PollsSent             (The number of data polls acknowledged by the parent).
+     *   'L': EmptyPolls            (The number of data polls acknowledged without a pending frame).
+     *   'L': AverageLatency        (The estimated average downlink latency in milliseconds).
+     *   'L': PollPeriod            (The current data poll period in milliseconds).
+     *
+     * Writing `1` (format `C`) to this property resets the statistics.
+     *
+     */
+    SPINEL_PROP_CNTR_DATA_POLL = SPINEL_PROP_CNTR__BEGIN + 405,
+
     SPINEL_PROP_CNTR__END = 0x800,
 
     SPINEL_PROP_NEST__BEGIN = 0x3BC0,
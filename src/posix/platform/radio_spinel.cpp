@@ -170,6 +170,7 @@ RadioSpinel::RadioSpinel(void)
     , mPanId(0xffff)
     , mRadioCaps(0)
     , mChannel(0)
+    , mRxChannelMask(0)
     , mRxSensitivity(0)
     , mState(kStateDisabled)
     , mIsPromiscuous(false)
@@ -1326,11 +1327,13 @@ otError RadioSpinel::Receive(uint8_t aChannel)
 
     VerifyOrExit(mState != kStateDisabled, error = OT_ERROR_INVALID_STATE);
 
-    if (mChannel != aChannel)
+    // Setting the channel also ends a multi-channel receive.
+    if (mChannel != aChannel || mRxChannelMask != 0)
     {
         error = Set(SPINEL_PROP_PHY_CHAN, SPINEL_DATATYPE_UINT8_S, aChannel);
         VerifyOrExit(error == OT_ERROR_NONE);
-        mChannel = aChannel;
+        mChannel       = aChannel;
+        mRxChannelMask = 0;
     }
 
     if (mState == kStateSleep)
@@ -1351,6 +1354,38 @@ exit:
     return error;
 }
 
+otError RadioSpinel::ReceiveMultiChannel(uint32_t aChannelMask)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mRadioCaps & OT_RADIO_CAPS_MULTI_CHANNEL_RX, error = OT_ERROR_NOT_IMPLEMENTED);
+    VerifyOrExit(mState != kStateDisabled, error = OT_ERROR_INVALID_STATE);
+
+    if (mState == kStateSleep)
+    {
+        error = Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, true);
+        VerifyOrExit(error == OT_ERROR_NONE);
+    }
+
+    if (mRxChannelMask != aChannelMask)
+    {
+        error = Set(SPINEL_PROP_PHY_CHAN_RX_MASK, SPINEL_DATATYPE_UINT32_S, aChannelMask);
+        VerifyOrExit(error == OT_ERROR_NONE);
+        mRxChannelMask = aChannelMask;
+    }
+
+    if (mTxRadioTid != 0)
+    {
+        FreeTid(mTxRadioTid);
+        mTxRadioTid = 0;
+    }
+
+    mState = kStateReceive;
+
+exit:
+    return error;
+}
+
 otError RadioSpinel::Sleep(void)
 {
     otError error = OT_ERROR_NONE;
@@ -1361,7 +1396,9 @@ otError RadioSpinel::Sleep(void)
         error = sRadioSpinel.Set(SPINEL_PROP_MAC_RAW_STREAM_ENABLED, SPINEL_DATATYPE_BOOL_S, false);
         VerifyOrExit(error == OT_ERROR_NONE);
 
-        mState = kStateSleep;
+        // The RCP receives on `SPINEL_PROP_PHY_CHAN` when the raw stream is enabled again.
+        mRxChannelMask = 0;
+        mState         = kStateSleep;
         break;
 
     case kStateSleep:
@@ -1542,6 +1579,12 @@ otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
     return sRadioSpinel.Receive(aChannel);
 }
 
+otError otPlatRadioReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    return sRadioSpinel.ReceiveMultiChannel(aChannelMask);
+}
+
 otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -345,6 +345,18 @@ public:
      */
     otError Receive(uint8_t aChannel);
 
+    /**
+     * This method switches the radio state from Sleep to Receive on multiple channels concurrently.
+     *
+     * @param[in]  aChannelMask  A bit vector of the channels to receive on.
+     *
+     * @retval OT_ERROR_NONE             Successfully transitioned to Receive.
+     * @retval OT_ERROR_INVALID_STATE    The radio was disabled.
+     * @retval OT_ERROR_NOT_IMPLEMENTED  The RCP does not support receiving on multiple channels.
+     *
+     */
+    otError ReceiveMultiChannel(uint32_t aChannelMask);
+
     /**
      * This method switches the radio state from Receive to Sleep.
      *
@@ -623,6 +635,7 @@ private:
     uint16_t     mPanId;
     otRadioCaps  mRadioCaps;
     uint8_t      mChannel;
+    uint32_t     mRxChannelMask;
     int8_t       mRxSensitivity;
     otError      mTxError;
     char         mVersion[kVersionStringSize];
@@ -0,0 +1,310 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the microbenchmark harness and its entry point.
+ */
+
+#include "benchmark.hpp"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/instance.h>
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kDefaultMinTime     = 200, ///< Default minimum duration of a measurement (in milliseconds).
+    kDefaultRepetitions = 3,   ///< Default number of measurements of each benchmark.
+    kMaxIterations      = 1UL << 30,
+};
+
+struct Entry
+{
+    const char *mName;
+    Function    mFunction;
+};
+
+struct Result
+{
+    uint32_t mIterations;
+    double   mNsPerOp;
+    double   mAllocsPerOp;
+};
+
+static const Entry sBenchmarks[] = {
+    {"lowpan.compress", LowpanCompress},
+    {"lowpan.decompress", LowpanDecompress},
+    {"message.read", MessageRead},
+    {"message.write", MessageWrite},
+    {"message.clone", MessageClone},
+    {"mac.frame.parse", MacFrameParse},
+    {"mle.parse", MleParse},
+    {"mle.parse-indexed", MleParseIndexed},
+    {"mle.route-tlv", MleRouteTlv},
+    {"mle.route-tlv-cached", MleRouteTlvCached},
+    {"aes-ccm.encrypt", AesCcmEncrypt},
+    {"aes-ccm.decrypt", AesCcmDecrypt},
+    {"aes-ccm.message", AesCcmMessage},
+    {"hdlc.encode", HdlcEncode},
+    {"hdlc.decode", HdlcDecode},
+    {"spinel.pack", SpinelPack},
+    {"spinel.unpack", SpinelUnpack},
+    {"priority-queue.enqueue-dequeue", PriorityQueueEnqueueDequeue},
+    {"timer-milli.start-stop", TimerMilliStartStop},
+#if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+    {"pbkdf2.reference", Pbkdf2CmacReference},
+    {"pbkdf2.cmac", Pbkdf2Cmac},
+    {"pskc.generate", PskcGenerate},
+    {"pskc.cached", PskcCached},
+#endif
+};
+
+Context::Context(Instance &aInstance, uint32_t aIterations)
+    : mInstance(aInstance)
+    , mIterations(aIterations)
+    , mAllocations(0)
+    , mStartTime(0)
+    , mElapsed(0)
+    , mSink(0)
+{
+}
+
+uint64_t Context::GetNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+void Context::Start(void)
+{
+    mStartTime = GetNow();
+}
+
+void Context::Stop(void)
+{
+    mElapsed = GetNow() - mStartTime;
+}
+
+/**
+ * This function measures a benchmark.
+ *
+ * The number of iterations is grown until a single run lasts at least @p aMinTime. The fastest of @p aRepetitions
+ * runs with that number of iterations is reported.
+ *
+ */
+static void Measure(Instance &aInstance, const Entry &aEntry, uint64_t aMinTime, uint32_t aRepetitions, Result &aResult)
+{
+    uint32_t iterations = 1;
+    uint64_t best       = 0;
+
+    for (;;)
+    {
+        Context  context(aInstance, iterations);
+        uint64_t next;
+
+        aEntry.mFunction(context);
+
+        if (context.GetElapsed() >= aMinTime || iterations >= kMaxIterations)
+        {
+            break;
+        }
+
+        // Aim 20% past the minimum time, growing by at least 2x and at most 100x per step.
+        next = (context.GetElapsed() > 0) ? (aMinTime * 6 / 5) * iterations / context.GetElapsed() : 0;
+
+        if (next < 2ULL * iterations)
+        {
+            next = 2ULL * iterations;
+        }
+
+        if (next > 100ULL * iterations)
+        {
+            next = 100ULL * iterations;
+        }
+
+        iterations = (next > kMaxIterations) ? static_cast<uint32_t>(kMaxIterations) : static_cast<uint32_t>(next);
+    }
+
+    aResult.mIterations  = iterations;
+    aResult.mAllocsPerOp = 0;
+
+    for (uint32_t i = 0; i < aRepetitions; i++)
+    {
+        Context context(aInstance, iterations);
+
+        aEntry.mFunction(context);
+
+        if (i == 0 || context.GetElapsed() < best)
+        {
+            best = context.GetElapsed();
+        }
+
+        aResult.mAllocsPerOp = static_cast<double>(context.GetAllocations()) / iterations;
+    }
+
+    aResult.mNsPerOp = static_cast<double>(best) / iterations;
+}
+
+static void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr, "Usage: %s [-j] [-f filter] [-t min_ms] [-r repetitions]\n", aProgram);
+    fprintf(stderr, "    -j              Print results as JSON.\n");
+    fprintf(stderr, "    -f filter       Only run benchmarks whose name contains `filter`.\n");
+    fprintf(stderr, "    -t min_ms       Minimum duration of a measurement (default: %d).\n", kDefaultMinTime);
+    fprintf(stderr, "    -r repetitions  Number of measurements, the fastest is reported (default: %d).\n",
+            kDefaultRepetitions);
+}
+
+static int Main(int aArgc, char *aArgv[])
+{
+    bool        json        = false;
+    const char *filter      = NULL;
+    long        minTime     = kDefaultMinTime;
+    long        repetitions = kDefaultRepetitions;
+    bool        first       = true;
+    Instance *  instance;
+    int         option;
+
+    while ((option = getopt(aArgc, aArgv, "jf:t:r:h")) != -1)
+    {
+        switch (option)
+        {
+        case 'j':
+            json = true;
+            break;
+
+        case 'f':
+            filter = optarg;
+            break;
+
+        case 't':
+            minTime = strtol(optarg, NULL, 0);
+            break;
+
+        case 'r':
+            repetitions = strtol(optarg, NULL, 0);
+            break;
+
+        default:
+            PrintUsage(aArgv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind != aArgc || minTime < 0 || repetitions <= 0)
+    {
+        PrintUsage(aArgv[0]);
+        return EXIT_FAILURE;
+    }
+
+#if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+    {
+        size_t instanceBufferLength = 0;
+        void * instanceBuffer;
+
+        (void)otInstanceInit(NULL, &instanceBufferLength);
+        instanceBuffer = calloc(1, instanceBufferLength);
+        VerifyOrQuit(instanceBuffer != NULL, "Failed to allocate otInstance");
+        instance = static_cast<Instance *>(otInstanceInit(instanceBuffer, &instanceBufferLength));
+    }
+#else
+    instance = static_cast<Instance *>(otInstanceInitSingle());
+#endif
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+
+    if (json)
+    {
+        printf("{\"benchmarks\":[");
+    }
+    else
+    {
+        printf("%-32s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "allocs/op");
+    }
+
+    for (size_t i = 0; i < sizeof(sBenchmarks) / sizeof(sBenchmarks[0]); i++)
+    {
+        const Entry &entry = sBenchmarks[i];
+        Result       result;
+
+        if (filter != NULL && strstr(entry.mName, filter) == NULL)
+        {
+            continue;
+        }
+
+        Measure(*instance, entry, static_cast<uint64_t>(minTime) * 1000000ULL, static_cast<uint32_t>(repetitions),
+                result);
+
+        if (json)
+        {
+            printf("%s\n{\"name\":\"%s\",\"iterations\":%u,\"ns_per_op\":%.2f,\"allocs_per_op\":%.2f}",
+                   first ? "" : ",", entry.mName, result.mIterations, result.mNsPerOp, result.mAllocsPerOp);
+        }
+        else
+        {
+            printf("%-32s %12u %12.2f %12.2f\n", entry.mName, result.mIterations, result.mNsPerOp,
+                   result.mAllocsPerOp);
+        }
+
+        fflush(stdout);
+        first = false;
+    }
+
+    if (json)
+    {
+        printf("\n]}\n");
+    }
+
+    otInstanceFinalize(instance);
+
+#if OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+    free(instance);
+#endif
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace Benchmark
+} // namespace ot
+
+int main(int argc, char *argv[])
+{
+    return ot::Benchmark::Main(argc, argv);
+}
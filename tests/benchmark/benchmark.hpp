@@ -0,0 +1,185 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the microbenchmark harness.
+ */
+
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include <stdint.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+
+namespace ot {
+namespace Benchmark {
+
+/**
+ * This class provides the state of a single benchmark run.
+ *
+ * A benchmark function prepares its inputs, calls `Start()`, executes the measured operation `GetIterations()`
+ * times, and calls `Stop()` before releasing its inputs.
+ *
+ */
+class Context
+{
+public:
+    /**
+     * This constructor initializes the context.
+     *
+     * @param[in]  aInstance    A reference to the OpenThread instance.
+     * @param[in]  aIterations  The number of times the measured operation must be executed.
+     *
+     */
+    Context(Instance &aInstance, uint32_t aIterations);
+
+    /**
+     * This method returns the OpenThread instance.
+     *
+     * @returns A reference to the OpenThread instance.
+     *
+     */
+    Instance &GetInstance(void) { return mInstance; }
+
+    /**
+     * This method returns the number of times the measured operation must be executed.
+     *
+     * @returns The number of iterations.
+     *
+     */
+    uint32_t GetIterations(void) const { return mIterations; }
+
+    /**
+     * This method starts the measurement.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops the measurement.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method returns the measured time.
+     *
+     * @returns The time between `Start()` and `Stop()` in nanoseconds.
+     *
+     */
+    uint64_t GetElapsed(void) const { return mElapsed; }
+
+    /**
+     * This method returns the number of free message buffers.
+     *
+     * Benchmarks use it to account message buffer allocations of the measured operation.
+     *
+     * @returns The number of free message buffers.
+     *
+     */
+    uint16_t GetFreeBufferCount(void) { return mInstance.Get<MessagePool>().GetFreeBufferCount(); }
+
+    /**
+     * This method accounts message buffer allocations.
+     *
+     * @param[in]  aCount  The number of message buffers allocated.
+     *
+     */
+    void AddAllocations(uint32_t aCount) { mAllocations += aCount; }
+
+    /**
+     * This method returns the number of message buffer allocations.
+     *
+     * @returns The number of message buffer allocations.
+     *
+     */
+    uint32_t GetAllocations(void) const { return mAllocations; }
+
+    /**
+     * This method consumes a result so that the compiler cannot discard the measured operation.
+     *
+     * @param[in]  aValue  A result of the measured operation.
+     *
+     */
+    void Consume(uint32_t aValue) { mSink += aValue; }
+
+private:
+    static uint64_t GetNow(void);
+
+    Instance &        mInstance;
+    uint32_t          mIterations;
+    uint32_t          mAllocations;
+    uint64_t          mStartTime;
+    uint64_t          mElapsed;
+    volatile uint32_t mSink;
+};
+
+/**
+ * This function pointer is called to run a benchmark.
+ *
+ * @param[in]  aContext  A reference to the benchmark context.
+ *
+ */
+typedef void (*Function)(Context &aContext);
+
+/*
+ * Benchmarks of the core hot paths, grouped by module in `benchmark_<module>.cpp`.
+ */
+void LowpanCompress(Context &aContext);
+void LowpanDecompress(Context &aContext);
+void MessageRead(Context &aContext);
+void MessageWrite(Context &aContext);
+void MessageClone(Context &aContext);
+void MacFrameParse(Context &aContext);
+void MleParse(Context &aContext);
+void MleParseIndexed(Context &aContext);
+void MleRouteTlv(Context &aContext);
+void MleRouteTlvCached(Context &aContext);
+void AesCcmEncrypt(Context &aContext);
+void AesCcmDecrypt(Context &aContext);
+void AesCcmMessage(Context &aContext);
+void HdlcEncode(Context &aContext);
+void HdlcDecode(Context &aContext);
+void SpinelPack(Context &aContext);
+void SpinelUnpack(Context &aContext);
+void PriorityQueueEnqueueDequeue(Context &aContext);
+void TimerMilliStartStop(Context &aContext);
+#if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+void Pbkdf2CmacReference(Context &aContext);
+void Pbkdf2Cmac(Context &aContext);
+void PskcGenerate(Context &aContext);
+void PskcCached(Context &aContext);
+#endif
+
+} // namespace Benchmark
+} // namespace ot
+
+#endif // BENCHMARK_HPP_
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/new.hpp"
+#include "common/timer.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kNumQueuedMessages = 8,  ///< Messages kept in the priority queue, spread over all priority levels.
+    kNumRunningTimers  = 16, ///< Timers kept running while a timer is started and stopped.
+};
+
+void PriorityQueueEnqueueDequeue(Context &aContext)
+{
+    MessagePool & messagePool = aContext.GetInstance().Get<MessagePool>();
+    PriorityQueue queue;
+    Message *     messages[kNumQueuedMessages];
+
+    for (uint8_t i = 0; i < kNumQueuedMessages; i++)
+    {
+        VerifyOrQuit((messages[i] = messagePool.New(Message::kTypeIp6, 0, i % Message::kNumPriorities)) != NULL,
+                     "Message::New failed");
+        SuccessOrQuit(queue.Enqueue(*messages[i]), "PriorityQueue::Enqueue failed");
+    }
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        Message &message = *messages[i % kNumQueuedMessages];
+
+        queue.Dequeue(message);
+        queue.Enqueue(message);
+    }
+
+    aContext.Stop();
+
+    for (uint8_t i = 0; i < kNumQueuedMessages; i++)
+    {
+        queue.Dequeue(*messages[i]);
+        messages[i]->Free();
+    }
+}
+
+static void HandleTimer(Timer &aTimer)
+{
+    OT_UNUSED_VARIABLE(aTimer);
+}
+
+void TimerMilliStartStop(Context &aContext)
+{
+    otDEFINE_ALIGNED_VAR(runningTimersRaw, sizeof(TimerMilli) * kNumRunningTimers, uint64_t);
+
+    Instance &  instance      = aContext.GetInstance();
+    TimerMilli  timer(instance, HandleTimer, NULL);
+    TimerMilli *runningTimers = reinterpret_cast<TimerMilli *>(runningTimersRaw);
+
+    for (uint8_t i = 0; i < kNumRunningTimers; i++)
+    {
+        new (&runningTimers[i]) TimerMilli(instance, HandleTimer, NULL);
+        runningTimers[i].Start(1000U * (i + 1));
+    }
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        // Spread the fire times so that the timer lands at different positions in the sorted timer list.
+        timer.Start(250U * ((i % (kNumRunningTimers + 1)) + 1));
+        timer.Stop();
+    }
+
+    aContext.Stop();
+
+    for (uint8_t i = 0; i < kNumRunningTimers; i++)
+    {
+        runningTimers[i].Stop();
+    }
+}
+
+} // namespace Benchmark
+} // namespace ot
@@ -0,0 +1,161 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/encoding.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "mac/mac_frame.hpp"
+#include "net/ip6_headers.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mle_router.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kSourceRloc16      = 0x0400,
+    kDestinationRloc16 = 0x0800,
+    kUdpPort           = 61631,
+    kPayloadLength     = 64,
+};
+
+/**
+ * This function builds a mesh-local UDP datagram between two RLOCs, the common case on the forwarding path.
+ *
+ */
+static Message *NewDatagram(Context &aContext, Mac::Address &aMacSource, Mac::Address &aMacDest)
+{
+    static const otMeshLocalPrefix kMeshLocalPrefix = {{0xfd, 0x00, 0xca, 0xfe, 0xfa, 0xce, 0x12, 0x34}};
+
+    Instance &     instance = aContext.GetInstance();
+    Message *      message;
+    Ip6::Header    ip6Header;
+    Ip6::UdpHeader udpHeader;
+    uint8_t        payload[kPayloadLength];
+
+    instance.Get<Mle::MleRouter>().SetMeshLocalPrefix(kMeshLocalPrefix);
+
+    aMacSource.SetShort(kSourceRloc16);
+    aMacDest.SetShort(kDestinationRloc16);
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + sizeof(payload));
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(64);
+    ip6Header.GetSource() = instance.Get<Mle::MleRouter>().GetMeshLocal16();
+    ip6Header.GetSource().mFields.m16[7] = Encoding::BigEndian::HostSwap16(kSourceRloc16);
+    ip6Header.GetDestination() = instance.Get<Mle::MleRouter>().GetMeshLocal16();
+    ip6Header.GetDestination().mFields.m16[7] = Encoding::BigEndian::HostSwap16(kDestinationRloc16);
+
+    udpHeader.SetSourcePort(kUdpPort);
+    udpHeader.SetDestinationPort(kUdpPort);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(payload));
+    udpHeader.SetChecksum(0x1234);
+
+    for (uint16_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<uint8_t>(i);
+    }
+
+    VerifyOrQuit((message = instance.Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL, "Message::New failed");
+    SuccessOrQuit(message->Append(&ip6Header, sizeof(ip6Header)), "Message::Append failed");
+    SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "Message::Append failed");
+    SuccessOrQuit(message->Append(payload, sizeof(payload)), "Message::Append failed");
+
+    return message;
+}
+
+void LowpanCompress(Context &aContext)
+{
+    Lowpan::Lowpan &lowpan = aContext.GetInstance().Get<Lowpan::Lowpan>();
+    Mac::Address    macSource;
+    Mac::Address    macDest;
+    uint8_t         frame[Mac::Frame::kMTU];
+    Message *       message = NewDatagram(aContext, macSource, macDest);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        Lowpan::BufferWriter buffer(frame, sizeof(frame));
+
+        message->SetOffset(0);
+        lowpan.Compress(*message, macSource, macDest, buffer);
+        aContext.Consume(static_cast<uint32_t>(buffer.GetWritePointer() - frame));
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+void LowpanDecompress(Context &aContext)
+{
+    Lowpan::Lowpan &lowpan = aContext.GetInstance().Get<Lowpan::Lowpan>();
+    Mac::Address    macSource;
+    Mac::Address    macDest;
+    uint8_t         frame[Mac::Frame::kMTU];
+    uint16_t        frameLength;
+    Message *       message = NewDatagram(aContext, macSource, macDest);
+
+    {
+        Lowpan::BufferWriter buffer(frame, sizeof(frame));
+
+        SuccessOrQuit(lowpan.Compress(*message, macSource, macDest, buffer), "Lowpan::Compress failed");
+        frameLength = static_cast<uint16_t>(buffer.GetWritePointer() - frame);
+        frameLength += message->Read(message->GetOffset(), message->GetLength() - message->GetOffset(),
+                                     frame + frameLength);
+    }
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        int headerLength;
+
+        message->SetLength(0);
+        message->SetOffset(0);
+        headerLength = lowpan.Decompress(*message, macSource, macDest, frame, frameLength, 0);
+        aContext.Consume(static_cast<uint32_t>(headerLength));
+    }
+
+    aContext.Stop();
+
+    VerifyOrQuit(message->GetLength() == sizeof(Ip6::Header) + sizeof(Ip6::UdpHeader), "Lowpan::Decompress failed");
+
+    message->Free();
+}
+
+} // namespace Benchmark
+} // namespace ot
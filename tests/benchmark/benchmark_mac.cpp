@@ -0,0 +1,204 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/instance.hpp"
+#include "crypto/aes_ccm.hpp"
+#include "mac/mac_frame.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kPanId            = 0xface,
+    kDstShort         = 0x0800,
+    kPayloadLength    = 80,
+    kMleHeaderLength  = 2 * sizeof(Ip6::Address) + 10,
+    kMlePayloadLength = 200,
+    kTagLength        = 4,
+    kNonceLength      = 13,
+};
+
+static const uint8_t sKey[] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+
+static const uint8_t sNonce[kNonceLength] = {
+    0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+};
+
+/**
+ * This function builds a secured data frame from an extended source to a short destination, as exchanged between a
+ * child and its parent.
+ *
+ */
+static void InitFrame(Mac::TxFrame &aFrame, uint8_t *aPsdu)
+{
+    Mac::ExtAddress extAddress;
+
+    for (uint8_t i = 0; i < sizeof(extAddress); i++)
+    {
+        extAddress.m8[i] = i;
+    }
+
+    aFrame.mPsdu = aPsdu;
+    aFrame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfAckRequest |
+                             Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfDstAddrShort |
+                             Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfSecurityEnabled,
+                         Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    aFrame.SetSequence(0x55);
+    aFrame.SetDstPanId(kPanId);
+    aFrame.SetDstAddr(static_cast<Mac::ShortAddress>(kDstShort));
+    aFrame.SetSrcAddr(extAddress);
+    aFrame.SetFrameCounter(5);
+    aFrame.SetKeyId(1);
+    aFrame.SetPayloadLength(kPayloadLength);
+
+    for (uint8_t i = 0; i < kPayloadLength; i++)
+    {
+        aFrame.GetPayload()[i] = i;
+    }
+
+    VerifyOrQuit(aFrame.ValidatePsdu() == OT_ERROR_NONE, "Mac::Frame::ValidatePsdu failed");
+}
+
+void MacFrameParse(Context &aContext)
+{
+    uint8_t      psdu[Mac::Frame::kMTU];
+    Mac::TxFrame txFrame;
+
+    InitFrame(txFrame, psdu);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        const Mac::Frame &frame = txFrame;
+        Mac::PanId        panId;
+        Mac::Address      dstAddress;
+        Mac::Address      srcAddress;
+        uint8_t           securityLevel;
+        uint8_t           keyIdMode;
+        uint32_t          frameCounter;
+        uint8_t           keyId;
+
+        SuccessOrQuit(frame.ValidatePsdu(), "Mac::Frame::ValidatePsdu failed");
+        frame.GetDstPanId(panId);
+        frame.GetDstAddr(dstAddress);
+        frame.GetSrcAddr(srcAddress);
+        frame.GetSecurityLevel(securityLevel);
+        frame.GetKeyIdMode(keyIdMode);
+        frame.GetFrameCounter(frameCounter);
+        frame.GetKeyId(keyId);
+
+        aContext.Consume(panId + dstAddress.GetShort() + srcAddress.GetExtended().m8[0] + securityLevel + keyIdMode +
+                         frameCounter + keyId + frame.GetPayloadLength());
+    }
+
+    aContext.Stop();
+}
+
+static void ProcessAesCcm(Context &aContext, bool aEncrypt)
+{
+    uint8_t        psdu[Mac::Frame::kMTU];
+    Mac::TxFrame   frame;
+    Crypto::AesCcm aesCcm;
+    uint8_t        headerLength;
+    uint8_t        tagLength;
+
+    InitFrame(frame, psdu);
+    headerLength = frame.GetHeaderLength();
+
+    aesCcm.SetKey(sKey, sizeof(sKey));
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        tagLength = kTagLength;
+
+        aesCcm.Init(headerLength, kPayloadLength, tagLength, sNonce, sizeof(sNonce));
+        aesCcm.Header(psdu, headerLength);
+        aesCcm.Payload(frame.GetPayload(), frame.GetPayload(), kPayloadLength, aEncrypt);
+        aesCcm.Finalize(frame.GetFooter(), &tagLength);
+        aContext.Consume(tagLength);
+    }
+
+    aContext.Stop();
+}
+
+void AesCcmEncrypt(Context &aContext)
+{
+    ProcessAesCcm(aContext, true);
+}
+
+void AesCcmDecrypt(Context &aContext)
+{
+    ProcessAesCcm(aContext, false);
+}
+
+void AesCcmMessage(Context &aContext)
+{
+    Message *      message;
+    uint8_t        header[kMleHeaderLength];
+    Crypto::AesCcm aesCcm;
+    uint8_t        tag[kTagLength];
+    uint8_t        tagLength;
+
+    memset(header, 0x5a, sizeof(header));
+
+    VerifyOrQuit((message = aContext.GetInstance().Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL,
+                 "Message::New failed");
+    SuccessOrQuit(message->SetLength(kMlePayloadLength), "Message::SetLength failed");
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        tagLength = kTagLength;
+
+        aesCcm.SetKey(aContext.GetInstance().Get<KeyManager>().GetCurrentMleKeyEcb());
+        aesCcm.Init(sizeof(header), kMlePayloadLength, tagLength, sNonce, sizeof(sNonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(*message, 0, kMlePayloadLength, true);
+        aesCcm.Finalize(tag, &tagLength);
+        aContext.Consume(tag[0]);
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+} // namespace Benchmark
+} // namespace ot
@@ -0,0 +1,171 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include <mbedtls/cmac.h>
+
+#include "common/instance.hpp"
+#include "crypto/pbkdf2_cmac.h"
+#include "meshcop/commissioner.hpp"
+
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kPbkdf2Iterations = 16384, ///< PBKDF2 iteration count used for the PSKc derivation.
+};
+
+static const char    kPassphrase[]  = "J01NME";
+static const char    kNetworkName[] = "OpenThread";
+static const uint8_t kSalt[]        = {'T', 'h', 'r', 'e', 'a', 'd', 0xde, 0xad, 0x00, 0xbe, 0xef, 0x00,
+                                0xca, 0xfe, 'O', 'p', 'e', 'n', 'T', 'h', 'r', 'e', 'a', 'd'};
+static const otExtendedPanId kExtPanId = {{0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe}};
+
+/**
+ * This function derives a key with PBKDF2 by calling `mbedtls_aes_cmac_prf_128()` for every iteration.
+ *
+ * This is the derivation `otPbkdf2Cmac()` used before its PRF key and CMAC subkey were prepared once per call. It is
+ * kept as the reference for the `pbkdf2.cmac` benchmark.
+ *
+ */
+static void DeriveReference(const uint8_t *aPassword,
+                            uint16_t       aPasswordLen,
+                            const uint8_t *aSalt,
+                            uint16_t       aSaltLen,
+                            uint32_t       aIterationCounter,
+                            uint8_t *      aKey)
+{
+    uint8_t prfInput[OT_PBKDF2_SALT_MAX_LEN + 4];
+    uint8_t prf[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    uint8_t block[MBEDTLS_CIPHER_BLKSIZE_MAX];
+
+    memcpy(prfInput, aSalt, aSaltLen);
+    prfInput[aSaltLen + 0] = 0;
+    prfInput[aSaltLen + 1] = 0;
+    prfInput[aSaltLen + 2] = 0;
+    prfInput[aSaltLen + 3] = 1;
+
+    mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, prfInput, aSaltLen + 4, prf);
+    memcpy(aKey, prf, sizeof(prf));
+
+    for (uint32_t i = 1; i < aIterationCounter; i++)
+    {
+        memcpy(block, prf, sizeof(block));
+        mbedtls_aes_cmac_prf_128(aPassword, aPasswordLen, block, sizeof(block), prf);
+
+        for (uint8_t j = 0; j < sizeof(prf); j++)
+        {
+            aKey[j] ^= prf[j];
+        }
+    }
+}
+
+void Pbkdf2CmacReference(Context &aContext)
+{
+    uint8_t key[OT_PSKC_MAX_SIZE];
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        DeriveReference(reinterpret_cast<const uint8_t *>(kPassphrase), sizeof(kPassphrase) - 1, kSalt, sizeof(kSalt),
+                        kPbkdf2Iterations, key);
+        aContext.Consume(key[0]);
+    }
+
+    aContext.Stop();
+}
+
+void Pbkdf2Cmac(Context &aContext)
+{
+    uint8_t key[OT_PSKC_MAX_SIZE];
+    uint8_t expected[OT_PSKC_MAX_SIZE];
+
+    // Both derivations must agree for the comparison to be meaningful.
+    DeriveReference(reinterpret_cast<const uint8_t *>(kPassphrase), sizeof(kPassphrase) - 1, kSalt, sizeof(kSalt),
+                    kPbkdf2Iterations, expected);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        otPbkdf2Cmac(reinterpret_cast<const uint8_t *>(kPassphrase), sizeof(kPassphrase) - 1, kSalt, sizeof(kSalt),
+                     kPbkdf2Iterations, sizeof(key), key);
+        aContext.Consume(key[0]);
+    }
+
+    aContext.Stop();
+
+    VerifyOrQuit(memcmp(key, expected, sizeof(key)) == 0, "otPbkdf2Cmac() differs from the reference");
+}
+
+void PskcGenerate(Context &aContext)
+{
+    uint8_t pskc[OT_PSKC_MAX_SIZE];
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        SuccessOrQuit(MeshCoP::Commissioner::GeneratePSKc(kPassphrase, kNetworkName, static_cast<const Mac::ExtendedPanId &>(kExtPanId), pskc),
+                      "Commissioner::GeneratePSKc failed");
+        aContext.Consume(pskc[0]);
+    }
+
+    aContext.Stop();
+}
+
+void PskcCached(Context &aContext)
+{
+    MeshCoP::Commissioner &commissioner = aContext.GetInstance().Get<MeshCoP::Commissioner>();
+    uint8_t                pskc[OT_PSKC_MAX_SIZE];
+
+    SuccessOrQuit(commissioner.GetPSKc(kPassphrase, kNetworkName, static_cast<const Mac::ExtendedPanId &>(kExtPanId), pskc), "Commissioner::GetPSKc failed");
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        SuccessOrQuit(commissioner.GetPSKc(kPassphrase, kNetworkName, static_cast<const Mac::ExtendedPanId &>(kExtPanId), pskc),
+                      "Commissioner::GetPSKc failed");
+        aContext.Consume(pskc[0]);
+    }
+
+    aContext.Stop();
+}
+
+} // namespace Benchmark
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
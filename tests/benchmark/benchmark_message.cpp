@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kMessageLength = 1280, ///< IPv6 minimum MTU, spans several message buffers.
+    kAccessOffset  = 600,
+    kAccessLength  = 64,
+};
+
+static Message *NewMessage(Context &aContext)
+{
+    Message *message;
+    uint8_t  data[kMessageLength];
+
+    for (uint16_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    VerifyOrQuit((message = aContext.GetInstance().Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL,
+                 "Message::New failed");
+    SuccessOrQuit(message->Append(data, sizeof(data)), "Message::Append failed");
+
+    return message;
+}
+
+void MessageRead(Context &aContext)
+{
+    Message *message = NewMessage(aContext);
+    uint8_t  buffer[kAccessLength];
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        aContext.Consume(message->Read(kAccessOffset, sizeof(buffer), buffer));
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+void MessageWrite(Context &aContext)
+{
+    Message *message = NewMessage(aContext);
+    uint8_t  buffer[kAccessLength];
+
+    memset(buffer, 0xa5, sizeof(buffer));
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        aContext.Consume(static_cast<uint32_t>(message->Write(kAccessOffset, sizeof(buffer), buffer)));
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+void MessageClone(Context &aContext)
+{
+    Message *message = NewMessage(aContext);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        uint16_t freeBuffers = aContext.GetFreeBufferCount();
+        Message *clone       = message->Clone();
+
+        VerifyOrQuit(clone != NULL, "Message::Clone failed");
+        aContext.AddAllocations(static_cast<uint32_t>(freeBuffers - aContext.GetFreeBufferCount()));
+        clone->Free();
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+} // namespace Benchmark
+} // namespace ot
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/instance.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/router_table.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+/**
+ * This function fills the router table with `kMaxRouters` routers, every other one a neighbor and the others reached
+ * through the preceding neighbor.
+ *
+ */
+static void PopulateRouterTable(Context &aContext)
+{
+    RouterTable &routerTable = aContext.GetInstance().Get<RouterTable>();
+
+    routerTable.Clear();
+
+    for (uint8_t routerId = 0; routerId < Mle::kMaxRouters; routerId++)
+    {
+        Router *router = routerTable.Allocate(routerId);
+
+        VerifyOrQuit(router != NULL, "RouterTable::Allocate failed");
+
+        if ((routerId % 2) == 0)
+        {
+            router->SetState(Neighbor::kStateValid);
+            router->SetLinkQualityOut(3);
+            router->GetLinkInfo().AddRss(-100, -60);
+            router->SetNextHop(Mle::kInvalidRouterId);
+        }
+        else
+        {
+            router->SetNextHop(routerId - 1);
+            router->SetCost(2);
+        }
+    }
+}
+
+void MleRouteTlv(Context &aContext)
+{
+    Mle::MleRouter &mleRouter = aContext.GetInstance().Get<Mle::MleRouter>();
+
+    PopulateRouterTable(aContext);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        Mle::RouteTlv tlv;
+
+        tlv.Init();
+        mleRouter.FillRouteTlv(tlv);
+        aContext.Consume(tlv.GetRouteDataLength());
+    }
+
+    aContext.Stop();
+
+    aContext.GetInstance().Get<RouterTable>().Clear();
+}
+
+void MleRouteTlvCached(Context &aContext)
+{
+    Mle::MleRouter &mleRouter = aContext.GetInstance().Get<Mle::MleRouter>();
+
+    PopulateRouterTable(aContext);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        aContext.Consume(mleRouter.GetRouteTlv().GetRouteDataLength());
+    }
+
+    aContext.Stop();
+
+    aContext.GetInstance().Get<RouterTable>().Clear();
+}
+
+} // namespace Benchmark
+} // namespace ot
@@ -0,0 +1,182 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "ncp/hdlc.hpp"
+#include "ncp/spinel.h"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+enum
+{
+    kFrameLength  = 127,
+    kBufferLength = 2 * (kFrameLength + 16), ///< Worst case HDLC encoding with flags and FCS.
+    kStreamPropId = SPINEL_PROP_STREAM_RAW,
+};
+
+/**
+ * The spinel format of a received frame (`SPINEL_PROP_STREAM_RAW`): header, command, property, PSDU, RSSI, noise
+ * floor and flags.
+ *
+ */
+#define BENCHMARK_STREAM_RAW_FORMAT                                                                         \
+    SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S SPINEL_DATATYPE_INT8_S SPINEL_DATATYPE_INT8_S \
+        SPINEL_DATATYPE_UINT16_S
+
+/**
+ * This function fills a frame with a pattern that includes the HDLC flag and escape bytes.
+ *
+ */
+static void InitFrame(uint8_t *aFrame)
+{
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        aFrame[i] = static_cast<uint8_t>(i * 7);
+    }
+}
+
+static void HandleFrame(void *aContext, otError aError)
+{
+    *static_cast<otError *>(aContext) = aError;
+}
+
+void HdlcEncode(Context &aContext)
+{
+    uint8_t                          frame[kFrameLength];
+    Hdlc::FrameBuffer<kBufferLength> buffer;
+    Hdlc::Encoder                    encoder(buffer);
+
+    InitFrame(frame);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        buffer.Clear();
+        encoder.BeginFrame();
+        encoder.Encode(frame, sizeof(frame));
+        encoder.EndFrame();
+        aContext.Consume(buffer.GetLength());
+    }
+
+    aContext.Stop();
+}
+
+void HdlcDecode(Context &aContext)
+{
+    uint8_t                          frame[kFrameLength];
+    Hdlc::FrameBuffer<kBufferLength> encoderBuffer;
+    Hdlc::Encoder                    encoder(encoderBuffer);
+    Hdlc::FrameBuffer<kBufferLength> decoderBuffer;
+    otError                          result = OT_ERROR_FAILED;
+    Hdlc::Decoder                    decoder(decoderBuffer, HandleFrame, &result);
+
+    InitFrame(frame);
+
+    SuccessOrQuit(encoder.BeginFrame(), "Hdlc::Encoder::BeginFrame failed");
+    SuccessOrQuit(encoder.Encode(frame, sizeof(frame)), "Hdlc::Encoder::Encode failed");
+    SuccessOrQuit(encoder.EndFrame(), "Hdlc::Encoder::EndFrame failed");
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        decoderBuffer.Clear();
+        decoder.Decode(encoderBuffer.GetFrame(), encoderBuffer.GetLength());
+        aContext.Consume(decoderBuffer.GetLength());
+    }
+
+    aContext.Stop();
+
+    SuccessOrQuit(result, "Hdlc::Decoder::Decode failed");
+    VerifyOrQuit(decoderBuffer.GetLength() == sizeof(frame), "Hdlc::Decoder::Decode length mismatch");
+}
+
+void SpinelPack(Context &aContext)
+{
+    uint8_t frame[kFrameLength];
+    uint8_t buffer[kBufferLength];
+
+    InitFrame(frame);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        spinel_ssize_t length = spinel_datatype_pack(
+            buffer, sizeof(buffer), BENCHMARK_STREAM_RAW_FORMAT, SPINEL_HEADER_FLAG, SPINEL_CMD_PROP_VALUE_IS,
+            kStreamPropId, frame, static_cast<uint32_t>(sizeof(frame)), -40, -100, 0);
+
+        aContext.Consume(static_cast<uint32_t>(length));
+    }
+
+    aContext.Stop();
+}
+
+void SpinelUnpack(Context &aContext)
+{
+    uint8_t        frame[kFrameLength];
+    uint8_t        buffer[kBufferLength];
+    spinel_ssize_t bufferLength;
+
+    InitFrame(frame);
+
+    bufferLength = spinel_datatype_pack(buffer, sizeof(buffer), BENCHMARK_STREAM_RAW_FORMAT, SPINEL_HEADER_FLAG,
+                                        SPINEL_CMD_PROP_VALUE_IS, kStreamPropId, frame,
+                                        static_cast<uint32_t>(sizeof(frame)), -40, -100, 0);
+    VerifyOrQuit(bufferLength > 0, "spinel_datatype_pack failed");
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        uint8_t        header;
+        unsigned int   command;
+        unsigned int   propId;
+        const uint8_t *psdu;
+        unsigned int   psduLength;
+        int8_t         rssi;
+        int8_t         noiseFloor;
+        uint16_t       flags;
+        spinel_ssize_t length;
+
+        length = spinel_datatype_unpack(buffer, static_cast<spinel_size_t>(bufferLength), BENCHMARK_STREAM_RAW_FORMAT,
+                                        &header, &command, &propId, &psdu, &psduLength, &rssi, &noiseFloor, &flags);
+
+        aContext.Consume(static_cast<uint32_t>(length) + psduLength);
+    }
+
+    aContext.Stop();
+}
+
+} // namespace Benchmark
+} // namespace ot
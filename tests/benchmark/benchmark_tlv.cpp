@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/tlvs.hpp"
+#include "thread/mle_tlvs.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+namespace Benchmark {
+
+/**
+ * The TLVs of a Child ID Request, in the order they are appended and looked up by `MleRouter::HandleChildIdRequest()`.
+ *
+ */
+static const struct
+{
+    Mle::Tlv::Type mType;
+    uint8_t        mLength;
+} kChildIdRequestTlvs[] = {
+    {Mle::Tlv::kResponse, 8},         {Mle::Tlv::kLinkFrameCounter, 4},     {Mle::Tlv::kMleFrameCounter, 4},
+    {Mle::Tlv::kMode, 1},             {Mle::Tlv::kTimeout, 4},              {Mle::Tlv::kVersion, 2},
+    {Mle::Tlv::kTlvRequest, 2},       {Mle::Tlv::kAddressRegistration, 19}, {Mle::Tlv::kActiveTimestamp, 8},
+    {Mle::Tlv::kPendingTimestamp, 8},
+};
+
+static Message *NewChildIdRequest(Context &aContext)
+{
+    Message *message;
+    uint8_t  value[32];
+
+    memset(value, 0, sizeof(value));
+
+    VerifyOrQuit((message = aContext.GetInstance().Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL,
+                 "Message::New failed");
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(kChildIdRequestTlvs); i++)
+    {
+        Tlv tlv;
+
+        tlv.SetType(static_cast<uint8_t>(kChildIdRequestTlvs[i].mType));
+        tlv.SetLength(kChildIdRequestTlvs[i].mLength);
+        SuccessOrQuit(message->Append(&tlv, sizeof(tlv)), "Message::Append failed");
+        SuccessOrQuit(message->Append(value, tlv.GetLength()), "Message::Append failed");
+    }
+
+    return message;
+}
+
+static void ParseChildIdRequest(Context &aContext, bool aUseIndex)
+{
+    Message *message = NewChildIdRequest(aContext);
+
+    aContext.Start();
+
+    for (uint32_t i = 0; i < aContext.GetIterations(); i++)
+    {
+        TlvIndex index;
+
+        if (aUseIndex)
+        {
+            index.Attach(*message);
+        }
+
+        for (uint8_t j = 0; j < OT_ARRAY_LENGTH(kChildIdRequestTlvs); j++)
+        {
+            uint16_t offset;
+
+            Mle::Tlv::GetOffset(*message, kChildIdRequestTlvs[j].mType, offset);
+            aContext.Consume(offset);
+        }
+    }
+
+    aContext.Stop();
+
+    message->Free();
+}
+
+void MleParse(Context &aContext)
+{
+    ParseChildIdRequest(aContext, false);
+}
+
+void MleParseIndexed(Context &aContext)
+{
+    ParseChildIdRequest(aContext, true);
+}
+
+} // namespace Benchmark
+} // namespace ot
@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+#  Copyright (c) 2019, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+cd $(dirname $0)
+cd ../..
+
+display_usage() {
+    echo ""
+    echo "Simulator build script "
+    echo ""
+    echo "Usage: $(basename $0) [options]"
+    echo ""
+    echo "Options:"
+    echo "        -c/--enable-coverage  Enable code coverage"
+    echo ""
+}
+
+die() {
+    echo " *** ERROR: " $*
+    exit 1
+}
+
+coverage=no
+
+while [ $# -ge 1 ]
+do
+    case $1 in
+        -c|--enable-coverage)
+            coverage=yes
+            shift
+            ;;
+        *)
+            echo "Error: Unknown option \"$1\""
+            display_usage
+            exit 1
+            ;;
+    esac
+done
+
+cppflags_config='-DOPENTHREAD_PROJECT_CORE_CONFIG_FILE=\"../tests/simulator/openthread-core-simulator-config.h\"'
+
+echo "===================================================================================================="
+echo "Building OpenThread in-process simulator"
+echo "===================================================================================================="
+./bootstrap || die
+./configure                                 \
+    CPPFLAGS="$cppflags_config"             \
+    --enable-coverage=${coverage}           \
+    --enable-ftd                            \
+    --enable-simulator                      \
+    --disable-docs                          \
+    --disable-tests || die
+make -j 8 || die
+
+exit 0
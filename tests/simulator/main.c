@@ -0,0 +1,104 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the command line entry point of the in-process simulator.
+ */
+
+#include "simulator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static void Usage(const char *aProgram)
+{
+    fprintf(stderr, "Usage: %s [-s seed] [-v] [script]\n", aProgram);
+    fprintf(stderr, "    -s seed  Seed of the random number generator (default: time based).\n");
+    fprintf(stderr, "    -v       Print the OpenThread logs.\n");
+    fprintf(stderr, "The script is read from the standard input if no file is given.\n");
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t    seed   = (uint32_t)time(NULL);
+    FILE *      script = stdin;
+    const char *name   = "<stdin>";
+    int         failures;
+    int         option;
+
+    while ((option = getopt(argc, argv, "s:vh")) != -1)
+    {
+        switch (option)
+        {
+        case 's':
+            seed = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+
+        case 'v':
+            SimSetLogEnabled(true);
+            break;
+
+        default:
+            Usage(argv[0]);
+            return (option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (optind < argc)
+    {
+        name   = argv[optind];
+        script = fopen(name, "r");
+
+        if (script == NULL)
+        {
+            perror(name);
+            return EXIT_FAILURE;
+        }
+    }
+
+    printf("seed %u\n", seed);
+
+    SimInit(seed);
+    failures = SimScriptRun(script, name);
+    SimDeinit();
+
+    if (script != stdin)
+    {
+        fclose(script);
+    }
+
+    if (failures > 0)
+    {
+        fprintf(stderr, "%s: %d failure(s)\n", name, failures);
+    }
+
+    return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OPENTHREAD_CORE_SIMULATOR_CONFIG_H_
+#define OPENTHREAD_CORE_SIMULATOR_CONFIG_H_
+
+/**
+ * This header file defines the OpenThread core configuration options used by the in-process simulator.
+ *
+ */
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_INFO
+ *
+ * The platform-specific string to insert into the OpenThread version string.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_INFO "SIMULATOR"
+
+/**
+ * @def OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+ *
+ * Define to 1 to enable multiple instance support. All simulated nodes are hosted in a single process.
+ *
+ */
+#define OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+ *
+ * Define to 1 to enable the microsecond timer, the software CSMA-CA backoff then has the resolution of the standard.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+ *
+ * The maximum number of children. Large topologies need more than the default to fit in 32 routers.
+ *
+ */
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 32
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE
+ *
+ * Define to 1 to save the router table snapshot, so that the `reset` command exercises fast router re-attach.
+ *
+ */
+#define OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL
+ *
+ * The interval (in seconds) at which the router table snapshot is taken.
+ *
+ */
+#define OPENTHREAD_CONFIG_MLE_ROUTER_TABLE_SNAPSHOT_INTERVAL 60
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE
+ *
+ * Define to 1 to scan all channels at once on the nodes enabled with the `multichannel` command.
+ *
+ */
+#define OPENTHREAD_CONFIG_MAC_MULTI_CHANNEL_SCAN_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+ *
+ * Define to 1 to support the `polllatency` and `pollstats` commands.
+ *
+ */
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+ *
+ * Define to 1 to send several frames per data poll between parents and sleepy children.
+ *
+ */
+#define OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_OUTPUT
+ *
+ * The simulator prints the logs of all nodes prefixed with the virtual time and the node identifier.
+ *
+ */
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+
+#endif /* OPENTHREAD_CORE_SIMULATOR_CONFIG_H_ */
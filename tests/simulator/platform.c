@@ -0,0 +1,963 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the OpenThread platform abstraction of the simulated nodes.
+ *
+ *   Every platform call is dispatched to the `SimNode` hosting the calling instance. Calls without an instance
+ *   argument (e.g. logging or entropy) use the node whose code is currently running.
+ */
+
+#include "simulator.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/entropy.h>
+#include <openthread/platform/logging.h>
+#include <openthread/platform/memory.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/radio.h>
+#include <openthread/platform/settings.h>
+
+#include "utils/code_utils.h"
+
+enum
+{
+    IEEE802154_FRAME_TYPE_MASK   = 0x7,
+    IEEE802154_FRAME_TYPE_ACK    = 0x2,
+    IEEE802154_FRAME_TYPE_MACCMD = 0x3,
+    IEEE802154_SECURITY_ENABLED  = 1 << 3,
+    IEEE802154_FRAME_PENDING     = 1 << 4,
+    IEEE802154_ACK_REQUEST       = 1 << 5,
+    IEEE802154_PANID_COMPRESSION = 1 << 6,
+
+    IEEE802154_DST_ADDR_MASK  = 3 << 2,
+    IEEE802154_DST_ADDR_NONE  = 0 << 2,
+    IEEE802154_DST_ADDR_SHORT = 2 << 2,
+    IEEE802154_DST_ADDR_EXT   = 3 << 2,
+    IEEE802154_SRC_ADDR_MASK  = 3 << 6,
+    IEEE802154_SRC_ADDR_SHORT = 2 << 6,
+    IEEE802154_SRC_ADDR_EXT   = 3 << 6,
+
+    IEEE802154_DSN_OFFSET     = 2,
+    IEEE802154_DSTPAN_OFFSET  = 3,
+    IEEE802154_DSTADDR_OFFSET = 5,
+
+    IEEE802154_SEC_LEVEL_MASK   = 7 << 0,
+    IEEE802154_KEY_ID_MODE_MASK = 3 << 3,
+    IEEE802154_KEY_ID_MODE_0    = 0 << 3,
+    IEEE802154_KEY_ID_MODE_1    = 1 << 3,
+    IEEE802154_KEY_ID_MODE_2    = 2 << 3,
+    IEEE802154_KEY_ID_MODE_3    = 3 << 3,
+
+    IEEE802154_MACCMD_DATA_REQ = 4,
+    IEEE802154_BROADCAST       = 0xffff,
+    IEEE802154_ACK_LENGTH      = 5,
+};
+
+static SimNode *GetNode(otInstance *aInstance)
+{
+    return SimGetNodeByInstance(aInstance);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Simulator hooks
+
+void SimPlatformInitNode(SimNode *aNode)
+{
+    aNode->mAlarmMilli.mRunning = false;
+    aNode->mAlarmMilli.mGeneration++;
+    aNode->mAlarmMicro.mRunning = false;
+    aNode->mAlarmMicro.mGeneration++;
+
+    aNode->mRadioState   = OT_RADIO_STATE_DISABLED;
+    aNode->mChannel      = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN;
+    aNode->mPanId        = IEEE802154_BROADCAST;
+    aNode->mShortAddress = IEEE802154_BROADCAST;
+    aNode->mPromiscuous  = false;
+    aNode->mTxPower      = 0;
+    aNode->mTxEndTime    = 0;
+    aNode->mTxGeneration++;
+    aNode->mRxChannelMask = 0;
+
+    aNode->mSrcMatchEnabled    = false;
+    aNode->mSrcMatchShortCount = 0;
+    aNode->mSrcMatchExtCount   = 0;
+    aNode->mTxFrame.mPsdu      = aNode->mTxPsdu;
+    aNode->mRxFrame.mPsdu      = aNode->mRxPsdu;
+    aNode->mAckFrame.mPsdu     = aNode->mAckPsdu;
+    memset(&aNode->mExtAddress, 0, sizeof(aNode->mExtAddress));
+}
+
+void SimPlatformDeinitNode(SimNode *aNode)
+{
+    for (uint16_t i = 0; i < aNode->mSettingsCount; i++)
+    {
+        free(aNode->mSettings[i].mValue);
+    }
+
+    free(aNode->mSettings);
+    aNode->mSettings      = NULL;
+    aNode->mSettingsCount = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Tasklets
+
+void otTaskletsSignalPending(otInstance *aInstance)
+{
+    SimSignalTasklets(GetNode(aInstance));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Alarm
+
+static void StartAlarm(SimNode *aNode, SimAlarm *aAlarm, SimEventType aType, uint64_t aFireTime)
+{
+    aAlarm->mRunning = true;
+    aAlarm->mGeneration++;
+
+    SimScheduleEvent(aNode, aType, aFireTime, aAlarm->mGeneration);
+}
+
+static void StopAlarm(SimAlarm *aAlarm)
+{
+    aAlarm->mRunning = false;
+    aAlarm->mGeneration++;
+}
+
+static bool HandleAlarmEvent(SimAlarm *aAlarm, uint32_t aGeneration)
+{
+    bool fired = aAlarm->mRunning && (aGeneration == aAlarm->mGeneration);
+
+    if (fired)
+    {
+        aAlarm->mRunning = false;
+    }
+
+    return fired;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return (uint32_t)(SimGetNow() / 1000);
+}
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    SimNode *node  = GetNode(aInstance);
+    uint64_t now   = SimGetNow() / 1000;
+    int32_t  delta = (int32_t)(aT0 + aDt - (uint32_t)now);
+
+    StartAlarm(node, &node->mAlarmMilli, SIM_EVENT_ALARM_MILLI, (now + (uint64_t)((delta < 0) ? 0 : delta)) * 1000);
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance)
+{
+    StopAlarm(&GetNode(aInstance)->mAlarmMilli);
+}
+
+void SimPlatformAlarmMilliFired(SimNode *aNode, uint32_t aGeneration)
+{
+    if (HandleAlarmEvent(&aNode->mAlarmMilli, aGeneration))
+    {
+        otPlatAlarmMilliFired(aNode->mInstance);
+    }
+}
+
+uint32_t otPlatAlarmMicroGetNow(void)
+{
+    return (uint32_t)SimGetNow();
+}
+
+void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    SimNode *node  = GetNode(aInstance);
+    uint64_t now   = SimGetNow();
+    int32_t  delta = (int32_t)(aT0 + aDt - (uint32_t)now);
+
+    StartAlarm(node, &node->mAlarmMicro, SIM_EVENT_ALARM_MICRO, now + (uint64_t)((delta < 0) ? 0 : delta));
+}
+
+void otPlatAlarmMicroStop(otInstance *aInstance)
+{
+    StopAlarm(&GetNode(aInstance)->mAlarmMicro);
+}
+
+void SimPlatformAlarmMicroFired(SimNode *aNode, uint32_t aGeneration)
+{
+    if (HandleAlarmEvent(&aNode->mAlarmMicro, aGeneration))
+    {
+        otPlatAlarmMicroFired(aNode->mInstance);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Radio
+
+static bool IsAckRequested(const uint8_t *aPsdu)
+{
+    return (aPsdu[0] & IEEE802154_ACK_REQUEST) != 0;
+}
+
+static bool IsPanIdCompressed(const uint8_t *aPsdu)
+{
+    return (aPsdu[0] & IEEE802154_PANID_COMPRESSION) != 0;
+}
+
+static bool FindSrcMatchShort(const SimNode *aNode, otShortAddress aShortAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aNode->mSrcMatchShortCount && !found; i++)
+    {
+        found = (aNode->mSrcMatchShort[i] == aShortAddress);
+    }
+
+    return found;
+}
+
+static bool FindSrcMatchExt(const SimNode *aNode, const uint8_t *aExtAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aNode->mSrcMatchExtCount && !found; i++)
+    {
+        found = (memcmp(aNode->mSrcMatchExt[i].m8, aExtAddress, sizeof(otExtAddress)) == 0);
+    }
+
+    return found;
+}
+
+static bool IsDataRequestAndHasFramePending(const SimNode *aNode, const uint8_t *aPsdu)
+{
+    const uint8_t *cur             = aPsdu + IEEE802154_DSTPAN_OFFSET;
+    bool           isDataRequest   = false;
+    bool           hasFramePending = false;
+
+    otEXPECT((aPsdu[0] & IEEE802154_FRAME_TYPE_MASK) == IEEE802154_FRAME_TYPE_MACCMD);
+
+    switch (aPsdu[1] & IEEE802154_DST_ADDR_MASK)
+    {
+    case IEEE802154_DST_ADDR_SHORT:
+        cur += sizeof(otPanId) + sizeof(otShortAddress);
+        break;
+
+    case IEEE802154_DST_ADDR_EXT:
+        cur += sizeof(otPanId) + sizeof(otExtAddress);
+        break;
+
+    default:
+        goto exit;
+    }
+
+    if (!IsPanIdCompressed(aPsdu))
+    {
+        cur += sizeof(otPanId);
+    }
+
+    switch (aPsdu[1] & IEEE802154_SRC_ADDR_MASK)
+    {
+    case IEEE802154_SRC_ADDR_SHORT:
+        hasFramePending = aNode->mSrcMatchEnabled && FindSrcMatchShort(aNode, (otShortAddress)(cur[1] << 8 | cur[0]));
+        cur += sizeof(otShortAddress);
+        break;
+
+    case IEEE802154_SRC_ADDR_EXT:
+        hasFramePending = aNode->mSrcMatchEnabled && FindSrcMatchExt(aNode, cur);
+        cur += sizeof(otExtAddress);
+        break;
+
+    default:
+        goto exit;
+    }
+
+    if (aPsdu[0] & IEEE802154_SECURITY_ENABLED)
+    {
+        uint8_t securityControl = *cur;
+
+        if (securityControl & IEEE802154_SEC_LEVEL_MASK)
+        {
+            cur += 1 + 4;
+        }
+
+        switch (securityControl & IEEE802154_KEY_ID_MODE_MASK)
+        {
+        case IEEE802154_KEY_ID_MODE_1:
+            cur += 1;
+            break;
+
+        case IEEE802154_KEY_ID_MODE_2:
+            cur += 5;
+            break;
+
+        case IEEE802154_KEY_ID_MODE_3:
+            cur += 9;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    isDataRequest = (cur[0] == IEEE802154_MACCMD_DATA_REQ);
+
+exit:
+    return isDataRequest && hasFramePending;
+}
+
+/**
+ * This function applies the receive address filter of a node.
+ *
+ * @returns TRUE if @p aNode accepts the frame, FALSE otherwise.
+ *
+ */
+static bool AcceptFrame(const SimNode *aNode, const uint8_t *aPsdu)
+{
+    bool    accept = false;
+    otPanId dstPanId;
+
+    otEXPECT_ACTION(!aNode->mPromiscuous, accept = true);
+
+    dstPanId = (otPanId)(aPsdu[IEEE802154_DSTPAN_OFFSET + 1] << 8 | aPsdu[IEEE802154_DSTPAN_OFFSET]);
+
+    switch (aPsdu[1] & IEEE802154_DST_ADDR_MASK)
+    {
+    case IEEE802154_DST_ADDR_NONE:
+        accept = true;
+        break;
+
+    case IEEE802154_DST_ADDR_SHORT:
+    {
+        otShortAddress dstShort =
+            (otShortAddress)(aPsdu[IEEE802154_DSTADDR_OFFSET + 1] << 8 | aPsdu[IEEE802154_DSTADDR_OFFSET]);
+
+        accept = (dstPanId == IEEE802154_BROADCAST || dstPanId == aNode->mPanId) &&
+                 (dstShort == IEEE802154_BROADCAST || dstShort == aNode->mShortAddress);
+        break;
+    }
+
+    case IEEE802154_DST_ADDR_EXT:
+        accept = (dstPanId == IEEE802154_BROADCAST || dstPanId == aNode->mPanId) &&
+                 (memcmp(&aPsdu[IEEE802154_DSTADDR_OFFSET], aNode->mExtAddress.m8, sizeof(otExtAddress)) == 0);
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return accept;
+}
+
+static bool IsLinkUp(uint16_t aFrom, uint16_t aTo)
+{
+    uint8_t loss = SimGetLinkLoss(aFrom, aTo);
+
+    return (loss == 0) || ((loss < SIM_LINK_NONE) && (SimGetRandom() % 100) >= loss);
+}
+
+/**
+ * This function delivers a frame to a receiving node.
+ *
+ * @returns TRUE if the receiver acknowledged the frame, FALSE otherwise.
+ *
+ */
+static bool DeliverFrame(SimNode *aSender, SimNode *aReceiver)
+{
+    const otRadioFrame *frame = &aSender->mTxFrame;
+    bool                acked = false;
+
+    otEXPECT(SimGetLinkLoss(aSender->mId, aReceiver->mId) < SIM_LINK_NONE);
+    otEXPECT(aReceiver->mRadioState == OT_RADIO_STATE_RECEIVE &&
+             (aReceiver->mChannel == frame->mChannel || (aReceiver->mRxChannelMask & (1UL << frame->mChannel)) != 0));
+
+    if (!IsLinkUp(aSender->mId, aReceiver->mId))
+    {
+        SimGetStats()->mFramesLost++;
+        goto exit;
+    }
+
+    otEXPECT(AcceptFrame(aReceiver, frame->mPsdu));
+
+    memcpy(aReceiver->mRxPsdu, frame->mPsdu, frame->mLength);
+    aReceiver->mRxFrame.mLength                              = frame->mLength;
+    aReceiver->mRxFrame.mChannel                             = frame->mChannel;
+    aReceiver->mRxFrame.mInfo.mRxInfo.mTimestamp             = SimGetNow();
+    aReceiver->mRxFrame.mInfo.mRxInfo.mRssi                  = SIM_RADIO_RSSI;
+    aReceiver->mRxFrame.mInfo.mRxInfo.mLqi                   = OT_RADIO_LQI_NONE;
+    aReceiver->mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = false;
+
+    if (!aReceiver->mPromiscuous && IsAckRequested(frame->mPsdu) && IsLinkUp(aReceiver->mId, aSender->mId))
+    {
+        acked = true;
+
+        aSender->mAckPsdu[0] = IEEE802154_FRAME_TYPE_ACK;
+        aSender->mAckPsdu[1] = 0;
+        aSender->mAckPsdu[2] = frame->mPsdu[IEEE802154_DSN_OFFSET];
+
+        if (IsDataRequestAndHasFramePending(aReceiver, frame->mPsdu))
+        {
+            aSender->mAckPsdu[0] |= IEEE802154_FRAME_PENDING;
+            aReceiver->mRxFrame.mInfo.mRxInfo.mAckedWithFramePending = true;
+        }
+
+        aSender->mAckFrame.mLength  = IEEE802154_ACK_LENGTH;
+        aSender->mAckFrame.mChannel = frame->mChannel;
+    }
+
+    SimGetStats()->mFramesReceived++;
+    aReceiver->mRxFrames++;
+
+    SimSetCurrentNode(aReceiver);
+    otPlatRadioReceiveDone(aReceiver->mInstance, &aReceiver->mRxFrame, OT_ERROR_NONE);
+    SimSetCurrentNode(aSender);
+
+exit:
+    return acked;
+}
+
+/**
+ * This function indicates whether a neighbor of @p aNode is currently transmitting on its channel.
+ *
+ */
+static bool IsChannelBusy(const SimNode *aNode)
+{
+    uint64_t now  = SimGetNow();
+    bool     busy = false;
+
+    for (uint16_t id = 1; id <= SimGetNodeCount() && !busy; id++)
+    {
+        const SimNode *neighbor = SimGetNode(id);
+
+        busy = (neighbor != aNode) && (neighbor->mTxEndTime > now) &&
+               (neighbor->mTxFrame.mChannel == aNode->mTxFrame.mChannel) &&
+               (SimGetLinkLoss(id, aNode->mId) < SIM_LINK_NONE);
+    }
+
+    return busy;
+}
+
+void SimPlatformRadioTxStart(SimNode *aNode)
+{
+    uint64_t duration = (uint64_t)(aNode->mTxFrame.mLength + SIM_PHY_HEADER_SIZE) * SIM_SYMBOLS_PER_OCTET *
+                        SIM_SYMBOL_TIME;
+
+    if (IsChannelBusy(aNode))
+    {
+        SimGetStats()->mCcaFailures++;
+        aNode->mRadioState = OT_RADIO_STATE_RECEIVE;
+        otPlatRadioTxDone(aNode->mInstance, &aNode->mTxFrame, NULL, OT_ERROR_CHANNEL_ACCESS_FAILURE);
+    }
+    else
+    {
+        aNode->mTxEndTime = SimGetNow() + duration;
+        otPlatRadioTxStarted(aNode->mInstance, &aNode->mTxFrame);
+        SimScheduleEvent(aNode, SIM_EVENT_RADIO_TX_DONE, aNode->mTxEndTime, aNode->mTxGeneration);
+    }
+}
+
+void SimPlatformRadioTxDone(SimNode *aNode)
+{
+    bool acked = false;
+
+    SimGetStats()->mFramesSent++;
+    aNode->mTxFrames++;
+
+    for (uint16_t id = 1; id <= SimGetNodeCount(); id++)
+    {
+        SimNode *receiver = SimGetNode(id);
+
+        if (receiver != aNode && DeliverFrame(aNode, receiver))
+        {
+            acked = true;
+        }
+    }
+
+    aNode->mRadioState = OT_RADIO_STATE_RECEIVE;
+
+    if (!IsAckRequested(aNode->mTxFrame.mPsdu))
+    {
+        otPlatRadioTxDone(aNode->mInstance, &aNode->mTxFrame, NULL, OT_ERROR_NONE);
+    }
+    else if (acked)
+    {
+        otPlatRadioTxDone(aNode->mInstance, &aNode->mTxFrame, &aNode->mAckFrame, OT_ERROR_NONE);
+    }
+    else
+    {
+        otPlatRadioTxDone(aNode->mInstance, &aNode->mTxFrame, NULL, OT_ERROR_NO_ACK);
+    }
+}
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    otRadioCaps caps = OT_RADIO_CAPS_ACK_TIMEOUT;
+
+    if (GetNode(aInstance)->mMultiChannelRx)
+    {
+        caps |= OT_RADIO_CAPS_MULTI_CHANNEL_RX;
+    }
+
+    return caps;
+}
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    SimNode *node = GetNode(aInstance);
+
+    aIeeeEui64[0] = 0x18;
+    aIeeeEui64[1] = 0xb4;
+    aIeeeEui64[2] = 0x30;
+    aIeeeEui64[3] = 0x00;
+    aIeeeEui64[4] = 0x00;
+    aIeeeEui64[5] = 0x00;
+    aIeeeEui64[6] = (uint8_t)(node->mId >> 8);
+    aIeeeEui64[7] = (uint8_t)(node->mId & 0xff);
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId)
+{
+    GetNode(aInstance)->mPanId = aPanId;
+}
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    // The MAC already provides the address in over-the-air byte order.
+    GetNode(aInstance)->mExtAddress = *aExtAddress;
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    GetNode(aInstance)->mShortAddress = aShortAddress;
+}
+
+otError otPlatRadioGetTransmitPower(otInstance *aInstance, int8_t *aPower)
+{
+    *aPower = GetNode(aInstance)->mTxPower;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSetTransmitPower(otInstance *aInstance, int8_t aPower)
+{
+    GetNode(aInstance)->mTxPower = aPower;
+
+    return OT_ERROR_NONE;
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance)
+{
+    return GetNode(aInstance)->mPromiscuous;
+}
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    GetNode(aInstance)->mPromiscuous = aEnable;
+}
+
+otRadioState otPlatRadioGetState(otInstance *aInstance)
+{
+    return GetNode(aInstance)->mRadioState;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    SimNode *node = GetNode(aInstance);
+
+    if (node->mRadioState == OT_RADIO_STATE_DISABLED)
+    {
+        node->mRadioState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    SimNode *node = GetNode(aInstance);
+
+    node->mRadioState = OT_RADIO_STATE_DISABLED;
+    node->mTxGeneration++;
+
+    return OT_ERROR_NONE;
+}
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return GetNode(aInstance)->mRadioState != OT_RADIO_STATE_DISABLED;
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mRadioState == OT_RADIO_STATE_SLEEP || node->mRadioState == OT_RADIO_STATE_RECEIVE,
+                    error = OT_ERROR_INVALID_STATE);
+    node->mRadioState    = OT_RADIO_STATE_SLEEP;
+    node->mRxChannelMask = 0;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mRadioState != OT_RADIO_STATE_DISABLED, error = OT_ERROR_INVALID_STATE);
+    node->mRadioState    = OT_RADIO_STATE_RECEIVE;
+    node->mChannel       = aChannel;
+    node->mRxChannelMask = 0;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioReceiveMultiChannel(otInstance *aInstance, uint32_t aChannelMask)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mMultiChannelRx, error = OT_ERROR_NOT_IMPLEMENTED);
+    otEXPECT_ACTION(node->mRadioState != OT_RADIO_STATE_DISABLED, error = OT_ERROR_INVALID_STATE);
+
+    node->mRadioState    = OT_RADIO_STATE_RECEIVE;
+    node->mRxChannelMask = aChannelMask;
+
+exit:
+    return error;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    return &GetNode(aInstance)->mTxFrame;
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(aFrame);
+
+    otEXPECT_ACTION(node->mRadioState == OT_RADIO_STATE_RECEIVE, error = OT_ERROR_INVALID_STATE);
+
+    node->mRadioState = OT_RADIO_STATE_TRANSMIT;
+    node->mChannel    = node->mTxFrame.mChannel;
+    node->mTxGeneration++;
+
+    SimScheduleEvent(node, SIM_EVENT_RADIO_TX_START, SimGetNow() + SIM_TURNAROUND_TIME, node->mTxGeneration);
+
+exit:
+    return error;
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return SIM_RADIO_SENSITIVITY;
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return SIM_RADIO_SENSITIVITY;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannel);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    GetNode(aInstance)->mSrcMatchEnabled = aEnable;
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mSrcMatchShortCount < SIM_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+    node->mSrcMatchShort[node->mSrcMatchShortCount++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(node->mSrcMatchExtCount < SIM_MAX_SRC_MATCH_ENTRIES, error = OT_ERROR_NO_BUFS);
+    node->mSrcMatchExt[node->mSrcMatchExtCount++] = *aExtAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t i = 0; i < node->mSrcMatchShortCount; i++)
+    {
+        if (node->mSrcMatchShort[i] == aShortAddress)
+        {
+            node->mSrcMatchShort[i] = node->mSrcMatchShort[--node->mSrcMatchShortCount];
+            error                   = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    SimNode *node  = GetNode(aInstance);
+    otError  error = OT_ERROR_NOT_FOUND;
+
+    for (uint8_t i = 0; i < node->mSrcMatchExtCount; i++)
+    {
+        if (memcmp(&node->mSrcMatchExt[i], aExtAddress, sizeof(otExtAddress)) == 0)
+        {
+            node->mSrcMatchExt[i] = node->mSrcMatchExt[--node->mSrcMatchExtCount];
+            error                 = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    GetNode(aInstance)->mSrcMatchShortCount = 0;
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    GetNode(aInstance)->mSrcMatchExtCount = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Settings (kept in memory, they survive a node reset)
+
+static SimSetting *FindSetting(SimNode *aNode, uint16_t aKey, int aIndex)
+{
+    SimSetting *setting = NULL;
+
+    for (uint16_t i = 0; i < aNode->mSettingsCount; i++)
+    {
+        if (aNode->mSettings[i].mKey == aKey && aIndex-- == 0)
+        {
+            setting = &aNode->mSettings[i];
+            break;
+        }
+    }
+
+    return setting;
+}
+
+static void RemoveSetting(SimNode *aNode, SimSetting *aSetting)
+{
+    size_t index = (size_t)(aSetting - aNode->mSettings);
+
+    free(aSetting->mValue);
+    aNode->mSettingsCount--;
+    memmove(aSetting, aSetting + 1, (aNode->mSettingsCount - index) * sizeof(SimSetting));
+}
+
+void otPlatSettingsInit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+void otPlatSettingsDeinit(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+}
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    SimSetting *setting = FindSetting(GetNode(aInstance), aKey, aIndex);
+    otError     error   = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(setting != NULL, error = OT_ERROR_NOT_FOUND);
+
+    if (aValueLength != NULL)
+    {
+        if (aValue != NULL)
+        {
+            memcpy(aValue, setting->mValue, (*aValueLength < setting->mLength) ? *aValueLength : setting->mLength);
+        }
+
+        *aValueLength = setting->mLength;
+    }
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    SimNode *   node  = GetNode(aInstance);
+    otError     error = OT_ERROR_NONE;
+    SimSetting *settings;
+    uint8_t *   value;
+
+    settings = (SimSetting *)realloc(node->mSettings, (node->mSettingsCount + 1u) * sizeof(SimSetting));
+    otEXPECT_ACTION(settings != NULL, error = OT_ERROR_NO_BUFS);
+    node->mSettings = settings;
+
+    value = (uint8_t *)malloc(aValueLength > 0 ? aValueLength : 1);
+    otEXPECT_ACTION(value != NULL, error = OT_ERROR_NO_BUFS);
+    memcpy(value, aValue, aValueLength);
+
+    settings[node->mSettingsCount].mKey    = aKey;
+    settings[node->mSettingsCount].mLength = aValueLength;
+    settings[node->mSettingsCount].mValue  = value;
+    node->mSettingsCount++;
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    SimNode *   node  = GetNode(aInstance);
+    otError     error = OT_ERROR_NOT_FOUND;
+    SimSetting *setting;
+
+    while ((setting = FindSetting(node, aKey, (aIndex < 0) ? 0 : aIndex)) != NULL)
+    {
+        RemoveSetting(node, setting);
+        error = OT_ERROR_NONE;
+
+        if (aIndex >= 0)
+        {
+            break;
+        }
+    }
+
+    return error;
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    (void)otPlatSettingsDelete(aInstance, aKey, -1);
+
+    return otPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+}
+
+void otPlatSettingsWipe(otInstance *aInstance)
+{
+    SimPlatformDeinitNode(GetNode(aInstance));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Miscellaneous
+
+otError otPlatEntropyGet(uint8_t *aOutput, uint16_t aOutputLength)
+{
+    for (uint16_t i = 0; i < aOutputLength; i++)
+    {
+        aOutput[i] = (uint8_t)SimGetRandom();
+    }
+
+    return OT_ERROR_NONE;
+}
+
+void *otPlatCAlloc(size_t aNum, size_t aSize)
+{
+    return calloc(aNum, aSize);
+}
+
+void otPlatFree(void *aPtr)
+{
+    free(aPtr);
+}
+
+void otPlatReset(otInstance *aInstance)
+{
+    GetNode(aInstance)->mResetRequested = true;
+}
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_RESET_REASON_POWER_ON;
+}
+
+void otPlatWakeHost(void)
+{
+}
+
+void otPlatLog(otLogLevel aLogLevel, otLogRegion aLogRegion, const char *aFormat, ...)
+{
+    SimNode *node = SimGetCurrentNode();
+    uint64_t now  = SimGetNow();
+    va_list  args;
+
+    OT_UNUSED_VARIABLE(aLogLevel);
+    OT_UNUSED_VARIABLE(aLogRegion);
+
+    otEXPECT(SimIsLogEnabled());
+
+    printf("%5u.%06u [%u] ", (unsigned int)(now / 1000000), (unsigned int)(now % 1000000),
+           (node != NULL) ? node->mId : 0);
+
+    va_start(args, aFormat);
+    vprintf(aFormat, args);
+    va_end(args);
+
+    printf("\n");
+
+exit:
+    return;
+}
@@ -0,0 +1,1051 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the scripting entry point of the in-process simulator (see README.md for the commands).
+ */
+
+#include "simulator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/icmp6.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/message.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "utils/code_utils.h"
+
+enum
+{
+    kMaxArgs       = 8,
+    kMaxLineLength = 256,
+};
+
+typedef struct Script
+{
+    const char *mName;
+    unsigned    mLine;
+    uint64_t    mWallStart; ///< Wall clock at script start (in usec).
+} Script;
+
+typedef otError (*CommandHandler)(Script *aScript, int aArgc, char *aArgv[]);
+
+typedef struct Command
+{
+    const char *   mName;
+    CommandHandler mHandler;
+} Command;
+
+static const char *const kRoleNames[] = {"disabled", "detached", "child", "router", "leader"};
+
+static uint64_t GetWallTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+static otError ParseLong(const char *aString, long *aValue)
+{
+    char *end;
+
+    *aValue = strtol(aString, &end, 0);
+
+    return (*end == '\0' && end != aString) ? OT_ERROR_NONE : OT_ERROR_INVALID_ARGS;
+}
+
+static otError ParseNodeId(const char *aString, uint16_t *aId)
+{
+    otError error = OT_ERROR_NONE;
+    long    value;
+
+    otEXPECT_ACTION(ParseLong(aString, &value) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(value >= 1 && value <= SimGetNodeCount(), error = OT_ERROR_INVALID_ARGS);
+    *aId = (uint16_t)value;
+
+exit:
+    return error;
+}
+
+/**
+ * This function parses a node range: `all`, `<id>` or `<first>-<last>`.
+ *
+ */
+static otError ParseNodeRange(const char *aString, uint16_t *aFirst, uint16_t *aLast)
+{
+    otError error = OT_ERROR_NONE;
+    char    first[16];
+    char *  dash;
+
+    otEXPECT_ACTION(SimGetNodeCount() > 0, error = OT_ERROR_INVALID_STATE);
+
+    if (strcmp(aString, "all") == 0)
+    {
+        *aFirst = 1;
+        *aLast  = SimGetNodeCount();
+    }
+    else if ((dash = strchr(aString, '-')) == NULL)
+    {
+        otEXPECT_ACTION(ParseNodeId(aString, aFirst) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        *aLast = *aFirst;
+    }
+    else
+    {
+        otEXPECT_ACTION((size_t)(dash - aString) < sizeof(first), error = OT_ERROR_INVALID_ARGS);
+        memcpy(first, aString, (size_t)(dash - aString));
+        first[dash - aString] = '\0';
+
+        otEXPECT_ACTION(ParseNodeId(first, aFirst) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        otEXPECT_ACTION(ParseNodeId(dash + 1, aLast) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+        otEXPECT_ACTION(*aFirst <= *aLast, error = OT_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    return error;
+}
+
+static otError ParseRole(const char *aString, otDeviceRole *aRole)
+{
+    otError error = OT_ERROR_INVALID_ARGS;
+
+    for (size_t i = 0; i < otARRAY_LENGTH(kRoleNames); i++)
+    {
+        if (strcmp(aString, kRoleNames[i]) == 0)
+        {
+            *aRole = (otDeviceRole)i;
+            error  = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+static void Report(const Script *aScript, const char *aMessage)
+{
+    fprintf(stderr, "%s:%u: %s\n", aScript->mName, aScript->mLine, aMessage);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Commands
+
+static otError ProcessSeed(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError error = OT_ERROR_NONE;
+    long    seed;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 && ParseLong(aArgv[1], &seed) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(SimGetNodeCount() == 0, error = OT_ERROR_INVALID_STATE);
+    SimInit((uint32_t)seed);
+    printf("seed %u\n", (uint32_t)seed);
+
+exit:
+    return error;
+}
+
+static otError ProcessNodes(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError error = OT_ERROR_NONE;
+    long    count;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 && ParseLong(aArgv[1], &count) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(count > 0 && count <= UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
+    error = SimCreateNodes((uint16_t)count);
+
+exit:
+    return error;
+}
+
+static void SetBidirectionalLink(uint16_t aFirst, uint16_t aSecond, uint8_t aLoss)
+{
+    SimSetLinkLoss(aFirst, aSecond, aLoss);
+    SimSetLinkLoss(aSecond, aFirst, aLoss);
+}
+
+static otError ProcessTopology(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error  = OT_ERROR_NONE;
+    uint16_t count  = SimGetNodeCount();
+    long     width  = 0;
+    long     radius = 0;
+    long     loss   = 0;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(count > 0, error = OT_ERROR_INVALID_STATE);
+    otEXPECT_ACTION(aArgc >= 2, error = OT_ERROR_INVALID_ARGS);
+
+    if (strcmp(aArgv[1], "grid") == 0)
+    {
+        otEXPECT_ACTION(aArgc >= 4, error = OT_ERROR_INVALID_ARGS);
+        otEXPECT_ACTION(ParseLong(aArgv[2], &width) == OT_ERROR_NONE && width > 0, error = OT_ERROR_INVALID_ARGS);
+        otEXPECT_ACTION(ParseLong(aArgv[3], &radius) == OT_ERROR_NONE && radius > 0, error = OT_ERROR_INVALID_ARGS);
+        aArgc -= 2;
+        aArgv += 2;
+    }
+
+    if (aArgc == 3)
+    {
+        otEXPECT_ACTION(ParseLong(aArgv[2], &loss) == OT_ERROR_NONE && loss >= 0 && loss < SIM_LINK_NONE,
+                        error = OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        otEXPECT_ACTION(aArgc == 2, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    for (uint16_t from = 1; from <= count; from++)
+    {
+        for (uint16_t to = 1; to <= count; to++)
+        {
+            SimSetLinkLoss(from, to, SIM_LINK_NONE);
+        }
+    }
+
+    if (strcmp(aArgv[1], "full") == 0)
+    {
+        for (uint16_t first = 1; first <= count; first++)
+        {
+            for (uint16_t second = first + 1; second <= count; second++)
+            {
+                SetBidirectionalLink(first, second, (uint8_t)loss);
+            }
+        }
+    }
+    else if (strcmp(aArgv[1], "line") == 0)
+    {
+        for (uint16_t id = 1; id < count; id++)
+        {
+            SetBidirectionalLink(id, id + 1, (uint8_t)loss);
+        }
+    }
+    else if (width > 0)
+    {
+        // Nodes are laid out row by row one unit apart, nodes within `radius` units of each other are linked.
+        for (uint16_t first = 1; first <= count; first++)
+        {
+            for (uint16_t second = first + 1; second <= count; second++)
+            {
+                long dx = ((first - 1) % width) - ((second - 1) % width);
+                long dy = ((first - 1) / width) - ((second - 1) / width);
+
+                if (dx * dx + dy * dy <= radius * radius)
+                {
+                    SetBidirectionalLink(first, second, (uint8_t)loss);
+                }
+            }
+        }
+    }
+    else
+    {
+        otEXPECT_ACTION(strcmp(aArgv[1], "none") == 0, error = OT_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessLink(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t second;
+    long     loss;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 4, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[1], &first) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[2], &second) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[3], &loss) == OT_ERROR_NONE && loss >= 0 && loss <= SIM_LINK_NONE,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    SetBidirectionalLink(first, second, (uint8_t)loss);
+
+exit:
+    return error;
+}
+
+static otError ProcessPanId(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    long     panId;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[2], &panId) == OT_ERROR_NONE && panId >= 0 && panId < 0xffff,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        error = otLinkSetPanId(SimGetNode(id)->mInstance, (otPanId)panId);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessChannel(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    long     channel;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[2], &channel) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(channel >= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN && channel <= OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MAX,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        error = otLinkSetChannel(SimGetNode(id)->mInstance, (uint8_t)channel);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessMode(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError          error = OT_ERROR_NONE;
+    otLinkModeConfig mode;
+    uint16_t         first;
+    uint16_t         last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    memset(&mode, 0, sizeof(mode));
+
+    for (const char *flag = aArgv[2]; *flag != '\0'; flag++)
+    {
+        switch (*flag)
+        {
+        case 'r':
+            mode.mRxOnWhenIdle = true;
+            break;
+
+        case 's':
+            mode.mSecureDataRequests = true;
+            break;
+
+        case 'd':
+            mode.mDeviceType = true;
+            break;
+
+        case 'n':
+            mode.mNetworkData = true;
+            break;
+
+        case '-':
+            break;
+
+        default:
+            error = OT_ERROR_INVALID_ARGS;
+            goto exit;
+        }
+    }
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        error = otThreadSetLinkMode(SimGetNode(id)->mInstance, mode);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessPollPeriod(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    long     period;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[2], &period) == OT_ERROR_NONE && period >= 0, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        error = otLinkSetPollPeriod(SimGetNode(id)->mInstance, (uint32_t)period);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessPollLatency(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    long     latency;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[2], &latency) == OT_ERROR_NONE && latency >= 0, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        error = otLinkSetPollLatencyBudget(SimGetNode(id)->mInstance, (uint32_t)latency);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessPollStats(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 || aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(aArgc == 2 || strcmp(aArgv[2], "reset") == 0, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last; id++)
+    {
+        SimNode *   node = SimGetNode(id);
+        otPollStats stats;
+
+        if (aArgc == 3)
+        {
+            otLinkResetPollStats(node->mInstance);
+            continue;
+        }
+
+        otLinkGetPollStats(node->mInstance, &stats);
+        printf("node %u: polls %u empty %u latency %u ms period %u ms\n", id, stats.mPollsSent, stats.mEmptyPolls,
+               stats.mAverageLatency, stats.mPollPeriod);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessJitter(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    long     jitter;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[2], &jitter) == OT_ERROR_NONE && jitter > 0 && jitter <= UINT8_MAX,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last; id++)
+    {
+        otThreadSetRouterSelectionJitter(SimGetNode(id)->mInstance, (uint8_t)jitter);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessMultiChannel(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+    bool     enable;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(strcmp(aArgv[2], "on") == 0 || strcmp(aArgv[2], "off") == 0, error = OT_ERROR_INVALID_ARGS);
+    enable = (strcmp(aArgv[2], "on") == 0);
+
+    // The radio capabilities are read when the instance is initialized.
+    for (uint16_t id = first; id <= last; id++)
+    {
+        SimNode *node = SimGetNode(id);
+
+        node->mMultiChannelRx = enable;
+        SimResetNode(node);
+    }
+
+exit:
+    return error;
+}
+
+static void HandleScanResult(otActiveScanResult *aResult, void *aContext)
+{
+    SimNode *node = (SimNode *)aContext;
+
+    if (aResult != NULL)
+    {
+        node->mScanResults++;
+    }
+    else
+    {
+        printf("node %u: scan done, results %u, %llu ms\n", node->mId, node->mScanResults,
+               (unsigned long long)((SimGetNow() - node->mScanStart) / 1000));
+    }
+}
+
+static otError ProcessScan(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t id;
+    SimNode *node;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 || aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[1], &id) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(aArgc == 2 || strcmp(aArgv[2], "discover") == 0, error = OT_ERROR_INVALID_ARGS);
+
+    node               = SimGetNode(id);
+    node->mScanResults = 0;
+    node->mScanStart   = SimGetNow();
+    SimSetCurrentNode(node);
+
+    if (aArgc == 2)
+    {
+        error = otLinkActiveScan(node->mInstance, 0, 0, HandleScanResult, node);
+    }
+    else if ((error = otIp6SetEnabled(node->mInstance, true)) == OT_ERROR_NONE)
+    {
+        error = otThreadDiscover(node->mInstance, 0, OT_PANID_BROADCAST, false, false, HandleScanResult, node);
+    }
+
+    SimSetCurrentNode(NULL);
+
+exit:
+    return error;
+}
+
+static otError ProcessStart(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error    = OT_ERROR_NONE;
+    long     interval = 0;
+    uint16_t first;
+    uint16_t last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 || aArgc == 3, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    if (aArgc == 3)
+    {
+        otEXPECT_ACTION(ParseLong(aArgv[2], &interval) == OT_ERROR_NONE && interval >= 0,
+                        error = OT_ERROR_INVALID_ARGS);
+    }
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        SimNode *node = SimGetNode(id);
+
+        SimSetCurrentNode(node);
+
+        if ((error = otIp6SetEnabled(node->mInstance, true)) == OT_ERROR_NONE)
+        {
+            error = otThreadSetEnabled(node->mInstance, true);
+        }
+
+        SimSetCurrentNode(NULL);
+
+        // Staggered start: let the simulation run between two nodes.
+        if (interval > 0)
+        {
+            SimRun((uint64_t)interval * 1000);
+        }
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessStop(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last && error == OT_ERROR_NONE; id++)
+    {
+        SimNode *node = SimGetNode(id);
+
+        SimSetCurrentNode(node);
+
+        if ((error = otThreadSetEnabled(node->mInstance, false)) == OT_ERROR_NONE)
+        {
+            error = otIp6SetEnabled(node->mInstance, false);
+        }
+    }
+
+    SimSetCurrentNode(NULL);
+
+exit:
+    return error;
+}
+
+static otError ProcessReset(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[1], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last; id++)
+    {
+        SimResetNode(SimGetNode(id));
+    }
+
+    SimSetCurrentNode(NULL);
+
+exit:
+    return error;
+}
+
+static otError ProcessRun(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError error = OT_ERROR_NONE;
+    long    duration;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2 && ParseLong(aArgv[1], &duration) == OT_ERROR_NONE && duration >= 0,
+                    error = OT_ERROR_INVALID_ARGS);
+    SimRun((uint64_t)duration * 1000);
+
+exit:
+    return error;
+}
+
+static otError ProcessState(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t first;
+    uint16_t last;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc <= 2, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange((aArgc == 2) ? aArgv[1] : "all", &first, &last) == OT_ERROR_NONE,
+                    error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last; id++)
+    {
+        SimNode *node = SimGetNode(id);
+
+        printf("node %u: %s rloc16 0x%04x partition 0x%08x tx %u rx %u replies %u\n", id,
+               kRoleNames[otThreadGetDeviceRole(node->mInstance)], otThreadGetRloc16(node->mInstance),
+               otThreadGetPartitionId(node->mInstance), node->mTxFrames, node->mRxFrames, node->mEchoReplies);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessPing(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError       error   = OT_ERROR_NONE;
+    otMessage *   message = NULL;
+    otMessageInfo messageInfo;
+    uint16_t      source;
+    uint16_t      destination;
+    long          size = 8;
+    SimNode *     node;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 3 || aArgc == 4, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[1], &source) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[2], &destination) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    if (aArgc == 4)
+    {
+        otEXPECT_ACTION(ParseLong(aArgv[3], &size) == OT_ERROR_NONE && size >= 0 && size <= 1280,
+                        error = OT_ERROR_INVALID_ARGS);
+    }
+
+    node = SimGetNode(source);
+    SimSetCurrentNode(node);
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = *otThreadGetMeshLocalEid(SimGetNode(destination)->mInstance);
+
+    otEXPECT_ACTION((message = otIp6NewMessage(node->mInstance, NULL)) != NULL, error = OT_ERROR_NO_BUFS);
+    otEXPECT((error = otMessageSetLength(message, (uint16_t)size)) == OT_ERROR_NONE);
+    otEXPECT((error = otIcmp6SendEchoRequest(node->mInstance, message, &messageInfo, 1)) == OT_ERROR_NONE);
+    message = NULL;
+
+exit:
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    SimSetCurrentNode(NULL);
+    return error;
+}
+
+static otError ExpectRole(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError      error = OT_ERROR_NONE;
+    otDeviceRole role;
+    uint16_t     first;
+    uint16_t     last;
+    char         message[kMaxLineLength];
+
+    otEXPECT_ACTION(aArgc == 4, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeRange(aArgv[2], &first, &last) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseRole(aArgv[3], &role) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    for (uint16_t id = first; id <= last; id++)
+    {
+        otDeviceRole actual = otThreadGetDeviceRole(SimGetNode(id)->mInstance);
+
+        // A router expectation is also met by the leader.
+        if (actual != role && !(role == OT_DEVICE_ROLE_ROUTER && actual == OT_DEVICE_ROLE_LEADER))
+        {
+            snprintf(message, sizeof(message), "expected node %u to be %s, it is %s", id, kRoleNames[role],
+                     kRoleNames[actual]);
+            Report(aScript, message);
+            error = OT_ERROR_FAILED;
+        }
+    }
+
+exit:
+    return error;
+}
+
+static otError ExpectCount(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError      error = OT_ERROR_NONE;
+    otDeviceRole role;
+    long         minimum;
+    long         maximum = UINT16_MAX;
+    long         count   = 0;
+    char         message[kMaxLineLength];
+
+    otEXPECT_ACTION(aArgc == 4 || aArgc == 5, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseRole(aArgv[2], &role) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[3], &minimum) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    if (aArgc == 5)
+    {
+        otEXPECT_ACTION(ParseLong(aArgv[4], &maximum) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    }
+
+    for (uint16_t id = 1; id <= SimGetNodeCount(); id++)
+    {
+        if (otThreadGetDeviceRole(SimGetNode(id)->mInstance) == role)
+        {
+            count++;
+        }
+    }
+
+    if (count < minimum || count > maximum)
+    {
+        snprintf(message, sizeof(message), "expected %ld to %ld %s nodes, found %ld", minimum, maximum,
+                 kRoleNames[role], count);
+        Report(aScript, message);
+        error = OT_ERROR_FAILED;
+    }
+
+exit:
+    return error;
+}
+
+static otError ExpectPartitions(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    long     expected;
+    long     count = 0;
+    char     message[kMaxLineLength];
+    uint16_t nodeCount = SimGetNodeCount();
+
+    otEXPECT_ACTION(aArgc == 3 && ParseLong(aArgv[2], &expected) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    // Count the leaders, each partition has exactly one.
+    for (uint16_t id = 1; id <= nodeCount; id++)
+    {
+        if (otThreadGetDeviceRole(SimGetNode(id)->mInstance) == OT_DEVICE_ROLE_LEADER)
+        {
+            count++;
+        }
+    }
+
+    if (count != expected)
+    {
+        snprintf(message, sizeof(message), "expected %ld partitions, found %ld", expected, count);
+        Report(aScript, message);
+        error = OT_ERROR_FAILED;
+    }
+
+exit:
+    return error;
+}
+
+static otError ExpectReplies(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t id;
+    long     minimum;
+    char     message[kMaxLineLength];
+
+    otEXPECT_ACTION(aArgc == 4, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseNodeId(aArgv[2], &id) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+    otEXPECT_ACTION(ParseLong(aArgv[3], &minimum) == OT_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    if (SimGetNode(id)->mEchoReplies < (uint32_t)minimum)
+    {
+        snprintf(message, sizeof(message), "expected node %u to receive %ld echo replies, received %u", id, minimum,
+                 SimGetNode(id)->mEchoReplies);
+        Report(aScript, message);
+        error = OT_ERROR_FAILED;
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessExpect(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError error = OT_ERROR_INVALID_ARGS;
+
+    otEXPECT(aArgc >= 2);
+
+    if (strcmp(aArgv[1], "role") == 0)
+    {
+        error = ExpectRole(aScript, aArgc, aArgv);
+    }
+    else if (strcmp(aArgv[1], "count") == 0)
+    {
+        error = ExpectCount(aScript, aArgc, aArgv);
+    }
+    else if (strcmp(aArgv[1], "partitions") == 0)
+    {
+        error = ExpectPartitions(aScript, aArgc, aArgv);
+    }
+    else if (strcmp(aArgv[1], "replies") == 0)
+    {
+        error = ExpectReplies(aScript, aArgc, aArgv);
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessLog(Script *aScript, int aArgc, char *aArgv[])
+{
+    otError error = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(aScript);
+
+    otEXPECT_ACTION(aArgc == 2, error = OT_ERROR_INVALID_ARGS);
+
+    if (strcmp(aArgv[1], "on") == 0)
+    {
+        SimSetLogEnabled(true);
+    }
+    else if (strcmp(aArgv[1], "off") == 0)
+    {
+        SimSetLogEnabled(false);
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+exit:
+    return error;
+}
+
+static otError ProcessStats(Script *aScript, int aArgc, char *aArgv[])
+{
+    const SimStats *stats   = SimGetStats();
+    uint64_t        now     = SimGetNow();
+    uint64_t        wall    = GetWallTime() - aScript->mWallStart;
+
+    OT_UNUSED_VARIABLE(aArgc);
+    OT_UNUSED_VARIABLE(aArgv);
+
+    printf("virtual %llu ms, wall %llu ms, speedup %.1fx\n", (unsigned long long)(now / 1000),
+           (unsigned long long)(wall / 1000), (wall > 0) ? (double)now / (double)wall : 0.0);
+    printf("events %llu, frames sent %llu, received %llu, lost %llu, cca failures %llu\n",
+           (unsigned long long)stats->mEvents, (unsigned long long)stats->mFramesSent,
+           (unsigned long long)stats->mFramesReceived, (unsigned long long)stats->mFramesLost,
+           (unsigned long long)stats->mCcaFailures);
+
+    return OT_ERROR_NONE;
+}
+
+static otError ProcessEcho(Script *aScript, int aArgc, char *aArgv[])
+{
+    OT_UNUSED_VARIABLE(aScript);
+
+    for (int i = 1; i < aArgc; i++)
+    {
+        printf("%s%s", (i > 1) ? " " : "", aArgv[i]);
+    }
+
+    printf("\n");
+
+    return OT_ERROR_NONE;
+}
+
+static const Command sCommands[] = {
+    {"channel", &ProcessChannel},
+    {"echo", &ProcessEcho},
+    {"expect", &ProcessExpect},
+    {"jitter", &ProcessJitter},
+    {"link", &ProcessLink},
+    {"log", &ProcessLog},
+    {"mode", &ProcessMode},
+    {"multichannel", &ProcessMultiChannel},
+    {"nodes", &ProcessNodes},
+    {"panid", &ProcessPanId},
+    {"ping", &ProcessPing},
+    {"pollperiod", &ProcessPollPeriod},
+    {"polllatency", &ProcessPollLatency},
+    {"pollstats", &ProcessPollStats},
+    {"reset", &ProcessReset},
+    {"run", &ProcessRun},
+    {"scan", &ProcessScan},
+    {"seed", &ProcessSeed},
+    {"start", &ProcessStart},
+    {"state", &ProcessState},
+    {"stats", &ProcessStats},
+    {"stop", &ProcessStop},
+    {"topology", &ProcessTopology},
+};
+
+static otError ProcessLine(Script *aScript, char *aLine)
+{
+    otError error = OT_ERROR_NONE;
+    char *  argv[kMaxArgs];
+    int     argc = 0;
+    char *  comment;
+    char *  token;
+
+    if ((comment = strchr(aLine, '#')) != NULL)
+    {
+        *comment = '\0';
+    }
+
+    for (token = strtok(aLine, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n"))
+    {
+        otEXPECT_ACTION(argc < kMaxArgs, error = OT_ERROR_INVALID_ARGS);
+        argv[argc++] = token;
+    }
+
+    otEXPECT(argc > 0);
+
+    error = OT_ERROR_PARSE;
+
+    for (size_t i = 0; i < otARRAY_LENGTH(sCommands); i++)
+    {
+        if (strcmp(argv[0], sCommands[i].mName) == 0)
+        {
+            error = sCommands[i].mHandler(aScript, argc, argv);
+            break;
+        }
+    }
+
+exit:
+    return error;
+}
+
+int SimScriptRun(FILE *aScript, const char *aName)
+{
+    Script script;
+    char   line[kMaxLineLength];
+    int    failures = 0;
+
+    script.mName      = aName;
+    script.mLine      = 0;
+    script.mWallStart = GetWallTime();
+
+    while (fgets(line, sizeof(line), aScript) != NULL)
+    {
+        otError error;
+
+        script.mLine++;
+        error = ProcessLine(&script, line);
+
+        if (error == OT_ERROR_FAILED)
+        {
+            failures++;
+        }
+        else if (error != OT_ERROR_NONE)
+        {
+            fprintf(stderr, "%s:%u: error: %s\n", aName, script.mLine, otThreadErrorToString(error));
+            failures++;
+        }
+    }
+
+    return failures;
+}
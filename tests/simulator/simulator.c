@@ -0,0 +1,450 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the event queue, node table and link model of the in-process simulator.
+ */
+
+#include "simulator.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+
+#include "utils/code_utils.h"
+
+/**
+ * This structure represents a scheduled event.
+ *
+ */
+typedef struct SimEvent
+{
+    uint64_t     mTime;
+    uint64_t     mSequence; ///< Keeps events scheduled for the same time in FIFO order.
+    SimNode *    mNode;
+    SimEventType mType;
+    uint32_t     mGeneration;
+} SimEvent;
+
+static uint64_t  sNow;
+static uint64_t  sSequence;
+static uint32_t  sRandomState = 1;
+static SimEvent *sEvents;
+static size_t    sEventCount;
+static size_t    sEventCapacity;
+static SimNode **sNodes;
+static uint16_t  sNodeCount;
+static uint8_t * sLinks; ///< Loss rate matrix, indexed by [from - 1][to - 1].
+static SimNode * sPendingHead;
+static SimNode * sPendingTail;
+static SimNode * sCurrentNode;
+static SimStats  sStats;
+static bool      sLogEnabled;
+
+static bool EventIsBefore(const SimEvent *aFirst, const SimEvent *aSecond)
+{
+    return (aFirst->mTime < aSecond->mTime) ||
+           ((aFirst->mTime == aSecond->mTime) && (aFirst->mSequence < aSecond->mSequence));
+}
+
+static void SwapEvents(size_t aFirst, size_t aSecond)
+{
+    SimEvent event = sEvents[aFirst];
+
+    sEvents[aFirst]  = sEvents[aSecond];
+    sEvents[aSecond] = event;
+}
+
+static void PopEvent(SimEvent *aEvent)
+{
+    size_t index = 0;
+
+    *aEvent    = sEvents[0];
+    sEvents[0] = sEvents[--sEventCount];
+
+    for (;;)
+    {
+        size_t child    = 2 * index + 1;
+        size_t smallest = index;
+
+        if (child < sEventCount && EventIsBefore(&sEvents[child], &sEvents[smallest]))
+        {
+            smallest = child;
+        }
+
+        if (child + 1 < sEventCount && EventIsBefore(&sEvents[child + 1], &sEvents[smallest]))
+        {
+            smallest = child + 1;
+        }
+
+        if (smallest == index)
+        {
+            break;
+        }
+
+        SwapEvents(index, smallest);
+        index = smallest;
+    }
+}
+
+void SimScheduleEvent(SimNode *aNode, SimEventType aType, uint64_t aTime, uint32_t aGeneration)
+{
+    size_t index;
+
+    if (sEventCount == sEventCapacity)
+    {
+        size_t    capacity = (sEventCapacity == 0) ? 256 : 2 * sEventCapacity;
+        SimEvent *events   = (SimEvent *)realloc(sEvents, capacity * sizeof(SimEvent));
+
+        if (events == NULL)
+        {
+            fprintf(stderr, "simulator: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+
+        sEvents        = events;
+        sEventCapacity = capacity;
+    }
+
+    index                      = sEventCount++;
+    sEvents[index].mTime       = (aTime < sNow) ? sNow : aTime;
+    sEvents[index].mSequence   = sSequence++;
+    sEvents[index].mNode       = aNode;
+    sEvents[index].mType       = aType;
+    sEvents[index].mGeneration = aGeneration;
+
+    while (index > 0 && EventIsBefore(&sEvents[index], &sEvents[(index - 1) / 2]))
+    {
+        SwapEvents(index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+}
+
+void SimSignalTasklets(SimNode *aNode)
+{
+    otEXPECT(!aNode->mTaskletsPending);
+
+    aNode->mTaskletsPending = true;
+    aNode->mNextPending     = NULL;
+
+    if (sPendingTail == NULL)
+    {
+        sPendingHead = aNode;
+    }
+    else
+    {
+        sPendingTail->mNextPending = aNode;
+    }
+
+    sPendingTail = aNode;
+
+exit:
+    return;
+}
+
+static void HandleIcmpReceive(void *               aContext,
+                              otMessage *          aMessage,
+                              const otMessageInfo *aMessageInfo,
+                              const otIcmp6Header *aIcmpHeader)
+{
+    SimNode *node = (SimNode *)aContext;
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    if (aIcmpHeader->mType == OT_ICMP6_TYPE_ECHO_REPLY)
+    {
+        node->mEchoReplies++;
+    }
+}
+
+static void InitInstance(SimNode *aNode, size_t aInstanceSize)
+{
+    SimSetCurrentNode(aNode);
+    SimPlatformInitNode(aNode);
+
+    aNode->mInstance = otInstanceInit(aNode->mInstanceBuffer, &aInstanceSize);
+
+    if (aNode->mInstance == NULL)
+    {
+        fprintf(stderr, "simulator: failed to initialize node %u\n", aNode->mId);
+        exit(EXIT_FAILURE);
+    }
+
+    memset(&aNode->mIcmpHandler, 0, sizeof(aNode->mIcmpHandler));
+    aNode->mIcmpHandler.mReceiveCallback = HandleIcmpReceive;
+    aNode->mIcmpHandler.mContext         = aNode;
+    (void)otIcmp6RegisterHandler(aNode->mInstance, &aNode->mIcmpHandler);
+
+    SimSetCurrentNode(NULL);
+}
+
+static size_t GetInstanceSize(void)
+{
+    size_t size = 0;
+
+    (void)otInstanceInit(NULL, &size);
+
+    return size;
+}
+
+void SimInit(uint32_t aSeed)
+{
+    sNow         = 0;
+    sSequence    = 0;
+    sRandomState = (aSeed == 0) ? 1 : aSeed;
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+void SimDeinit(void)
+{
+    // Finalizing an instance may still signal tasklets, nodes are freed once all of them are finalized.
+    for (uint16_t i = 0; i < sNodeCount; i++)
+    {
+        SimSetCurrentNode(sNodes[i]);
+        otInstanceFinalize(sNodes[i]->mInstance);
+        SimPlatformDeinitNode(sNodes[i]);
+    }
+
+    SimSetCurrentNode(NULL);
+
+    for (uint16_t i = 0; i < sNodeCount; i++)
+    {
+        free(sNodes[i]);
+    }
+
+    free(sNodes);
+    free(sLinks);
+    free(sEvents);
+
+    sNodes         = NULL;
+    sLinks         = NULL;
+    sEvents        = NULL;
+    sNodeCount     = 0;
+    sEventCount    = 0;
+    sEventCapacity = 0;
+    sPendingHead   = NULL;
+    sPendingTail   = NULL;
+}
+
+otError SimCreateNodes(uint16_t aCount)
+{
+    otError error        = OT_ERROR_NONE;
+    size_t  instanceSize = GetInstanceSize();
+
+    otEXPECT_ACTION(sNodeCount == 0, error = OT_ERROR_ALREADY);
+    otEXPECT_ACTION(aCount > 0, error = OT_ERROR_INVALID_ARGS);
+
+    sNodes = (SimNode **)calloc(aCount, sizeof(SimNode *));
+    sLinks = (uint8_t *)malloc((size_t)aCount * aCount);
+    otEXPECT_ACTION(sNodes != NULL && sLinks != NULL, error = OT_ERROR_NO_BUFS);
+
+    memset(sLinks, SIM_LINK_NONE, (size_t)aCount * aCount);
+
+    for (uint16_t i = 0; i < aCount; i++)
+    {
+        SimNode *node = (SimNode *)calloc(1, sizeof(SimNode) + instanceSize);
+
+        otEXPECT_ACTION(node != NULL, error = OT_ERROR_NO_BUFS);
+
+        node->mId  = i + 1;
+        sNodes[i]  = node;
+        sNodeCount = i + 1;
+
+        InitInstance(node, instanceSize);
+    }
+
+exit:
+    return error;
+}
+
+uint16_t SimGetNodeCount(void)
+{
+    return sNodeCount;
+}
+
+SimNode *SimGetNode(uint16_t aId)
+{
+    return (aId >= 1 && aId <= sNodeCount) ? sNodes[aId - 1] : NULL;
+}
+
+SimNode *SimGetNodeByInstance(otInstance *aInstance)
+{
+    return (SimNode *)(void *)((uint8_t *)aInstance - offsetof(SimNode, mInstanceBuffer));
+}
+
+void SimResetNode(SimNode *aNode)
+{
+    SimSetCurrentNode(aNode);
+    otInstanceFinalize(aNode->mInstance);
+    aNode->mResetRequested = false;
+    InitInstance(aNode, GetInstanceSize());
+}
+
+void SimSetLinkLoss(uint16_t aFrom, uint16_t aTo, uint8_t aLossPercent)
+{
+    if (aFrom >= 1 && aFrom <= sNodeCount && aTo >= 1 && aTo <= sNodeCount && aFrom != aTo)
+    {
+        sLinks[(size_t)(aFrom - 1) * sNodeCount + (aTo - 1)] =
+            (aLossPercent > SIM_LINK_NONE) ? (uint8_t)SIM_LINK_NONE : aLossPercent;
+    }
+}
+
+uint8_t SimGetLinkLoss(uint16_t aFrom, uint16_t aTo)
+{
+    uint8_t loss = SIM_LINK_NONE;
+
+    if (aFrom >= 1 && aFrom <= sNodeCount && aTo >= 1 && aTo <= sNodeCount && aFrom != aTo)
+    {
+        loss = sLinks[(size_t)(aFrom - 1) * sNodeCount + (aTo - 1)];
+    }
+
+    return loss;
+}
+
+uint64_t SimGetNow(void)
+{
+    return sNow;
+}
+
+uint32_t SimGetRandom(void)
+{
+    // xorshift32
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+SimStats *SimGetStats(void)
+{
+    return &sStats;
+}
+
+void SimSetLogEnabled(bool aEnabled)
+{
+    sLogEnabled = aEnabled;
+}
+
+bool SimIsLogEnabled(void)
+{
+    return sLogEnabled;
+}
+
+SimNode *SimGetCurrentNode(void)
+{
+    return sCurrentNode;
+}
+
+void SimSetCurrentNode(SimNode *aNode)
+{
+    sCurrentNode = aNode;
+}
+
+static void HandlePendingReset(SimNode *aNode)
+{
+    if (aNode->mResetRequested)
+    {
+        SimResetNode(aNode);
+    }
+}
+
+static void ProcessTasklets(void)
+{
+    while (sPendingHead != NULL)
+    {
+        SimNode *node = sPendingHead;
+
+        sPendingHead = node->mNextPending;
+
+        if (sPendingHead == NULL)
+        {
+            sPendingTail = NULL;
+        }
+
+        node->mTaskletsPending = false;
+
+        SimSetCurrentNode(node);
+        otTaskletsProcess(node->mInstance);
+        HandlePendingReset(node);
+    }
+
+    SimSetCurrentNode(NULL);
+}
+
+void SimRun(uint64_t aDuration)
+{
+    uint64_t end = sNow + aDuration;
+
+    ProcessTasklets();
+
+    while (sEventCount > 0 && sEvents[0].mTime <= end)
+    {
+        SimEvent event;
+
+        PopEvent(&event);
+        sNow = event.mTime;
+        sStats.mEvents++;
+
+        SimSetCurrentNode(event.mNode);
+
+        switch (event.mType)
+        {
+        case SIM_EVENT_ALARM_MILLI:
+            SimPlatformAlarmMilliFired(event.mNode, event.mGeneration);
+            break;
+
+        case SIM_EVENT_ALARM_MICRO:
+            SimPlatformAlarmMicroFired(event.mNode, event.mGeneration);
+            break;
+
+        case SIM_EVENT_RADIO_TX_START:
+            if (event.mGeneration == event.mNode->mTxGeneration)
+            {
+                SimPlatformRadioTxStart(event.mNode);
+            }
+            break;
+
+        case SIM_EVENT_RADIO_TX_DONE:
+            if (event.mGeneration == event.mNode->mTxGeneration)
+            {
+                SimPlatformRadioTxDone(event.mNode);
+            }
+            break;
+        }
+
+        HandlePendingReset(event.mNode);
+        ProcessTasklets();
+    }
+
+    sNow = end;
+}
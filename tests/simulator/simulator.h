@@ -0,0 +1,331 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines the in-process multi-node simulator.
+ *
+ *   The simulator hosts all nodes as OpenThread instances in a single process (which requires
+ *   `OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE`) and drives them from a shared discrete-event queue in virtual time.
+ */
+
+#ifndef SIMULATOR_H_
+#define SIMULATOR_H_
+
+#include <openthread-core-config.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <openthread/icmp6.h>
+#include <openthread/instance.h>
+#include <openthread/platform/radio.h>
+
+#if !OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+#error "The simulator requires OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE."
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+    SIM_LINK_NONE             = 100, ///< Loss rate (in percent) of a non-existing link.
+    SIM_MAX_SRC_MATCH_ENTRIES = 32,  ///< Size of each source match table.
+    SIM_RADIO_RSSI            = -20, ///< RSSI reported for received frames (in dBm).
+    SIM_RADIO_SENSITIVITY     = -100, ///< Receive sensitivity (in dBm).
+    SIM_TURNAROUND_TIME       = 192, ///< Time between a transmit request and the start of the frame (in usec).
+    SIM_SYMBOLS_PER_OCTET     = 2,
+    SIM_SYMBOL_TIME           = 16, ///< Duration of a symbol (in usec).
+    SIM_PHY_HEADER_SIZE       = 6,  ///< Preamble, SFD and PHR (in octets).
+};
+
+/**
+ * This enumeration defines the simulator event types.
+ *
+ */
+typedef enum SimEventType
+{
+    SIM_EVENT_ALARM_MILLI,    ///< The node's millisecond alarm fired.
+    SIM_EVENT_ALARM_MICRO,    ///< The node's microsecond alarm fired.
+    SIM_EVENT_RADIO_TX_START, ///< The node starts transmitting its frame (after turnaround and CCA).
+    SIM_EVENT_RADIO_TX_DONE,  ///< The node's frame is fully on air and is delivered to its neighbors.
+} SimEventType;
+
+/**
+ * This structure represents an alarm of a node.
+ *
+ */
+typedef struct SimAlarm
+{
+    bool     mRunning;
+    uint32_t mGeneration; ///< Invalidates alarm events that were scheduled before a restart or stop.
+} SimAlarm;
+
+/**
+ * This structure represents a settings record of a node.
+ *
+ */
+typedef struct SimSetting
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t *mValue;
+} SimSetting;
+
+/**
+ * This structure represents a simulated node.
+ *
+ */
+typedef struct SimNode
+{
+    uint16_t        mId; ///< Node identifier (starting from 1).
+    otInstance *    mInstance;
+    struct SimNode *mNextPending; ///< Next node in the pending tasklets list.
+    bool            mTaskletsPending;
+    bool            mResetRequested;
+
+    SimAlarm mAlarmMilli;
+    SimAlarm mAlarmMicro;
+
+    otRadioState   mRadioState;
+    uint8_t        mChannel;
+    otPanId        mPanId;
+    otShortAddress mShortAddress;
+    otExtAddress   mExtAddress; ///< In over-the-air byte order.
+    bool           mPromiscuous;
+    int8_t         mTxPower;
+    uint64_t       mTxEndTime;      ///< End of the frame currently on air.
+    uint32_t       mTxGeneration;   ///< Invalidates radio events of an aborted transmission.
+    bool           mMultiChannelRx; ///< Radio reports `OT_RADIO_CAPS_MULTI_CHANNEL_RX`.
+    uint32_t       mRxChannelMask;  ///< Channels received on concurrently, zero when receiving on `mChannel` only.
+
+    bool           mSrcMatchEnabled;
+    uint8_t        mSrcMatchShortCount;
+    uint8_t        mSrcMatchExtCount;
+    otShortAddress mSrcMatchShort[SIM_MAX_SRC_MATCH_ENTRIES];
+    otExtAddress   mSrcMatchExt[SIM_MAX_SRC_MATCH_ENTRIES];
+
+    otRadioFrame mTxFrame;
+    otRadioFrame mRxFrame;
+    otRadioFrame mAckFrame;
+    uint8_t      mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+
+    SimSetting *mSettings;
+    uint16_t    mSettingsCount;
+
+    otIcmp6Handler mIcmpHandler;
+    uint32_t       mEchoReplies;
+    uint32_t       mScanResults;
+    uint64_t       mScanStart;
+    uint32_t       mTxFrames;
+    uint32_t       mRxFrames;
+
+    uint64_t mInstanceBuffer[1]; ///< Storage of the OpenThread instance (allocated with the node).
+} SimNode;
+
+/**
+ * This structure represents the simulator statistics.
+ *
+ */
+typedef struct SimStats
+{
+    uint64_t mEvents;         ///< Number of processed events.
+    uint64_t mFramesSent;     ///< Number of frames put on air.
+    uint64_t mFramesReceived; ///< Number of frame receptions (one per receiving node).
+    uint64_t mFramesLost;     ///< Number of receptions dropped by the link model.
+    uint64_t mCcaFailures;    ///< Number of transmissions aborted because a neighbor was on air.
+} SimStats;
+
+/**
+ * This function initializes the simulator.
+ *
+ * @param[in]  aSeed  The seed of the simulator's random number generator (makes runs reproducible).
+ *
+ */
+void SimInit(uint32_t aSeed);
+
+/**
+ * This function finalizes all nodes and frees the simulator resources.
+ *
+ */
+void SimDeinit(void);
+
+/**
+ * This function creates the simulated nodes.
+ *
+ * Nodes can only be created once, all links are initially absent (see `SimSetLinkLoss()`).
+ *
+ * @param[in]  aCount  The number of nodes.
+ *
+ * @retval OT_ERROR_NONE           Successfully created the nodes.
+ * @retval OT_ERROR_ALREADY        Nodes were already created.
+ * @retval OT_ERROR_INVALID_ARGS   @p aCount is zero.
+ * @retval OT_ERROR_NO_BUFS        Could not allocate the nodes.
+ *
+ */
+otError SimCreateNodes(uint16_t aCount);
+
+/**
+ * This function returns the number of nodes.
+ *
+ */
+uint16_t SimGetNodeCount(void);
+
+/**
+ * This function returns a node by its identifier, or NULL if there is no such node.
+ *
+ */
+SimNode *SimGetNode(uint16_t aId);
+
+/**
+ * This function returns the node hosting a given OpenThread instance.
+ *
+ */
+SimNode *SimGetNodeByInstance(otInstance *aInstance);
+
+/**
+ * This function resets a node: its OpenThread instance is finalized and initialized again, settings are kept.
+ *
+ */
+void SimResetNode(SimNode *aNode);
+
+/**
+ * This function sets the loss rate of the link from @p aFrom to @p aTo.
+ *
+ * @param[in]  aFrom          The transmitting node identifier.
+ * @param[in]  aTo            The receiving node identifier.
+ * @param[in]  aLossPercent   The frame loss rate in percent, `SIM_LINK_NONE` removes the link.
+ *
+ */
+void SimSetLinkLoss(uint16_t aFrom, uint16_t aTo, uint8_t aLossPercent);
+
+/**
+ * This function returns the loss rate of the link from @p aFrom to @p aTo.
+ *
+ */
+uint8_t SimGetLinkLoss(uint16_t aFrom, uint16_t aTo);
+
+/**
+ * This function returns the current virtual time in microseconds.
+ *
+ */
+uint64_t SimGetNow(void);
+
+/**
+ * This function returns a random number from the simulator's generator.
+ *
+ */
+uint32_t SimGetRandom(void);
+
+/**
+ * This function schedules an event for a node.
+ *
+ * @param[in]  aNode        The node.
+ * @param[in]  aType        The event type.
+ * @param[in]  aTime        The virtual time of the event (in usec).
+ * @param[in]  aGeneration  A value passed back to the event handler.
+ *
+ */
+void SimScheduleEvent(SimNode *aNode, SimEventType aType, uint64_t aTime, uint32_t aGeneration);
+
+/**
+ * This function marks a node as having pending tasklets.
+ *
+ */
+void SimSignalTasklets(SimNode *aNode);
+
+/**
+ * This function runs the simulation for a duration of virtual time.
+ *
+ * @param[in]  aDuration  The duration in microseconds.
+ *
+ */
+void SimRun(uint64_t aDuration);
+
+/**
+ * This function returns the simulator statistics.
+ *
+ */
+SimStats *SimGetStats(void);
+
+/**
+ * This function enables or disables printing the OpenThread logs.
+ *
+ */
+void SimSetLogEnabled(bool aEnabled);
+
+/**
+ * This function indicates whether printing the OpenThread logs is enabled.
+ *
+ */
+bool SimIsLogEnabled(void);
+
+/**
+ * This function returns the node whose code is currently running, or NULL.
+ *
+ */
+SimNode *SimGetCurrentNode(void);
+
+/**
+ * This function sets the node whose code is currently running.
+ *
+ */
+void SimSetCurrentNode(SimNode *aNode);
+
+/**
+ * The following functions are implemented by the simulated platform (platform.c) and called by the simulator.
+ *
+ */
+void SimPlatformInitNode(SimNode *aNode);
+void SimPlatformDeinitNode(SimNode *aNode);
+void SimPlatformAlarmMilliFired(SimNode *aNode, uint32_t aGeneration);
+void SimPlatformAlarmMicroFired(SimNode *aNode, uint32_t aGeneration);
+void SimPlatformRadioTxStart(SimNode *aNode);
+void SimPlatformRadioTxDone(SimNode *aNode);
+
+/**
+ * This function runs a simulation script.
+ *
+ * @param[in]  aScript  The script (see README.md for the commands).
+ * @param[in]  aName    The script name used in error messages.
+ *
+ * @returns Zero if all commands and expectations succeeded, non-zero otherwise.
+ *
+ */
+int SimScriptRun(FILE *aScript, const char *aName);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // SIMULATOR_H_
@@ -29,6 +29,8 @@
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
 #include "crypto/aes_ccm.hpp"
 #include "utils/wrap_string.h"
 
@@ -134,11 +136,100 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed\n");
 }
 
+/**
+ * Verifies that a payload spanning several message buffers is processed in place the same as a flat buffer.
+ *
+ */
+void TestAesCcmMessage(void)
+{
+    enum
+    {
+        kOffset        = 7,
+        kHeaderLength  = 21,
+        kPayloadLength = 300,
+        kTagLength     = 4,
+    };
+
+    uint8_t key[] = {
+        0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    };
+
+    uint8_t nonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x02,
+    };
+
+    ot::Instance *     instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::Message *      message;
+    ot::Crypto::AesEcb aesEcb;
+    ot::Crypto::AesCcm aesCcm;
+    uint8_t            header[kHeaderLength];
+    uint8_t            payload[kPayloadLength];
+    uint8_t            buffer[kPayloadLength];
+    uint8_t            tag[2][kTagLength];
+    uint8_t            tagLength;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+    VerifyOrQuit((message = instance->Get<ot::MessagePool>().New(ot::Message::kTypeIp6, 0)) != NULL,
+                 "Message::New failed\n");
+
+    for (uint16_t i = 0; i < kHeaderLength; i++)
+    {
+        header[i] = static_cast<uint8_t>(0xa0 + i);
+    }
+
+    for (uint16_t i = 0; i < kPayloadLength; i++)
+    {
+        payload[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    SuccessOrQuit(message->SetLength(kOffset + kPayloadLength), "Message::SetLength failed\n");
+    message->Write(kOffset, kPayloadLength, payload);
+
+    memcpy(buffer, payload, sizeof(buffer));
+    aesCcm.SetKey(key, sizeof(key));
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Header(header, kHeaderLength);
+    aesCcm.Payload(buffer, buffer, kPayloadLength, true);
+    tagLength = kTagLength;
+    aesCcm.Finalize(tag[0], &tagLength);
+
+    // The message is processed with a prepared key.
+    aesEcb.SetKey(key, 8 * sizeof(key));
+    aesCcm.SetKey(aesEcb);
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Header(header, kHeaderLength);
+    aesCcm.Payload(*message, kOffset, kPayloadLength, true);
+    tagLength = kTagLength;
+    aesCcm.Finalize(tag[1], &tagLength);
+
+    VerifyOrQuit(memcmp(tag[0], tag[1], kTagLength) == 0, "AesCcm::Payload tag differs\n");
+    message->Read(kOffset, kPayloadLength, payload);
+    VerifyOrQuit(memcmp(buffer, payload, kPayloadLength) == 0, "AesCcm::Payload encrypt failed\n");
+
+    aesCcm.Init(kHeaderLength, kPayloadLength, kTagLength, nonce, sizeof(nonce));
+    aesCcm.Header(header, kHeaderLength);
+    aesCcm.Payload(*message, kOffset, kPayloadLength, false);
+    tagLength = kTagLength;
+    aesCcm.Finalize(tag[1], &tagLength);
+
+    VerifyOrQuit(memcmp(tag[0], tag[1], kTagLength) == 0, "AesCcm::Payload tag differs\n");
+    message->Read(kOffset, kPayloadLength, payload);
+
+    for (uint16_t i = 0; i < kPayloadLength; i++)
+    {
+        VerifyOrQuit(payload[i] == static_cast<uint8_t>(i * 7), "AesCcm::Payload decrypt failed\n");
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesCcmMessage();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,252 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <stdio.h>
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/binary_log.hpp"
+#include "common/code_utils.hpp"
+#include "common/encoding.hpp"
+
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+using ot::Encoding::LittleEndian::ReadUint32;
+using ot::Encoding::LittleEndian::WriteUint32;
+
+namespace ot {
+
+enum
+{
+    kLogBufferSize = OPENTHREAD_CONFIG_LOG_BINARY_BUFFER_SIZE,
+    kMaxStringSize = 1024,
+};
+
+static uint8_t sRecords[kLogBufferSize];
+
+static void Drain(void)
+{
+    while (BinaryLog::Read(sRecords, sizeof(sRecords)) != 0)
+    {
+    }
+}
+
+static void DecodeSequence(const uint8_t *aRecords, uint16_t aLength, uint32_t &aNext)
+{
+    const uint8_t *cur = aRecords;
+
+    while (cur < aRecords + aLength)
+    {
+        otLogBinaryRecordInfo info;
+        char                  string[kMaxStringSize];
+        unsigned int          seq;
+
+        SuccessOrQuit(BinaryLog::Decode(cur, cur[0], info, string, sizeof(string)), "Decode() failed\n");
+        VerifyOrQuit(sscanf(string, "seq %u", &seq) == 1, "Decode() returned unexpected string\n");
+        VerifyOrQuit(seq == aNext, "record is out of sequence\n");
+
+        aNext++;
+        cur += cur[0];
+    }
+}
+
+void TestBinaryLogDecode(void)
+{
+    const uint8_t         dump[20] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+                              0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 'a',  'b',  'c',  'd'};
+    uint8_t               record[OT_LOGGING_BINARY_MAX_RECORD_LENGTH];
+    otLogBinaryRecordInfo info;
+    char                  string[kMaxStringSize];
+    uint16_t              length;
+    uint32_t              offset;
+
+    printf("TestBinaryLogDecode");
+
+    Drain();
+
+    // Log record with integer, string, `*` width, 64-bit and double arguments.
+
+    otPlatLog(OT_LOG_LEVEL_NOTE, OT_LOG_REGION_MLE, "Child %04x %s rssi:%*d count:%lu time:%5.2f %%", 0x4401,
+              "valid", 4, -20, 123456789UL, 1.5);
+
+    length = BinaryLog::Read(record, sizeof(record));
+    VerifyOrQuit(length != 0 && record[0] == length, "Read() failed\n");
+
+    SuccessOrQuit(BinaryLog::Decode(record, length, info, string, sizeof(string)), "Decode() failed\n");
+    VerifyOrQuit(strcmp(string, "Child 4401 valid rssi: -20 count:123456789 time: 1.50 %") == 0,
+                 "Decode() returned unexpected string\n");
+    VerifyOrQuit(info.mLogLevel == OT_LOG_LEVEL_NOTE, "Decode() returned unexpected log level\n");
+    VerifyOrQuit(info.mLogRegion == OT_LOG_REGION_MLE, "Decode() returned unexpected log region\n");
+
+    // The output string is truncated to its size.
+
+    SuccessOrQuit(BinaryLog::Decode(record, length, info, string, 11), "Decode() failed\n");
+    VerifyOrQuit(strcmp(string, "Child 4401") == 0, "Decode() did not truncate the string\n");
+
+    // Malformed records.
+
+    VerifyOrQuit(BinaryLog::Decode(record, length - 1, info, string, sizeof(string)) == OT_ERROR_PARSE,
+                 "Decode() accepted a record with a wrong length\n");
+
+    record[0] = BinaryLog::kHeaderLength + 4;
+    VerifyOrQuit(BinaryLog::Decode(record, record[0], info, string, sizeof(string)) == OT_ERROR_PARSE,
+                 "Decode() accepted a record with missing arguments\n");
+    record[0] = static_cast<uint8_t>(length);
+
+    // Format strings outside of the range of format strings written to records are not dereferenced.
+
+    offset = ReadUint32(&record[7]);
+
+    WriteUint32(0x7fffffff, &record[7]);
+    VerifyOrQuit(BinaryLog::Decode(record, length, info, string, sizeof(string)) == OT_ERROR_PARSE,
+                 "Decode() accepted a format string beyond the format strings\n");
+
+    WriteUint32(0x80000000, &record[7]);
+    VerifyOrQuit(BinaryLog::Decode(record, length, info, string, sizeof(string)) == OT_ERROR_PARSE,
+                 "Decode() accepted a format string before the format strings\n");
+
+    WriteUint32(offset, &record[7]);
+    SuccessOrQuit(BinaryLog::Decode(record, length, info, string, sizeof(string)), "Decode() failed\n");
+
+    // Dump record.
+
+    BinaryLog::WriteDump(OT_LOG_LEVEL_CRIT, OT_LOG_REGION_CORE, "test-dump", dump, sizeof(dump));
+
+    length = BinaryLog::Read(record, sizeof(record));
+    VerifyOrQuit(length != 0 && record[0] == length, "Read() failed\n");
+    VerifyOrQuit(BinaryLog::Read(record, sizeof(record)) == 0, "Read() returned more than one dump record\n");
+
+    SuccessOrQuit(BinaryLog::Decode(record, length, info, string, sizeof(string)), "Decode() failed\n");
+    VerifyOrQuit(strstr(string, "[test-dump len=020]") != NULL, "Decode() returned unexpected dump title\n");
+    VerifyOrQuit(strstr(string, "| 00 01 02 03 04 05 06 07 | 08 09 0A 0B 0C 0D 0E 0F | ................") != NULL,
+                 "Decode() returned unexpected dump line\n");
+    VerifyOrQuit(strstr(string, "| 61 62 63 64 .. .. .. .. | .. .. .. .. .. .. .. .. | abcd") != NULL,
+                 "Decode() returned unexpected dump line\n");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogWrapAround(void)
+{
+    uint32_t dropCount;
+    uint32_t next = 0;
+
+    printf("TestBinaryLogWrapAround");
+
+    Drain();
+    dropCount = BinaryLog::GetDropCount();
+
+    // Write enough records for both the buffer and the 16-bit ring indices to wrap around several times.
+
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        otPlatLog(OT_LOG_LEVEL_INFO, OT_LOG_REGION_CORE, "seq %u", static_cast<unsigned int>(i));
+
+        if ((i % 7) == 6)
+        {
+            DecodeSequence(sRecords, BinaryLog::Read(sRecords, sizeof(sRecords)), next);
+        }
+    }
+
+    DecodeSequence(sRecords, BinaryLog::Read(sRecords, sizeof(sRecords)), next);
+
+    VerifyOrQuit(next == 20000, "records were lost\n");
+    VerifyOrQuit(BinaryLog::GetDropCount() == dropCount, "records were dropped\n");
+
+    printf(" -- PASS\n");
+}
+
+void TestBinaryLogDrop(void)
+{
+    otLogBinaryRecordInfo info;
+    char                  string[kMaxStringSize];
+    char                  expected[40];
+    uint32_t              dropCount;
+    uint32_t              numDropped;
+    uint32_t              numWritten = 0;
+    uint32_t              next       = 0;
+    uint16_t              length;
+
+    printf("TestBinaryLogDrop");
+
+    Drain();
+    dropCount = BinaryLog::GetDropCount();
+
+    // Fill the buffer until records are dropped.
+
+    while (BinaryLog::GetDropCount() - dropCount < 5)
+    {
+        otPlatLog(OT_LOG_LEVEL_INFO, OT_LOG_REGION_CORE, "seq %u", static_cast<unsigned int>(numWritten++));
+    }
+
+    numDropped = BinaryLog::GetDropCount() - dropCount;
+
+    length = BinaryLog::Read(sRecords, sizeof(sRecords));
+    VerifyOrQuit(length > kLogBufferSize - OT_LOGGING_BINARY_MAX_RECORD_LENGTH, "buffer was not filled\n");
+    DecodeSequence(sRecords, length, next);
+    VerifyOrQuit(next + numDropped == numWritten, "unexpected number of dropped records\n");
+
+    // The next record is preceded by a record with the number of dropped records.
+
+    otPlatLog(OT_LOG_LEVEL_INFO, OT_LOG_REGION_CORE, "seq %u", static_cast<unsigned int>(numWritten));
+
+    length = BinaryLog::Read(sRecords, sizeof(sRecords));
+    VerifyOrQuit(length > sRecords[0], "Read() did not return the drop record\n");
+
+    SuccessOrQuit(BinaryLog::Decode(sRecords, sRecords[0], info, string, sizeof(string)), "Decode() failed\n");
+    snprintf(expected, sizeof(expected), "Dropped %u log records", static_cast<unsigned int>(numDropped));
+    VerifyOrQuit(strcmp(string, expected) == 0, "Decode() returned unexpected drop record\n");
+
+    next = numWritten;
+    DecodeSequence(sRecords + sRecords[0], length - sRecords[0], next);
+    VerifyOrQuit(next == numWritten + 1, "record after the drop record was lost\n");
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_CONFIG_LOG_OUTPUT == OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
+    ot::TestBinaryLogDecode();
+    ot::TestBinaryLogWrapAround();
+    ot::TestBinaryLogDrop();
+    printf("\nAll tests passed.\n");
+#else
+    printf("Binary log output is not enabled\n");
+#endif
+    return 0;
+}
+#endif
@@ -340,8 +340,8 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i].mState);
-        child->SetRloc16(testChildList[i].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i].mExtAddress));
 
         VerifyChildTableContent(*table, i + 1, testChildList);
     }
@@ -362,8 +362,8 @@ void TestChildTable(void)
         VerifyOrQuit(child != NULL, "GetNewChild() failed");
 
         child->SetState(testChildList[i - 1].mState);
-        child->SetRloc16(testChildList[i - 1].mRloc16);
-        child->SetExtAddress((static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress)));
+        table->SetChildRloc16(*child, testChildList[i - 1].mRloc16);
+        table->SetChildExtAddress(*child, static_cast<const Mac::ExtAddress &>(testChildList[i - 1].mExtAddress));
 
         VerifyChildTableContent(*table, testListLength - i + 1, &testChildList[i - 1]);
     }
@@ -400,12 +400,146 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+// Fills in the extended address of the test child with a given index. Each pair of children gets extended addresses
+// with the same value at a different offset, so that the table lookup sees entries with equal hashes.
+static void GetTestExtAddress(uint16_t aIndex, Mac::ExtAddress &aExtAddress)
+{
+    uint16_t value  = (aIndex >> 1) + 1;
+    uint8_t  offset = (aIndex & 1) ? 4 : 6;
+
+    memset(&aExtAddress, 0, sizeof(aExtAddress));
+    aExtAddress.m8[0]          = 0x12;
+    aExtAddress.m8[offset]     = static_cast<uint8_t>(value >> 8);
+    aExtAddress.m8[offset + 1] = static_cast<uint8_t>(value);
+}
+
+void TestChildTableLookup(void)
+{
+    ChildTable *    table;
+    Child *         child;
+    Mac::ExtAddress extAddress;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    printf("Test ChildTable lookup with %d children", kMaxChildren);
+
+    // Fill the table.
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        child = table->GetNewChild();
+        VerifyOrQuit(child != NULL, "GetNewChild() failed");
+
+        GetTestExtAddress(i, extAddress);
+        child->SetState(Child::kStateValid);
+        table->SetChildRloc16(*child, 0x4401 + i);
+        table->SetChildExtAddress(*child, extAddress);
+    }
+
+    VerifyOrQuit(table->GetNewChild() == NULL, "GetNewChild() did not fail when table was full");
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        GetTestExtAddress(i, extAddress);
+
+        child = table->FindChild(0x4401 + i, ChildTable::kInStateValid);
+        VerifyOrQuit(child == table->GetChildAtIndex(i), "FindChild(rloc) failed");
+
+        child = table->FindChild(extAddress, ChildTable::kInStateValid);
+        VerifyOrQuit(child == table->GetChildAtIndex(i), "FindChild(ExtAddress) failed");
+    }
+
+    VerifyOrQuit(table->FindChild(0x4401 + kMaxChildren, ChildTable::kInStateValid) == NULL,
+                 "FindChild(rloc) found a missing child");
+    GetTestExtAddress(kMaxChildren, extAddress);
+    VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateValid) == NULL,
+                 "FindChild(ExtAddress) found a missing child");
+
+    // Change the RLOC16 of every other child, the extended address of every fourth child and remove every third
+    // child.
+
+    for (uint16_t i = 0; i < kMaxChildren; i += 2)
+    {
+        child = table->GetChildAtIndex(i);
+        table->SetChildRloc16(*child, 0x8001 + i);
+    }
+
+    for (uint16_t i = 1; i < kMaxChildren; i += 4)
+    {
+        GetTestExtAddress(2 * kMaxChildren + i, extAddress);
+        table->SetChildExtAddress(*table->GetChildAtIndex(i), extAddress);
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i += 3)
+    {
+        table->GetChildAtIndex(i)->SetState(Child::kStateInvalid);
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child *expected = (i % 3 == 0) ? NULL : table->GetChildAtIndex(i);
+
+        GetTestExtAddress(i, extAddress);
+
+        if (i % 2 == 0)
+        {
+            VerifyOrQuit(table->FindChild(0x4401 + i, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                         "FindChild(rloc) found a child by its previous RLOC16");
+            VerifyOrQuit(table->FindChild(0x8001 + i, ChildTable::kInStateAnyExceptInvalid) == expected,
+                         "FindChild(rloc) failed after RLOC16 change");
+        }
+        else
+        {
+            VerifyOrQuit(table->FindChild(0x4401 + i, ChildTable::kInStateAnyExceptInvalid) == expected,
+                         "FindChild(rloc) failed");
+        }
+
+        if (i % 4 == 1)
+        {
+            VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                         "FindChild(ExtAddress) found a child by its previous address");
+            GetTestExtAddress(2 * kMaxChildren + i, extAddress);
+        }
+
+        VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateAnyExceptInvalid) == expected,
+                     "FindChild(ExtAddress) failed");
+    }
+
+    // Reuse a removed entry for a new child, which takes the RLOC16 of another removed child.
+
+    child = table->GetNewChild();
+    VerifyOrQuit(child == table->GetChildAtIndex(0), "GetNewChild() failed");
+
+    GetTestExtAddress(kMaxChildren, extAddress);
+    child->SetState(Child::kStateValid);
+    table->SetChildRloc16(*child, 0x4401 + 3);
+    table->SetChildExtAddress(*child, extAddress);
+
+    VerifyOrQuit(table->FindChild(0x4401 + 3, ChildTable::kInStateValid) == child, "FindChild(rloc) failed");
+    VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateValid) == child, "FindChild(ExtAddress) failed");
+    GetTestExtAddress(0, extAddress);
+    VerifyOrQuit(table->FindChild(extAddress, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                 "FindChild(ExtAddress) found a child by its previous address");
+
+    table->Clear();
+    VerifyOrQuit(table->FindChild(0x4401 + 3, ChildTable::kInStateAnyExceptInvalid) == NULL,
+                 "FindChild(rloc) failed after Clear()");
+
+    printf(" -- PASS\n");
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableLookup();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,487 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/coap.h>
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+
+#include "coap/coap.hpp"
+#include "coap/coap_message.hpp"
+#include "common/instance.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && OPENTHREAD_CONFIG_COAP_API_ENABLE
+
+enum
+{
+    kBodyLength   = 300,
+    kServerLength = 32,
+    kMaxBlocks    = 32,
+};
+
+struct TransferContext
+{
+    uint8_t  mBody[kBodyLength];
+    uint16_t mLength;
+    uint16_t mReceived;
+    bool     mLastMore;
+    uint16_t mMaxPartLength;
+    uint16_t mNumBlocks;
+    uint32_t mBlockNum[kMaxBlocks];
+    uint16_t mBlockSize[kMaxBlocks];
+    bool     mDone;
+    otError  mResult;
+    uint8_t  mCode;
+};
+
+static otInstance *            sInstance;
+static TransferContext         sClient;
+static TransferContext         sServer;
+static const char              kUriPath[] = "block";
+static otCoapResource          sResource;
+static otCoapBlockwiseResource sBlockwiseResource;
+
+static uint8_t BodyByte(uint32_t aPosition)
+{
+    return static_cast<uint8_t>(aPosition * 7 + 3);
+}
+
+static void ProcessTasklets(void)
+{
+    while (otTaskletsArePending(sInstance))
+    {
+        otTaskletsProcess(sInstance);
+    }
+}
+
+static ot::Coap::Message *NewMessage(void)
+{
+    return static_cast<ot::Coap::Message *>(otCoapNewMessage(sInstance, NULL));
+}
+
+static otError TransmitHook(void *aContext, uint8_t *aBlock, uint32_t aPosition, uint16_t *aBlockLength, bool *aMore)
+{
+    TransferContext *context = static_cast<TransferContext *>(aContext);
+    otError          error   = OT_ERROR_NONE;
+
+    VerifyOrExit(aPosition <= context->mLength, error = OT_ERROR_INVALID_ARGS);
+
+    if (*aBlockLength > context->mMaxPartLength)
+    {
+        context->mMaxPartLength = *aBlockLength;
+    }
+
+    if (aPosition + *aBlockLength >= context->mLength)
+    {
+        *aBlockLength = static_cast<uint16_t>(context->mLength - aPosition);
+        *aMore        = false;
+    }
+    else
+    {
+        *aMore = true;
+    }
+
+    for (uint16_t i = 0; i < *aBlockLength; i++)
+    {
+        aBlock[i] = BodyByte(aPosition + i);
+    }
+
+exit:
+    return error;
+}
+
+static otError ReceiveHook(void *         aContext,
+                           const uint8_t *aBlock,
+                           uint32_t       aPosition,
+                           uint16_t       aBlockLength,
+                           bool           aMore,
+                           uint32_t       aTotalLength)
+{
+    TransferContext *context = static_cast<TransferContext *>(aContext);
+    otError          error   = OT_ERROR_NONE;
+
+    OT_UNUSED_VARIABLE(aTotalLength);
+
+    VerifyOrExit(aPosition == context->mReceived && aPosition + aBlockLength <= sizeof(context->mBody),
+                 error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(context->mLastMore, error = OT_ERROR_NO_BUFS);
+
+    memcpy(&context->mBody[aPosition], aBlock, aBlockLength);
+    context->mReceived += aBlockLength;
+    context->mLastMore = aMore;
+
+    if (aBlockLength > context->mMaxPartLength)
+    {
+        context->mMaxPartLength = aBlockLength;
+    }
+
+exit:
+    return error;
+}
+
+static void ResponseHandler(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    TransferContext *context = static_cast<TransferContext *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    context->mDone   = true;
+    context->mResult = aResult;
+    context->mCode   = (aMessage != NULL) ? static_cast<ot::Coap::Message *>(aMessage)->GetCode() : 0;
+}
+
+static void ResetContexts(void)
+{
+    memset(&sClient, 0, sizeof(sClient));
+    memset(&sServer, 0, sizeof(sServer));
+    sClient.mLastMore = true;
+    sServer.mLastMore = true;
+}
+
+static void InitMessageInfo(otMessageInfo &aMessageInfo)
+{
+    memset(&aMessageInfo, 0, sizeof(aMessageInfo));
+    aMessageInfo.mPeerAddr = *otThreadGetLinkLocalIp6Address(sInstance);
+    aMessageInfo.mPeerPort = OT_DEFAULT_COAP_PORT;
+}
+
+void TestCoapBlockOptionEncoding(void)
+{
+    static const uint32_t kNums[]    = {0, 1, 15, 16, 4095, 4096, 0xfffff};
+    static const uint8_t  kLengths[] = {1, 1, 1, 2, 2, 3, 3};
+
+    ot::Coap::Message *message;
+    uint32_t           num;
+    bool               more;
+    otCoapBlockSize    size;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null OpenThread instance\n");
+
+    for (unsigned i = 0; i < sizeof(kNums) / sizeof(kNums[0]); i++)
+    {
+        for (int szx = OT_COAP_BLOCK_SIZE_16; szx <= OT_COAP_BLOCK_SIZE_1024; szx++)
+        {
+            const otCoapOption *option;
+
+            VerifyOrQuit((message = NewMessage()) != NULL, "Coap::Message::New failed\n");
+            message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+            SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK2, kNums[i], (i % 2) == 0,
+                                                     static_cast<otCoapBlockSize>(szx)),
+                          "AppendBlockOption failed\n");
+
+            option = message->GetFirstOption();
+            VerifyOrQuit(option != NULL && option->mNumber == OT_COAP_OPTION_BLOCK2, "Block option not found\n");
+            VerifyOrQuit(option->mLength == kLengths[i], "Block option has a wrong length\n");
+
+            SuccessOrQuit(message->ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, size),
+                          "ReadBlockOptionValues failed\n");
+            VerifyOrQuit(num == kNums[i] && more == ((i % 2) == 0) && size == szx,
+                         "ReadBlockOptionValues returned wrong values\n");
+
+            message->Free();
+        }
+    }
+
+    VerifyOrQuit((message = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    VerifyOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0x100000, false, OT_COAP_BLOCK_SIZE_16) ==
+                     OT_ERROR_INVALID_ARGS,
+                 "AppendBlockOption accepted a block number beyond 20 bits\n");
+    VerifyOrQuit(message->ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, size) == OT_ERROR_NOT_FOUND,
+                 "ReadBlockOptionValues found a missing option\n");
+    message->Free();
+
+    testFreeInstance(sInstance);
+
+    printf("TestCoapBlockOptionEncoding -- PASS\n");
+}
+
+void TestCoapBlockOptionUpdate(void)
+{
+    static const uint32_t kNums[]    = {0, 40, 5000, 3, 300, 0};
+    static const uint8_t  kPayload[] = {0xde, 0xad, 0xbe, 0xef};
+
+    ot::Coap::Message *message;
+    uint32_t           num;
+    bool               more;
+    otCoapBlockSize    size;
+    uint32_t           size1;
+    uint8_t            payload[sizeof(kPayload)];
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null OpenThread instance\n");
+
+    VerifyOrQuit((message = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    SuccessOrQuit(message->SetToken(ot::Coap::Message::kDefaultTokenLength), "SetToken failed\n");
+    SuccessOrQuit(message->AppendUriPathOptions(kUriPath), "AppendUriPathOptions failed\n");
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0, true, OT_COAP_BLOCK_SIZE_64),
+                  "AppendBlockOption failed\n");
+    SuccessOrQuit(message->AppendUintOption(OT_COAP_OPTION_SIZE1, 60000), "AppendUintOption failed\n");
+    SuccessOrQuit(message->SetPayloadMarker(), "SetPayloadMarker failed\n");
+    SuccessOrQuit(message->Append(kPayload, sizeof(kPayload)), "Append failed\n");
+
+    // Each update changes the value length, which moves the Size1 option and the payload.
+    for (unsigned i = 0; i < sizeof(kNums) / sizeof(kNums[0]); i++)
+    {
+        otCoapBlockSize newSize = static_cast<otCoapBlockSize>(i % (OT_COAP_BLOCK_SIZE_1024 + 1));
+
+        SuccessOrQuit(message->UpdateBlockOption(OT_COAP_OPTION_BLOCK1, kNums[i], (i % 2) != 0, newSize),
+                      "UpdateBlockOption failed\n");
+
+        SuccessOrQuit(message->ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, size),
+                      "ReadBlockOptionValues failed\n");
+        VerifyOrQuit(num == kNums[i] && more == ((i % 2) != 0) && size == newSize,
+                     "UpdateBlockOption wrote wrong values\n");
+
+        SuccessOrQuit(message->ReadUintOption(OT_COAP_OPTION_SIZE1, size1), "ReadUintOption failed\n");
+        VerifyOrQuit(size1 == 60000, "UpdateBlockOption corrupted the following option\n");
+
+        VerifyOrQuit(message->GetHeaderLength() == message->GetOffset() &&
+                         message->GetLength() - message->GetOffset() == sizeof(kPayload),
+                     "UpdateBlockOption did not keep the header length\n");
+        message->Read(message->GetOffset(), sizeof(payload), payload);
+        VerifyOrQuit(memcmp(payload, kPayload, sizeof(payload)) == 0, "UpdateBlockOption corrupted the payload\n");
+    }
+
+    VerifyOrQuit(message->UpdateBlockOption(OT_COAP_OPTION_BLOCK2, 0, false, OT_COAP_BLOCK_SIZE_16) ==
+                     OT_ERROR_NOT_FOUND,
+                 "UpdateBlockOption updated a missing option\n");
+    VerifyOrQuit(message->UpdateBlockOption(OT_COAP_OPTION_BLOCK1, 0x100000, false, OT_COAP_BLOCK_SIZE_16) ==
+                     OT_ERROR_INVALID_ARGS,
+                 "UpdateBlockOption accepted a block number beyond 20 bits\n");
+
+    message->Free();
+
+    testFreeInstance(sInstance);
+
+    printf("TestCoapBlockOptionUpdate -- PASS\n");
+}
+
+static void HandleBlock1Request(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TransferContext *  context = static_cast<TransferContext *>(aContext);
+    ot::Coap::Message &request = *static_cast<ot::Coap::Message *>(aMessage);
+    ot::Coap::Message *response;
+    uint32_t           num;
+    bool               more;
+    otCoapBlockSize    size;
+    uint16_t           length = request.GetLength() - request.GetOffset();
+
+    SuccessOrQuit(request.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK1, num, more, size),
+                  "Request has no Block1 option\n");
+
+    VerifyOrQuit(context->mNumBlocks < kMaxBlocks, "Too many blocks\n");
+    context->mBlockNum[context->mNumBlocks]  = num;
+    context->mBlockSize[context->mNumBlocks] = ot::Coap::Message::BlockSizeFromExponent(size);
+    context->mNumBlocks++;
+
+    VerifyOrQuit((response = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    SuccessOrQuit(response->SetDefaultResponseHeader(request), "SetDefaultResponseHeader failed\n");
+
+    if (ot::Coap::Message::BlockSizeFromExponent(size) > kServerLength)
+    {
+        // Ask for smaller blocks, the client is expected to send the rejected block again.
+        response->SetCode(OT_COAP_CODE_REQUEST_TOO_LARGE);
+        SuccessOrQuit(response->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0, false, OT_COAP_BLOCK_SIZE_32),
+                      "AppendBlockOption failed\n");
+    }
+    else
+    {
+        VerifyOrQuit(num * kServerLength == context->mReceived, "Block received out of order\n");
+        request.Read(request.GetOffset(), length, &context->mBody[context->mReceived]);
+        context->mReceived += length;
+        context->mLastMore = more;
+
+        response->SetCode(more ? OT_COAP_CODE_CONTINUE : OT_COAP_CODE_CHANGED);
+        SuccessOrQuit(response->AppendBlockOption(OT_COAP_OPTION_BLOCK1, num, more, size),
+                      "AppendBlockOption failed\n");
+    }
+
+    SuccessOrQuit(otCoapSendResponse(sInstance, response, aMessageInfo), "otCoapSendResponse failed\n");
+}
+
+void TestCoapBlock1Transfer(void)
+{
+    otMessageInfo      messageInfo;
+    ot::Coap::Message *message;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null OpenThread instance\n");
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true), "otIp6SetEnabled failed\n");
+    SuccessOrQuit(otCoapStart(sInstance, OT_DEFAULT_COAP_PORT), "otCoapStart failed\n");
+
+    ResetContexts();
+    sClient.mLength = 200;
+
+    memset(&sResource, 0, sizeof(sResource));
+    sResource.mUriPath = kUriPath;
+    sResource.mHandler = HandleBlock1Request;
+    sResource.mContext = &sServer;
+    SuccessOrQuit(otCoapAddResource(sInstance, &sResource), "otCoapAddResource failed\n");
+
+    // The first block is larger than the server accepts (4.13), the body then follows in 32-byte blocks.
+    VerifyOrQuit((message = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    SuccessOrQuit(message->SetToken(ot::Coap::Message::kDefaultTokenLength), "SetToken failed\n");
+    SuccessOrQuit(message->AppendUriPathOptions(kUriPath), "AppendUriPathOptions failed\n");
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK1, 0, true, OT_COAP_BLOCK_SIZE_128),
+                  "AppendBlockOption failed\n");
+
+    InitMessageInfo(messageInfo);
+    SuccessOrQuit(otCoapSendRequestBlockWise(sInstance, message, &messageInfo, ResponseHandler, &sClient, TransmitHook,
+                                             NULL),
+                  "otCoapSendRequestBlockWise failed\n");
+
+    ProcessTasklets();
+
+    VerifyOrQuit(sClient.mDone && sClient.mResult == OT_ERROR_NONE && sClient.mCode == OT_COAP_CODE_CHANGED,
+                 "Block1 transfer did not complete\n");
+    VerifyOrQuit(sClient.mMaxPartLength <= 64, "Transmit hook was asked for more than 64 bytes\n");
+
+    VerifyOrQuit(sServer.mNumBlocks == 1 + (200 + kServerLength - 1) / kServerLength, "Unexpected number of blocks\n");
+    VerifyOrQuit(sServer.mBlockNum[0] == 0 && sServer.mBlockSize[0] == 128, "First block is not 128 bytes\n");
+
+    for (uint16_t i = 1; i < sServer.mNumBlocks; i++)
+    {
+        VerifyOrQuit(sServer.mBlockNum[i] == i - 1u && sServer.mBlockSize[i] == kServerLength,
+                     "Block sent with a wrong number or size\n");
+    }
+
+    VerifyOrQuit(sServer.mReceived == 200 && !sServer.mLastMore, "Server did not receive the whole body\n");
+
+    for (uint16_t i = 0; i < sServer.mReceived; i++)
+    {
+        VerifyOrQuit(sServer.mBody[i] == BodyByte(i), "Server received a wrong body\n");
+    }
+
+    otCoapRemoveResource(sInstance, &sResource);
+    SuccessOrQuit(otCoapStop(sInstance), "otCoapStop failed\n");
+
+    testFreeInstance(sInstance);
+
+    printf("TestCoapBlock1Transfer -- PASS\n");
+}
+
+static void HandleBlock2Request(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    ot::Coap::Message &request = *static_cast<ot::Coap::Message *>(aMessage);
+    ot::Coap::Message *response;
+    uint32_t           num;
+    bool               more;
+    otCoapBlockSize    size;
+
+    SuccessOrQuit(request.ReadBlockOptionValues(OT_COAP_OPTION_BLOCK2, num, more, size),
+                  "Request has no Block2 option\n");
+    VerifyOrQuit(num == 0, "Handler called for a follow-up block\n");
+
+    VerifyOrQuit((response = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    SuccessOrQuit(response->SetDefaultResponseHeader(request), "SetDefaultResponseHeader failed\n");
+    response->SetCode(OT_COAP_CODE_CONTENT);
+    SuccessOrQuit(response->AppendBlockOption(OT_COAP_OPTION_BLOCK2, num, true, size), "AppendBlockOption failed\n");
+
+    SuccessOrQuit(otCoapSendResponseBlockWise(sInstance, response, aMessageInfo, aContext, TransmitHook),
+                  "otCoapSendResponseBlockWise failed\n");
+}
+
+void TestCoapBlock2Transfer(void)
+{
+    otMessageInfo      messageInfo;
+    ot::Coap::Message *message;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null OpenThread instance\n");
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true), "otIp6SetEnabled failed\n");
+    SuccessOrQuit(otCoapStart(sInstance, OT_DEFAULT_COAP_PORT), "otCoapStart failed\n");
+
+    ResetContexts();
+    sServer.mLength = kBodyLength;
+
+    memset(&sBlockwiseResource, 0, sizeof(sBlockwiseResource));
+    sBlockwiseResource.mUriPath      = kUriPath;
+    sBlockwiseResource.mHandler      = HandleBlock2Request;
+    sBlockwiseResource.mTransmitHook = TransmitHook;
+    sBlockwiseResource.mContext      = &sServer;
+    SuccessOrQuit(otCoapAddBlockWiseResource(sInstance, &sBlockwiseResource), "otCoapAddBlockWiseResource failed\n");
+
+    // 128-byte blocks are passed to and pulled from the hooks in 64-byte parts.
+    VerifyOrQuit((message = NewMessage()) != NULL, "Coap::Message::New failed\n");
+    message->Init(OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_GET);
+    SuccessOrQuit(message->SetToken(ot::Coap::Message::kDefaultTokenLength), "SetToken failed\n");
+    SuccessOrQuit(message->AppendUriPathOptions(kUriPath), "AppendUriPathOptions failed\n");
+    SuccessOrQuit(message->AppendBlockOption(OT_COAP_OPTION_BLOCK2, 0, false, OT_COAP_BLOCK_SIZE_128),
+                  "AppendBlockOption failed\n");
+
+    InitMessageInfo(messageInfo);
+    SuccessOrQuit(otCoapSendRequestBlockWise(sInstance, message, &messageInfo, ResponseHandler, &sClient, NULL,
+                                             ReceiveHook),
+                  "otCoapSendRequestBlockWise failed\n");
+
+    ProcessTasklets();
+
+    VerifyOrQuit(sClient.mDone && sClient.mResult == OT_ERROR_NONE && sClient.mCode == OT_COAP_CODE_CONTENT,
+                 "Block2 transfer did not complete\n");
+    VerifyOrQuit(sClient.mReceived == kBodyLength && !sClient.mLastMore, "Client did not receive the whole body\n");
+    VerifyOrQuit(sClient.mMaxPartLength == 64, "Receive hook was not called in 64-byte parts\n");
+    VerifyOrQuit(sServer.mMaxPartLength == 64, "Transmit hook was not called in 64-byte parts\n");
+
+    for (uint16_t i = 0; i < sClient.mReceived; i++)
+    {
+        VerifyOrQuit(sClient.mBody[i] == BodyByte(i), "Client received a wrong body\n");
+    }
+
+    otCoapRemoveBlockWiseResource(sInstance, &sBlockwiseResource);
+    SuccessOrQuit(otCoapStop(sInstance), "otCoapStop failed\n");
+
+    testFreeInstance(sInstance);
+
+    printf("TestCoapBlock2Transfer -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && OPENTHREAD_CONFIG_COAP_API_ENABLE
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE && OPENTHREAD_CONFIG_COAP_API_ENABLE
+    TestCoapBlockOptionEncoding();
+    TestCoapBlockOptionUpdate();
+    TestCoapBlock1Transfer();
+    TestCoapBlock2Transfer();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "coap/coap.hpp"
+#include "common/code_utils.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kStart = 100000, // Time (in milliseconds) of the first measurement.
+};
+
+void TestRttEstimatorUpdate(void)
+{
+    Coap::RttEstimator estimator;
+    uint32_t           now = kStart;
+
+    VerifyOrQuit(estimator.GetRto(now) == Coap::RttEstimator::kDefaultRto, "RttEstimator: initial RTO is incorrect");
+
+    // Strong estimate: SRTT = 100, RTTVAR = 50, RTO = (100 + 4 * 50 + 2000) / 2.
+    estimator.Update(100, 0, now);
+    VerifyOrQuit(estimator.GetRto(now) == 1150, "RttEstimator: RTO after first strong update is incorrect");
+
+    // Strong estimate: SRTT = 100, RTTVAR = 37, RTO = (100 + 4 * 37 + 1150) / 2.
+    estimator.Update(100, 0, now);
+    VerifyOrQuit(estimator.GetRto(now) == 699, "RttEstimator: RTO after second strong update is incorrect");
+
+    // Weak estimate: SRTT = 1000, RTTVAR = 500, RTO = (1000 + 500 + 3 * 699) / 4.
+    estimator.Update(1000, 2, now);
+    VerifyOrQuit(estimator.GetRto(now) == 899, "RttEstimator: RTO after weak update is incorrect");
+
+    // Measurements after more than two retransmissions are ignored.
+    estimator.Update(10000, 3, now);
+    VerifyOrQuit(estimator.GetRto(now) == 899, "RttEstimator: RTO changed by ambiguous measurement");
+
+    estimator.Reset();
+    VerifyOrQuit(estimator.GetRto(now) == Coap::RttEstimator::kDefaultRto, "RttEstimator: Reset() failed");
+
+    printf("TestRttEstimatorUpdate() passed\n");
+}
+
+void TestRttEstimatorBounds(void)
+{
+    Coap::RttEstimator estimator;
+
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.Update(0, 0, kStart);
+    }
+
+    VerifyOrQuit(estimator.GetRto(kStart) == Coap::RttEstimator::kMinRto, "RttEstimator: RTO is below the minimum");
+
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.Update(1000000, 0, kStart);
+    }
+
+    VerifyOrQuit(estimator.GetRto(kStart) == Coap::RttEstimator::kMaxRto, "RttEstimator: RTO is above the maximum");
+
+    printf("TestRttEstimatorBounds() passed\n");
+}
+
+void TestRttEstimatorAging(void)
+{
+    Coap::RttEstimator estimator;
+    uint32_t           rto;
+
+    // A small RTO is doubled once it was not updated for 16 RTOs.
+    estimator.Update(100, 0, kStart);
+    estimator.Update(100, 0, kStart);
+    rto = estimator.GetRto(kStart);
+    VerifyOrQuit(rto < 1000, "RttEstimator: RTO is not small");
+    VerifyOrQuit(estimator.GetRto(kStart + 16 * rto - 1) == rto, "RttEstimator: small RTO aged too early");
+    VerifyOrQuit(estimator.GetRto(kStart + 16 * rto) == 2 * rto, "RttEstimator: small RTO did not age");
+
+    // A large RTO moves half-way to the default RTO once it was not updated for 4 RTOs.
+    estimator.Reset();
+    estimator.Update(10000, 0, kStart);
+    rto = estimator.GetRto(kStart);
+    VerifyOrQuit(rto > 3000, "RttEstimator: RTO is not large");
+    VerifyOrQuit(estimator.GetRto(kStart + 4 * rto - 1) == rto, "RttEstimator: large RTO aged too early");
+    VerifyOrQuit(estimator.GetRto(kStart + 4 * rto) == (rto + Coap::RttEstimator::kDefaultRto) / 2,
+                 "RttEstimator: large RTO did not age");
+
+    printf("TestRttEstimatorAging() passed\n");
+}
+
+void TestRttEstimatorBackoff(void)
+{
+    VerifyOrQuit(Coap::RttEstimator::GetBackoffFactor(500) == 6, "RttEstimator: backoff of small RTO is not 3");
+    VerifyOrQuit(Coap::RttEstimator::GetBackoffFactor(2000) == 4, "RttEstimator: default backoff is not 2");
+    VerifyOrQuit(Coap::RttEstimator::GetBackoffFactor(5000) == 3, "RttEstimator: backoff of large RTO is not 1.5");
+
+    printf("TestRttEstimatorBackoff() passed\n");
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestRttEstimatorUpdate();
+    ot::TestRttEstimatorBounds();
+    ot::TestRttEstimatorAging();
+    ot::TestRttEstimatorBackoff();
+    printf("\nAll tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/thread.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "mac/data_poll_sender.hpp"
+#include "mac/mac_frame.hpp"
+#include "thread/mle_router.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+
+enum
+{
+    kParentRloc16 = 0x4400,
+    kOtherRloc16  = 0x5800,
+};
+
+static const otExtAddress kParentExtAddress = {{0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80}};
+static const otExtAddress kOtherExtAddress  = {{0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88}};
+
+static bool ReceiveFrame(DataPollSender &aSender, const Mac::Address &aSrcAddr, bool aFramePending)
+{
+    uint8_t      psdu[Mac::Frame::kMTU];
+    Mac::RxFrame frame;
+    uint16_t     fcf = Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfDstAddrShort |
+                   Mac::Frame::kFcfFrameVersion2006;
+
+    fcf |= aSrcAddr.IsExtended() ? Mac::Frame::kFcfSrcAddrExt : Mac::Frame::kFcfSrcAddrShort;
+
+    frame.mPsdu = psdu;
+    frame.InitMacHeader(fcf, Mac::Frame::kSecNone);
+    frame.SetDstPanId(0xface);
+    frame.SetDstAddr(0x4401);
+    frame.SetSrcAddr(aSrcAddr);
+    frame.SetFramePending(aFramePending);
+
+    return aSender.ContinueFrameBurst(frame);
+}
+
+static void SendPoll(DataPollSender &aSender)
+{
+    uint8_t      psdu[Mac::Frame::kMTU];
+    Mac::TxFrame frame;
+
+    frame.mPsdu = psdu;
+    frame.InitMacHeader(Mac::Frame::kFcfFrameMacCmd | Mac::Frame::kFcfPanidCompression |
+                            Mac::Frame::kFcfDstAddrShort | Mac::Frame::kFcfSrcAddrShort |
+                            Mac::Frame::kFcfFrameVersion2006,
+                        Mac::Frame::kSecNone);
+    frame.SetDstPanId(0xface);
+    frame.SetDstAddr(kParentRloc16);
+    frame.SetSrcAddr(0x4401);
+
+    aSender.HandlePollSent(frame, OT_ERROR_NONE, true);
+}
+
+void TestFrameBurst(void)
+{
+    Instance *       instance;
+    DataPollSender * sender;
+    Router *         parent;
+    otLinkModeConfig linkMode;
+    Mac::Address     parentExt;
+    Mac::Address     parentShort;
+    Mac::Address     otherExt;
+    Mac::Address     otherShort;
+    Mac::ExtAddress  extAddress;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    sender = &instance->Get<DataPollSender>();
+    parent = instance->Get<Mle::MleRouter>().GetParent();
+
+    memset(&linkMode, 0, sizeof(linkMode));
+    SuccessOrQuit(otThreadSetLinkMode(instance, linkMode), "otThreadSetLinkMode() failed");
+
+    extAddress.Set(kParentExtAddress.m8);
+    parent->SetExtAddress(extAddress);
+    parent->SetRloc16(kParentRloc16);
+    parent->SetState(Neighbor::kStateValid);
+
+    parentExt.SetExtended(kParentExtAddress.m8);
+    parentShort.SetShort(kParentRloc16);
+    otherExt.SetExtended(kOtherExtAddress.m8);
+    otherShort.SetShort(kOtherRloc16);
+
+    SuccessOrQuit(sender->StartPolling(), "StartPolling() failed");
+    sender->SetFrameBurstLimit(3);
+
+    printf("TestFrameBurst");
+
+    // Frames from the parent continue the burst until the limit is reached.
+    VerifyOrQuit(ReceiveFrame(*sender, parentExt, true), "burst ended on first frame from parent\n");
+    VerifyOrQuit(ReceiveFrame(*sender, parentShort, true), "burst ended on second frame from parent\n");
+    VerifyOrQuit(!ReceiveFrame(*sender, parentExt, true), "burst continued past the limit\n");
+
+    // A successful data poll starts a new burst.
+    SendPoll(*sender);
+    VerifyOrQuit(ReceiveFrame(*sender, parentShort, true), "burst did not restart after data poll\n");
+
+    // Frames from other sources neither continue nor count towards the burst.
+    VerifyOrQuit(!ReceiveFrame(*sender, otherExt, true), "burst continued on frame from non-parent (ext)\n");
+    VerifyOrQuit(!ReceiveFrame(*sender, otherShort, true), "burst continued on frame from non-parent (short)\n");
+    VerifyOrQuit(ReceiveFrame(*sender, parentExt, true), "frame from non-parent was counted in the burst\n");
+    VerifyOrQuit(!ReceiveFrame(*sender, parentExt, true), "burst continued past the limit\n");
+
+    // A frame without the frame pending bit ends the burst.
+    SendPoll(*sender);
+    VerifyOrQuit(!ReceiveFrame(*sender, parentExt, false), "burst continued without frame pending\n");
+
+    // The limit is capped to the configured maximum.
+    sender->SetFrameBurstLimit(0xff);
+
+    for (uint8_t i = 1; i < OPENTHREAD_CONFIG_MAC_FRAME_BURST_MAX_FRAMES; i++)
+    {
+        VerifyOrQuit(ReceiveFrame(*sender, parentExt, true), "burst ended before the configured maximum\n");
+    }
+
+    VerifyOrQuit(!ReceiveFrame(*sender, parentExt, true), "burst continued past the configured maximum\n");
+
+    printf(" -- PASS\n");
+
+    sender->StopPolling();
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_CONFIG_MAC_FRAME_BURST_ENABLE
+    ot::TestFrameBurst();
+    printf("\nAll tests passed.\n");
+#else
+    printf("Frame burst is not enabled\n");
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,290 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "meshcop/dtls.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_CONFIG_DTLS_ENABLE
+
+namespace ot {
+
+enum
+{
+    kNumClients   = MeshCoP::Dtls::kMaxSessions + 1, ///< One more client than the server has sessions.
+    kMaxDatagrams = 32,
+    kServerPort   = 1000,
+};
+
+static const uint8_t kPsk[] = {'J', '0', '1', 'N', 'M', 'E'};
+
+struct Endpoint
+{
+    MeshCoP::Dtls *mDtls;
+    Ip6::Address   mAddress;
+    uint16_t       mPort;
+    bool           mConnected;
+    uint8_t        mNumConnected;
+    uint8_t        mReceived;
+    Ip6::Address   mReceivedFrom;
+};
+
+struct Datagram
+{
+    Endpoint *       mReceiver;
+    Message *        mMessage;
+    Ip6::MessageInfo mMessageInfo;
+};
+
+static Endpoint sServer;
+static Endpoint sClients[kNumClients];
+static Datagram sDatagrams[kMaxDatagrams];
+static uint8_t  sNumDatagrams;
+
+static Endpoint *FindEndpoint(const Ip6::Address &aAddress, uint16_t aPort)
+{
+    Endpoint *endpoint = NULL;
+
+    if (sServer.mAddress == aAddress && sServer.mPort == aPort)
+    {
+        endpoint = &sServer;
+    }
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        if (sClients[i].mAddress == aAddress && sClients[i].mPort == aPort)
+        {
+            endpoint = &sClients[i];
+        }
+    }
+
+    return endpoint;
+}
+
+static otError HandleTransport(void *aContext, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Endpoint &sender   = *static_cast<Endpoint *>(aContext);
+    Datagram &datagram = sDatagrams[sNumDatagrams];
+
+    VerifyOrQuit(sNumDatagrams < kMaxDatagrams, "too many datagrams in flight");
+
+    datagram.mReceiver = FindEndpoint(aMessageInfo.GetPeerAddr(), aMessageInfo.GetPeerPort());
+    VerifyOrQuit(datagram.mReceiver != NULL, "datagram sent to an unknown peer");
+
+    datagram.mMessage = &aMessage;
+    datagram.mMessageInfo.SetPeerAddr(sender.mAddress);
+    datagram.mMessageInfo.SetPeerPort(sender.mPort);
+    datagram.mMessageInfo.SetSockAddr(datagram.mReceiver->mAddress);
+    datagram.mMessageInfo.SetSockPort(datagram.mReceiver->mPort);
+    sNumDatagrams++;
+
+    return OT_ERROR_NONE;
+}
+
+static void HandleConnected(void *aContext, bool aConnected)
+{
+    Endpoint &endpoint = *static_cast<Endpoint *>(aContext);
+
+    endpoint.mConnected = aConnected;
+
+    if (aConnected)
+    {
+        endpoint.mNumConnected++;
+    }
+}
+
+static void HandleReceive(void *aContext, uint8_t *aBuf, uint16_t aLength)
+{
+    Endpoint &endpoint = *static_cast<Endpoint *>(aContext);
+
+    OT_UNUSED_VARIABLE(aBuf);
+    OT_UNUSED_VARIABLE(aLength);
+
+    endpoint.mReceived++;
+    endpoint.mReceivedFrom = endpoint.mDtls->GetPeerAddress().GetPeerAddr();
+}
+
+static void DeliverDatagrams(void)
+{
+    // Datagrams are delivered in order, the handshakes of all clients are interleaved.
+    while (sNumDatagrams > 0)
+    {
+        Datagram datagram = sDatagrams[0];
+
+        memmove(&sDatagrams[0], &sDatagrams[1], (sNumDatagrams - 1) * sizeof(Datagram));
+        sNumDatagrams--;
+
+        datagram.mReceiver->mDtls->HandleUdpReceive(*datagram.mMessage, datagram.mMessageInfo);
+        datagram.mMessage->Free();
+    }
+}
+
+static void InitEndpoint(Endpoint &aEndpoint, MeshCoP::Dtls &aDtls, uint8_t aId, uint16_t aPort)
+{
+    memset(&aEndpoint, 0, sizeof(aEndpoint));
+    aEndpoint.mDtls                   = &aDtls;
+    aEndpoint.mAddress.mFields.m8[0]  = 0xfd;
+    aEndpoint.mAddress.mFields.m8[15] = aId;
+    aEndpoint.mPort                   = aPort;
+
+    SuccessOrQuit(aDtls.Open(HandleReceive, HandleConnected, &aEndpoint), "Dtls::Open failed");
+    SuccessOrQuit(aDtls.Bind(HandleTransport, &aEndpoint), "Dtls::Bind failed");
+    SuccessOrQuit(aDtls.SetPsk(kPsk, sizeof(kPsk)), "Dtls::SetPsk failed");
+}
+
+static void SendApplicationData(Endpoint &aSender, const Endpoint &aReceiver)
+{
+    static const uint8_t kData[] = {'p', 'i', 'n', 'g'};
+
+    Message *     message = aSender.mDtls->GetInstance().Get<MessagePool>().New(Message::kTypeIp6, 0);
+    Ip6::SockAddr peer;
+
+    VerifyOrQuit(message != NULL, "MessagePool::New failed");
+    SuccessOrQuit(message->Append(kData, sizeof(kData)), "Message::Append failed");
+
+    peer.mAddress = aReceiver.mAddress;
+    peer.mPort    = aReceiver.mPort;
+
+    SuccessOrQuit(aSender.mDtls->Send(*message, message->GetLength(), peer), "Dtls::Send failed");
+}
+
+void TestDtlsConcurrentSessions(void)
+{
+    Instance *    instance = testInitInstance();
+    MeshCoP::Dtls server(*instance, false);
+    MeshCoP::Dtls client0(*instance, false);
+    MeshCoP::Dtls client1(*instance, false);
+#if OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS > 1
+    MeshCoP::Dtls client2(*instance, false);
+#endif
+#if OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS > 2
+    MeshCoP::Dtls client3(*instance, false);
+#endif
+    MeshCoP::Dtls *clients[] = {
+        &client0,
+        &client1,
+#if OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS > 1
+        &client2,
+#endif
+#if OPENTHREAD_CONFIG_DTLS_MAX_SESSIONS > 2
+        &client3,
+#endif
+    };
+
+    VerifyOrQuit(OT_ARRAY_LENGTH(clients) >= kNumClients, "test supports up to 3 DTLS sessions");
+
+    sNumDatagrams = 0;
+    InitEndpoint(sServer, server, 0x80, kServerPort);
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        Ip6::SockAddr sockAddr;
+
+        InitEndpoint(sClients[i], *clients[i], i + 1, kServerPort + i + 1);
+
+        sockAddr.mAddress = sServer.mAddress;
+        sockAddr.mPort    = sServer.mPort;
+        SuccessOrQuit(clients[i]->Connect(sockAddr), "Dtls::Connect failed");
+        VerifyOrQuit(clients[i]->Connect(sockAddr) == OT_ERROR_INVALID_STATE,
+                     "Dtls::Connect accepted a second session");
+    }
+
+    DeliverDatagrams();
+
+    // All sessions of the server are used, the last client is refused.
+    VerifyOrQuit(sServer.mNumConnected == MeshCoP::Dtls::kMaxSessions, "server sessions not all connected");
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        bool expected = (i < MeshCoP::Dtls::kMaxSessions);
+
+        VerifyOrQuit(sClients[i].mConnected == expected, "unexpected client connection state");
+        VerifyOrQuit(server.IsConnectionActive(sClients[i].mAddress, sClients[i].mPort) == expected,
+                     "unexpected server session state");
+    }
+
+    // Application data is exchanged on each session, with the peer of the session.
+    for (uint8_t i = 0; i < MeshCoP::Dtls::kMaxSessions; i++)
+    {
+        SendApplicationData(sClients[i], sServer);
+        DeliverDatagrams();
+        VerifyOrQuit(sServer.mReceived == i + 1, "server did not receive application data");
+        VerifyOrQuit(sServer.mReceivedFrom == sClients[i].mAddress, "server reported the wrong peer");
+
+        SendApplicationData(sServer, sClients[i]);
+        DeliverDatagrams();
+        VerifyOrQuit(sClients[i].mReceived == 1, "client did not receive application data");
+    }
+
+    {
+        Message *message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+
+        VerifyOrQuit(message != NULL, "MessagePool::New failed");
+        VerifyOrQuit(server.Send(*message, 0, Ip6::SockAddr()) == OT_ERROR_INVALID_STATE,
+                     "Dtls::Send accepted an unknown peer");
+        message->Free();
+    }
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        clients[i]->Close();
+    }
+
+    server.Close();
+    DeliverDatagrams();
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestDtlsConcurrentSessions();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
+
+#else // OPENTHREAD_CONFIG_DTLS_ENABLE
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    printf("DTLS disabled\n");
+    return 0;
+}
+#endif
+
+#endif // OPENTHREAD_CONFIG_DTLS_ENABLE
@@ -0,0 +1,236 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "meshcop/joiner_table.hpp"
+#include "meshcop/meshcop.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+
+namespace ot {
+
+using MeshCoP::JoinerTable;
+
+enum
+{
+    kMaxJoiners = JoinerTable::kMaxJoiners,
+};
+
+static JoinerTable sJoinerTable;
+
+static Mac::ExtAddress GetEui64(uint16_t aIndex)
+{
+    Mac::ExtAddress eui64;
+
+    // EUI-64s of a single vendor only differ in their last bytes.
+    eui64.m8[0] = 0x18;
+    eui64.m8[1] = 0xb4;
+    eui64.m8[2] = 0x30;
+    eui64.m8[3] = 0x00;
+    eui64.m8[4] = 0x00;
+    eui64.m8[5] = 0x00;
+    eui64.m8[6] = static_cast<uint8_t>(aIndex >> 8);
+    eui64.m8[7] = static_cast<uint8_t>(aIndex);
+
+    return eui64;
+}
+
+static Mac::ExtAddress GetJoinerId(uint16_t aIndex)
+{
+    Mac::ExtAddress joinerId;
+
+    MeshCoP::ComputeJoinerId(GetEui64(aIndex), joinerId);
+
+    return joinerId;
+}
+
+/**
+ * This function verifies that the table holds the Joiners of the given indices (and no other), and that the Steering
+ * Data matches them.
+ *
+ */
+static void VerifyJoiners(const bool *aAdded, uint16_t aNumIndices, bool aAny)
+{
+    MeshCoP::SteeringDataTlv steeringData;
+    uint16_t                 numAdded = aAny ? 1 : 0;
+
+    steeringData.Init();
+
+    if (aAny)
+    {
+        steeringData.SetLength(1);
+        steeringData.Set();
+    }
+
+    for (uint16_t i = 0; i < aNumIndices; i++)
+    {
+        Mac::ExtAddress      eui64    = GetEui64(i);
+        Mac::ExtAddress      joinerId = GetJoinerId(i);
+        JoinerTable::Joiner *joiner   = sJoinerTable.Find(&eui64);
+
+        if (!aAdded[i])
+        {
+            VerifyOrQuit(joiner == NULL, "Find() returned a removed Joiner\n");
+            VerifyOrQuit(sJoinerTable.FindById(joinerId) == sJoinerTable.Find(NULL),
+                         "FindById() returned a removed Joiner\n");
+            continue;
+        }
+
+        numAdded++;
+
+        VerifyOrQuit(joiner != NULL, "Find() failed\n");
+        VerifyOrQuit(joiner->mValid && !joiner->mAny, "Find() returned an invalid entry\n");
+        VerifyOrQuit(joiner->mEui64 == eui64, "Find() returned a wrong entry\n");
+        VerifyOrQuit(joiner->mJoinerId == joinerId, "entry has a wrong Joiner ID\n");
+        VerifyOrQuit(sJoinerTable.FindById(joinerId) == joiner, "FindById() failed\n");
+        VerifyOrQuit(&sJoinerTable.GetJoiner(sJoinerTable.GetIndex(*joiner)) == joiner, "GetIndex() failed\n");
+
+        if (!aAny)
+        {
+            steeringData.ComputeBloomFilter(joinerId);
+        }
+    }
+
+    VerifyOrQuit(sJoinerTable.GetNumFree() == kMaxJoiners - numAdded, "GetNumFree() failed\n");
+    VerifyOrQuit(sJoinerTable.GetSteeringData().GetSteeringDataLength() == steeringData.GetSteeringDataLength(),
+                 "Steering Data has a wrong length\n");
+    VerifyOrQuit(memcmp(sJoinerTable.GetSteeringData().GetValue(), steeringData.GetValue(),
+                        steeringData.GetSteeringDataLength()) == 0,
+                 "Steering Data does not match the Joiners\n");
+}
+
+void TestJoinerTable(void)
+{
+    bool                 added[kMaxJoiners + 1];
+    Mac::ExtAddress      eui64;
+    JoinerTable::Joiner *joiner;
+    JoinerTable::Joiner *any;
+
+    memset(added, 0, sizeof(added));
+
+    printf("TestJoinerTable");
+
+    // Empty table.
+
+    sJoinerTable.Clear();
+    VerifyOrQuit(sJoinerTable.Find(NULL) == NULL, "Find() returned any Joiner from an empty table\n");
+    VerifyOrQuit(sJoinerTable.GetSteeringData().IsCleared(), "Steering Data of an empty table is not cleared\n");
+    VerifyJoiners(added, kMaxJoiners + 1, false);
+
+    // Fill the table.
+
+    for (uint16_t i = 0; i < kMaxJoiners; i++)
+    {
+        eui64  = GetEui64(i);
+        joiner = sJoinerTable.Add(&eui64, "J01NME", 1000 + i);
+
+        VerifyOrQuit(joiner != NULL, "Add() failed\n");
+        VerifyOrQuit(strcmp(joiner->mPsk, "J01NME") == 0, "Add() did not set the PSKd\n");
+        VerifyOrQuit(joiner->mExpirationTime == 1000u + i, "Add() did not set the expiration time\n");
+
+        added[i] = true;
+        VerifyJoiners(added, kMaxJoiners + 1, false);
+    }
+
+    eui64 = GetEui64(kMaxJoiners);
+    VerifyOrQuit(sJoinerTable.Add(&eui64, "J01NME", 0) == NULL, "Add() succeeded on a full table\n");
+    VerifyOrQuit(sJoinerTable.Add(NULL, "J01NME", 0) == NULL, "Add() succeeded on a full table\n");
+    VerifyJoiners(added, kMaxJoiners + 1, false);
+
+    // Remove the entries in a different order than they were added, and add them back.
+
+    for (uint16_t i = 0; i < kMaxJoiners; i += 2)
+    {
+        eui64 = GetEui64(i);
+        sJoinerTable.Remove(*sJoinerTable.Find(&eui64));
+        added[i] = false;
+        VerifyJoiners(added, kMaxJoiners + 1, false);
+    }
+
+    for (uint16_t i = 1; i < kMaxJoiners; i += 2)
+    {
+        eui64 = GetEui64(i);
+        sJoinerTable.Remove(*sJoinerTable.Find(&eui64));
+        added[i] = false;
+        VerifyJoiners(added, kMaxJoiners + 1, false);
+    }
+
+    for (uint16_t i = kMaxJoiners; i > 0; i--)
+    {
+        eui64 = GetEui64(i);
+        VerifyOrQuit(sJoinerTable.Add(&eui64, "J01NME", 0) != NULL, "Add() failed after Remove()\n");
+        added[i] = true;
+        VerifyJoiners(added, kMaxJoiners + 1, false);
+    }
+
+    // Any Joiner.
+
+    eui64 = GetEui64(kMaxJoiners);
+    sJoinerTable.Remove(*sJoinerTable.Find(&eui64));
+    added[kMaxJoiners] = false;
+
+    any = sJoinerTable.Add(NULL, "ANYJ01NER", 0);
+    VerifyOrQuit(any != NULL && any->mAny, "Add() failed for any Joiner\n");
+    VerifyOrQuit(sJoinerTable.Find(NULL) == any, "Find() failed for any Joiner\n");
+    VerifyOrQuit(sJoinerTable.GetSteeringData().DoesAllowAny(), "Steering Data does not allow any Joiner\n");
+    VerifyJoiners(added, kMaxJoiners + 1, true);
+
+    sJoinerTable.Remove(*any);
+    VerifyOrQuit(sJoinerTable.Find(NULL) == NULL, "Find() returned a removed any Joiner\n");
+    VerifyJoiners(added, kMaxJoiners + 1, false);
+
+    // Clear.
+
+    sJoinerTable.Clear();
+    memset(added, 0, sizeof(added));
+    VerifyJoiners(added, kMaxJoiners + 1, false);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+    ot::TestJoinerTable();
+    printf("\nAll tests passed.\n");
+#else
+    printf("Commissioner is not enabled\n");
+#endif
+    return 0;
+}
+#endif
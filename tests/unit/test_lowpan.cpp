@@ -1743,6 +1743,42 @@ static void TestErrorReservedNhc6(void)
     Test(testVector, false, true);
 }
 
+/***************************************************************************************************
+ * @section Hop limit update in place.
+ **************************************************************************************************/
+
+static void TestDecrementHopLimit(void)
+{
+    // Inline traffic class, flow label and next header, with a context identifier extension.
+    uint8_t inlineFields[] = {0x60, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x40};
+    // Elided traffic class and flow label, compressed next header.
+    uint8_t elidedFields[] = {0x7c, 0x33, 0x02};
+    uint8_t hopLimit64[]   = {0x7e, 0x33};
+    uint8_t hopLimitOne[]  = {0x7c, 0x33, 0x01};
+    uint8_t truncated[]    = {0x7c, 0x33};
+
+    printf("TestDecrementHopLimit");
+
+    SuccessOrQuit(Lowpan::Lowpan::DecrementHopLimit(inlineFields, sizeof(inlineFields)), "DecrementHopLimit failed");
+    VerifyOrQuit(inlineFields[8] == 0x3f, "DecrementHopLimit failed");
+
+    SuccessOrQuit(Lowpan::Lowpan::DecrementHopLimit(elidedFields, sizeof(elidedFields)), "DecrementHopLimit failed");
+    VerifyOrQuit(elidedFields[2] == 0x01, "DecrementHopLimit failed");
+
+    VerifyOrQuit(Lowpan::Lowpan::DecrementHopLimit(hopLimit64, sizeof(hopLimit64)) == OT_ERROR_NOT_CAPABLE,
+                 "DecrementHopLimit updated a compressed hop limit");
+    VerifyOrQuit(hopLimit64[0] == 0x7e, "DecrementHopLimit updated a compressed hop limit");
+
+    VerifyOrQuit(Lowpan::Lowpan::DecrementHopLimit(hopLimitOne, sizeof(hopLimitOne)) == OT_ERROR_NOT_CAPABLE,
+                 "DecrementHopLimit updated an expiring hop limit");
+    VerifyOrQuit(hopLimitOne[2] == 0x01, "DecrementHopLimit updated an expiring hop limit");
+
+    VerifyOrQuit(Lowpan::Lowpan::DecrementHopLimit(truncated, sizeof(truncated)) == OT_ERROR_PARSE,
+                 "DecrementHopLimit accepted a truncated header");
+
+    printf(" -- PASS\n");
+}
+
 /***************************************************************************************************
  * @section Main test.
  **************************************************************************************************/
@@ -1845,6 +1881,7 @@ void TestLowpanIphc(void)
 int main(void)
 {
     TestLowpanIphc();
+    TestDecrementHopLimit();
 
     printf("All tests passed\n");
     return 0;
@@ -63,10 +63,129 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageChildMask(void)
+{
+    enum
+    {
+        kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    };
+
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint16_t         freeBuffers;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+    freeBuffers = messagePool->GetFreeBufferCount();
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    VerifyOrQuit(!message->IsChildPending(), "Message::IsChildPending failed\n");
+
+    // A single child.
+
+    SuccessOrQuit(message->SetChildMask(kMaxChildren - 1), "Message::SetChildMask failed\n");
+    SuccessOrQuit(message->SetChildMask(kMaxChildren - 1), "Message::SetChildMask failed\n");
+    VerifyOrQuit(message->IsChildPending(), "Message::IsChildPending failed\n");
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        VerifyOrQuit(message->GetChildMask(i) == (i == kMaxChildren - 1), "Message::GetChildMask failed\n");
+    }
+
+    message->ClearChildMask(0);
+    VerifyOrQuit(message->IsChildPending(), "Message::ClearChildMask cleared another child\n");
+    message->ClearChildMask(kMaxChildren - 1);
+    VerifyOrQuit(!message->IsChildPending(), "Message::ClearChildMask failed\n");
+
+    // All children, cleared in order.
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        SuccessOrQuit(message->SetChildMask(i), "Message::SetChildMask failed\n");
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        VerifyOrQuit(message->GetChildMask(i), "Message::GetChildMask failed\n");
+    }
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        VerifyOrQuit(message->IsChildPending(), "Message::IsChildPending failed\n");
+        message->ClearChildMask(i);
+        VerifyOrQuit(!message->GetChildMask(i), "Message::ClearChildMask failed\n");
+    }
+
+    VerifyOrQuit(!message->IsChildPending(), "Message::IsChildPending failed\n");
+
+    // Free a message with pending children.
+
+    SuccessOrQuit(message->SetChildMask(0), "Message::SetChildMask failed\n");
+    SuccessOrQuit(message->SetChildMask(kMaxChildren - 1), "Message::SetChildMask failed\n");
+    message->Free();
+
+    VerifyOrQuit(messagePool->GetFreeBufferCount() == freeBuffers, "Message::Free leaked a buffer\n");
+
+    testFreeInstance(instance);
+}
+
+void TestMessageChunks(void)
+{
+    ot::Instance *   instance;
+    ot::MessagePool *messagePool;
+    ot::Message *    message;
+    uint8_t          writeBuffer[600];
+    uint16_t         offsets[] = {0, 1, 100, 200, 300, 599, 600};
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<ot::MessagePool>();
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool->New(ot::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    message->Write(0, sizeof(writeBuffer), writeBuffer);
+
+    // The chunks of a range cover the message data of the range, truncated to the message length.
+    for (unsigned i = 0; i < OT_ARRAY_LENGTH(offsets); i++)
+    {
+        uint16_t           offset = offsets[i];
+        uint16_t           length = 250;
+        uint16_t           expectedLength;
+        uint16_t           covered = 0;
+        ot::Message::Chunk chunk;
+
+        expectedLength = (offset + length > sizeof(writeBuffer)) ? sizeof(writeBuffer) - offset : length;
+
+        for (message->GetFirstChunk(offset, length, chunk); chunk.GetLength() > 0; message->GetNextChunk(length, chunk))
+        {
+            VerifyOrQuit(memcmp(chunk.GetData(), writeBuffer + offset + covered, chunk.GetLength()) == 0,
+                         "Message::GetNextChunk returned wrong data\n");
+            covered += chunk.GetLength();
+        }
+
+        VerifyOrQuit(covered == expectedLength && length == 0, "Message chunks do not cover the range\n");
+    }
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMessage();
+    TestMessageChildMask();
+    TestMessageChunks();
     printf("All tests passed\n");
     return 0;
 }
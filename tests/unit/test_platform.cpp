@@ -47,6 +47,12 @@ testPlatRadioReceive            g_testPlatRadioReceive            = NULL;
 testPlatRadioTransmit           g_testPlatRadioTransmit           = NULL;
 testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer  = NULL;
 
+testPlatSettingsGet    g_testPlatSettingsGet    = NULL;
+testPlatSettingsSet    g_testPlatSettingsSet    = NULL;
+testPlatSettingsAdd    g_testPlatSettingsAdd    = NULL;
+testPlatSettingsDelete g_testPlatSettingsDelete = NULL;
+testPlatSettingsWipe   g_testPlatSettingsWipe   = NULL;
+
 void testPlatResetToDefaults(void)
 {
     g_testPlatAlarmSet     = false;
@@ -65,6 +71,12 @@ void testPlatResetToDefaults(void)
     g_testPlatRadioReceive            = NULL;
     g_testPlatRadioTransmit           = NULL;
     g_testPlatRadioGetTransmitBuffer  = NULL;
+
+    g_testPlatSettingsGet    = NULL;
+    g_testPlatSettingsSet    = NULL;
+    g_testPlatSettingsAdd    = NULL;
+    g_testPlatSettingsDelete = NULL;
+    g_testPlatSettingsWipe   = NULL;
 }
 
 ot::Instance *testInitInstance(void)
@@ -480,9 +492,11 @@ otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
     return OT_PLAT_RESET_REASON_POWER_ON;
 }
 
+#if OPENTHREAD_CONFIG_LOG_OUTPUT != OPENTHREAD_CONFIG_LOG_OUTPUT_BINARY
 void otPlatLog(otLogLevel, otLogRegion, const char *, ...)
 {
 }
+#endif
 
 //
 // Settings
@@ -500,6 +514,11 @@ void otPlatSettingsDeinit(otInstance *aInstance)
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
+    if (g_testPlatSettingsGet)
+    {
+        return g_testPlatSettingsGet(aInstance, aKey, aIndex, aValue, aValueLength);
+    }
+
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKey);
     OT_UNUSED_VARIABLE(aIndex);
@@ -511,6 +530,11 @@ otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
+    if (g_testPlatSettingsSet)
+    {
+        return g_testPlatSettingsSet(aInstance, aKey, aValue, aValueLength);
+    }
+
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKey);
     OT_UNUSED_VARIABLE(aValue);
@@ -521,6 +545,11 @@ otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *a
 
 otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
+    if (g_testPlatSettingsAdd)
+    {
+        return g_testPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+    }
+
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKey);
     OT_UNUSED_VARIABLE(aValue);
@@ -531,6 +560,11 @@ otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *a
 
 otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 {
+    if (g_testPlatSettingsDelete)
+    {
+        return g_testPlatSettingsDelete(aInstance, aKey, aIndex);
+    }
+
     OT_UNUSED_VARIABLE(aInstance);
     OT_UNUSED_VARIABLE(aKey);
     OT_UNUSED_VARIABLE(aIndex);
@@ -540,7 +574,14 @@ otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
 
 void otPlatSettingsWipe(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    if (g_testPlatSettingsWipe)
+    {
+        g_testPlatSettingsWipe(aInstance);
+    }
+    else
+    {
+        OT_UNUSED_VARIABLE(aInstance);
+    }
 }
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
@@ -37,6 +37,7 @@
 #include <openthread/platform/logging.h>
 #include <openthread/platform/misc.h>
 #include <openthread/platform/radio.h>
+#include <openthread/platform/settings.h>
 
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
@@ -83,6 +84,22 @@ extern testPlatRadioReceive            g_testPlatRadioReceive;
 extern testPlatRadioTransmit           g_testPlatRadioTransmit;
 extern testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer;
 
+//
+// Settings Platform
+//
+
+typedef otError (*testPlatSettingsGet)(otInstance *, uint16_t, int, uint8_t *, uint16_t *);
+typedef otError (*testPlatSettingsSet)(otInstance *, uint16_t, const uint8_t *, uint16_t);
+typedef otError (*testPlatSettingsAdd)(otInstance *, uint16_t, const uint8_t *, uint16_t);
+typedef otError (*testPlatSettingsDelete)(otInstance *, uint16_t, int);
+typedef void (*testPlatSettingsWipe)(otInstance *);
+
+extern testPlatSettingsGet    g_testPlatSettingsGet;
+extern testPlatSettingsSet    g_testPlatSettingsSet;
+extern testPlatSettingsAdd    g_testPlatSettingsAdd;
+extern testPlatSettingsDelete g_testPlatSettingsDelete;
+extern testPlatSettingsWipe   g_testPlatSettingsWipe;
+
 ot::Instance *testInitInstance(void);
 void          testFreeInstance(otInstance *aInstance);
 
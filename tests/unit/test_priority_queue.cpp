@@ -52,6 +52,8 @@ void VerifyPriorityQueueContent(ot::PriorityQueue &aPriorityQueue, int aExpected
     // Check the `GetInfo`
     aPriorityQueue.GetInfo(msgCount, bufCount);
     VerifyOrQuit(msgCount == aExpectedLength, "GetInfo() result does not match expected len.\n");
+    VerifyOrQuit(aPriorityQueue.GetNumMessages() == aExpectedLength,
+                 "GetNumMessages() result does not match expected len.\n");
 
     va_start(args, aExpectedLength);
 
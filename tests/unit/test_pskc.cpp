@@ -27,6 +27,7 @@
  */
 #include <openthread/config.h>
 
+#include "common/instance.hpp"
 #include "common/logging.hpp"
 #include "meshcop/commissioner.hpp"
 #include "utils/wrap_string.h"
@@ -82,11 +83,52 @@ void TestMaximumPassphrase(void)
     testFreeInstance(instance);
 }
 
+void TestPskcCache(void)
+{
+    uint8_t       pskc[OT_PSKC_MAX_SIZE];
+    uint8_t       otherPskc[OT_PSKC_MAX_SIZE];
+    const uint8_t expectedPskc[] = {0x44, 0x98, 0x8e, 0x22, 0xcf, 0x65, 0x2e, 0xee,
+                                    0xcc, 0xd1, 0xe4, 0xc0, 0x1d, 0x01, 0x54, 0xf8};
+    const char    passphrase[]   = "123456";
+    otInstance *  instance       = testInitInstance();
+
+    ot::MeshCoP::Commissioner &commissioner =
+        static_cast<ot::Instance *>(instance)->Get<ot::MeshCoP::Commissioner>();
+
+    // The first call generates the PSKc, the following ones return the cached one.
+    for (int i = 0; i < 3; i++)
+    {
+        memset(pskc, 0, sizeof(pskc));
+        SuccessOrQuit(
+            commissioner.GetPSKc(passphrase, "OpenThread", static_cast<const ot::Mac::ExtendedPanId &>(sXPanId), pskc),
+            "TestPskcCache failed to get PSKc");
+        VerifyOrQuit(memcmp(pskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcCache got wrong cached pskc");
+    }
+
+    // A different input must not hit the cache.
+    SuccessOrQuit(ot::MeshCoP::Commissioner::GeneratePSKc(
+                      passphrase, "OpenThreaD", static_cast<const ot::Mac::ExtendedPanId &>(sXPanId), otherPskc),
+                  "TestPskcCache failed to generate PSKc");
+    SuccessOrQuit(
+        commissioner.GetPSKc(passphrase, "OpenThreaD", static_cast<const ot::Mac::ExtendedPanId &>(sXPanId), pskc),
+        "TestPskcCache failed to get PSKc");
+    VerifyOrQuit(memcmp(pskc, otherPskc, sizeof(pskc)) == 0, "TestPskcCache returned a stale pskc");
+
+    // The cache follows the latest input.
+    SuccessOrQuit(
+        commissioner.GetPSKc(passphrase, "OpenThread", static_cast<const ot::Mac::ExtendedPanId &>(sXPanId), pskc),
+        "TestPskcCache failed to get PSKc");
+    VerifyOrQuit(memcmp(pskc, expectedPskc, sizeof(pskc)) == 0, "TestPskcCache returned a stale pskc");
+
+    testFreeInstance(instance);
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMinimumPassphrase();
     TestMaximumPassphrase();
+    TestPskcCache();
     printf("All tests passed\n");
     return 0;
 }
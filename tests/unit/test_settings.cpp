@@ -0,0 +1,372 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/settings.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+// Keys of the settings values used by the test.
+enum
+{
+    kKeyNetworkInfo = 0x0003,
+    kKeyParentInfo  = 0x0004,
+    kKeyChildInfo   = 0x0005,
+};
+
+enum
+{
+    kMaxRecords     = 16,
+    kMaxRecordSize  = 64,
+    kMaxOperations  = 64,
+    kNumReAddCycles = 20,
+};
+
+// A settings value in the fake flash.
+struct Record
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t  mValue[kMaxRecordSize];
+};
+
+// An operation on the fake flash.
+struct Operation
+{
+    char     mType; // 'S' (set), 'A' (add), 'D' (delete) or 'W' (wipe)
+    uint16_t mKey;
+    int      mIndex;
+};
+
+static Record    sRecords[kMaxRecords];
+static uint8_t   sNumRecords;
+static Operation sOperations[kMaxOperations];
+static uint8_t   sNumOperations;
+
+static void LogOperation(char aType, uint16_t aKey, int aIndex)
+{
+    VerifyOrQuit(sNumOperations < kMaxOperations, "too many settings operations");
+    sOperations[sNumOperations].mType  = aType;
+    sOperations[sNumOperations].mKey   = aKey;
+    sOperations[sNumOperations].mIndex = aIndex;
+    sNumOperations++;
+}
+
+static bool OperationMatches(uint8_t aIndex, char aType, uint16_t aKey)
+{
+    return (aIndex < sNumOperations) && (sOperations[aIndex].mType == aType) && (sOperations[aIndex].mKey == aKey);
+}
+
+static Record *FindRecord(uint16_t aKey, int aIndex)
+{
+    Record *record = NULL;
+
+    for (uint8_t i = 0; i < sNumRecords; i++)
+    {
+        if (sRecords[i].mKey == aKey && aIndex-- == 0)
+        {
+            ExitNow(record = &sRecords[i]);
+        }
+    }
+
+exit:
+    return record;
+}
+
+static void RemoveRecord(Record *aRecord)
+{
+    sNumRecords--;
+    memmove(aRecord, aRecord + 1, static_cast<size_t>(&sRecords[sNumRecords] - aRecord) * sizeof(Record));
+}
+
+static uint8_t GetNumRecords(uint16_t aKey)
+{
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < sNumRecords; i++)
+    {
+        count += (sRecords[i].mKey == aKey) ? 1 : 0;
+    }
+
+    return count;
+}
+
+static otError FakeSettingsGet(otInstance *, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    otError error  = OT_ERROR_NONE;
+    Record *record = FindRecord(aKey, aIndex);
+
+    VerifyOrExit(record != NULL, error = OT_ERROR_NOT_FOUND);
+
+    if (aValue != NULL)
+    {
+        memcpy(aValue, record->mValue, (*aValueLength < record->mLength) ? *aValueLength : record->mLength);
+    }
+
+    *aValueLength = record->mLength;
+
+exit:
+    return error;
+}
+
+static otError FakeSettingsAdd(otInstance *, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    Record &record = sRecords[sNumRecords];
+
+    VerifyOrQuit(sNumRecords < kMaxRecords && aValueLength <= kMaxRecordSize, "fake settings are full");
+    LogOperation('A', aKey, 0);
+    sNumRecords++;
+
+    record.mKey    = aKey;
+    record.mLength = aValueLength;
+    memcpy(record.mValue, aValue, aValueLength);
+
+    return OT_ERROR_NONE;
+}
+
+static otError FakeSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    Record *record;
+
+    while ((record = FindRecord(aKey, 0)) != NULL)
+    {
+        RemoveRecord(record);
+    }
+
+    FakeSettingsAdd(aInstance, aKey, aValue, aValueLength);
+    sOperations[sNumOperations - 1].mType = 'S';
+
+    return OT_ERROR_NONE;
+}
+
+static otError FakeSettingsDelete(otInstance *, uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
+    Record *record;
+
+    LogOperation('D', aKey, aIndex);
+
+    while ((record = FindRecord(aKey, (aIndex < 0) ? 0 : aIndex)) != NULL)
+    {
+        RemoveRecord(record);
+        error = OT_ERROR_NONE;
+        VerifyOrExit(aIndex < 0);
+    }
+
+exit:
+    return error;
+}
+
+static void FakeSettingsWipe(otInstance *)
+{
+    LogOperation('W', 0, 0);
+    sNumRecords = 0;
+}
+
+static void ClearOperations(void)
+{
+    sNumOperations = 0;
+}
+
+static uint8_t GetNumChildInfos(Instance &aInstance)
+{
+    uint8_t count = 0;
+
+    for (Settings::ChildInfoIterator iter(aInstance); !iter.IsDone(); iter++)
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void TestSettingsWriteBehind(void)
+{
+    Instance *            instance = testInitInstance();
+    Settings *            settings;
+    Settings::NetworkInfo networkInfo;
+    Settings::ParentInfo  parentInfo;
+    Settings::ChildInfo   childInfo;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance");
+    settings = &instance->Get<Settings>();
+
+    // Start from an empty fake flash, with nothing left pending from the instance initialization.
+    settings->Flush();
+
+    g_testPlatSettingsGet    = FakeSettingsGet;
+    g_testPlatSettingsSet    = FakeSettingsSet;
+    g_testPlatSettingsAdd    = FakeSettingsAdd;
+    g_testPlatSettingsDelete = FakeSettingsDelete;
+    g_testPlatSettingsWipe   = FakeSettingsWipe;
+
+    memset(&networkInfo, 0, sizeof(networkInfo));
+    memset(&parentInfo, 0, sizeof(parentInfo));
+    memset(&childInfo, 0, sizeof(childInfo));
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test coalescing saves of a value");
+
+    networkInfo.mRloc16 = 0x1000;
+    SuccessOrQuit(settings->SaveNetworkInfo(networkInfo), "SaveNetworkInfo() failed");
+    networkInfo.mRloc16 = 0x2000;
+    SuccessOrQuit(settings->SaveNetworkInfo(networkInfo), "SaveNetworkInfo() failed");
+    VerifyOrQuit(sNumOperations == 0, "value was written before flush");
+
+    memset(&networkInfo, 0, sizeof(networkInfo));
+    SuccessOrQuit(settings->ReadNetworkInfo(networkInfo), "ReadNetworkInfo() failed");
+    VerifyOrQuit(networkInfo.mRloc16 == 0x2000, "ReadNetworkInfo() did not return the pending value");
+
+    settings->Flush();
+    VerifyOrQuit(sNumOperations == 1 && OperationMatches(0, 'S', kKeyNetworkInfo), "pending saves were not coalesced");
+    VerifyOrQuit(GetNumRecords(kKeyNetworkInfo) == 1, "NetworkInfo was not saved");
+    VerifyOrQuit(reinterpret_cast<Settings::NetworkInfo *>(FindRecord(kKeyNetworkInfo, 0)->mValue)->mRloc16 == 0x2000,
+                 "the latest NetworkInfo was not saved");
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test flush ordering");
+
+    ClearOperations();
+    parentInfo.mExtAddress.m8[0] = 1;
+    SuccessOrQuit(settings->SaveParentInfo(parentInfo), "SaveParentInfo() failed");
+    networkInfo.mRloc16 = 0x3000;
+    SuccessOrQuit(settings->SaveNetworkInfo(networkInfo), "SaveNetworkInfo() failed");
+    childInfo.mRloc16 = 0x3001;
+    SuccessOrQuit(settings->AddChildInfo(childInfo), "AddChildInfo() failed");
+    parentInfo.mExtAddress.m8[0] = 2;
+    SuccessOrQuit(settings->SaveParentInfo(parentInfo), "SaveParentInfo() failed");
+
+    settings->Flush();
+
+    // A value saved again keeps the position of its first pending write.
+    VerifyOrQuit(sNumOperations == 3, "unexpected number of flushed writes");
+    VerifyOrQuit(OperationMatches(0, 'S', kKeyParentInfo), "ParentInfo was not flushed first");
+    VerifyOrQuit(OperationMatches(1, 'S', kKeyNetworkInfo), "NetworkInfo was not flushed second");
+    VerifyOrQuit(OperationMatches(2, 'A', kKeyChildInfo), "ChildInfo was not flushed last");
+    VerifyOrQuit(FindRecord(kKeyParentInfo, 0)->mValue[0] == 2, "the latest ParentInfo was not saved");
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test add/delete/re-add of a child before flush");
+
+    ClearOperations();
+    childInfo.mRloc16 = 0x3002;
+
+    // Each cycle empties the pending Child Info entries, which must not queue the key again.
+    for (uint8_t i = 0; i < kNumReAddCycles; i++)
+    {
+        SuccessOrQuit(settings->AddChildInfo(childInfo), "AddChildInfo() failed");
+        VerifyOrQuit(GetNumChildInfos(*instance) == 2, "pending ChildInfo is not iterated");
+
+        for (Settings::ChildInfoIterator iter(*instance); !iter.IsDone(); iter++)
+        {
+            if (iter.GetChildInfo().mRloc16 == 0x3002)
+            {
+                SuccessOrQuit(iter.Delete(), "ChildInfoIterator::Delete() failed");
+                break;
+            }
+        }
+
+        VerifyOrQuit(GetNumChildInfos(*instance) == 1, "pending ChildInfo was not deleted");
+    }
+
+    SuccessOrQuit(settings->AddChildInfo(childInfo), "AddChildInfo() failed");
+    VerifyOrQuit(sNumOperations == 0, "ChildInfo was written before flush");
+
+    settings->Flush();
+    VerifyOrQuit(sNumOperations == 1 && OperationMatches(0, 'A', kKeyChildInfo), "ChildInfo was not added once");
+    VerifyOrQuit(GetNumRecords(kKeyChildInfo) == 2, "unexpected number of stored ChildInfo");
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test delete of all children before flush");
+
+    ClearOperations();
+    SuccessOrQuit(settings->DeleteChildInfo(), "DeleteChildInfo() failed");
+    VerifyOrQuit(GetNumChildInfos(*instance) == 0, "stored ChildInfo is iterated after delete");
+
+    childInfo.mRloc16 = 0x3003;
+    SuccessOrQuit(settings->AddChildInfo(childInfo), "AddChildInfo() failed");
+    VerifyOrQuit(GetNumChildInfos(*instance) == 1, "pending ChildInfo is not iterated");
+
+    settings->Flush();
+    VerifyOrQuit(sNumOperations == 2, "unexpected number of flushed writes");
+    VerifyOrQuit(OperationMatches(0, 'D', kKeyChildInfo) && sOperations[0].mIndex == -1, "ChildInfo was not deleted");
+    VerifyOrQuit(OperationMatches(1, 'A', kKeyChildInfo), "ChildInfo was not added after delete");
+    VerifyOrQuit(GetNumRecords(kKeyChildInfo) == 1, "unexpected number of stored ChildInfo");
+
+    printf(" -- PASS\n");
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    printf("Test wipe of pending writes");
+
+    ClearOperations();
+    networkInfo.mRloc16 = 0x4000;
+    SuccessOrQuit(settings->SaveNetworkInfo(networkInfo), "SaveNetworkInfo() failed");
+    SuccessOrQuit(settings->AddChildInfo(childInfo), "AddChildInfo() failed");
+
+    settings->Wipe();
+    settings->Flush();
+
+    VerifyOrQuit(sNumOperations == 1 && OperationMatches(0, 'W', 0), "pending writes were flushed after wipe");
+    VerifyOrQuit(settings->ReadNetworkInfo(networkInfo) == OT_ERROR_NOT_FOUND, "NetworkInfo was read after wipe");
+    VerifyOrQuit(GetNumChildInfos(*instance) == 0, "ChildInfo was read after wipe");
+
+    printf(" -- PASS\n");
+
+    testPlatResetToDefaults();
+    testFreeInstance(instance);
+}
+
+#endif // OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_CONFIG_SETTINGS_WRITE_BEHIND_ENABLE
+    ot::TestSettingsWriteBehind();
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
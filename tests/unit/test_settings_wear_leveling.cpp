@@ -0,0 +1,354 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/platform/settings.h>
+
+#include "utils/flash.h"
+#include "utils/wrap_string.h"
+
+#include "test_util.h"
+
+#if OPENTHREAD_SETTINGS_WEAR_LEVELING
+
+enum
+{
+    kFlashSize       = 0x40000, // Same geometry as the posix flash.
+    kFlashPageSize   = 0x800,
+    kSettingsBase    = 0x39000,
+    kSettingsPageNum = 4,
+    kNumKeys         = 8,
+    kMaxValuesPerKey = 4,
+    kMaxValueLength  = 64,
+    kNumRandomOps    = 20000,
+    kReinitInterval  = 97,
+};
+
+/**
+ * This simulated NOR flash checks that no bit is ever written from 0 to 1 without an erase.
+ *
+ */
+static uint8_t  sFlash[kFlashSize];
+static uint32_t sEraseCount[kFlashSize / kFlashPageSize];
+static uint32_t sReadCount;
+
+extern "C" otError utilsFlashInit(void)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" uint32_t utilsFlashGetSize(void)
+{
+    return kFlashSize;
+}
+
+extern "C" otError utilsFlashErasePage(uint32_t aAddress)
+{
+    VerifyOrQuit(aAddress >= kSettingsBase && aAddress < kSettingsBase + kSettingsPageNum * kFlashPageSize,
+                 "erase outside of settings\n");
+
+    aAddress &= ~static_cast<uint32_t>(kFlashPageSize - 1);
+    memset(&sFlash[aAddress], 0xff, kFlashPageSize);
+    sEraseCount[aAddress / kFlashPageSize]++;
+
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError utilsFlashStatusWait(uint32_t aTimeout)
+{
+    (void)aTimeout;
+    return OT_ERROR_NONE;
+}
+
+extern "C" uint32_t utilsFlashWrite(uint32_t aAddress, uint8_t *aData, uint32_t aSize)
+{
+    VerifyOrQuit(aAddress >= kSettingsBase && aAddress + aSize <= kSettingsBase + kSettingsPageNum * kFlashPageSize,
+                 "write outside of settings\n");
+    VerifyOrQuit(aAddress / kFlashPageSize == (aAddress + aSize - 1) / kFlashPageSize, "write across pages\n");
+
+    for (uint32_t i = 0; i < aSize; i++)
+    {
+        VerifyOrQuit((sFlash[aAddress + i] & aData[i]) == aData[i], "write of a bit from 0 to 1\n");
+        sFlash[aAddress + i] &= aData[i];
+    }
+
+    return aSize;
+}
+
+extern "C" uint32_t utilsFlashRead(uint32_t aAddress, uint8_t *aData, uint32_t aSize)
+{
+    VerifyOrQuit(aAddress + aSize <= kFlashSize, "read outside of flash\n");
+
+    memcpy(aData, &sFlash[aAddress], aSize);
+    sReadCount++;
+
+    return aSize;
+}
+
+/**
+ * This structure is the reference model of the settings.
+ *
+ */
+struct Model
+{
+    uint8_t  mValues[kNumKeys][kMaxValuesPerKey][kMaxValueLength];
+    uint16_t mLengths[kNumKeys][kMaxValuesPerKey];
+    uint8_t  mCounts[kNumKeys];
+};
+
+static Model sModel;
+
+static void FillValue(uint8_t *aValue, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aValue[i] = static_cast<uint8_t>(rand());
+    }
+}
+
+static void VerifyModel(void)
+{
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        uint8_t  value[kMaxValueLength];
+        uint16_t length;
+
+        for (uint8_t index = 0; index < sModel.mCounts[key]; index++)
+        {
+            length     = sizeof(value);
+            sReadCount = 0;
+            SuccessOrQuit(otPlatSettingsGet(NULL, key, index, value, &length), "Get failed\n");
+            VerifyOrQuit(sReadCount == 1, "Get should read flash once\n");
+            VerifyOrQuit(length == sModel.mLengths[key][index], "Get returned wrong length\n");
+            VerifyOrQuit(memcmp(value, sModel.mValues[key][index], length) == 0, "Get returned wrong value\n");
+        }
+
+        length = sizeof(value);
+        VerifyOrQuit(otPlatSettingsGet(NULL, key, sModel.mCounts[key], value, &length) == OT_ERROR_NOT_FOUND,
+                     "Get should fail past the last value\n");
+    }
+}
+
+static void ResetFlash(void)
+{
+    memset(sFlash, 0xff, sizeof(sFlash));
+    memset(sEraseCount, 0, sizeof(sEraseCount));
+    memset(&sModel, 0, sizeof(sModel));
+    otPlatSettingsInit(NULL);
+}
+
+void TestSettingsBasic(void)
+{
+    const uint8_t value1[] = {0x01, 0x02, 0x03};
+    const uint8_t value2[] = {0x04, 0x05, 0x06, 0x07, 0x08};
+    uint8_t       value[8];
+    uint16_t      length;
+
+    ResetFlash();
+
+    length = sizeof(value);
+    VerifyOrQuit(otPlatSettingsGet(NULL, 1, 0, value, &length) == OT_ERROR_NOT_FOUND, "Get of missing key\n");
+    VerifyOrQuit(otPlatSettingsDelete(NULL, 1, -1) == OT_ERROR_NOT_FOUND, "Delete of missing key\n");
+
+    SuccessOrQuit(otPlatSettingsSet(NULL, 1, value1, sizeof(value1)), "Set failed\n");
+    SuccessOrQuit(otPlatSettingsAdd(NULL, 1, value2, sizeof(value2)), "Add failed\n");
+
+    length = 0;
+    SuccessOrQuit(otPlatSettingsGet(NULL, 1, 1, NULL, &length), "Get of length failed\n");
+    VerifyOrQuit(length == sizeof(value2), "Get returned wrong length\n");
+
+    length = 2;
+    SuccessOrQuit(otPlatSettingsGet(NULL, 1, 0, value, &length), "Get failed\n");
+    VerifyOrQuit(length == sizeof(value1) && memcmp(value, value1, 2) == 0, "Get of a truncated value failed\n");
+
+    // Deleting the first value makes the second one first, also after init.
+    SuccessOrQuit(otPlatSettingsDelete(NULL, 1, 0), "Delete failed\n");
+    otPlatSettingsInit(NULL);
+
+    length = sizeof(value);
+    SuccessOrQuit(otPlatSettingsGet(NULL, 1, 0, value, &length), "Get failed\n");
+    VerifyOrQuit(length == sizeof(value2) && memcmp(value, value2, length) == 0, "Get returned wrong value\n");
+    VerifyOrQuit(otPlatSettingsGet(NULL, 1, 1, value, &length) == OT_ERROR_NOT_FOUND, "Get of deleted value\n");
+
+    SuccessOrQuit(otPlatSettingsSet(NULL, 1, value1, sizeof(value1)), "Set failed\n");
+    SuccessOrQuit(otPlatSettingsSet(NULL, 2, value2, sizeof(value2)), "Set failed\n");
+    otPlatSettingsWipe(NULL);
+
+    VerifyOrQuit(otPlatSettingsGet(NULL, 1, 0, value, &length) == OT_ERROR_NOT_FOUND, "Get after wipe\n");
+    VerifyOrQuit(otPlatSettingsGet(NULL, 2, 0, value, &length) == OT_ERROR_NOT_FOUND, "Get after wipe\n");
+}
+
+void TestSettingsRandom(void)
+{
+    uint32_t minErases;
+    uint32_t maxErases;
+
+    ResetFlash();
+    srand(0);
+
+    for (uint32_t op = 0; op < kNumRandomOps; op++)
+    {
+        uint16_t key    = static_cast<uint16_t>(rand() % kNumKeys);
+        uint16_t length = static_cast<uint16_t>(rand() % (kMaxValueLength + 1));
+        uint8_t  count  = sModel.mCounts[key];
+
+        switch (rand() % 4)
+        {
+        case 0:
+        case 1:
+            FillValue(sModel.mValues[key][0], length);
+            sModel.mLengths[key][0] = length;
+            sModel.mCounts[key]     = 1;
+            SuccessOrQuit(otPlatSettingsSet(NULL, key, sModel.mValues[key][0], length), "Set failed\n");
+            break;
+
+        case 2:
+            if (count < kMaxValuesPerKey)
+            {
+                FillValue(sModel.mValues[key][count], length);
+                sModel.mLengths[key][count] = length;
+                sModel.mCounts[key]++;
+                SuccessOrQuit(otPlatSettingsAdd(NULL, key, sModel.mValues[key][count], length), "Add failed\n");
+            }
+
+            break;
+
+        case 3:
+            if (count == 0)
+            {
+                VerifyOrQuit(otPlatSettingsDelete(NULL, key, 0) == OT_ERROR_NOT_FOUND, "Delete of missing value\n");
+            }
+            else if (rand() % 2)
+            {
+                SuccessOrQuit(otPlatSettingsDelete(NULL, key, -1), "Delete failed\n");
+                sModel.mCounts[key] = 0;
+            }
+            else
+            {
+                uint8_t index = static_cast<uint8_t>(rand() % count);
+
+                SuccessOrQuit(otPlatSettingsDelete(NULL, key, index), "Delete failed\n");
+                memmove(sModel.mValues[key][index], sModel.mValues[key][index + 1],
+                        (count - index - 1) * sizeof(sModel.mValues[key][0]));
+                memmove(&sModel.mLengths[key][index], &sModel.mLengths[key][index + 1],
+                        (count - index - 1) * sizeof(sModel.mLengths[key][0]));
+                sModel.mCounts[key]--;
+            }
+
+            break;
+        }
+
+        if (op % kReinitInterval == 0)
+        {
+            otPlatSettingsInit(NULL);
+        }
+
+        VerifyModel();
+    }
+
+    otPlatSettingsInit(NULL);
+    VerifyModel();
+
+    // Pages are erased in turn, so they wear evenly.
+    minErases = maxErases = sEraseCount[kSettingsBase / kFlashPageSize];
+
+    for (uint16_t page = 1; page < kSettingsPageNum; page++)
+    {
+        uint32_t erases = sEraseCount[kSettingsBase / kFlashPageSize + page];
+
+        minErases = (erases < minErases) ? erases : minErases;
+        maxErases = (erases > maxErases) ? erases : maxErases;
+    }
+
+    printf("erases per page: min %u, max %u\n", minErases, maxErases);
+    VerifyOrQuit(minErases > 0 && maxErases - minErases <= 1, "pages are not erased evenly\n");
+}
+
+void TestSettingsFull(void)
+{
+    uint8_t  value[kMaxValueLength];
+    otError  error = OT_ERROR_NONE;
+    uint16_t count = 0;
+
+    ResetFlash();
+    FillValue(value, sizeof(value));
+
+    // Values are added until the settings are full, and are kept when they are.
+    while (error == OT_ERROR_NONE)
+    {
+        error = otPlatSettingsAdd(NULL, 1, value, sizeof(value));
+        count += (error == OT_ERROR_NONE) ? 1 : 0;
+    }
+
+    VerifyOrQuit(error == OT_ERROR_NO_BUFS, "Add should fail with NO_BUFS when full\n");
+    VerifyOrQuit(count > 0, "no value was added\n");
+
+    otPlatSettingsInit(NULL);
+
+    for (uint16_t index = 0; index < count; index++)
+    {
+        uint8_t  read[kMaxValueLength];
+        uint16_t length = sizeof(read);
+
+        SuccessOrQuit(otPlatSettingsGet(NULL, 1, index, read, &length), "Get failed\n");
+        VerifyOrQuit(length == sizeof(value) && memcmp(read, value, length) == 0, "Get returned wrong value\n");
+    }
+
+    SuccessOrQuit(otPlatSettingsDelete(NULL, 1, -1), "Delete failed\n");
+    SuccessOrQuit(otPlatSettingsSet(NULL, 1, value, sizeof(value)), "Set after delete failed\n");
+}
+
+void RunSettingsTests(void)
+{
+    TestSettingsBasic();
+    TestSettingsRandom();
+    TestSettingsFull();
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    RunSettingsTests();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
+
+#else // OPENTHREAD_SETTINGS_WEAR_LEVELING
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    printf("Wear-leveled settings disabled\n");
+    return 0;
+}
+#endif
+
+#endif // OPENTHREAD_SETTINGS_WEAR_LEVELING
@@ -0,0 +1,282 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/tlvs.hpp"
+#include "thread/mle_router.hpp"
+#include "thread/router_table.hpp"
+#include "utils/wrap_string.h"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kPrefixLength = 3,
+    kNumTlvs      = OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES * 2 + 3,
+    kNumTypes     = 8,
+    kMaxInstances = 8,
+};
+
+static void AppendTlvs(Message &aMessage)
+{
+    uint8_t prefix[kPrefixLength] = {0x01, 0x02, 0x03};
+    uint8_t value[300];
+
+    for (uint16_t i = 0; i < sizeof(value); i++)
+    {
+        value[i] = static_cast<uint8_t>(i);
+    }
+
+    SuccessOrQuit(aMessage.Append(prefix, sizeof(prefix)), "Message::Append failed\n");
+
+    // Duplicate types, more TLVs than the index holds, and an extended TLV in the middle.
+    for (uint8_t i = 0; i < kNumTlvs; i++)
+    {
+        uint8_t length = i % 5;
+
+        if (i == OPENTHREAD_CONFIG_TLV_INDEX_MAX_ENTRIES / 2)
+        {
+            ExtendedTlv tlv;
+
+            tlv.SetType(i % kNumTypes);
+            tlv.SetLength(sizeof(value));
+            SuccessOrQuit(aMessage.Append(&tlv, sizeof(tlv)), "Message::Append failed\n");
+            SuccessOrQuit(aMessage.Append(value, sizeof(value)), "Message::Append failed\n");
+        }
+        else
+        {
+            Tlv tlv;
+
+            tlv.SetType(i % kNumTypes);
+            tlv.SetLength(length);
+            SuccessOrQuit(aMessage.Append(&tlv, sizeof(tlv)), "Message::Append failed\n");
+            SuccessOrQuit(aMessage.Append(value, length), "Message::Append failed\n");
+        }
+    }
+
+    {
+        // A malformed TLV ends the search.
+        Tlv tlv;
+
+        tlv.SetType(kNumTypes);
+        tlv.SetLength(10);
+        SuccessOrQuit(aMessage.Append(&tlv, sizeof(tlv)), "Message::Append failed\n");
+    }
+
+    aMessage.SetOffset(kPrefixLength);
+}
+
+static void VerifySameAsScan(Message &aMessage, TlvIndex &aIndex)
+{
+    for (uint16_t type = 0; type <= kNumTypes; type++)
+    {
+        for (uint8_t instance = 0; instance < kMaxInstances; instance++)
+        {
+            uint16_t offset[2]      = {0, 0};
+            uint16_t valueOffset[2] = {0, 0};
+            uint16_t length[2]      = {0, 0};
+            otError  error[2];
+
+            aIndex.Detach();
+            error[0] = TlvIndex::Scan(aMessage, aMessage.GetOffset(), static_cast<uint8_t>(type), instance, offset[0],
+                                      valueOffset[0], length[0]);
+
+            aIndex.Attach(aMessage);
+            VerifyOrQuit(TlvIndex::GetAttached(aMessage) == &aIndex, "TlvIndex::GetAttached failed\n");
+            error[1] = TlvIndex::Scan(aMessage, aMessage.GetOffset(), static_cast<uint8_t>(type), instance, offset[1],
+                                      valueOffset[1], length[1]);
+
+            VerifyOrQuit(error[0] == error[1], "TlvIndex::Find returned a different error than a scan\n");
+            VerifyOrQuit(offset[0] == offset[1] && valueOffset[0] == valueOffset[1] && length[0] == length[1],
+                         "TlvIndex::Find returned a different TLV than a scan\n");
+            VerifyOrQuit(error[0] == OT_ERROR_NONE || type == kNumTypes || instance > 0,
+                         "TlvIndex::Scan did not find a TLV\n");
+            VerifyOrQuit(type != kNumTypes || error[0] == OT_ERROR_NOT_FOUND, "a malformed TLV was found\n");
+        }
+    }
+}
+
+void TestTlvIndex(void)
+{
+    Instance *instance = static_cast<Instance *>(testInitInstance());
+    Message * message;
+    TlvIndex  index;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+    VerifyOrQuit((message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+
+    AppendTlvs(*message);
+    VerifyOrQuit(TlvIndex::GetAttached(*message) == NULL, "TlvIndex::GetAttached failed\n");
+
+    VerifySameAsScan(*message, index);
+
+    // Tlv::Get() copies the same bytes with and without the index.
+    for (uint8_t type = 0; type < kNumTypes; type++)
+    {
+        uint8_t buffer[2][sizeof(ExtendedTlv) + 300];
+
+        memset(buffer, 0, sizeof(buffer));
+
+        index.Detach();
+        SuccessOrQuit(Tlv::Get(*message, type, sizeof(buffer[0]), *reinterpret_cast<Tlv *>(buffer[0])),
+                      "Tlv::Get failed\n");
+        index.Attach(*message);
+        SuccessOrQuit(Tlv::Get(*message, type, sizeof(buffer[1]), *reinterpret_cast<Tlv *>(buffer[1])),
+                      "Tlv::Get failed\n");
+        VerifyOrQuit(memcmp(buffer[0], buffer[1], sizeof(buffer[0])) == 0, "Tlv::Get copied a different TLV\n");
+    }
+
+    // The index follows changes of the message offset.
+    message->MoveOffset(sizeof(Tlv));
+    VerifySameAsScan(*message, index);
+
+    {
+        // The index is invalidated when the message is written to or its length changes.
+        Tlv      tlv;
+        uint16_t offset;
+        uint16_t firstOffset;
+        uint16_t lastOffset;
+
+        index.Attach(*message);
+        SuccessOrQuit(Tlv::GetOffset(*message, kNumTypes - 1, offset), "Tlv::GetOffset failed\n");
+
+        message->Read(message->GetOffset(), sizeof(tlv), &tlv);
+        firstOffset = message->GetOffset();
+        tlv.SetType(kNumTypes + 1);
+        message->Write(firstOffset, sizeof(tlv), &tlv);
+
+        SuccessOrQuit(Tlv::GetOffset(*message, kNumTypes + 1, offset), "Tlv::GetOffset missed a written TLV\n");
+        VerifyOrQuit(offset == firstOffset, "Tlv::GetOffset returned a wrong offset\n");
+        VerifyOrQuit(TlvIndex::GetAttached(*message) == &index, "TlvIndex::GetAttached failed\n");
+
+        SuccessOrQuit(Tlv::GetOffset(*message, kNumTypes - 1, lastOffset), "Tlv::GetOffset failed\n");
+        SuccessOrQuit(message->SetLength(lastOffset), "Message::SetLength failed\n");
+        VerifyOrQuit(Tlv::GetOffset(*message, kNumTypes - 1, offset) == OT_ERROR_NOT_FOUND,
+                     "Tlv::GetOffset found a TLV past the end of the message\n");
+        SuccessOrQuit(Tlv::GetOffset(*message, kNumTypes + 1, offset), "Tlv::GetOffset failed\n");
+        VerifyOrQuit(offset == firstOffset, "Tlv::GetOffset returned a wrong offset\n");
+    }
+
+    {
+        // Indexes of different messages are attached at the same time.
+        Message *other;
+        TlvIndex otherIndex;
+
+        VerifyOrQuit((other = instance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+        AppendTlvs(*other);
+        otherIndex.Attach(*other);
+
+        VerifyOrQuit(TlvIndex::GetAttached(*message) == &index, "TlvIndex::GetAttached failed\n");
+        VerifyOrQuit(TlvIndex::GetAttached(*other) == &otherIndex, "TlvIndex::GetAttached failed\n");
+
+        otherIndex.Detach();
+        other->Free();
+    }
+
+    index.Detach();
+    VerifyOrQuit(TlvIndex::GetAttached(*message) == NULL, "TlvIndex::Detach failed\n");
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+static void VerifyRouteTlv(Mle::MleRouter &aMleRouter)
+{
+    Mle::RouteTlv tlv;
+
+    tlv.Init();
+    aMleRouter.FillRouteTlv(tlv);
+
+    VerifyOrQuit(memcmp(&tlv, &aMleRouter.GetRouteTlv(), tlv.GetSize()) == 0, "MleRouter::GetRouteTlv is outdated\n");
+}
+
+void TestRouteTlvCache(void)
+{
+    Instance *      instance = static_cast<Instance *>(testInitInstance());
+    Mle::MleRouter *mleRouter;
+    RouterTable *   routerTable;
+    Router *        neighbor;
+    Router *        router;
+
+    VerifyOrQuit(instance != NULL, "Null OpenThread instance\n");
+
+    mleRouter   = &instance->Get<Mle::MleRouter>();
+    routerTable = &instance->Get<RouterTable>();
+
+    VerifyRouteTlv(*mleRouter);
+
+    VerifyOrQuit((neighbor = routerTable->Allocate(1)) != NULL, "RouterTable::Allocate failed\n");
+    VerifyRouteTlv(*mleRouter);
+    VerifyOrQuit((router = routerTable->Allocate(2)) != NULL, "RouterTable::Allocate failed\n");
+    VerifyRouteTlv(*mleRouter);
+
+    neighbor->SetState(Neighbor::kStateValid);
+    neighbor->SetLinkQualityOut(3);
+    VerifyRouteTlv(*mleRouter);
+
+    // Link quality in changes with the link margin of received frames.
+    neighbor->GetLinkInfo().AddRss(-100, -60);
+    VerifyRouteTlv(*mleRouter);
+    neighbor->GetLinkInfo().Clear();
+    neighbor->GetLinkInfo().AddRss(-100, -95);
+    VerifyRouteTlv(*mleRouter);
+
+    router->SetNextHop(1);
+    router->SetCost(3);
+    VerifyRouteTlv(*mleRouter);
+    router->SetCost(4);
+    VerifyRouteTlv(*mleRouter);
+
+    // A change of the link to the next hop changes the route cost.
+    neighbor->SetLinkQualityOut(1);
+    VerifyRouteTlv(*mleRouter);
+    neighbor->SetState(Neighbor::kStateInvalid);
+    VerifyRouteTlv(*mleRouter);
+
+    routerTable->Clear();
+    VerifyRouteTlv(*mleRouter);
+
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    ot::TestTlvIndex();
+    ot::TestRouteTlvCache();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
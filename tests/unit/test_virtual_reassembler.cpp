@@ -0,0 +1,386 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+#include <openthread/ip6.h>
+#include <openthread/link.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/child_table.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+#include "thread/virtual_reassembler.hpp"
+
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+
+namespace ot {
+
+enum
+{
+    kNumEntries     = OPENTHREAD_CONFIG_NUM_VIRTUAL_REASSEMBLY_ENTRIES,
+    kDatagramSize   = 200,
+    kFragmentSize   = 64,
+    kMaxFrameLength = 127,
+    kHopLimit       = 10,
+    kHopsLeft       = 5,
+
+    kMeshHeaderLength  = 5, ///< Mesh header with short addresses.
+    kFrag1HeaderLength = 4, ///< First fragment header.
+    kHopLimitOffset    = 3, ///< Offset of the inline hop limit in the LOWPAN_IPHC header built by `BuildFrame()`.
+};
+
+enum TestFrameFlags
+{
+    kInlineHopLimit    = 1 << 0, ///< The hop limit is carried inline (compressed as 64 otherwise).
+    kElidedSource      = 1 << 1, ///< The source address is derived from the mesh source.
+    kRxOnWhenIdleChild = 1 << 2, ///< The frame is sent to the rx-on-when-idle child (sleepy child otherwise).
+};
+
+static ot::Instance *sInstance;
+static uint16_t      sLeaderRloc16;
+static uint16_t      sMeshSource;
+
+static void InitNetwork(void)
+{
+    ChildTable &table = sInstance->Get<ChildTable>();
+    Child *     child;
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true), "otIp6SetEnabled() failed");
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true), "otThreadSetEnabled() failed");
+    SuccessOrQuit(otThreadBecomeLeader(sInstance), "otThreadBecomeLeader() failed");
+
+    sLeaderRloc16 = otThreadGetRloc16(sInstance);
+    sMeshSource   = sLeaderRloc16 ^ 0x0400;
+
+    // An rx-on-when-idle minimal child and a sleepy child.
+
+    child = table.GetNewChild();
+    VerifyOrQuit(child != NULL, "GetNewChild() failed");
+    child->SetState(Child::kStateValid);
+    child->SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle));
+    table.SetChildRloc16(*child, sLeaderRloc16 | 1);
+
+    child = table.GetNewChild();
+    VerifyOrQuit(child != NULL, "GetNewChild() failed");
+    child->SetState(Child::kStateValid);
+    child->SetDeviceMode(Mle::DeviceMode(0));
+    table.SetChildRloc16(*child, sLeaderRloc16 | 2);
+}
+
+static uint16_t BuildFrame(uint8_t *aFrame, uint8_t aFlags, bool aFragment, uint16_t aTag, uint16_t aOffset)
+{
+    Lowpan::MeshHeader     meshHeader;
+    Lowpan::FragmentHeader fragmentHeader;
+    uint16_t               length = 0;
+    uint16_t               payloadLength;
+
+    meshHeader.Init();
+    meshHeader.SetHopsLeft(kHopsLeft);
+    meshHeader.SetSource(sMeshSource);
+    meshHeader.SetDestination(sLeaderRloc16 | ((aFlags & kRxOnWhenIdleChild) ? 1 : 2));
+    meshHeader.AppendTo(aFrame);
+    length += meshHeader.GetHeaderLength();
+
+    if (aFragment)
+    {
+        fragmentHeader.Init();
+        fragmentHeader.SetDatagramSize(kDatagramSize);
+        fragmentHeader.SetDatagramTag(aTag);
+        fragmentHeader.SetDatagramOffset(aOffset);
+        memcpy(aFrame + length, &fragmentHeader, fragmentHeader.GetHeaderLength());
+        length += fragmentHeader.GetHeaderLength();
+    }
+
+    if (aOffset == 0)
+    {
+        // LOWPAN_IPHC with elided traffic class and flow label, inline next header (ICMPv6), inline or compressed
+        // (64) hop limit, link-local source and destination derived from the mesh destination.
+        aFrame[length++] = (aFlags & kInlineHopLimit) ? 0x78 : 0x7a;
+        aFrame[length++] = (aFlags & kElidedSource) ? 0x33 : 0x23;
+        aFrame[length++] = Ip6::kProtoIcmp6;
+
+        if (aFlags & kInlineHopLimit)
+        {
+            aFrame[length++] = kHopLimit;
+        }
+
+        if (!(aFlags & kElidedSource))
+        {
+            aFrame[length++] = static_cast<uint8_t>(sMeshSource >> 8);
+            aFrame[length++] = static_cast<uint8_t>(sMeshSource);
+        }
+    }
+
+    payloadLength = aFragment ? kFragmentSize : 16;
+
+    if (aFragment && aOffset + payloadLength > kDatagramSize)
+    {
+        payloadLength = kDatagramSize - aOffset;
+    }
+
+    memset(aFrame + length, 0xa5, payloadLength);
+
+    return length + payloadLength;
+}
+
+static otError ForwardFrame(uint8_t *aFrame, uint16_t aFrameLength)
+{
+    otThreadLinkInfo linkInfo;
+    Mac::Address     macSource;
+
+    memset(&linkInfo, 0, sizeof(linkInfo));
+    linkInfo.mPanId        = otLinkGetPanId(sInstance);
+    linkInfo.mLinkSecurity = true;
+    macSource.SetShort(sMeshSource);
+
+    return sInstance->Get<VirtualReassembler>().ForwardFrame(aFrame, aFrameLength, macSource, linkInfo);
+}
+
+static void VerifyForwardedFrame(uint16_t aNumMessages, const uint8_t *aFrame, uint16_t aFrameLength)
+{
+    const PriorityQueue &sendQueue = sInstance->Get<MeshForwarder>().GetSendQueue();
+    uint8_t              frame[kMaxFrameLength];
+    Message *            message;
+
+    VerifyOrQuit(sendQueue.GetNumMessages() == aNumMessages + 1, "frame was not queued");
+
+    message = sendQueue.GetTail();
+    VerifyOrQuit(message->GetType() == Message::kType6lowpan, "queued message is not a 6LoWPAN frame");
+    VerifyOrQuit(message->GetLength() == aFrameLength, "queued frame length is incorrect");
+    message->Read(0, aFrameLength, frame);
+    VerifyOrQuit(memcmp(frame, aFrame, aFrameLength) == 0, "queued frame content is incorrect");
+}
+
+static uint16_t GetTag(const uint8_t *aFrame)
+{
+    Lowpan::FragmentHeader fragmentHeader;
+
+    SuccessOrQuit(fragmentHeader.Init(aFrame + kMeshHeaderLength, kMaxFrameLength - kMeshHeaderLength),
+                  "FragmentHeader::Init() failed");
+
+    return fragmentHeader.GetDatagramTag();
+}
+
+static void TestVirtualReassemblyForwarding(void)
+{
+    const PriorityQueue &sendQueue = sInstance->Get<MeshForwarder>().GetSendQueue();
+    uint8_t              frame[kMaxFrameLength];
+    uint8_t              original[kMaxFrameLength];
+    uint16_t             length;
+    uint16_t             numMessages;
+    uint16_t             forwardTag;
+    uint16_t             offset;
+
+    printf("TestVirtualReassemblyForwarding");
+
+    sInstance->Get<VirtualReassembler>().Clear();
+
+    // An unfragmented frame is forwarded with the hop limit decremented.
+
+    numMessages = sendQueue.GetNumMessages();
+    length      = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, false, 0, 0);
+    memcpy(original, frame, length);
+    SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for an unfragmented frame");
+    original[kMeshHeaderLength + kHopLimitOffset]--;
+    VerifyForwardedFrame(numMessages, original, length);
+
+    // The first fragment is forwarded with the hop limit decremented and a new datagram tag.
+
+    numMessages = sendQueue.GetNumMessages();
+    length      = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, true, 0x1234, 0);
+    memcpy(original, frame, length);
+    SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for the first fragment");
+
+    forwardTag = GetTag(frame);
+    VerifyOrQuit(forwardTag != 0x1234 && forwardTag != 0, "datagram tag was not rewritten");
+    reinterpret_cast<Lowpan::FragmentHeader *>(original + kMeshHeaderLength)->SetDatagramTag(forwardTag);
+    original[kMeshHeaderLength + kFrag1HeaderLength + kHopLimitOffset]--;
+    VerifyForwardedFrame(numMessages, original, length);
+
+    // The subsequent fragments follow the first one and get the same new datagram tag.
+
+    for (offset = kFragmentSize; offset < kDatagramSize; offset += kFragmentSize)
+    {
+        numMessages = sendQueue.GetNumMessages();
+        length      = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x1234, offset);
+        memcpy(original, frame, length);
+        SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for a subsequent fragment");
+
+        reinterpret_cast<Lowpan::FragmentHeader *>(original + kMeshHeaderLength)->SetDatagramTag(forwardTag);
+        VerifyForwardedFrame(numMessages, original, length);
+    }
+
+    // The last fragment released the entry.
+
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x1234, kFragmentSize);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "fragment after the last one was forwarded");
+
+    // A subsequent fragment from another mesh source does not match the entry of a datagram.
+
+    length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, true, 0x1235, 0);
+    SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for the first fragment");
+    sMeshSource ^= 0x0800;
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x1235, kFragmentSize);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "fragment of another source was forwarded");
+    sMeshSource ^= 0x0800;
+
+    printf(" -- PASS\n");
+}
+
+static void TestVirtualReassemblyFallback(void)
+{
+    const PriorityQueue &sendQueue = sInstance->Get<MeshForwarder>().GetSendQueue();
+    uint8_t              frame[kMaxFrameLength];
+    uint8_t              original[kMaxFrameLength];
+    uint16_t             length;
+    uint16_t             numMessages;
+
+    printf("TestVirtualReassemblyFallback");
+
+    sInstance->Get<VirtualReassembler>().Clear();
+    numMessages = sendQueue.GetNumMessages();
+
+    // Each frame falls back to full reassembly unmodified, and so do the subsequent fragments of its datagram.
+
+    length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild | kElidedSource, true, 0x2000, 0);
+    memcpy(original, frame, length);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "frame with elided source was forwarded");
+    VerifyOrQuit(memcmp(frame, original, length) == 0, "frame with elided source was modified");
+
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x2000, kFragmentSize);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "fragment after a fallback was forwarded");
+
+    length = BuildFrame(frame, kInlineHopLimit, true, 0x2001, 0);
+    memcpy(original, frame, length);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "frame to a sleepy child was forwarded");
+    VerifyOrQuit(memcmp(frame, original, length) == 0, "frame to a sleepy child was modified");
+
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x2002, 0);
+    memcpy(original, frame, length);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "frame with compressed hop limit was forwarded");
+    VerifyOrQuit(memcmp(frame, original, length) == 0, "frame with compressed hop limit was modified");
+
+    length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, false, 0, 0);
+    frame[kMeshHeaderLength + kHopLimitOffset] = 1;
+    memcpy(original, frame, length);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "frame with hop limit 1 was forwarded");
+    VerifyOrQuit(memcmp(frame, original, length) == 0, "frame with hop limit 1 was modified");
+
+    VerifyOrQuit(sendQueue.GetNumMessages() == numMessages, "a frame was queued");
+
+    // When all the entries are in use, the first fragment of another datagram falls back to full reassembly.
+
+    for (uint16_t i = 0; i < kNumEntries; i++)
+    {
+        length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, true, 0x3000 + i, 0);
+        SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for the first fragment");
+    }
+
+    numMessages = sendQueue.GetNumMessages();
+
+    length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, true, 0x3000 + kNumEntries, 0);
+    memcpy(original, frame, length);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "frame was forwarded with a full table");
+    VerifyOrQuit(memcmp(frame, original, length) == 0, "frame was modified with a full table");
+    VerifyOrQuit(sendQueue.GetNumMessages() == numMessages, "a frame was queued with a full table");
+
+    printf(" -- PASS\n");
+}
+
+static void TestVirtualReassemblyExpiry(void)
+{
+    VirtualReassembler &reassembler = sInstance->Get<VirtualReassembler>();
+    uint8_t             frame[kMaxFrameLength];
+    uint16_t            length;
+
+    printf("TestVirtualReassemblyExpiry");
+
+    reassembler.Clear();
+
+    VerifyOrQuit(!reassembler.UpdateLifetime(), "UpdateLifetime() reported an entry in use");
+
+    length = BuildFrame(frame, kInlineHopLimit | kRxOnWhenIdleChild, true, 0x4000, 0);
+    SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for the first fragment");
+
+    // Each fragment restarts the lifetime of the entry.
+
+    for (uint16_t i = 0; i < kReassemblyTimeout - 1; i++)
+    {
+        VerifyOrQuit(reassembler.UpdateLifetime(), "entry expired early");
+    }
+
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x4000, kFragmentSize);
+    SuccessOrQuit(ForwardFrame(frame, length), "ForwardFrame() failed for a subsequent fragment");
+
+    for (uint16_t i = 0; i < kReassemblyTimeout - 1; i++)
+    {
+        VerifyOrQuit(reassembler.UpdateLifetime(), "entry expired early");
+    }
+
+    VerifyOrQuit(!reassembler.UpdateLifetime(), "entry did not expire");
+
+    length = BuildFrame(frame, kRxOnWhenIdleChild, true, 0x4000, 2 * kFragmentSize);
+    VerifyOrQuit(ForwardFrame(frame, length) == OT_ERROR_NOT_CAPABLE, "fragment of an expired datagram was forwarded");
+
+    printf(" -- PASS\n");
+}
+
+void TestVirtualReassembler(void)
+{
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != NULL, "Null instance");
+
+    InitNetwork();
+
+    TestVirtualReassemblyForwarding();
+    TestVirtualReassemblyFallback();
+    TestVirtualReassemblyExpiry();
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+#if OPENTHREAD_CONFIG_6LOWPAN_VIRTUAL_REASSEMBLY_ENABLE
+    ot::TestVirtualReassembler();
+#endif
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,287 @@
+#!/usr/bin/env python
+#
+#  Copyright (c) 2019, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Decodes OpenThread binary log records using the firmware image which wrote them.
+
+See README.md for the record format.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+ANCHOR = b'OpenThread-BinaryLog-Anchor\0'
+HEADER_LENGTH = 11
+
+TYPE_LOG = 0
+TYPE_DUMP = 1
+TYPE_DROP = 2
+
+TRUNCATED_FLAG = 0x08
+LEVEL_MASK = 0x07
+
+DUMP_WIDTH = 72
+
+LEVELS = ['NONE', 'CRIT', 'WARN', 'NOTE', 'INFO', 'DEBG']
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|[0-9]*)(?:\.(\*|[0-9]*))?(hh|h|ll|l|j|z|t|L)?([a-zA-Z%])')
+
+
+class Image(object):
+    """A firmware image (ELF file or raw flash image) holding the format strings."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self._data = f.read()
+
+        self._anchor = self._data.find(ANCHOR)
+
+        if self._anchor < 0:
+            raise ValueError('%s was not built with binary log output' % path)
+
+        if self._data.find(ANCHOR, self._anchor + 1) >= 0:
+            raise ValueError('%s contains more than one binary log anchor' % path)
+
+    def get_string(self, offset):
+        start = self._anchor + offset
+
+        if start < 0 or start >= len(self._data):
+            raise ValueError('string offset %d is outside of the image' % offset)
+
+        end = self._data.find(b'\0', start)
+
+        return self._data[start:end].decode('utf-8', 'replace')
+
+
+class ArgReader(object):
+
+    def __init__(self, data):
+        self._data = data
+        self._offset = 0
+
+    def read(self, fmt):
+        size = struct.calcsize(fmt)
+
+        if self._offset + size > len(self._data):
+            raise IndexError()
+
+        value = struct.unpack_from(fmt, self._data, self._offset)[0]
+        self._offset += size
+
+        return value
+
+    def read_string(self):
+        length = self.read('<B')
+
+        if self._offset + length > len(self._data):
+            raise IndexError()
+
+        value = self._data[self._offset:self._offset + length]
+        self._offset += length
+
+        return value.decode('utf-8', 'replace')
+
+
+def format_conversion(match, args):
+    flags, width, precision, length, specifier = match.groups()
+
+    if specifier == '%':
+        return '%'
+
+    if width == '*':
+        width = str(args.read('<i'))
+
+    if precision == '*':
+        value = args.read('<i')
+        precision = str(value) if value >= 0 else None
+
+    spec = '%' + flags + width + ('.' + precision if precision is not None else '')
+
+    if specifier in 'di':
+        if length in ('l', 'll', 'j', 'z', 't'):
+            value = args.read('<q')
+        else:
+            value = args.read('<i')
+            if length == 'h':
+                value = struct.unpack('<h', struct.pack('<H', value & 0xffff))[0]
+            elif length == 'hh':
+                value = struct.unpack('<b', struct.pack('<B', value & 0xff))[0]
+        return (spec + 'd') % value
+
+    if specifier in 'ouxXc':
+        if length in ('l', 'll', 'j', 'z', 't'):
+            value = args.read('<Q')
+        else:
+            value = args.read('<I')
+            if length == 'h':
+                value &= 0xffff
+            elif length == 'hh':
+                value &= 0xff
+        if specifier == 'c':
+            return (spec + 'c') % chr(value & 0xff)
+        return (spec + ('d' if specifier == 'u' else specifier)) % value
+
+    if specifier in 'eEfFgGaA':
+        value = args.read('<d')
+        if specifier in 'aA':
+            return value.hex()
+        return (spec + specifier) % value
+
+    if specifier == 'p':
+        return '0x%x' % args.read('<Q')
+
+    if specifier == 's':
+        return (spec + 's') % args.read_string()
+
+    return ''
+
+
+def decode_log(fmt, data, truncated):
+    args = ArgReader(data)
+    output = []
+    position = 0
+
+    for match in CONVERSION.finditer(fmt):
+        output.append(fmt[position:match.start()])
+        position = match.end()
+
+        try:
+            output.append(format_conversion(match, args))
+        except IndexError:
+            if not truncated:
+                raise ValueError('record is missing arguments of "%s"' % fmt)
+            output.append('...')
+            return ''.join(output)
+
+    output.append(fmt[position:])
+
+    return ''.join(output)
+
+
+def decode_dump(dump_id, data):
+    if len(data) < 4:
+        raise ValueError('dump record is too short')
+
+    length, offset = struct.unpack_from('<HH', data)
+    data = data[4:]
+    lines = []
+
+    if offset == 0:
+        padding = (DUMP_WIDTH - len(dump_id)) // 2 if len(dump_id) < DUMP_WIDTH - 10 else 5
+        lines.append('=' * (padding - 5) + '[%s len=%03u]' % (dump_id, length) + '=' * (padding - 4))
+    else:
+        lines.append('[%s offset=%u]' % (dump_id, offset))
+
+    for i in range(0, len(data), 16):
+        chunk = bytearray(data[i:i + 16])
+        line = '|'
+
+        for j in range(16):
+            line += ' %02X' % chunk[j] if j < len(chunk) else ' ..'
+            if (j + 1) % 8 == 0:
+                line += ' |'
+
+        line += ' ' + ''.join(chr(c & 0x7f) if 0x20 <= (c & 0x7f) < 0x7f else '.' for c in chunk)
+        line += '.' * (16 - len(chunk))
+        lines.append(line)
+
+    if offset + len(data) == length:
+        lines.append('-' * DUMP_WIDTH)
+
+    return lines
+
+
+def decode_record(image, record):
+    """Returns the timestamp, the level name, the region and the decoded lines of a record."""
+
+    if len(record) < HEADER_LENGTH or record[0] != len(record):
+        raise ValueError('malformed record')
+
+    flags, region, timestamp, offset = struct.unpack_from('<BBIi', record, 1)
+    record_type = flags >> 4
+    level = flags & LEVEL_MASK
+    data = bytes(record[HEADER_LENGTH:])
+
+    if record_type == TYPE_LOG:
+        lines = [decode_log(image.get_string(offset), data, (flags & TRUNCATED_FLAG) != 0)]
+    elif record_type == TYPE_DUMP:
+        lines = decode_dump(image.get_string(offset), data)
+    elif record_type == TYPE_DROP:
+        lines = ['Dropped %u log records' % struct.unpack('<I', data)[0]]
+    else:
+        raise ValueError('unknown record type %d' % record_type)
+
+    level_name = LEVELS[level] if level < len(LEVELS) else str(level)
+
+    return timestamp, level_name, region, lines
+
+
+def split_records(data):
+    data = bytearray(data)
+    offset = 0
+
+    while offset < len(data):
+        length = data[offset]
+
+        if length < HEADER_LENGTH or offset + length > len(data):
+            raise ValueError('truncated record at offset %d' % offset)
+
+        yield data[offset:offset + length]
+        offset += length
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode OpenThread binary log records.')
+    parser.add_argument('image', help='firmware image (ELF file or raw flash image) which wrote the records')
+    parser.add_argument('records', nargs='?', help='file holding the records (default: standard input)')
+    parser.add_argument('--hex', action='store_true', help='records are hex strings, one or more records per line')
+    args = parser.parse_args()
+
+    image = Image(args.image)
+    stream = open(args.records, 'rb') if args.records else getattr(sys.stdin, 'buffer', sys.stdin)
+
+    if args.hex:
+        chunks = [bytearray.fromhex(line.decode('ascii').strip()) for line in stream if line.strip()]
+    else:
+        chunks = [stream.read()]
+
+    for chunk in chunks:
+        for record in split_records(chunk):
+            try:
+                timestamp, level, region, lines = decode_record(image, record)
+            except ValueError as error:
+                print('<%s>' % error)
+                continue
+
+            for line in lines:
+                print('%10u.%03u [%s] %2u: %s' % (timestamp // 1000, timestamp % 1000, level, region, line))
+
+
+if __name__ == '__main__':
+    main()